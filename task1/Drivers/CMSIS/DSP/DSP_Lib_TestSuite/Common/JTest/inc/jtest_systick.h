@@ -40,7 +40,8 @@
   #include "ARMv8MML_DP.h"
 #elif defined ARMv8MML_DSP_DP
   #include "ARMv8MML_DSP_DP.h"
-
+#elif defined ARM_MATH_HOST
+  /* No SysTick on a host build, cycle counts are reported as 0. */
 #else
   #warning "no appropriate header file found!"
 #endif
@@ -57,6 +58,23 @@
  */
 #define JTEST_SYSTICK_INITIAL_VALUE 0xFFFFFF
 
+#if defined ARM_MATH_HOST
+
+#define JTEST_SYSTICK_RESET(systick_ptr)        \
+    do                                          \
+    {                                           \
+    } while (0)
+
+#define JTEST_SYSTICK_START(systick_ptr)        \
+    do                                          \
+    {                                           \
+    } while (0)
+
+#define JTEST_SYSTICK_VALUE(systick_ptr)        \
+    (JTEST_SYSTICK_INITIAL_VALUE)
+
+#else
+
 /**
  *  Reset the SysTick, decrementing timer to it's maximum value and disable it.
  *
@@ -89,5 +107,7 @@
  */
 #define JTEST_SYSTICK_VALUE(systick_ptr)        \
     ((systick_ptr)->VAL)
-           
+
+#endif /* defined ARM_MATH_HOST */
+
 #endif /* _JTEST_SYSTICK_H_ */
@@ -1,6 +1,10 @@
 
 #include "jtest_fw.h"
 
+#if defined ARM_MATH_HOST
+#include <stdlib.h>             /* exit() */
+#endif
+
 void test_start    (void) {
 //  ;
   JTEST_FW.test_start++;
@@ -24,6 +28,10 @@ void group_end     (void) {
 void dump_str      (void) {
 //  ;
   JTEST_FW.dump_str++;
+#if defined ARM_MATH_HOST
+  /* Print the segment the debugger would have read. */
+  printf("%.*s", JTEST_STR_MAX_OUTPUT_SIZE, JTEST_FW.str_buffer);
+#endif
 }
 
 void dump_data     (void) {
@@ -34,4 +42,9 @@ void dump_data     (void) {
 void exit_fw       (void) {
 //  ;
   JTEST_FW.exit_fw++;
+#if defined ARM_MATH_HOST
+  printf("\nPassed: %u, Failed: %u\n",
+         (unsigned) JTEST_FW.passed, (unsigned) JTEST_FW.failed);
+  exit((JTEST_FW.failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+#endif
 }
@@ -14,6 +14,9 @@
 #define STATISTICS_MAX_INPUT_ELEMENTS 32
 #define STATISTICS_BIGGEST_INPUT_TYPE float32_t
 
+/* Length of the pseudo-random inputs of the median and percentile tests. */
+#define STATISTICS_RANDOM_MAX_LEN 4096
+
 /*--------------------------------------------------------------------------------*/
 /* Declare Variables */
 /*--------------------------------------------------------------------------------*/
@@ -30,6 +33,10 @@ statistics_output_f32_ref[STATISTICS_MAX_INPUT_ELEMENTS];
 extern STATISTICS_BIGGEST_INPUT_TYPE
 statistics_output_f32_fut[STATISTICS_MAX_INPUT_ELEMENTS];
 
+/* Pseudo-random Q31 input, and its conversion to the type under test */
+extern q31_t statistics_random_input[STATISTICS_RANDOM_MAX_LEN];
+extern q31_t statistics_random_src[STATISTICS_RANDOM_MAX_LEN];
+
 
 /* Block Sizes */
 ARR_DESC_DECLARE(statistics_block_sizes);
@@ -16,6 +16,17 @@ SIN_COS_TEST_TEMPLATE_ELT1(f32, float32_t, cos);
 SIN_COS_TEST_TEMPLATE_ELT1(q31, q31_t, cos);
 SIN_COS_TEST_TEMPLATE_ELT1(q15, q15_t, cos);
 
+VECTOR_TEST_TEMPLATE_ELT1(vexp, FAST_MATH_VEXP_INPUT);
+VECTOR_TEST_TEMPLATE_ELT1(vlog, FAST_MATH_VLOG_INPUT);
+VECTOR_TEST_TEMPLATE_ELT1(vtanh, FAST_MATH_VTANH_INPUT);
+
+ATAN2_TEST_TEMPLATE_ELT1(f32, float32_t,
+    FAST_MATH_ULP_COMPARE_INTERFACE(FAST_MATH_MAX_LEN, FAST_MATH_MAX_ULP_atan2));
+ATAN2_TEST_TEMPLATE_ELT1(q31, q31_t,
+    FAST_MATH_ANGLE_COMPARE_INTERFACE(FAST_MATH_MAX_LEN, q31_t, FAST_MATH_MAX_LSB_q31_t));
+ATAN2_TEST_TEMPLATE_ELT1(q15, q15_t,
+    FAST_MATH_ANGLE_COMPARE_INTERFACE(FAST_MATH_MAX_LEN, q15_t, FAST_MATH_MAX_LSB_q15_t));
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group */
 /*--------------------------------------------------------------------------------*/
@@ -35,4 +46,12 @@ JTEST_DEFINE_GROUP(fast_math_tests)
     JTEST_TEST_CALL(arm_cos_f32_test);
     JTEST_TEST_CALL(arm_cos_q31_test);
     JTEST_TEST_CALL(arm_cos_q15_test);
+
+    JTEST_TEST_CALL(arm_vexp_f32_test);
+    JTEST_TEST_CALL(arm_vlog_f32_test);
+    JTEST_TEST_CALL(arm_vtanh_f32_test);
+
+    JTEST_TEST_CALL(arm_atan2_f32_test);
+    JTEST_TEST_CALL(arm_atan2_q31_test);
+    JTEST_TEST_CALL(arm_atan2_q15_test);
 }
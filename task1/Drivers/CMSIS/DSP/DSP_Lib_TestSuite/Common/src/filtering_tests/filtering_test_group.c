@@ -10,8 +10,11 @@ JTEST_DEFINE_GROUP(filtering_tests)
     JTEST_GROUP_CALL(conv_tests);
     JTEST_GROUP_CALL(correlate_tests);
     JTEST_GROUP_CALL(fir_tests);
+    JTEST_GROUP_CALL(fir_fft_tests);
+    JTEST_GROUP_CALL(fir_resample_tests);
     JTEST_GROUP_CALL(iir_tests);
     JTEST_GROUP_CALL(lms_tests);
+    JTEST_GROUP_CALL(multichannel_tests);
 
     return;
 }
@@ -0,0 +1,191 @@
+#include "jtest.h"
+#include "filtering_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "filtering_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Long Filter Data */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  The FFT-based filter is meant for filters much longer than the ones in
+  filtering_test_data, so it gets its own pseudo-random coefficients and input,
+  generated at run time.
+*/
+#define FIR_FFT_MAX_NUMTAPS     4096
+#define FIR_FFT_MAX_BLOCKSIZE   256
+#define FIR_FFT_INPUT_LEN       2048
+#define FIR_FFT_MAX_SPECTRA     (2 * (FIR_FFT_MAX_NUMTAPS + FIR_FFT_MAX_BLOCKSIZE))
+
+/* Partition length of the benchmark, a typical audio block. */
+#define FIR_FFT_BENCH_BLOCKSIZE 128
+
+static float32_t fir_fft_coeffs[FIR_FFT_MAX_NUMTAPS];
+static float32_t fir_fft_input[FIR_FFT_INPUT_LEN];
+static float32_t fir_fft_inplace[FIR_FFT_INPUT_LEN];
+static float32_t fir_fft_coeffs_freq[FIR_FFT_MAX_SPECTRA];
+static float32_t fir_fft_state[FIR_FFT_MAX_SPECTRA + FIR_FFT_MAX_BLOCKSIZE];
+static float32_t fir_fft_scratch[4 * FIR_FFT_MAX_BLOCKSIZE];
+static float32_t fir_fft_direct_state[FIR_FFT_MAX_NUMTAPS + FIR_FFT_INPUT_LEN];
+static float32_t fir_fft_output_fut[FIR_FFT_INPUT_LEN];
+static float32_t fir_fft_output_ref[FIR_FFT_INPUT_LEN];
+
+/* Filter lengths and partition lengths of the correctness test. */
+static const uint16_t fir_fft_numtaps[]    = {  1, 34, 100, 511, 1024, 4000 };
+static const uint16_t fir_fft_blocksizes[] = { 16, 16,  32,  64,  128,  256 };
+
+/* Filter lengths of the benchmark. */
+static const uint16_t fir_fft_bench_numtaps[] =
+{
+    16, 32, 64, 128, 256, 512, 1024, 2048, 4096
+};
+
+/**
+ *  Filter the whole input with the direct form reference.
+ */
+static void fir_fft_reference(
+    uint16_t numTaps)
+{
+    arm_fir_instance_f32 fir_inst_ref;
+
+    arm_fir_init_f32(&fir_inst_ref, numTaps, fir_fft_coeffs,
+                     fir_fft_direct_state, FIR_FFT_INPUT_LEN);
+    ref_fir_f32(&fir_inst_ref, fir_fft_input, fir_fft_output_ref,
+                FIR_FFT_INPUT_LEN);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Tests */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_TEST(arm_fir_fft_f32_test,
+                  arm_fir_fft_f32)
+{
+    arm_fir_fft_instance_f32 fir_inst_fut;
+    uint32_t cfg, pos, blockSize;
+    uint16_t numTaps;
+
+    arm_fill_rand_f32(fir_fft_coeffs, FIR_FFT_MAX_NUMTAPS, 1U, 1.0f);
+    arm_fill_rand_f32(fir_fft_input, FIR_FFT_INPUT_LEN, 2U, 1.0f);
+
+    for (cfg = 0; cfg < sizeof(fir_fft_numtaps) / sizeof(uint16_t); cfg++)
+    {
+        numTaps = fir_fft_numtaps[cfg];
+        blockSize = fir_fft_blocksizes[cfg];
+
+        /* Display test parameter values */
+        JTEST_DUMP_STRF("Block Size: %d\n"
+                        "Number of Taps: %d\n",
+                        (int)blockSize,
+                        (int)numTaps);
+
+        TEST_ASSERT_EQUAL(
+            arm_fir_fft_init_f32(&fir_inst_fut, numTaps, fir_fft_coeffs,
+                                 fir_fft_coeffs_freq, fir_fft_state,
+                                 fir_fft_scratch, blockSize),
+            ARM_MATH_SUCCESS);
+
+        /* Two partitions per call, so that the delay line wraps across calls */
+        for (pos = 0; pos < FIR_FFT_INPUT_LEN; pos += 2 * blockSize)
+        {
+            arm_fir_fft_f32(&fir_inst_fut, fir_fft_input + pos,
+                            fir_fft_output_fut + pos, 2 * blockSize);
+        }
+
+        fir_fft_reference(numTaps);
+
+        TEST_ASSERT_SNR(fir_fft_output_ref, fir_fft_output_fut,
+                        FIR_FFT_INPUT_LEN,
+                        FILTERING_SNR_THRESHOLD_float32_t);
+
+        /* In-place filtering gives the same output */
+        arm_fir_fft_init_f32(&fir_inst_fut, numTaps, fir_fft_coeffs,
+                             fir_fft_coeffs_freq, fir_fft_state,
+                             fir_fft_scratch, blockSize);
+        memcpy(fir_fft_inplace, fir_fft_input, sizeof(fir_fft_inplace));
+        arm_fir_fft_f32(&fir_inst_fut, fir_fft_inplace, fir_fft_inplace,
+                        FIR_FFT_INPUT_LEN);
+
+        TEST_ASSERT_BUFFERS_EQUAL(fir_fft_inplace, fir_fft_output_fut,
+                                  sizeof(fir_fft_inplace));
+    }
+
+    /* Partition lengths without a real FFT are rejected */
+    TEST_ASSERT_EQUAL(
+        arm_fir_fft_init_f32(&fir_inst_fut, 64, fir_fft_coeffs,
+                             fir_fft_coeffs_freq, fir_fft_state,
+                             fir_fft_scratch, 100),
+        ARM_MATH_ARGUMENT_ERROR);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  Crossover benchmark: the same input is filtered in blocks of
+  FIR_FFT_BENCH_BLOCKSIZE samples by arm_fir_f32() and arm_fir_fft_f32(). The
+  first cycle count is the direct form, the second the FFT-based filter.
+*/
+JTEST_DEFINE_TEST(arm_fir_fft_f32_bench,
+                  arm_fir_fft_f32)
+{
+    arm_fir_fft_instance_f32 fir_inst_fut;
+    arm_fir_instance_f32 fir_inst_direct;
+    uint32_t cfg, pos;
+    uint16_t numTaps;
+
+    arm_fill_rand_f32(fir_fft_coeffs, FIR_FFT_MAX_NUMTAPS, 1U, 1.0f);
+    arm_fill_rand_f32(fir_fft_input, FIR_FFT_INPUT_LEN, 2U, 1.0f);
+
+    for (cfg = 0; cfg < sizeof(fir_fft_bench_numtaps) / sizeof(uint16_t); cfg++)
+    {
+        numTaps = fir_fft_bench_numtaps[cfg];
+
+        JTEST_DUMP_STRF("Block Size: %d\n"
+                        "Number of Taps: %d\n"
+                        "Samples: %d\n",
+                        (int)FIR_FFT_BENCH_BLOCKSIZE,
+                        (int)numTaps,
+                        (int)FIR_FFT_INPUT_LEN);
+
+        arm_fir_init_f32(&fir_inst_direct, numTaps, fir_fft_coeffs,
+                         fir_fft_direct_state, FIR_FFT_BENCH_BLOCKSIZE);
+
+        JTEST_COUNT_CYCLES(
+            for (pos = 0; pos < FIR_FFT_INPUT_LEN; pos += FIR_FFT_BENCH_BLOCKSIZE)
+            {
+                arm_fir_f32(&fir_inst_direct, fir_fft_input + pos,
+                            fir_fft_output_ref + pos, FIR_FFT_BENCH_BLOCKSIZE);
+            });
+
+        arm_fir_fft_init_f32(&fir_inst_fut, numTaps, fir_fft_coeffs,
+                             fir_fft_coeffs_freq, fir_fft_state,
+                             fir_fft_scratch, FIR_FFT_BENCH_BLOCKSIZE);
+
+        JTEST_COUNT_CYCLES(
+            for (pos = 0; pos < FIR_FFT_INPUT_LEN; pos += FIR_FFT_BENCH_BLOCKSIZE)
+            {
+                arm_fir_fft_f32(&fir_inst_fut, fir_fft_input + pos,
+                                fir_fft_output_fut + pos, FIR_FFT_BENCH_BLOCKSIZE);
+            });
+
+        TEST_ASSERT_SNR(fir_fft_output_ref, fir_fft_output_fut,
+                        FIR_FFT_INPUT_LEN,
+                        FILTERING_SNR_THRESHOLD_float32_t);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(fir_fft_tests)
+{
+    JTEST_TEST_CALL(arm_fir_fft_f32_test);
+    JTEST_TEST_CALL(arm_fir_fft_f32_bench);
+}
@@ -0,0 +1,312 @@
+#include "jtest.h"
+#include "filtering_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "filtering_templates.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Resampler Data */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  The resampler filters have L * phaseLength taps, up to 2560 for a 44.1 kHz to
+  48 kHz converter, so the coefficients and input are generated at run time.
+  The buffers are float32_t and are cast to the type under test.
+*/
+#define RESAMPLE_MAX_NUMTAPS    2560
+#define RESAMPLE_MAX_PHASELEN   16
+#define RESAMPLE_INPUT_LEN      480
+#define RESAMPLE_MAX_OUTPUT     (RESAMPLE_INPUT_LEN * 4)
+#define RESAMPLE_BLOCKSIZE      96
+#define RESAMPLE_STATE_LEN      (RESAMPLE_BLOCKSIZE + RESAMPLE_MAX_PHASELEN - 1)
+
+/* Largest upsampled block of the two-stage benchmark. */
+#define RESAMPLE_MAX_UPSAMPLED  (RESAMPLE_BLOCKSIZE * 3)
+
+static float32_t resample_proto[RESAMPLE_MAX_NUMTAPS];
+static float32_t resample_coeffs[RESAMPLE_MAX_NUMTAPS];
+static float32_t resample_phase_coeffs[RESAMPLE_MAX_NUMTAPS];
+static float32_t resample_source[RESAMPLE_INPUT_LEN];
+static float32_t resample_input[RESAMPLE_INPUT_LEN];
+static float32_t resample_state[RESAMPLE_STATE_LEN];
+static float32_t resample_output_fut[RESAMPLE_MAX_OUTPUT];
+static float32_t resample_output_ref[RESAMPLE_MAX_OUTPUT];
+static float32_t resample_upsampled[RESAMPLE_MAX_UPSAMPLED];
+
+/* Resampling factors and polyphase lengths of the correctness tests: rate
+   conversions both ways, plain decimation and plain interpolation. */
+static const uint16_t resample_L[]        = { 160, 147, 3,  2,  1, 4 };
+static const uint16_t resample_M[]        = { 147, 160, 2,  3,  4, 1 };
+static const uint16_t resample_phaselen[] = {   8,   8, 12, 12, 16, 8 };
+
+/* Sizes of the successive calls, cycled through; none divides the others. */
+static const uint16_t resample_call_lens[] = { 64, 17, 1, 40, 96 };
+
+/* Resampling factors of the benchmark, with a polyphase length of 16. */
+static const uint16_t resample_bench_L[] = { 160, 147, 3, 2 };
+static const uint16_t resample_bench_M[] = { 147, 160, 2, 3 };
+
+/**
+ *  Design a Hann-windowed sinc lowpass with a cutoff of 1/max(L, M) and a gain
+ *  of L, in time reversed order. A little noise is added so that the response
+ *  is not symmetric, which would hide a reversed polyphase component.
+ */
+static void resample_design(
+    uint16_t L,
+    uint16_t M,
+    uint16_t numTaps)
+{
+    float64_t fc = 0.5 / ((L > M) ? L : M);
+    float64_t t, h;
+    uint32_t k;
+
+    arm_fill_rand_f32(resample_proto, numTaps, 3U, 0.5f);
+
+    for (k = 0; k < numTaps; k++)
+    {
+        t = k - (numTaps - 1) / 2.0;
+        h = (t == 0.0) ? 2.0 * fc : sin(6.28318530717958647692 * fc * t) / (3.14159265358979323846 * t);
+        h *= 0.5 - 0.5 * cos(6.28318530717958647692 * (k + 0.5) / numTaps);
+
+        resample_proto[numTaps - 1 - k] = (float32_t)(L * h) +
+            0.01f * resample_proto[numTaps - 1 - k];
+    }
+}
+
+/**
+ *  Conversion of the generated data to the type under test. The q15
+ *  coefficients are halved to fit the passband gain of L.
+ */
+static void resample_from_float_f32(
+    uint16_t numTaps)
+{
+    arm_copy_f32(resample_proto, resample_coeffs, numTaps);
+    arm_copy_f32(resample_source, resample_input, RESAMPLE_INPUT_LEN);
+}
+
+static void resample_from_float_q15(
+    uint16_t numTaps)
+{
+    /* The per-phase buffer is free until the instance is initialized */
+    arm_scale_f32(resample_proto, 0.5f, resample_phase_coeffs, numTaps);
+    arm_float_to_q15(resample_phase_coeffs, (q15_t *) resample_coeffs, numTaps);
+    arm_float_to_q15(resample_source, (q15_t *) resample_input, RESAMPLE_INPUT_LEN);
+}
+
+/**
+ *  Two-stage conversion: arm_fir_interpolate into a buffer at L times the input
+ *  rate, then keep every M-th sample, counting them in outCnt.
+ */
+#define RESAMPLE_TWO_STAGE(suffix, type, S, pDst)                               \
+    do                                                                          \
+    {                                                                           \
+        uint32_t pos, j = 0;                                                    \
+                                                                                \
+        for (pos = 0; pos < RESAMPLE_INPUT_LEN; pos += RESAMPLE_BLOCKSIZE)      \
+        {                                                                       \
+            arm_fir_interpolate_##suffix(                                       \
+                S, (type *) resample_input + pos,                               \
+                (type *) resample_upsampled, RESAMPLE_BLOCKSIZE);               \
+                                                                                \
+            for (; j < RESAMPLE_BLOCKSIZE * L; j += M)                          \
+            {                                                                   \
+                (pDst)[outCnt++] = ((type *) resample_upsampled)[j];            \
+            }                                                                   \
+            j -= RESAMPLE_BLOCKSIZE * L;                                        \
+        }                                                                       \
+    } while (0)
+
+/**
+ *  Compare the outputs of the function under test and of the reference.
+ *  The fixed-point results are exact.
+ */
+#define RESAMPLE_COMPARE_f32(len)                                               \
+    TEST_ASSERT_SNR(resample_output_ref, resample_output_fut, len,              \
+                    FILTERING_SNR_THRESHOLD_float32_t)
+
+#define RESAMPLE_COMPARE_q15(len)                                               \
+    TEST_ASSERT_BUFFERS_EQUAL(resample_output_ref, resample_output_fut,         \
+                              (len) * sizeof(q15_t))
+
+/*--------------------------------------------------------------------------------*/
+/* Tests */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  The input is pushed in calls of varying size and the outputs are checked
+  against the reference resampler, which filters the whole input at once from
+  the definition.
+*/
+#define RESAMPLE_DEFINE_TEST(suffix, type)                                      \
+    JTEST_DEFINE_TEST(arm_fir_resample_##suffix##_test,                         \
+                      arm_fir_resample_##suffix)                                \
+    {                                                                           \
+        arm_fir_resample_instance_##suffix S;                                   \
+        uint32_t cfg, pos, len, call, outCnt, refCnt;                           \
+        uint16_t L, M, numTaps;                                                 \
+                                                                                \
+        arm_fill_rand_f32(resample_source, RESAMPLE_INPUT_LEN, 1U, 0.5f);       \
+                                                                                \
+        for (cfg = 0; cfg < sizeof(resample_L) / sizeof(uint16_t); cfg++)       \
+        {                                                                       \
+            L = resample_L[cfg];                                                \
+            M = resample_M[cfg];                                                \
+            numTaps = L * resample_phaselen[cfg];                               \
+                                                                                \
+            /* Display test parameter values */                                 \
+            JTEST_DUMP_STRF("L: %d\n"                                           \
+                            "M: %d\n"                                           \
+                            "Number of Taps: %d\n",                             \
+                            (int)L, (int)M, (int)numTaps);                      \
+                                                                                \
+            resample_design(L, M, numTaps);                                     \
+            resample_from_float_##suffix(numTaps);                              \
+                                                                                \
+            TEST_ASSERT_EQUAL(                                                  \
+                arm_fir_resample_init_##suffix(                                 \
+                    &S, L, M, numTaps, (type *) resample_coeffs,                \
+                    (type *) resample_phase_coeffs, (type *) resample_state,    \
+                    RESAMPLE_BLOCKSIZE),                                        \
+                ARM_MATH_SUCCESS);                                              \
+                                                                                \
+            outCnt = 0;                                                         \
+            call = 0;                                                           \
+            for (pos = 0; pos < RESAMPLE_INPUT_LEN; pos += len)                 \
+            {                                                                   \
+                len = resample_call_lens[call++ %                               \
+                    (sizeof(resample_call_lens) / sizeof(uint16_t))];           \
+                len = (len < RESAMPLE_INPUT_LEN - pos) ?                        \
+                    len : RESAMPLE_INPUT_LEN - pos;                             \
+                                                                                \
+                outCnt += arm_fir_resample_##suffix(                            \
+                    &S, (type *) resample_input + pos,                          \
+                    (type *) resample_output_fut + outCnt, len);                \
+            }                                                                   \
+                                                                                \
+            refCnt = ref_fir_resample_##suffix(                                 \
+                (type *) resample_coeffs, numTaps, L, M,                        \
+                (type *) resample_input, (type *) resample_output_ref,          \
+                RESAMPLE_INPUT_LEN);                                            \
+                                                                                \
+            TEST_ASSERT_EQUAL(outCnt, refCnt);                                  \
+            RESAMPLE_COMPARE_##suffix(outCnt);                                  \
+        }                                                                       \
+                                                                                \
+        /* Filter lengths that are not a multiple of L are rejected */          \
+        TEST_ASSERT_EQUAL(                                                      \
+            arm_fir_resample_init_##suffix(                                     \
+                &S, 160, 147, 1000, (type *) resample_coeffs,                   \
+                (type *) resample_phase_coeffs, (type *) resample_state,        \
+                RESAMPLE_BLOCKSIZE),                                            \
+            ARM_MATH_LENGTH_ERROR);                                             \
+        TEST_ASSERT_EQUAL(                                                      \
+            arm_fir_resample_init_##suffix(                                     \
+                &S, 3, 0, 12, (type *) resample_coeffs,                         \
+                (type *) resample_phase_coeffs, (type *) resample_state,        \
+                RESAMPLE_BLOCKSIZE),                                            \
+            ARM_MATH_ARGUMENT_ERROR);                                           \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+RESAMPLE_DEFINE_TEST(f32, float32_t);
+RESAMPLE_DEFINE_TEST(q15, q15_t);
+
+/*--------------------------------------------------------------------------------*/
+/* Benchmark */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  The input is resampled in blocks of RESAMPLE_BLOCKSIZE samples. The first
+  cycle count is arm_fir_resample; the cost per output sample is phaseLength
+  multiply-accumulates. Where the upsampled block fits in
+  RESAMPLE_MAX_UPSAMPLED samples, the second cycle count is the two-stage
+  conversion through arm_fir_interpolate, which computes L outputs per input
+  sample and keeps L/M of them. For 160/147 the upsampled block would be 15360
+  samples.
+*/
+#define RESAMPLE_DEFINE_BENCH(suffix, type)                                     \
+    JTEST_DEFINE_TEST(arm_fir_resample_##suffix##_bench,                        \
+                      arm_fir_resample_##suffix)                                \
+    {                                                                           \
+        arm_fir_resample_instance_##suffix S;                                   \
+        arm_fir_interpolate_instance_##suffix S2;                               \
+        uint32_t cfg, pos, outCnt, resCnt;                                      \
+        uint16_t L, M, numTaps;                                                 \
+                                                                                \
+        arm_fill_rand_f32(resample_source, RESAMPLE_INPUT_LEN, 1U, 0.5f);       \
+                                                                                \
+        for (cfg = 0; cfg < sizeof(resample_bench_L) / sizeof(uint16_t); cfg++) \
+        {                                                                       \
+            L = resample_bench_L[cfg];                                          \
+            M = resample_bench_M[cfg];                                          \
+            numTaps = L * RESAMPLE_MAX_PHASELEN;                                \
+                                                                                \
+            resample_design(L, M, numTaps);                                     \
+            resample_from_float_##suffix(numTaps);                              \
+                                                                                \
+            arm_fir_resample_init_##suffix(                                     \
+                &S, L, M, numTaps, (type *) resample_coeffs,                    \
+                (type *) resample_phase_coeffs, (type *) resample_state,        \
+                RESAMPLE_BLOCKSIZE);                                            \
+                                                                                \
+            resCnt = 0;                                                         \
+            JTEST_COUNT_CYCLES(                                                 \
+                for (pos = 0; pos < RESAMPLE_INPUT_LEN;                         \
+                     pos += RESAMPLE_BLOCKSIZE)                                 \
+                {                                                               \
+                    resCnt += arm_fir_resample_##suffix(                        \
+                        &S, (type *) resample_input + pos,                      \
+                        (type *) resample_output_fut + resCnt,                  \
+                        RESAMPLE_BLOCKSIZE);                                    \
+                });                                                             \
+                                                                                \
+            JTEST_DUMP_STRF("L: %d\n"                                           \
+                            "M: %d\n"                                           \
+                            "Number of Taps: %d\n"                              \
+                            "Input Samples: %d\n"                               \
+                            "Output Samples: %d\n"                              \
+                            "MACs per Output: %d\n",                            \
+                            (int)L, (int)M, (int)numTaps,                       \
+                            (int)RESAMPLE_INPUT_LEN, (int)resCnt,               \
+                            (int)RESAMPLE_MAX_PHASELEN);                        \
+                                                                                \
+            if (RESAMPLE_BLOCKSIZE * L > RESAMPLE_MAX_UPSAMPLED)                \
+            {                                                                   \
+                continue;                                                       \
+            }                                                                   \
+                                                                                \
+            arm_fir_interpolate_init_##suffix(                                  \
+                &S2, (uint8_t) L, numTaps, (type *) resample_coeffs,            \
+                (type *) resample_state, RESAMPLE_BLOCKSIZE);                   \
+                                                                                \
+            outCnt = 0;                                                         \
+            JTEST_COUNT_CYCLES(                                                 \
+                RESAMPLE_TWO_STAGE(suffix, type, &S2,                           \
+                                   (type *) resample_output_ref));              \
+                                                                                \
+            TEST_ASSERT_EQUAL(outCnt, resCnt);                                  \
+            RESAMPLE_COMPARE_##suffix(outCnt);                                  \
+        }                                                                       \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+RESAMPLE_DEFINE_BENCH(f32, float32_t);
+RESAMPLE_DEFINE_BENCH(q15, q15_t);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(fir_resample_tests)
+{
+    JTEST_TEST_CALL(arm_fir_resample_f32_test);
+    JTEST_TEST_CALL(arm_fir_resample_q15_test);
+    JTEST_TEST_CALL(arm_fir_resample_f32_bench);
+    JTEST_TEST_CALL(arm_fir_resample_q15_bench);
+}
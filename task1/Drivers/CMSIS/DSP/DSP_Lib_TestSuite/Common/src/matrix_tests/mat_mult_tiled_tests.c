@@ -0,0 +1,188 @@
+#include "jtest.h"
+#include "matrix_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "matrix_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* The tiled variants take a scratch buffer for the packed panel of pSrcB. */
+/*--------------------------------------------------------------------------------*/
+
+#define ARM_mat_mult_tiled_INPUT_INTERFACE(type, input_a_ptr, input_b_ptr) \
+    PAREN(input_a_ptr, input_b_ptr,                                     \
+          (void *) &matrix_output_fut,                                  \
+          (type *) matrix_output_scratch)
+
+#define ARM_mat_mult_tiled_f32_INPUT_INTERFACE(input_a_ptr, input_b_ptr) \
+    ARM_mat_mult_tiled_INPUT_INTERFACE(float32_t, input_a_ptr, input_b_ptr)
+
+#define ARM_mat_mult_tiled_q31_INPUT_INTERFACE(input_a_ptr, input_b_ptr) \
+    ARM_mat_mult_tiled_INPUT_INTERFACE(q31_t, input_a_ptr, input_b_ptr)
+
+#define ARM_mat_mult_tiled_q15_INPUT_INTERFACE(input_a_ptr, input_b_ptr) \
+    ARM_mat_mult_tiled_INPUT_INTERFACE(q15_t, input_a_ptr, input_b_ptr)
+
+#define JTEST_ARM_MAT_MULT_TILED_TEST(suffix)                   \
+    JTEST_DEFINE_TEST(arm_mat_mult_tiled_##suffix##_test,       \
+                      arm_mat_mult_tiled_##suffix)              \
+    {                                                           \
+        MATRIX_TEST_TEMPLATE_ELT2(                              \
+            matrix_##suffix##_a_inputs,                         \
+            matrix_##suffix##_b_inputs,                         \
+            arm_matrix_instance_##suffix * ,                    \
+            arm_matrix_instance_##suffix,                       \
+            TYPE_FROM_ABBREV(suffix),                           \
+            arm_mat_mult_tiled_##suffix,                        \
+            ARM_mat_mult_tiled_##suffix##_INPUT_INTERFACE,      \
+            ref_mat_mult_##suffix,                              \
+            REF_mat_mult_INPUT_INTERFACE,                       \
+            MATRIX_TEST_CONFIG_MULTIPLICATIVE_OUTPUT,           \
+            MATRIX_TEST_VALID_MULTIPLICATIVE_DIMENSIONS,        \
+            MATRIX_COMPARE_INTERFACE);                          \
+    }
+
+JTEST_ARM_MAT_MULT_TILED_TEST(f32);
+JTEST_ARM_MAT_MULT_TILED_TEST(q31);
+JTEST_ARM_MAT_MULT_TILED_TEST(q15);
+
+/*--------------------------------------------------------------------------------*/
+/* Benchmark Sweep */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  The test inputs above are at most 4 x 4, which is too small to show the
+  effect of the tiling. The sweep multiplies square matrices of growing size
+  with both the plain and the tiled function, displays both cycle counts and
+  checks that the tiled function gives the same result.
+*/
+
+#define MAT_MULT_TILED_SWEEP_MAX_DIM 32
+#define MAT_MULT_TILED_SWEEP_MAX_ELTS \
+    (MAT_MULT_TILED_SWEEP_MAX_DIM * MAT_MULT_TILED_SWEEP_MAX_DIM)
+
+static const uint16_t mat_mult_tiled_sweep_dims[] = {5, 8, 13, 16, 24, 32};
+
+static float32_t mat_mult_tiled_sweep_a[MAT_MULT_TILED_SWEEP_MAX_ELTS];
+static float32_t mat_mult_tiled_sweep_b[MAT_MULT_TILED_SWEEP_MAX_ELTS];
+static float32_t mat_mult_tiled_sweep_plain[MAT_MULT_TILED_SWEEP_MAX_ELTS];
+static float32_t mat_mult_tiled_sweep_tiled[MAT_MULT_TILED_SWEEP_MAX_ELTS];
+static float32_t mat_mult_tiled_sweep_scratch[4 * MAT_MULT_TILED_SWEEP_MAX_DIM];
+
+/*
+  Fill the first num_elts words of buf with pseudo-random values of the given
+  type in the range [-0.125, 0.125), so that no sum of products saturates.
+*/
+static void mat_mult_tiled_sweep_fill(
+    void * buf,
+    uint32_t num_elts,
+    uint32_t seed,
+    uint32_t type_bits)
+{
+    uint32_t i;
+    int32_t value;
+
+    for (i = 0; i < num_elts; i++)
+    {
+        value = (int32_t) arm_rand_lcg(&seed);
+
+        switch (type_bits)
+        {
+        case 15:
+            ((q15_t *) buf)[i] = (q15_t) (value >> 19);
+            break;
+        case 31:
+            ((q31_t *) buf)[i] = (q31_t) (value >> 3);
+            break;
+        default:
+            ((float32_t *) buf)[i] = (float32_t) (value >> 8) / 134217728.0f;
+            break;
+        }
+    }
+}
+
+#define MAT_MULT_TILED_SWEEP_TEST(suffix, type_bits, plain_extra_args)      \
+    JTEST_DEFINE_TEST(arm_mat_mult_tiled_##suffix##_sweep_test,             \
+                      arm_mat_mult_tiled_##suffix)                          \
+    {                                                                       \
+        arm_matrix_instance_##suffix mat_a;                                 \
+        arm_matrix_instance_##suffix mat_b;                                 \
+        arm_matrix_instance_##suffix mat_plain;                             \
+        arm_matrix_instance_##suffix mat_tiled;                             \
+        uint32_t dim_idx;                                                   \
+        uint16_t dim;                                                       \
+                                                                            \
+        for (dim_idx = 0;                                                   \
+             dim_idx < (sizeof(mat_mult_tiled_sweep_dims) /                 \
+                        sizeof(mat_mult_tiled_sweep_dims[0]));              \
+             dim_idx++)                                                     \
+        {                                                                   \
+            dim = mat_mult_tiled_sweep_dims[dim_idx];                       \
+                                                                            \
+            mat_mult_tiled_sweep_fill(                                      \
+                mat_mult_tiled_sweep_a, dim * dim, dim, type_bits);         \
+            mat_mult_tiled_sweep_fill(                                      \
+                mat_mult_tiled_sweep_b, dim * dim, dim + 1U, type_bits);    \
+                                                                            \
+            arm_mat_init_##suffix(&mat_a, dim, dim,                         \
+                (TYPE_FROM_ABBREV(suffix) *) mat_mult_tiled_sweep_a);       \
+            arm_mat_init_##suffix(&mat_b, dim, dim,                         \
+                (TYPE_FROM_ABBREV(suffix) *) mat_mult_tiled_sweep_b);       \
+            arm_mat_init_##suffix(&mat_plain, dim, dim,                     \
+                (TYPE_FROM_ABBREV(suffix) *) mat_mult_tiled_sweep_plain);   \
+            arm_mat_init_##suffix(&mat_tiled, dim, dim,                     \
+                (TYPE_FROM_ABBREV(suffix) *) mat_mult_tiled_sweep_tiled);   \
+                                                                            \
+            JTEST_DUMP_STRF("Dimension: %d\n", (int) dim);                  \
+                                                                            \
+            JTEST_COUNT_CYCLES(                                             \
+                arm_mat_mult_##suffix(                                      \
+                    &mat_a, &mat_b, &mat_plain plain_extra_args));          \
+                                                                            \
+            JTEST_COUNT_CYCLES(                                             \
+                arm_mat_mult_tiled_##suffix(                                \
+                    &mat_a, &mat_b, &mat_tiled,                             \
+                    (TYPE_FROM_ABBREV(suffix) *)                            \
+                    mat_mult_tiled_sweep_scratch));                         \
+                                                                            \
+            if (memcmp(mat_mult_tiled_sweep_plain,                          \
+                       mat_mult_tiled_sweep_tiled,                          \
+                       dim * dim * sizeof(TYPE_FROM_ABBREV(suffix))) != 0)  \
+            {                                                               \
+                JTEST_DUMP_STRF("Tiled result differs at dimension %d\n",  \
+                                (int) dim);                                 \
+                return JTEST_TEST_FAILED;                                   \
+            }                                                               \
+        }                                                                   \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+/* arm_mat_mult_q15() needs a scratch buffer for the transposed pSrcB. */
+#define MAT_MULT_TILED_SWEEP_Q15_SCRATCH                                    \
+    , (q15_t *) mat_mult_tiled_sweep_q15_transpose
+
+static q15_t mat_mult_tiled_sweep_q15_transpose[MAT_MULT_TILED_SWEEP_MAX_ELTS];
+
+MAT_MULT_TILED_SWEEP_TEST(f32, 0, );
+MAT_MULT_TILED_SWEEP_TEST(q31, 31, );
+MAT_MULT_TILED_SWEEP_TEST(q15, 15, MAT_MULT_TILED_SWEEP_Q15_SCRATCH);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(mat_mult_tiled_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_mat_mult_tiled_f32_test);
+    JTEST_TEST_CALL(arm_mat_mult_tiled_q31_test);
+    JTEST_TEST_CALL(arm_mat_mult_tiled_q15_test);
+    JTEST_TEST_CALL(arm_mat_mult_tiled_f32_sweep_test);
+    JTEST_TEST_CALL(arm_mat_mult_tiled_q31_sweep_test);
+    JTEST_TEST_CALL(arm_mat_mult_tiled_q15_sweep_test);
+}
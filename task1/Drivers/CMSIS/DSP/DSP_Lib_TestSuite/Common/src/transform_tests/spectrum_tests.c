@@ -0,0 +1,266 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Buffers */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  The estimator buffers are carved out of the transform test buffers, which hold
+  2 * TRANSFORM_MAX_FFT_LEN samples each. The input stream is
+  transform_fft_f32_inputs.
+*/
+#define SPECTRUM_STATE        transform_fft_input_fut
+#define SPECTRUM_WINDOW       (transform_fft_input_fut + TRANSFORM_MAX_FFT_LEN)
+#define SPECTRUM_ACCUM        transform_fft_input_ref
+#define SPECTRUM_SCRATCH      transform_fft_output_fut
+#define SPECTRUM_OUTPUT_FUT   transform_fft_output_f32_fut
+#define SPECTRUM_OUTPUT_REF   transform_fft_output_f32_ref
+#define SPECTRUM_INPUT_LEN    (TRANSFORM_MAX_FFT_LEN * 2)
+
+/* Size of the blocks pushed into the estimator, not a divisor of any hop size. */
+#define SPECTRUM_PUSH_LEN     100U
+
+/* Frame lengths and overlaps of the correctness tests. */
+static const uint16_t spectrum_fftlens[]  = { 256, 256, 512, 1024 };
+static const uint16_t spectrum_overlaps[] = { 128, 192,   0,  512 };
+
+/* Frame lengths of the benchmark, with an overlap of half a frame. */
+static const uint16_t spectrum_bench_fftlens[] = { 256, 512, 1024, 2048, 4096 };
+
+/**
+ *  Number of frames in a stream of the given length.
+ */
+static uint32_t spectrum_num_frames(
+    uint32_t len,
+    uint16_t fftlen,
+    uint16_t overlap)
+{
+    return (len - fftlen) / (fftlen - overlap) + 1U;
+}
+
+/**
+ *  Initialize an estimator with a Hann window for the given frame.
+ */
+static arm_status spectrum_init(
+    arm_spectrum_instance_f32 * S,
+    uint16_t fftlen,
+    uint16_t overlap)
+{
+    arm_spectrum_hann_f32(SPECTRUM_WINDOW, fftlen);
+
+    return arm_spectrum_init_f32(S, fftlen, overlap, SPECTRUM_WINDOW,
+                                 SPECTRUM_STATE, SPECTRUM_SCRATCH,
+                                 SPECTRUM_ACCUM);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Window and Initialization Tests */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_TEST(arm_spectrum_hann_f32_test,
+                  arm_spectrum_hann_f32)
+{
+    arm_spectrum_instance_f32 S;
+    uint32_t fftlen;
+    uint32_t n;
+
+    for (fftlen = 32; fftlen <= TRANSFORM_MAX_FFT_LEN; fftlen *= 2)
+    {
+        JTEST_DUMP_STRF("Window Length: %d\n", (int)fftlen);
+
+        TEST_ASSERT_EQUAL(
+            arm_spectrum_hann_f32(SPECTRUM_OUTPUT_FUT, fftlen),
+            ARM_MATH_SUCCESS);
+
+        for (n = 0; n < fftlen; n++)
+        {
+            SPECTRUM_OUTPUT_REF[n] = (float32_t)
+                (0.5 - 0.5 * cos(6.28318530717958647692 * n / fftlen));
+        }
+
+        TEST_ASSERT_SNR(SPECTRUM_OUTPUT_REF, SPECTRUM_OUTPUT_FUT, fftlen,
+                        TRANSFORM_SNR_THRESHOLD_float32_t);
+    }
+
+    /* Lengths without a real FFT and overlaps of a whole frame are rejected */
+    TEST_ASSERT_EQUAL(arm_spectrum_hann_f32(SPECTRUM_OUTPUT_FUT, 100),
+                      ARM_MATH_ARGUMENT_ERROR);
+    TEST_ASSERT_EQUAL(spectrum_init(&S, 256, 256), ARM_MATH_ARGUMENT_ERROR);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Estimator Tests */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_TEST(arm_spectrum_welch_f32_test,
+                  arm_spectrum_welch_f32)
+{
+    arm_spectrum_instance_f32 S;
+    uint32_t cfg, pos, len, frames, expected;
+
+    for (cfg = 0; cfg < sizeof(spectrum_fftlens) / sizeof(uint16_t); cfg++)
+    {
+        JTEST_DUMP_STRF("Frame Length: %d\n"
+                        "Overlap: %d\n",
+                        (int)spectrum_fftlens[cfg],
+                        (int)spectrum_overlaps[cfg]);
+
+        TEST_ASSERT_EQUAL(
+            spectrum_init(&S, spectrum_fftlens[cfg], spectrum_overlaps[cfg]),
+            ARM_MATH_SUCCESS);
+
+        /* Stream the input in blocks that do not line up with the frames */
+        frames = 0;
+        for (pos = 0; pos < SPECTRUM_INPUT_LEN; pos += len)
+        {
+            len = SPECTRUM_INPUT_LEN - pos;
+            len = (len < SPECTRUM_PUSH_LEN) ? len : SPECTRUM_PUSH_LEN;
+            frames += arm_spectrum_welch_f32(
+                &S, transform_fft_f32_inputs + pos, len);
+        }
+
+        expected = spectrum_num_frames(SPECTRUM_INPUT_LEN,
+                                       spectrum_fftlens[cfg],
+                                       spectrum_overlaps[cfg]);
+        TEST_ASSERT_EQUAL(frames, expected);
+        TEST_ASSERT_EQUAL(arm_spectrum_psd_f32(&S, SPECTRUM_OUTPUT_FUT),
+                          expected);
+
+        ref_spectrum_f32(transform_fft_f32_inputs, expected,
+                         spectrum_fftlens[cfg],
+                         spectrum_fftlens[cfg] - spectrum_overlaps[cfg],
+                         SPECTRUM_WINDOW, 1U, SPECTRUM_OUTPUT_REF);
+
+        TEST_ASSERT_SNR(SPECTRUM_OUTPUT_REF, SPECTRUM_OUTPUT_FUT,
+                        spectrum_fftlens[cfg] / 2 + 1,
+                        TRANSFORM_SNR_THRESHOLD_float32_t);
+
+        /* The average restarts after it is read */
+        TEST_ASSERT_EQUAL(arm_spectrum_psd_f32(&S, SPECTRUM_OUTPUT_FUT), 0U);
+        TEST_ASSERT_EQUAL(SPECTRUM_OUTPUT_FUT[0], 0.0f);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_spectrum_stft_f32_test,
+                  arm_spectrum_stft_f32)
+{
+    arm_spectrum_instance_f32 S;
+    uint32_t cfg, pos, len, end, frames, expected, bins;
+
+    for (cfg = 0; cfg < sizeof(spectrum_fftlens) / sizeof(uint16_t); cfg++)
+    {
+        JTEST_DUMP_STRF("Frame Length: %d\n"
+                        "Overlap: %d\n",
+                        (int)spectrum_fftlens[cfg],
+                        (int)spectrum_overlaps[cfg]);
+
+        TEST_ASSERT_EQUAL(
+            spectrum_init(&S, spectrum_fftlens[cfg], spectrum_overlaps[cfg]),
+            ARM_MATH_SUCCESS);
+
+        bins = spectrum_fftlens[cfg] / 2 + 1;
+        expected = spectrum_num_frames(SPECTRUM_INPUT_LEN,
+                                       spectrum_fftlens[cfg],
+                                       spectrum_overlaps[cfg]);
+
+        /* Keep the frames that fit in the output buffer */
+        while (expected * bins > SPECTRUM_INPUT_LEN)
+        {
+            expected--;
+        }
+
+        /* Push the samples of these frames only */
+        end = spectrum_fftlens[cfg] +
+            (expected - 1) * (spectrum_fftlens[cfg] - spectrum_overlaps[cfg]);
+
+        frames = 0;
+        for (pos = 0; pos < end; pos += len)
+        {
+            len = end - pos;
+            len = (len < SPECTRUM_PUSH_LEN) ? len : SPECTRUM_PUSH_LEN;
+            frames += arm_spectrum_stft_f32(
+                &S, transform_fft_f32_inputs + pos, len,
+                SPECTRUM_OUTPUT_FUT + frames * bins);
+        }
+
+        TEST_ASSERT_EQUAL(frames, expected);
+
+        ref_spectrum_f32(transform_fft_f32_inputs, expected,
+                         spectrum_fftlens[cfg],
+                         spectrum_fftlens[cfg] - spectrum_overlaps[cfg],
+                         SPECTRUM_WINDOW, 0U, SPECTRUM_OUTPUT_REF);
+
+        TEST_ASSERT_SNR(SPECTRUM_OUTPUT_REF, SPECTRUM_OUTPUT_FUT,
+                        expected * bins,
+                        TRANSFORM_SNR_THRESHOLD_float32_t);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Benchmark */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  The whole input is pushed in one block with an overlap of half a frame. The
+  frame rate is the core clock times the number of frames divided by the cycle
+  count. The RAM is the instance, state, scratch and accumulator; the window
+  may be placed in flash and is reported separately.
+*/
+JTEST_DEFINE_TEST(arm_spectrum_welch_f32_bench,
+                  arm_spectrum_welch_f32)
+{
+    arm_spectrum_instance_f32 S;
+    uint32_t cfg, fftlen, frames;
+
+    for (cfg = 0; cfg < sizeof(spectrum_bench_fftlens) / sizeof(uint16_t); cfg++)
+    {
+        fftlen = spectrum_bench_fftlens[cfg];
+
+        TEST_ASSERT_EQUAL(spectrum_init(&S, fftlen, fftlen / 2),
+                          ARM_MATH_SUCCESS);
+
+        JTEST_COUNT_CYCLES(
+            frames = arm_spectrum_welch_f32(
+                &S, transform_fft_f32_inputs, SPECTRUM_INPUT_LEN));
+
+        JTEST_DUMP_STRF("Frame Length: %d\n"
+                        "Frames: %d\n"
+                        "RAM: %d bytes\n"
+                        "Window: %d bytes\n",
+                        (int)fftlen,
+                        (int)frames,
+                        (int)(sizeof(S) +
+                              (fftlen + 2 * fftlen + fftlen / 2 + 1) *
+                              sizeof(float32_t)),
+                        (int)(fftlen * sizeof(float32_t)));
+
+        TEST_ASSERT_EQUAL(frames,
+                          spectrum_num_frames(SPECTRUM_INPUT_LEN, fftlen,
+                                              fftlen / 2));
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(spectrum_tests)
+{
+    JTEST_TEST_CALL(arm_spectrum_hann_f32_test);
+    JTEST_TEST_CALL(arm_spectrum_welch_f32_test);
+    JTEST_TEST_CALL(arm_spectrum_stft_f32_test);
+    JTEST_TEST_CALL(arm_spectrum_welch_f32_bench);
+}
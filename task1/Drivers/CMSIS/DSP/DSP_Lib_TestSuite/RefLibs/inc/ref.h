@@ -480,6 +480,18 @@ arm_status ref_sqrt_q31(q31_t in, q31_t * pOut);
 
 arm_status ref_sqrt_q15(q15_t in, q15_t * pOut);
 
+void ref_vexp_f32(float32_t * pSrc, float32_t * pDst, uint32_t blockSize);
+
+void ref_vlog_f32(float32_t * pSrc, float32_t * pDst, uint32_t blockSize);
+
+void ref_vtanh_f32(float32_t * pSrc, float32_t * pDst, uint32_t blockSize);
+
+void ref_atan2_f32(float32_t * pSrcY, float32_t * pSrcX, float32_t * pDst, uint32_t blockSize);
+
+void ref_atan2_q31(q31_t * pSrcY, q31_t * pSrcX, q31_t * pDst, uint32_t blockSize);
+
+void ref_atan2_q15(q15_t * pSrcY, q15_t * pSrcX, q15_t * pDst, uint32_t blockSize);
+
 	/*
 	 * Filtering Functions
 	 */
@@ -929,6 +941,24 @@ void ref_fir_interpolate_q15(
   q15_t * pDst,
   uint32_t blockSize);
 
+uint32_t ref_fir_resample_f32(
+	float32_t * pCoeffs,
+	uint16_t numTaps,
+	uint16_t L,
+	uint16_t M,
+	float32_t * pSrc,
+	float32_t * pDst,
+	uint32_t srcLen);
+
+uint32_t ref_fir_resample_q15(
+	q15_t * pCoeffs,
+	uint16_t numTaps,
+	uint16_t L,
+	uint16_t M,
+	q15_t * pSrc,
+	q15_t * pDst,
+	uint32_t srcLen);
+
 	/*
 	 * Matrix Functions
 	 */
@@ -955,6 +985,44 @@ arm_status ref_mat_inverse_f64(
   const arm_matrix_instance_f64 * pSrc,
   arm_matrix_instance_f64 * pDst);
 
+arm_status ref_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst);
+
+arm_status ref_mat_cholesky_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst);
+
+arm_status ref_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst,
+  float32_t * pD);
+
+arm_status ref_mat_ldlt_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst,
+  float64_t * pD);
+
+arm_status ref_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcL,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+arm_status ref_mat_solve_lower_triangular_f64(
+  const arm_matrix_instance_f64 * pSrcL,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst);
+
+arm_status ref_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcU,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+arm_status ref_mat_solve_upper_triangular_f64(
+  const arm_matrix_instance_f64 * pSrcU,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst);
+
 arm_status ref_mat_mult_f32(
   const arm_matrix_instance_f32 * pSrcA,
   const arm_matrix_instance_f32 * pSrcB,
@@ -1175,6 +1243,55 @@ void ref_var_q15(
   uint32_t blockSize,
   q15_t * pResult);
 
+void ref_median_filter_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  float32_t * pWindow,
+  uint32_t blockSize,
+  uint16_t windowLen);
+
+void ref_median_filter_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  q31_t * pWindow,
+  uint32_t blockSize,
+  uint16_t windowLen);
+
+void ref_median_filter_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  q15_t * pWindow,
+  uint32_t blockSize,
+  uint16_t windowLen);
+
+void ref_percentile_f32(
+  float32_t * pSrc,
+  float32_t * pScratch,
+  uint32_t blockSize,
+  float32_t percentile,
+  float32_t * pResult);
+
+void ref_percentile_q31(
+  q31_t * pSrc,
+  q31_t * pScratch,
+  uint32_t blockSize,
+  q31_t percentile,
+  q31_t * pResult);
+
+void ref_percentile_q15(
+  q15_t * pSrc,
+  q15_t * pScratch,
+  uint32_t blockSize,
+  q15_t percentile,
+  q15_t * pResult);
+
+void ref_percentile_q7(
+  q7_t * pSrc,
+  q7_t * pScratch,
+  uint32_t blockSize,
+  q7_t percentile,
+  q7_t * pResult);
+
 	/*
 	 * Support Functions
 	 */
@@ -1218,6 +1335,26 @@ void ref_fill_q7(
   q7_t * pDst,
   uint32_t blockSize);
 
+void ref_sort_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+void ref_sort_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+void ref_sort_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+void ref_sort_q7(
+  q7_t * pSrc,
+  q7_t * pDst,
+  uint32_t blockSize);
+
 void ref_q31_to_q15(
   q31_t * pSrc,
   q15_t * pDst,
@@ -1338,6 +1475,15 @@ void ref_rfft_fast_f32(
 	float32_t * p, float32_t * pOut,
 	uint8_t ifftFlag);
 
+void ref_spectrum_f32(
+	float32_t * pSrc,
+	uint32_t numFrames,
+	uint16_t fftLen,
+	uint16_t hopSize,
+	const float32_t * pWindow,
+	uint8_t average,
+	float32_t * pDst);
+
 void ref_rfft_q31(
   const arm_rfft_instance_q31 * S,
   q31_t * pSrc,
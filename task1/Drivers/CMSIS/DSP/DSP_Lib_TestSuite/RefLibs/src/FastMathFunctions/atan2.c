@@ -0,0 +1,33 @@
+#include "ref.h"
+
+void ref_atan2_f32(float32_t * pSrcY, float32_t * pSrcX, float32_t * pDst, uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		pDst[i] = (float32_t)atan2((float64_t)pSrcY[i], (float64_t)pSrcX[i]);
+	}
+}
+
+void ref_atan2_q31(q31_t * pSrcY, q31_t * pSrcX, q31_t * pDst, uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		/* +pi wraps to -pi */
+		pDst[i] = (q31_t)(uint32_t)(int64_t)floor(atan2((float64_t)pSrcY[i], (float64_t)pSrcX[i]) / 3.14159265358979323846 * 2147483648.0 + 0.5);
+	}
+}
+
+void ref_atan2_q15(q15_t * pSrcY, q15_t * pSrcX, q15_t * pDst, uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		/* +pi wraps to -pi */
+		pDst[i] = (q15_t)(int32_t)floor(atan2((float64_t)pSrcY[i], (float64_t)pSrcX[i]) / 3.14159265358979323846 * 32768.0 + 0.5);
+	}
+}
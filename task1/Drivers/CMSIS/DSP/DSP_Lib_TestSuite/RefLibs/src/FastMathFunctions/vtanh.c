@@ -0,0 +1,11 @@
+#include "ref.h"
+
+void ref_vtanh_f32(float32_t * pSrc, float32_t * pDst, uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		pDst[i] = (float32_t)tanh((float64_t)pSrc[i]);
+	}
+}
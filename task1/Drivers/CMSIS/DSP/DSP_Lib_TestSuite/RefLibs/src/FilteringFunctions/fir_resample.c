@@ -0,0 +1,62 @@
+#include "ref.h"
+
+/*
+ * The reference resamplers filter the whole input at once, straight from the
+ * definition: the input is upsampled by L with zeros, convolved with the filter
+ * and every M-th sample is kept. pCoeffs is in time reversed order.
+ */
+
+uint32_t ref_fir_resample_f32(
+	float32_t * pCoeffs,
+	uint16_t numTaps,
+	uint16_t L,
+	uint16_t M,
+	float32_t * pSrc,
+	float32_t * pDst,
+	uint32_t srcLen)
+{
+	uint32_t t, k, outCnt = 0;
+	float32_t acc;
+
+	for (t = 0; t < srcLen * L; t += M)
+	{
+		acc = 0.0f;
+
+		/* Only the taps that land on a non-zero upsampled sample contribute */
+		for (k = t % L; k < numTaps && k <= t; k += L)
+		{
+			acc += pCoeffs[numTaps - 1 - k] * pSrc[(t - k) / L];
+		}
+
+		pDst[outCnt++] = acc;
+	}
+
+	return outCnt;
+}
+
+uint32_t ref_fir_resample_q15(
+	q15_t * pCoeffs,
+	uint16_t numTaps,
+	uint16_t L,
+	uint16_t M,
+	q15_t * pSrc,
+	q15_t * pDst,
+	uint32_t srcLen)
+{
+	uint32_t t, k, outCnt = 0;
+	q63_t acc;
+
+	for (t = 0; t < srcLen * L; t += M)
+	{
+		acc = 0;
+
+		for (k = t % L; k < numTaps && k <= t; k += L)
+		{
+			acc += (q31_t)pCoeffs[numTaps - 1 - k] * pSrc[(t - k) / L];
+		}
+
+		pDst[outCnt++] = ref_sat_q15((q31_t)(acc >> 15));
+	}
+
+	return outCnt;
+}
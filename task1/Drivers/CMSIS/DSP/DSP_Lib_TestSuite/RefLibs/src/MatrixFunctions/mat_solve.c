@@ -0,0 +1,121 @@
+#include "ref.h"
+
+arm_status ref_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcL,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+	uint32_t r,c,k;
+	uint32_t n = pSrcL->numRows;
+	uint32_t numC = pSrcB->numCols;
+	float32_t sum;
+	
+	for(c=0;c<numC;c++)
+	{
+		for(r=0;r<n;r++)
+		{
+			if(pSrcL->pData[r*n + r] == 0)
+			{
+				return ARM_MATH_SINGULAR;
+			}
+			sum = pSrcB->pData[r*numC + c];
+			for(k=0;k<r;k++)
+			{
+				sum -= pSrcL->pData[r*n + k] * pDst->pData[k*numC + c];
+			}
+			pDst->pData[r*numC + c] = sum / pSrcL->pData[r*n + r];
+		}
+	}
+	
+	return ARM_MATH_SUCCESS;
+}
+
+arm_status ref_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcU,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+	uint32_t r,c,k;
+	uint32_t n = pSrcU->numRows;
+	uint32_t numC = pSrcB->numCols;
+	float32_t sum;
+	
+	for(c=0;c<numC;c++)
+	{
+		for(r=n;r>0;r--)
+		{
+			if(pSrcU->pData[(r-1)*n + r-1] == 0)
+			{
+				return ARM_MATH_SINGULAR;
+			}
+			sum = pSrcB->pData[(r-1)*numC + c];
+			for(k=r;k<n;k++)
+			{
+				sum -= pSrcU->pData[(r-1)*n + k] * pDst->pData[k*numC + c];
+			}
+			pDst->pData[(r-1)*numC + c] = sum / pSrcU->pData[(r-1)*n + r-1];
+		}
+	}
+	
+	return ARM_MATH_SUCCESS;
+}
+
+arm_status ref_mat_solve_lower_triangular_f64(
+  const arm_matrix_instance_f64 * pSrcL,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst)
+{
+	uint64_t r,c,k;
+	uint64_t n = pSrcL->numRows;
+	uint64_t numC = pSrcB->numCols;
+	float64_t sum;
+	
+	for(c=0;c<numC;c++)
+	{
+		for(r=0;r<n;r++)
+		{
+			if(pSrcL->pData[r*n + r] == 0)
+			{
+				return ARM_MATH_SINGULAR;
+			}
+			sum = pSrcB->pData[r*numC + c];
+			for(k=0;k<r;k++)
+			{
+				sum -= pSrcL->pData[r*n + k] * pDst->pData[k*numC + c];
+			}
+			pDst->pData[r*numC + c] = sum / pSrcL->pData[r*n + r];
+		}
+	}
+	
+	return ARM_MATH_SUCCESS;
+}
+
+arm_status ref_mat_solve_upper_triangular_f64(
+  const arm_matrix_instance_f64 * pSrcU,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst)
+{
+	uint64_t r,c,k;
+	uint64_t n = pSrcU->numRows;
+	uint64_t numC = pSrcB->numCols;
+	float64_t sum;
+	
+	for(c=0;c<numC;c++)
+	{
+		for(r=n;r>0;r--)
+		{
+			if(pSrcU->pData[(r-1)*n + r-1] == 0)
+			{
+				return ARM_MATH_SINGULAR;
+			}
+			sum = pSrcB->pData[(r-1)*numC + c];
+			for(k=r;k<n;k++)
+			{
+				sum -= pSrcU->pData[(r-1)*n + k] * pDst->pData[k*numC + c];
+			}
+			pDst->pData[(r-1)*numC + c] = sum / pSrcU->pData[(r-1)*n + r-1];
+		}
+	}
+	
+	return ARM_MATH_SUCCESS;
+}
@@ -0,0 +1,90 @@
+#include "ref.h"
+
+/*
+ * The reference sorts are insertion sorts, the usual hand-written sort of a
+ * small window. They also serve as the baseline of the sort benchmarks.
+ */
+
+void ref_sort_f32(
+	float32_t * pSrc,
+	float32_t * pDst,
+	uint32_t blockSize)
+{
+	uint32_t i, j;
+	float32_t in;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		in = pSrc[i];
+
+		for (j = i; j > 0 && pDst[j - 1] > in; j--)
+		{
+			pDst[j] = pDst[j - 1];
+		}
+
+		pDst[j] = in;
+	}
+}
+
+void ref_sort_q31(
+	q31_t * pSrc,
+	q31_t * pDst,
+	uint32_t blockSize)
+{
+	uint32_t i, j;
+	q31_t in;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		in = pSrc[i];
+
+		for (j = i; j > 0 && pDst[j - 1] > in; j--)
+		{
+			pDst[j] = pDst[j - 1];
+		}
+
+		pDst[j] = in;
+	}
+}
+
+void ref_sort_q15(
+	q15_t * pSrc,
+	q15_t * pDst,
+	uint32_t blockSize)
+{
+	uint32_t i, j;
+	q15_t in;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		in = pSrc[i];
+
+		for (j = i; j > 0 && pDst[j - 1] > in; j--)
+		{
+			pDst[j] = pDst[j - 1];
+		}
+
+		pDst[j] = in;
+	}
+}
+
+void ref_sort_q7(
+	q7_t * pSrc,
+	q7_t * pDst,
+	uint32_t blockSize)
+{
+	uint32_t i, j;
+	q7_t in;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		in = pSrc[i];
+
+		for (j = i; j > 0 && pDst[j - 1] > in; j--)
+		{
+			pDst[j] = pDst[j - 1];
+		}
+
+		pDst[j] = in;
+	}
+}
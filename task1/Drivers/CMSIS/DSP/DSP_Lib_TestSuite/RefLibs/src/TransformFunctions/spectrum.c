@@ -0,0 +1,59 @@
+#include "ref.h"
+
+void ref_spectrum_f32(
+	float32_t * pSrc,
+	uint32_t numFrames,
+	uint16_t fftLen,
+	uint16_t hopSize,
+	const float32_t * pWindow,
+	uint8_t average,
+	float32_t * pDst)
+{
+	uint32_t frame, k, n;
+	float64_t energy = 0.0, re, im, x, power, sum;
+	const float64_t w0 = 6.28318530717958647692 / fftLen;
+
+	for (n = 0; n < fftLen; n++)
+	{
+		energy += (float64_t)pWindow[n] * pWindow[n];
+	}
+
+	for (k = 0; k <= fftLen / 2; k++)
+	{
+		sum = 0.0;
+
+		for (frame = 0; frame < numFrames; frame++)
+		{
+			/* DFT of the windowed frame */
+			re = 0.0;
+			im = 0.0;
+			for (n = 0; n < fftLen; n++)
+			{
+				x = (float64_t)pSrc[frame * hopSize + n] * pWindow[n];
+				re += x * cos(w0 * ((n * k) % fftLen));
+				im -= x * sin(w0 * ((n * k) % fftLen));
+			}
+
+			/* One-sided density: the complex bins are counted twice */
+			power = (re * re + im * im) / energy;
+			if ((k != 0) && (k != fftLen / 2))
+			{
+				power *= 2.0;
+			}
+
+			if (average)
+			{
+				sum += power;
+			}
+			else
+			{
+				pDst[frame * (fftLen / 2 + 1) + k] = (float32_t)power;
+			}
+		}
+
+		if (average)
+		{
+			pDst[k] = (float32_t)(sum / numFrames);
+		}
+	}
+}
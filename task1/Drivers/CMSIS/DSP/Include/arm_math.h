@@ -131,6 +131,17 @@
    * Define macro ARM_MATH_ARMV8MBL for building the library on Armv8-M Baseline target, ARM_MATH_ARMV8MML for building library
    * on Armv8-M Mainline target.
    *
+   * - ARM_MATH_HOST:
+   *
+   * Define macro ARM_MATH_HOST for building the library with GCC or Clang on a host computer, for offline processing and
+   * regression testing. The library takes the Cortex-M4 code paths and the core and DSP intrinsics are replaced by C functions
+   * with the same results as the instructions, so fixed-point results match the Cortex-M4 bit for bit. Build with
+   * -fno-strict-aliasing, as the library reads pairs of 16-bit values through 32-bit pointers, and leave out
+   * arm_bitreversal2.S, which is replaced by C versions in arm_bitreversal.c. On x86 hosts
+   * arm_fir_f32, arm_dot_prod_f32/q31/q15/q7, arm_mat_mult_f32, arm_cfft_f32 and arm_biquad_cascade_df2T_f32 use SSE2,
+   * and AVX2 when built with -mavx2. Only arm_dot_prod_f32 changes the order of its floating-point additions, the other
+   * kernels give the same results as the C code.
+   *
    * - __FPU_PRESENT:
    *
    * Initialize macro __FPU_PRESENT = 1 when building on FPU supported Targets. Enable this macro for floating point libraries.
@@ -170,8 +181,10 @@
 /**
  * @defgroup groupFastMath Fast Math Functions
  * This set of functions provides a fast approximation to sine, cosine, and square root.
- * As compared to most of the other functions in the CMSIS math library, the fast math functions
+ * As compared to most of the other functions in the CMSIS math library, these fast math functions
  * operate on individual values and not arrays.
+ * The vector functions for exponential, natural logarithm, hyperbolic tangent, and four-quadrant
+ * arc tangent operate on arrays and are accurate to a few ULP.
  * There are separate functions for Q15, Q31, and floating-point data.
  *
  */
@@ -337,8 +350,91 @@
   #if (defined (__DSP_PRESENT) && (__DSP_PRESENT == 1))
     #define ARM_MATH_DSP
   #endif
+#elif defined (ARM_MATH_HOST)
+  #include <stdint.h>
+  #if defined (__SSE2__)
+    #include <immintrin.h>
+  #endif
+  #define ARM_MATH_DSP
+  #ifndef __FPU_USED
+    #define __FPU_USED              1U
+  #endif
+  #ifndef __STATIC_INLINE
+    #define __STATIC_INLINE         static inline
+  #endif
+
+  /*
+   * @brief C version of CLZ for host builds
+   */
+  static inline uint8_t __CLZ(
+  uint32_t x)
+  {
+    return ((x == 0U) ? 32U : (uint8_t)__builtin_clz(x));
+  }
+
+  /*
+   * @brief C version of SSAT for host builds
+   */
+  static inline int32_t __SSAT(
+  int32_t val,
+  uint32_t sat)
+  {
+    if ((sat >= 1U) && (sat <= 32U))
+    {
+      const int32_t max = (int32_t)((1U << (sat - 1U)) - 1U);
+      const int32_t min = -1 - max;
+
+      if (val > max)
+      {
+        return (max);
+      }
+      else if (val < min)
+      {
+        return (min);
+      }
+    }
+    return (val);
+  }
+
+  /*
+   * @brief C version of USAT for host builds
+   */
+  static inline uint32_t __USAT(
+  int32_t val,
+  uint32_t sat)
+  {
+    if (sat <= 31U)
+    {
+      const uint32_t max = ((1U << sat) - 1U);
+
+      if (val > (int32_t)max)
+      {
+        return (max);
+      }
+      else if (val < 0)
+      {
+        return (0U);
+      }
+    }
+    return ((uint32_t)val);
+  }
+
+  /*
+   * @brief C version of ROR for host builds
+   */
+  static inline uint32_t __ROR(
+  uint32_t op1,
+  uint32_t op2)
+  {
+    op2 %= 32U;
+    if (op2 == 0U)
+    {
+      return (op1);
+    }
+    return ((op1 >> op2) | (op1 << (32U - op2)));
+  }
 #else
-  #error "Define according the used Cortex core ARM_MATH_CM7, ARM_MATH_CM4, ARM_MATH_CM3, ARM_MATH_CM0PLUS, ARM_MATH_CM0, ARM_MATH_ARMV8MBL, ARM_MATH_ARMV8MML"
+  #error "Define according the used Cortex core ARM_MATH_CM7, ARM_MATH_CM4, ARM_MATH_CM3, ARM_MATH_CM0PLUS, ARM_MATH_CM0, ARM_MATH_ARMV8MBL, ARM_MATH_ARMV8MML, or ARM_MATH_HOST"
 #endif
 
 #undef  __CMSIS_GENERIC         /* enable NVIC and Systick functions */
@@ -404,7 +500,8 @@ extern "C"
     ARM_MATH_SIZE_MISMATCH = -3,         /**< Size of matrices is not compatible with the operation. */
     ARM_MATH_NANINF = -4,                /**< Not-a-number (NaN) or infinity is generated */
     ARM_MATH_SINGULAR = -5,              /**< Generated by matrix inversion if the input matrix is singular and cannot be inverted. */
-    ARM_MATH_TEST_FAILURE = -6           /**< Test Failed  */
+    ARM_MATH_TEST_FAILURE = -6,          /**< Test Failed  */
+    ARM_MATH_DECOMPOSITION_FAILURE = -7  /**< Generated by matrix decompositions if the input matrix has no decomposition of the requested form. */
   } arm_status;
 
   /**
@@ -484,7 +581,7 @@ extern "C"
 #define _SIMD32_OFFSET(addr)  (*(__SIMD32_TYPE *)  (addr))
 #define __SIMD64(addr)        (*(int64_t **) & (addr))
 
-#if !defined (ARM_MATH_DSP)
+#if !defined (ARM_MATH_DSP) || defined (ARM_MATH_HOST)
   /**
    * @brief definition to pack two 16 bit values.
    */
@@ -493,7 +590,7 @@ extern "C"
 #define __PKHTB(ARG1, ARG2, ARG3) ( (((int32_t)(ARG1) <<    0) & (int32_t)0xFFFF0000) | \
                                     (((int32_t)(ARG2) >> ARG3) & (int32_t)0x0000FFFF)  )
 
-#endif /* !defined (ARM_MATH_DSP) */
+#endif /* !defined (ARM_MATH_DSP) || defined (ARM_MATH_HOST) */
 
    /**
    * @brief definition to pack four 8 bit values.
@@ -670,9 +767,11 @@ extern "C"
 
 
 /*
- * @brief C custom defined intrinsic function for M3 and M0 processors
+ * @brief C custom defined intrinsic function for M3 and M0 processors, and for host builds.
+ * Products and sums that can exceed 32 bits are evaluated in 64 bits and truncated,
+ * so the results wrap as those of the instructions do.
  */
-#if !defined (ARM_MATH_DSP)
+#if !defined (ARM_MATH_DSP) || defined (ARM_MATH_HOST)
 
   /*
    * @brief C custom defined QADD8 for M3 and M0 processors
@@ -846,8 +945,8 @@ extern "C"
   uint32_t x,
   uint32_t y)
   {
-    return ((uint32_t)(((((q31_t)x << 16) >> 16) * (((q31_t)y      ) >> 16)) -
-                       ((((q31_t)x      ) >> 16) * (((q31_t)y << 16) >> 16))   ));
+    return ((uint32_t)((q63_t)((((q31_t)x << 16) >> 16) * (((q31_t)y      ) >> 16)) -
+                       (q63_t)((((q31_t)x      ) >> 16) * (((q31_t)y << 16) >> 16))   ));
   }
 
   /*
@@ -857,8 +956,8 @@ extern "C"
   uint32_t x,
   uint32_t y)
   {
-    return ((uint32_t)(((((q31_t)x << 16) >> 16) * (((q31_t)y      ) >> 16)) +
-                       ((((q31_t)x      ) >> 16) * (((q31_t)y << 16) >> 16))   ));
+    return ((uint32_t)((q63_t)((((q31_t)x << 16) >> 16) * (((q31_t)y      ) >> 16)) +
+                       (q63_t)((((q31_t)x      ) >> 16) * (((q31_t)y << 16) >> 16))   ));
   }
 
 
@@ -892,9 +991,9 @@ extern "C"
   uint32_t y,
   uint32_t sum)
   {
-    return ((uint32_t)(((((q31_t)x << 16) >> 16) * (((q31_t)y << 16) >> 16)) +
-                       ((((q31_t)x      ) >> 16) * (((q31_t)y      ) >> 16)) +
-                       ( ((q31_t)sum    )                                  )   ));
+    return ((uint32_t)((q63_t)((((q31_t)x << 16) >> 16) * (((q31_t)y << 16) >> 16)) +
+                       (q63_t)((((q31_t)x      ) >> 16) * (((q31_t)y      ) >> 16)) +
+                       ( ((q63_t)(q31_t)sum)                               )   ));
   }
 
 
@@ -906,9 +1005,9 @@ extern "C"
   uint32_t y,
   uint32_t sum)
   {
-    return ((uint32_t)(((((q31_t)x << 16) >> 16) * (((q31_t)y      ) >> 16)) +
-                       ((((q31_t)x      ) >> 16) * (((q31_t)y << 16) >> 16)) +
-                       ( ((q31_t)sum    )                                  )   ));
+    return ((uint32_t)((q63_t)((((q31_t)x << 16) >> 16) * (((q31_t)y      ) >> 16)) +
+                       (q63_t)((((q31_t)x      ) >> 16) * (((q31_t)y << 16) >> 16)) +
+                       ( ((q63_t)(q31_t)sum)                               )   ));
   }
 
 
@@ -920,9 +1019,9 @@ extern "C"
   uint32_t y,
   uint32_t sum)
   {
-    return ((uint32_t)(((((q31_t)x << 16) >> 16) * (((q31_t)y      ) >> 16)) -
-                       ((((q31_t)x      ) >> 16) * (((q31_t)y << 16) >> 16)) +
-                       ( ((q31_t)sum    )                                  )   ));
+    return ((uint32_t)((q63_t)((((q31_t)x << 16) >> 16) * (((q31_t)y      ) >> 16)) -
+                       (q63_t)((((q31_t)x      ) >> 16) * (((q31_t)y << 16) >> 16)) +
+                       ( ((q63_t)(q31_t)sum)                               )   ));
   }
 
 
@@ -935,8 +1034,8 @@ extern "C"
   uint64_t sum)
   {
 /*  return (sum + ((q15_t) (x >> 16) * (q15_t) (y >> 16)) + ((q15_t) x * (q15_t) y)); */
-    return ((uint64_t)(((((q31_t)x << 16) >> 16) * (((q31_t)y << 16) >> 16)) +
-                       ((((q31_t)x      ) >> 16) * (((q31_t)y      ) >> 16)) +
+    return ((uint64_t)((q63_t)((((q31_t)x << 16) >> 16) * (((q31_t)y << 16) >> 16)) +
+                       (q63_t)((((q31_t)x      ) >> 16) * (((q31_t)y      ) >> 16)) +
                        ( ((q63_t)sum    )                                  )   ));
   }
 
@@ -950,8 +1049,8 @@ extern "C"
   uint64_t sum)
   {
 /*  return (sum + ((q15_t) (x >> 16) * (q15_t) y)) + ((q15_t) x * (q15_t) (y >> 16)); */
-    return ((uint64_t)(((((q31_t)x << 16) >> 16) * (((q31_t)y      ) >> 16)) +
-                       ((((q31_t)x      ) >> 16) * (((q31_t)y << 16) >> 16)) +
+    return ((uint64_t)((q63_t)((((q31_t)x << 16) >> 16) * (((q31_t)y      ) >> 16)) +
+                       (q63_t)((((q31_t)x      ) >> 16) * (((q31_t)y << 16) >> 16)) +
                        ( ((q63_t)sum    )                                  )   ));
   }
 
@@ -963,8 +1062,8 @@ extern "C"
   uint32_t x,
   uint32_t y)
   {
-    return ((uint32_t)(((((q31_t)x << 16) >> 16) * (((q31_t)y << 16) >> 16)) +
-                       ((((q31_t)x      ) >> 16) * (((q31_t)y      ) >> 16))   ));
+    return ((uint32_t)((q63_t)((((q31_t)x << 16) >> 16) * (((q31_t)y << 16) >> 16)) +
+                       (q63_t)((((q31_t)x      ) >> 16) * (((q31_t)y      ) >> 16))   ));
   }
 
 
@@ -975,8 +1074,8 @@ extern "C"
   uint32_t x,
   uint32_t y)
   {
-    return ((uint32_t)(((((q31_t)x << 16) >> 16) * (((q31_t)y << 16) >> 16)) -
-                       ((((q31_t)x      ) >> 16) * (((q31_t)y      ) >> 16))   ));
+    return ((uint32_t)((q63_t)((((q31_t)x << 16) >> 16) * (((q31_t)y << 16) >> 16)) -
+                       (q63_t)((((q31_t)x      ) >> 16) * (((q31_t)y      ) >> 16))   ));
   }
 
 
@@ -998,10 +1097,10 @@ extern "C"
   int32_t y,
   int32_t sum)
   {
-    return (sum + (int32_t) (((int64_t) x * y) >> 32));
+    return ((int32_t)((uint32_t)sum + (uint32_t)(((int64_t) x * y) >> 32)));
   }
 
-#endif /* !defined (ARM_MATH_DSP) */
+#endif /* !defined (ARM_MATH_DSP) || defined (ARM_MATH_HOST) */
 
 
   /**
@@ -1194,6 +1293,139 @@ extern "C"
   float32_t * pState,
   uint32_t blockSize);
 
+  /**
+   * @brief Instance structure for the Q15 multichannel FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numChans;        /**< number of interleaved channels. */
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint32_t maxBlockSize;    /**< maximum number of frames processed per call. Each delay line is of length numTaps+maxBlockSize-1. */
+    q15_t *pState;            /**< points to the state variable array. The array is of length numChans*(numTaps+maxBlockSize-1). */
+    q15_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_mc_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 multichannel FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numChans;        /**< number of interleaved channels. */
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint32_t maxBlockSize;    /**< maximum number of frames processed per call. Each delay line is of length numTaps+maxBlockSize-1. */
+    q31_t *pState;            /**< points to the state variable array. The array is of length numChans*(numTaps+maxBlockSize-1). */
+    q31_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_mc_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point multichannel FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numChans;        /**< number of interleaved channels. */
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint32_t maxBlockSize;    /**< maximum number of frames processed per call. Each delay line is of length numTaps+maxBlockSize-1. */
+    float32_t *pState;        /**< points to the state variable array. The array is of length numChans*(numTaps+maxBlockSize-1). */
+    float32_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_mc_instance_f32;
+
+
+  /**
+   * @brief Processing function for the Q15 multichannel FIR filter.
+   * @param[in]  S          points to an instance of the Q15 multichannel FIR structure.
+   * @param[in]  pSrc       points to the block of interleaved input frames.
+   * @param[out] pDst       points to the block of interleaved output frames.
+   * @param[in]  blockSize  number of frames to process.
+   */
+  void arm_fir_mc_q15(
+  const arm_fir_mc_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 multichannel FIR filter.
+   * @param[in,out] S          points to an instance of the Q15 multichannel FIR structure.
+   * @param[in]     numChans   number of interleaved channels.
+   * @param[in]     numTaps    Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  maximum number of frames that are processed at a time.
+   */
+  void arm_fir_mc_init_q15(
+  arm_fir_mc_instance_q15 * S,
+  uint16_t numChans,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q31 multichannel FIR filter.
+   * @param[in]  S          points to an instance of the Q31 multichannel FIR structure.
+   * @param[in]  pSrc       points to the block of interleaved input frames.
+   * @param[out] pDst       points to the block of interleaved output frames.
+   * @param[in]  blockSize  number of frames to process.
+   */
+  void arm_fir_mc_q31(
+  const arm_fir_mc_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 multichannel FIR filter.
+   * @param[in,out] S          points to an instance of the Q31 multichannel FIR structure.
+   * @param[in]     numChans   number of interleaved channels.
+   * @param[in]     numTaps    Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  maximum number of frames that are processed at a time.
+   */
+  void arm_fir_mc_init_q31(
+  arm_fir_mc_instance_q31 * S,
+  uint16_t numChans,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the floating-point multichannel FIR filter.
+   * @param[in]  S          points to an instance of the floating-point multichannel FIR structure.
+   * @param[in]  pSrc       points to the block of interleaved input frames.
+   * @param[out] pDst       points to the block of interleaved output frames.
+   * @param[in]  blockSize  number of frames to process.
+   */
+  void arm_fir_mc_f32(
+  const arm_fir_mc_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point multichannel FIR filter.
+   * @param[in,out] S          points to an instance of the floating-point multichannel FIR structure.
+   * @param[in]     numChans   number of interleaved channels.
+   * @param[in]     numTaps    Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  maximum number of frames that are processed at a time.
+   */
+  void arm_fir_mc_init_f32(
+  arm_fir_mc_instance_f32 * S,
+  uint16_t numChans,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+
 
   /**
    * @brief Instance structure for the Q15 Biquad cascade filter.
@@ -1315,6 +1547,93 @@ extern "C"
   q31_t * pState,
   int8_t postShift);
 
+  /**
+   * @brief Instance structure for the Q15 multichannel Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint16_t numChans;       /**< number of interleaved channels. */
+    int8_t numStages;        /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    int8_t postShift;        /**< Additional shift, in bits, applied to each output sample. */
+    q15_t *pState;           /**< Points to the array of state coefficients.  The array is of length 4*numStages*numChans. */
+    q15_t *pCoeffs;          /**< Points to the array of coefficients.  The array is of length 6*numStages. */
+  } arm_biquad_cascade_mc_df1_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 multichannel Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint16_t numChans;       /**< number of interleaved channels. */
+    uint8_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint8_t postShift;       /**< Additional shift, in bits, applied to each output sample. */
+    q31_t *pState;           /**< Points to the array of state coefficients.  The array is of length 4*numStages*numChans. */
+    q31_t *pCoeffs;          /**< Points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_mc_df1_instance_q31;
+
+
+  /**
+   * @brief Processing function for the Q15 Biquad cascade filter. Interleaved channels
+   * @param[in]  S          points to an instance of the Q15 multichannel Biquad cascade structure.
+   * @param[in]  pSrc       points to the block of interleaved input frames.
+   * @param[out] pDst       points to the block of interleaved output frames.
+   * @param[in]  blockSize  number of frames to process.
+   */
+  void arm_biquad_cascade_mc_df1_q15(
+  const arm_biquad_cascade_mc_df1_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 Biquad cascade filter. Interleaved channels
+   * @param[in,out] S          points to an instance of the Q15 multichannel Biquad cascade structure.
+   * @param[in]     numChans   number of interleaved channels.
+   * @param[in]     numStages  number of 2nd order stages in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     postShift  Shift to be applied to the output. Varies according to the coefficients format
+   */
+  void arm_biquad_cascade_mc_df1_init_q15(
+  arm_biquad_cascade_mc_df1_instance_q15 * S,
+  uint16_t numChans,
+  uint8_t numStages,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  int8_t postShift);
+
+  /**
+   * @brief Processing function for the Q31 Biquad cascade filter. Interleaved channels
+   * @param[in]  S          points to an instance of the Q31 multichannel Biquad cascade structure.
+   * @param[in]  pSrc       points to the block of interleaved input frames.
+   * @param[out] pDst       points to the block of interleaved output frames.
+   * @param[in]  blockSize  number of frames to process.
+   */
+  void arm_biquad_cascade_mc_df1_q31(
+  const arm_biquad_cascade_mc_df1_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 Biquad cascade filter. Interleaved channels
+   * @param[in,out] S          points to an instance of the Q31 multichannel Biquad cascade structure.
+   * @param[in]     numChans   number of interleaved channels.
+   * @param[in]     numStages  number of 2nd order stages in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     postShift  Shift to be applied to the output. Varies according to the coefficients format
+   */
+  void arm_biquad_cascade_mc_df1_init_q31(
+  arm_biquad_cascade_mc_df1_instance_q31 * S,
+  uint16_t numChans,
+  uint8_t numStages,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  int8_t postShift);
+
 
   /**
    * @brief Processing function for the floating-point Biquad cascade filter.
@@ -1581,6 +1900,55 @@ extern "C"
   arm_matrix_instance_q31 * pDst);
 
 
+  /**
+   * @brief Floating-point matrix multiplication (register-tiled variant)
+   * @param[in]  pSrcA   points to the first input matrix structure
+   * @param[in]  pSrcB   points to the second input matrix structure
+   * @param[out] pDst    points to output matrix structure
+   * @param[in]  pState  points to the array for storing a packed panel of pSrcB, of size 4 * numColsA
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+  arm_status arm_mat_mult_tiled_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst,
+  float32_t * pState);
+
+
+  /**
+   * @brief Q15 matrix multiplication (register-tiled variant)
+   * @param[in]  pSrcA   points to the first input matrix structure
+   * @param[in]  pSrcB   points to the second input matrix structure
+   * @param[out] pDst    points to output matrix structure
+   * @param[in]  pState  points to the word aligned array for storing a packed panel of pSrcB,
+   *                     of size 2 * numColsA rounded up to a multiple of 4
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+  arm_status arm_mat_mult_tiled_q15(
+  const arm_matrix_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB,
+  arm_matrix_instance_q15 * pDst,
+  q15_t * pState);
+
+
+  /**
+   * @brief Q31 matrix multiplication (register-tiled variant)
+   * @param[in]  pSrcA   points to the first input matrix structure
+   * @param[in]  pSrcB   points to the second input matrix structure
+   * @param[out] pDst    points to output matrix structure
+   * @param[in]  pState  points to the array for storing a packed panel of pSrcB, of size 2 * numColsA
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+  arm_status arm_mat_mult_tiled_q31(
+  const arm_matrix_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+  arm_matrix_instance_q31 * pDst,
+  q31_t * pState);
+
+
   /**
    * @brief Floating-point matrix subtraction
    * @param[in]  pSrcA  points to the first input matrix structure
@@ -2229,6 +2597,141 @@ void arm_rfft_fast_f32(
   float32_t * p, float32_t * pOut,
   uint8_t ifftFlag);
 
+  /**
+   * @brief Instance structure for the floating-point streaming spectrum estimator.
+   */
+  typedef struct
+  {
+    arm_rfft_fast_instance_f32 rfft;     /**< real FFT of the frames. */
+    uint16_t fftLen;                     /**< length of each frame. */
+    uint16_t hopSize;                    /**< number of samples between the starts of consecutive frames. */
+    const float32_t *pWindow;            /**< points to the window of length fftLen. */
+    float32_t *pState;                   /**< points to the circular buffer of the last fftLen samples. */
+    float32_t *pScratch;                 /**< points to the scratch buffer of length 2*fftLen. */
+    float32_t *pAccum;                   /**< points to the accumulator of length fftLen/2+1. */
+    uint32_t stateIndex;                 /**< position of the oldest sample in the circular buffer. */
+    uint32_t pending;                    /**< number of samples still needed to complete the next frame. */
+    uint32_t numFrames;                  /**< number of frames in the accumulator. */
+    float32_t scale;                     /**< reciprocal of the window energy. */
+  } arm_spectrum_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point streaming spectrum estimator.
+   * @param[in,out] *S         points to an instance of the spectrum estimator structure.
+   * @param[in]     fftLen     length of each frame.
+   * @param[in]     overlap    number of samples shared by consecutive frames.
+   * @param[in]     *pWindow   points to the window of length fftLen.
+   * @param[in]     *pState    points to the state buffer of length fftLen.
+   * @param[in]     *pScratch  points to the scratch buffer of length 2*fftLen.
+   * @param[in]     *pAccum    points to the accumulator of length fftLen/2+1, or NULL.
+   * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_spectrum_init_f32(
+  arm_spectrum_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t overlap,
+  const float32_t * pWindow,
+  float32_t * pState,
+  float32_t * pScratch,
+  float32_t * pAccum);
+
+  /**
+   * @brief  Generates a periodic Hann window.
+   * @param[out]    *pDst    points to the window of length fftLen.
+   * @param[in]     fftLen   length of the window.
+   * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_spectrum_hann_f32(
+  float32_t * pDst,
+  uint16_t fftLen);
+
+  /**
+   * @brief  Pushes samples into the Welch power spectrum estimator.
+   * @param[in,out] *S          points to an instance of the spectrum estimator structure.
+   * @param[in]     *pSrc       points to the block of input samples.
+   * @param[in]     blockSize   number of samples in the block.
+   * @return        number of frames added to the accumulator.
+   */
+  uint32_t arm_spectrum_welch_f32(
+  arm_spectrum_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Returns the Welch power spectral density and restarts the average.
+   * @param[in,out] *S      points to an instance of the spectrum estimator structure.
+   * @param[out]    *pDst   points to the power spectral density of length fftLen/2+1.
+   * @return        number of frames in the average.
+   */
+  uint32_t arm_spectrum_psd_f32(
+  arm_spectrum_instance_f32 * S,
+  float32_t * pDst);
+
+  /**
+   * @brief  Pushes samples into the short-time power spectrum estimator.
+   * @param[in,out] *S          points to an instance of the spectrum estimator structure.
+   * @param[in]     *pSrc       points to the block of input samples.
+   * @param[in]     blockSize   number of samples in the block.
+   * @param[out]    *pDst       points to the output frames of fftLen/2+1 bins each.
+   * @return        number of frames written.
+   */
+  uint32_t arm_spectrum_stft_f32(
+  arm_spectrum_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pDst);
+
+
+  /**
+   * @brief Instance structure for the floating-point FFT-based FIR filter.
+   */
+  typedef struct
+  {
+    arm_rfft_fast_instance_f32 rfft;  /**< real FFT of length 2*blockSize. */
+    uint16_t numTaps;                 /**< number of filter coefficients in the filter. */
+    uint16_t blockSize;               /**< partition length. */
+    uint16_t numParts;                /**< number of partitions. */
+    uint16_t partIndex;               /**< position of the newest input spectrum in the delay line. */
+    const float32_t *pCoeffsFreq;     /**< points to the partition spectra. The array is of length 2*numParts*blockSize. */
+    float32_t *pState;                /**< points to the state variable array. The array is of length (2*numParts+1)*blockSize. */
+    float32_t *pScratch;              /**< points to the scratch array. The array is of length 4*blockSize. */
+  } arm_fir_fft_instance_f32;
+
+
+  /**
+   * @brief Processing function for the floating-point FFT-based FIR filter.
+   * @param[in,out] S          points to an instance of the floating-point FFT-based FIR filter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process, a multiple of the partition length.
+   */
+  void arm_fir_fft_f32(
+  arm_fir_fft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point FFT-based FIR filter.
+   * @param[in,out] S            points to an instance of the floating-point FFT-based FIR filter structure.
+   * @param[in]     numTaps      Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs      points to the filter coefficients.
+   * @param[out]    pCoeffsFreq  points to the partition spectra.
+   * @param[in]     pState       points to the state buffer.
+   * @param[in]     pScratch     points to the scratch buffer.
+   * @param[in]     blockSize    partition length.
+   * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_fir_fft_init_f32(
+  arm_fir_fft_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pCoeffsFreq,
+  float32_t * pState,
+  float32_t * pScratch,
+  uint32_t blockSize);
+
   /**
    * @brief Instance structure for the floating-point DCT4/IDCT4 function.
    */
@@ -2857,33 +3360,87 @@ void arm_rfft_fast_f32(
    * @param[out] pDst       output pointer
    * @param[in]  blockSize  number of samples to process
    */
-  void arm_fill_q7(
-  q7_t value,
-  q7_t * pDst,
+  void arm_fill_q7(
+  q7_t value,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Fills a constant value into a Q15 vector.
+   * @param[in]  value      input value to be filled
+   * @param[out] pDst       output pointer
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_fill_q15(
+  q15_t value,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Fills a constant value into a Q31 vector.
+   * @param[in]  value      input value to be filled
+   * @param[out] pDst       output pointer
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_fill_q31(
+  q31_t value,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Sorts the elements of a floating-point vector in ascending order.
+   * @param[in]  pSrc       input pointer
+   * @param[out] pDst       output pointer
+   * @param[in]  pScratch   scratch buffer of blockSize samples, used for long vectors only
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_sort_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  float32_t * pScratch,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Sorts the elements of a Q31 vector in ascending order.
+   * @param[in]  pSrc       input pointer
+   * @param[out] pDst       output pointer
+   * @param[in]  pScratch   scratch buffer of blockSize samples, used for long vectors only
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_sort_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  q31_t * pScratch,
   uint32_t blockSize);
 
 
   /**
-   * @brief  Fills a constant value into a Q15 vector.
-   * @param[in]  value      input value to be filled
+   * @brief  Sorts the elements of a Q15 vector in ascending order.
+   * @param[in]  pSrc       input pointer
    * @param[out] pDst       output pointer
+   * @param[in]  pScratch   scratch buffer of blockSize samples, used for long vectors only
    * @param[in]  blockSize  number of samples to process
    */
-  void arm_fill_q15(
-  q15_t value,
+  void arm_sort_q15(
+  q15_t * pSrc,
   q15_t * pDst,
+  q15_t * pScratch,
   uint32_t blockSize);
 
 
   /**
-   * @brief  Fills a constant value into a Q31 vector.
-   * @param[in]  value      input value to be filled
+   * @brief  Sorts the elements of a Q7 vector in ascending order.
+   * @param[in]  pSrc       input pointer
    * @param[out] pDst       output pointer
    * @param[in]  blockSize  number of samples to process
    */
-  void arm_fill_q31(
-  q31_t value,
-  q31_t * pDst,
+  void arm_sort_q7(
+  q7_t * pSrc,
+  q7_t * pDst,
   uint32_t blockSize);
 
 
@@ -3543,6 +4100,115 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief Instance structure for the Q15 polyphase resampler.
+   */
+  typedef struct
+  {
+    uint16_t L;                     /**< upsample factor. */
+    uint16_t M;                     /**< downsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    uint16_t phase;                 /**< polyphase component of the next output sample. */
+    uint32_t inputOffset;           /**< position of the next output sample in the next input block. */
+    q15_t *pCoeffs;                 /**< points to the per-phase coefficient array. The array is of length L*phaseLength. */
+    q15_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_instance_q15;
+
+  /**
+   * @brief Instance structure for the floating-point polyphase resampler.
+   */
+  typedef struct
+  {
+    uint16_t L;                     /**< upsample factor. */
+    uint16_t M;                     /**< downsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    uint16_t phase;                 /**< polyphase component of the next output sample. */
+    uint32_t inputOffset;           /**< position of the next output sample in the next input block. */
+    float32_t *pCoeffs;             /**< points to the per-phase coefficient array. The array is of length L*phaseLength. */
+    float32_t *pState;              /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_instance_f32;
+
+
+  /**
+   * @brief Processing function for the Q15 polyphase resampler.
+   * @param[in,out] S          points to an instance of the Q15 resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process.
+   * @return        number of output samples written.
+   */
+  uint32_t arm_fir_resample_q15(
+  arm_fir_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 polyphase resampler.
+   * @param[in,out] S             points to an instance of the Q15 resampler structure.
+   * @param[in]     L             upsample factor.
+   * @param[in]     M             downsample factor.
+   * @param[in]     numTaps       number of filter coefficients in the filter.
+   * @param[in]     pCoeffs       points to the filter coefficient buffer.
+   * @param[out]    pPhaseCoeffs  points to the per-phase coefficient buffer of length numTaps.
+   * @param[in]     pState        points to the state buffer.
+   * @param[in]     blockSize     maximum number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful, ARM_MATH_ARGUMENT_ERROR if
+   * <code>L</code> or <code>M</code> is zero, or ARM_MATH_LENGTH_ERROR if the filter length <code>numTaps</code>
+   * is not a multiple of <code>L</code>.
+   */
+  arm_status arm_fir_resample_init_q15(
+  arm_fir_resample_instance_q15 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pPhaseCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the floating-point polyphase resampler.
+   * @param[in,out] S          points to an instance of the floating-point resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process.
+   * @return        number of output samples written.
+   */
+  uint32_t arm_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point polyphase resampler.
+   * @param[in,out] S             points to an instance of the floating-point resampler structure.
+   * @param[in]     L             upsample factor.
+   * @param[in]     M             downsample factor.
+   * @param[in]     numTaps       number of filter coefficients in the filter.
+   * @param[in]     pCoeffs       points to the filter coefficient buffer.
+   * @param[out]    pPhaseCoeffs  points to the per-phase coefficient buffer of length numTaps.
+   * @param[in]     pState        points to the state buffer.
+   * @param[in]     blockSize     maximum number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful, ARM_MATH_ARGUMENT_ERROR if
+   * <code>L</code> or <code>M</code> is zero, or ARM_MATH_LENGTH_ERROR if the filter length <code>numTaps</code>
+   * is not a multiple of <code>L</code>.
+   */
+  arm_status arm_fir_resample_init_f32(
+  arm_fir_resample_instance_f32 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pPhaseCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+
   /**
    * @brief Instance structure for the high precision Q31 Biquad cascade filter.
    */
@@ -3603,6 +4269,17 @@ void arm_rfft_fast_f32(
     float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
   } arm_biquad_cascade_stereo_df2T_instance_f32;
 
+  /**
+   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter. Interleaved channels
+   */
+  typedef struct
+  {
+    uint16_t numChans;         /**< number of interleaved channels. */
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages*numChans. */
+    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_mc_df2T_instance_f32;
+
   /**
    * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
    */
@@ -3642,6 +4319,20 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter. Interleaved channels
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of interleaved input frames.
+   * @param[out] pDst       points to the block of interleaved output frames.
+   * @param[in]  blockSize  number of frames to process.
+   */
+  void arm_biquad_cascade_mc_df2T_f32(
+  const arm_biquad_cascade_mc_df2T_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
   /**
    * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
    * @param[in]  S          points to an instance of the filter data structure.
@@ -3684,6 +4375,22 @@ void arm_rfft_fast_f32(
   float32_t * pState);
 
 
+  /**
+   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter. Interleaved channels
+   * @param[in,out] S          points to an instance of the filter data structure.
+   * @param[in]     numChans   number of interleaved channels.
+   * @param[in]     numStages  number of 2nd order stages in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   */
+  void arm_biquad_cascade_mc_df2T_init_f32(
+  arm_biquad_cascade_mc_df2T_instance_f32 * S,
+  uint16_t numChans,
+  uint8_t numStages,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
+
   /**
    * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
    * @param[in,out] S          points to an instance of the filter data structure.
@@ -4925,6 +5632,114 @@ void arm_rfft_fast_f32(
   arm_matrix_instance_f64 * dst);
 
 
+  /**
+   * @brief Floating-point Cholesky decomposition.
+   * @param[in]  pSrc  points to the instance of the input symmetric positive definite matrix.
+   * @param[out] pDst  points to the instance of the output lower triangular matrix, which may be pSrc.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is not positive definite, then the algorithm terminates and returns error status ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Floating-point Cholesky decomposition.
+   * @param[in]  pSrc  points to the instance of the input symmetric positive definite matrix.
+   * @param[out] pDst  points to the instance of the output lower triangular matrix, which may be pSrc.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is not positive definite, then the algorithm terminates and returns error status ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_cholesky_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst);
+
+
+  /**
+   * @brief Floating-point LDLT decomposition.
+   * @param[in]  pSrc  points to the instance of the input symmetric matrix.
+   * @param[out] pDst  points to the instance of the output unit lower triangular matrix, which may be pSrc.
+   * @param[out] pD    points to the output array of numRows elements holding the diagonal of D.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a pivot is zero, then the algorithm terminates and returns error status ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst,
+  float32_t * pD);
+
+
+  /**
+   * @brief Floating-point LDLT decomposition.
+   * @param[in]  pSrc  points to the instance of the input symmetric matrix.
+   * @param[out] pDst  points to the instance of the output unit lower triangular matrix, which may be pSrc.
+   * @param[out] pD    points to the output array of numRows elements holding the diagonal of D.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a pivot is zero, then the algorithm terminates and returns error status ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_ldlt_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst,
+  float64_t * pD);
+
+
+  /**
+   * @brief Floating-point lower triangular solve.
+   * @param[in]  pSrcL  points to the instance of the lower triangular matrix.
+   * @param[in]  pSrcB  points to the instance of the right-hand side matrix.
+   * @param[out] pDst   points to the instance of the solution matrix, which may be pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of the triangular matrix is zero, then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcL,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Floating-point lower triangular solve.
+   * @param[in]  pSrcL  points to the instance of the lower triangular matrix.
+   * @param[in]  pSrcB  points to the instance of the right-hand side matrix.
+   * @param[out] pDst   points to the instance of the solution matrix, which may be pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of the triangular matrix is zero, then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_solve_lower_triangular_f64(
+  const arm_matrix_instance_f64 * pSrcL,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst);
+
+
+  /**
+   * @brief Floating-point upper triangular solve.
+   * @param[in]  pSrcU  points to the instance of the upper triangular matrix.
+   * @param[in]  pSrcB  points to the instance of the right-hand side matrix.
+   * @param[out] pDst   points to the instance of the solution matrix, which may be pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of the triangular matrix is zero, then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcU,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Floating-point upper triangular solve.
+   * @param[in]  pSrcU  points to the instance of the upper triangular matrix.
+   * @param[in]  pSrcB  points to the instance of the right-hand side matrix.
+   * @param[out] pDst   points to the instance of the solution matrix, which may be pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of the triangular matrix is zero, then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_solve_upper_triangular_f64(
+  const arm_matrix_instance_f64 * pSrcU,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst);
+
+
 
   /**
    * @ingroup groupController
@@ -5780,6 +6595,84 @@ void arm_rfft_fast_f32(
    */
 
 
+  /**
+   * @brief  Floating-point vector exponential.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in the vector
+   */
+  void arm_vexp_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Floating-point vector natural logarithm.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in the vector
+   */
+  void arm_vlog_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Floating-point vector hyperbolic tangent.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in the vector
+   */
+  void arm_vtanh_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Floating-point vector four-quadrant arc tangent.
+   * @param[in]  pSrcY      points to the input vector of ordinates
+   * @param[in]  pSrcX      points to the input vector of abscissas
+   * @param[out] pDst       points to the output vector of angles in radians
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_atan2_f32(
+  float32_t * pSrcY,
+  float32_t * pSrcX,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q31 vector four-quadrant arc tangent.
+   * @param[in]  pSrcY      points to the input vector of ordinates
+   * @param[in]  pSrcX      points to the input vector of abscissas
+   * @param[out] pDst       points to the output vector of angles divided by pi
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_atan2_q31(
+  q31_t * pSrcY,
+  q31_t * pSrcX,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q15 vector four-quadrant arc tangent.
+   * @param[in]  pSrcY      points to the input vector of ordinates
+   * @param[in]  pSrcX      points to the input vector of abscissas
+   * @param[out] pDst       points to the output vector of angles divided by pi
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_atan2_q15(
+  q15_t * pSrcY,
+  q15_t * pSrcX,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
   /**
    * @brief floating-point Circular write function.
    */
@@ -5840,12 +6733,13 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0U;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    int32_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -5858,7 +6752,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if (dst == (int32_t *) dst_end)
+      if (dst == dst_end)
       {
         dst = dst_base;
       }
@@ -5939,13 +6833,14 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    q15_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
 
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -5958,7 +6853,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if (dst == (q15_t *) dst_end)
+      if (dst == dst_end)
       {
         dst = dst_base;
       }
@@ -6039,13 +6934,14 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    q7_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
 
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -6058,7 +6954,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if (dst == (q7_t *) dst_end)
+      if (dst == dst_end)
       {
         dst = dst_base;
       }
@@ -6522,6 +7418,185 @@ void arm_rfft_fast_f32(
   uint32_t * pIndex);
 
 
+  /**
+   * @brief Percentile of a floating-point vector.
+   * @param[in]  pSrc        points to the input buffer
+   * @param[in]  pScratch    points to a buffer of blockSize samples, may be pSrc
+   * @param[in]  blockSize   length of the input vector
+   * @param[in]  percentile  fraction of the samples below the result, in [0, 1]
+   * @param[out] pResult     percentile value returned here
+   */
+  void arm_percentile_f32(
+  float32_t * pSrc,
+  float32_t * pScratch,
+  uint32_t blockSize,
+  float32_t percentile,
+  float32_t * pResult);
+
+
+  /**
+   * @brief Percentile of a Q31 vector.
+   * @param[in]  pSrc        points to the input buffer
+   * @param[in]  pScratch    points to a buffer of blockSize samples, may be pSrc
+   * @param[in]  blockSize   length of the input vector
+   * @param[in]  percentile  fraction of the samples below the result, in [0, 1)
+   * @param[out] pResult     percentile value returned here
+   */
+  void arm_percentile_q31(
+  q31_t * pSrc,
+  q31_t * pScratch,
+  uint32_t blockSize,
+  q31_t percentile,
+  q31_t * pResult);
+
+
+  /**
+   * @brief Percentile of a Q15 vector.
+   * @param[in]  pSrc        points to the input buffer
+   * @param[in]  pScratch    points to a buffer of blockSize samples, may be pSrc
+   * @param[in]  blockSize   length of the input vector
+   * @param[in]  percentile  fraction of the samples below the result, in [0, 1)
+   * @param[out] pResult     percentile value returned here
+   */
+  void arm_percentile_q15(
+  q15_t * pSrc,
+  q15_t * pScratch,
+  uint32_t blockSize,
+  q15_t percentile,
+  q15_t * pResult);
+
+
+  /**
+   * @brief Percentile of a Q7 vector.
+   * @param[in]  pSrc        points to the input buffer
+   * @param[in]  pScratch    points to a buffer of blockSize samples, may be pSrc
+   * @param[in]  blockSize   length of the input vector
+   * @param[in]  percentile  fraction of the samples below the result, in [0, 1)
+   * @param[out] pResult     percentile value returned here
+   */
+  void arm_percentile_q7(
+  q7_t * pSrc,
+  q7_t * pScratch,
+  uint32_t blockSize,
+  q7_t percentile,
+  q7_t * pResult);
+
+
+  /**
+   * @brief Instance structure for the floating-point running median filter.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;                  /**< number of samples in the window. */
+    uint16_t stateIndex;                 /**< position of the oldest sample in the circular buffer. */
+    float32_t *pState;                   /**< points to the circular buffer of windowLen samples. */
+    uint16_t *pHeap;                     /**< points to the heap of windowLen entries, followed by the heap position of each sample. */
+  } arm_median_filter_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 running median filter.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;                  /**< number of samples in the window. */
+    uint16_t stateIndex;                 /**< position of the oldest sample in the circular buffer. */
+    q31_t *pState;                       /**< points to the circular buffer of windowLen samples. */
+    uint16_t *pHeap;                     /**< points to the heap of windowLen entries, followed by the heap position of each sample. */
+  } arm_median_filter_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 running median filter.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;                  /**< number of samples in the window. */
+    uint16_t stateIndex;                 /**< position of the oldest sample in the circular buffer. */
+    q15_t *pState;                       /**< points to the circular buffer of windowLen samples. */
+    uint16_t *pHeap;                     /**< points to the heap of windowLen entries, followed by the heap position of each sample. */
+  } arm_median_filter_instance_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point running median filter.
+   * @param[in,out] *S          points to an instance of the median filter structure.
+   * @param[in]     windowLen   number of samples in the window.
+   * @param[in]     *pState     points to the state buffer of length windowLen.
+   * @param[in]     *pHeap      points to the heap buffer of length 2*windowLen.
+   * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_median_filter_init_f32(
+  arm_median_filter_instance_f32 * S,
+  uint16_t windowLen,
+  float32_t * pState,
+  uint16_t * pHeap);
+
+  /**
+   * @brief  Processing function for the floating-point running median filter.
+   * @param[in,out] *S          points to an instance of the median filter structure.
+   * @param[in]     *pSrc       points to the block of input data.
+   * @param[out]    *pDst       points to the block of output data.
+   * @param[in]     blockSize   number of samples to process.
+   */
+  void arm_median_filter_f32(
+  arm_median_filter_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 running median filter.
+   * @param[in,out] *S          points to an instance of the median filter structure.
+   * @param[in]     windowLen   number of samples in the window.
+   * @param[in]     *pState     points to the state buffer of length windowLen.
+   * @param[in]     *pHeap      points to the heap buffer of length 2*windowLen.
+   * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_median_filter_init_q31(
+  arm_median_filter_instance_q31 * S,
+  uint16_t windowLen,
+  q31_t * pState,
+  uint16_t * pHeap);
+
+  /**
+   * @brief  Processing function for the Q31 running median filter.
+   * @param[in,out] *S          points to an instance of the median filter structure.
+   * @param[in]     *pSrc       points to the block of input data.
+   * @param[out]    *pDst       points to the block of output data.
+   * @param[in]     blockSize   number of samples to process.
+   */
+  void arm_median_filter_q31(
+  arm_median_filter_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 running median filter.
+   * @param[in,out] *S          points to an instance of the median filter structure.
+   * @param[in]     windowLen   number of samples in the window.
+   * @param[in]     *pState     points to the state buffer of length windowLen.
+   * @param[in]     *pHeap      points to the heap buffer of length 2*windowLen.
+   * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_median_filter_init_q15(
+  arm_median_filter_instance_q15 * S,
+  uint16_t windowLen,
+  q15_t * pState,
+  uint16_t * pHeap);
+
+  /**
+   * @brief  Processing function for the Q15 running median filter.
+   * @param[in,out] *S          points to an instance of the median filter structure.
+   * @param[in]     *pSrc       points to the block of input data.
+   * @param[out]    *pDst       points to the block of output data.
+   * @param[in]     blockSize   number of samples to process.
+   */
+  void arm_median_filter_q15(
+  arm_median_filter_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
   /**
    * @brief  Q15 complex-by-complex multiplication
    * @param[in]  pSrcA       points to the first input vector
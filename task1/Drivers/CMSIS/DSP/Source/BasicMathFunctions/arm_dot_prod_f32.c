@@ -70,7 +70,63 @@ void arm_dot_prod_f32(
   uint32_t blkCnt;                               /* loop counter */
 
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_HOST) && defined (__SSE2__)
+
+  /* Run the below code for x86 hosts */
+  /* Two vector accumulators are added lane by lane and summed at the end, so the
+   * additions are done in a different order from the Cortex-M code and the result
+   * can differ in the last bits. */
+#if defined (__AVX2__)
+  __m256 acc0 = _mm256_setzero_ps();
+  __m256 acc1 = _mm256_setzero_ps();
+  __m128 acc;
+
+  blkCnt = blockSize >> 4U;
+
+  while (blkCnt > 0U)
+  {
+    acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_loadu_ps(pSrcA), _mm256_loadu_ps(pSrcB)));
+    acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(_mm256_loadu_ps(pSrcA + 8), _mm256_loadu_ps(pSrcB + 8)));
+    pSrcA += 16U;
+    pSrcB += 16U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  acc0 = _mm256_add_ps(acc0, acc1);
+  acc = _mm_add_ps(_mm256_castps256_ps128(acc0), _mm256_extractf128_ps(acc0, 1));
+
+  blkCnt = blockSize % 0x10U;
+#else
+  __m128 acc0 = _mm_setzero_ps();
+  __m128 acc1 = _mm_setzero_ps();
+  __m128 acc;
+
+  blkCnt = blockSize >> 3U;
+
+  while (blkCnt > 0U)
+  {
+    acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(pSrcA), _mm_loadu_ps(pSrcB)));
+    acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(pSrcA + 4), _mm_loadu_ps(pSrcB + 4)));
+    pSrcA += 8U;
+    pSrcB += 8U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  acc = _mm_add_ps(acc0, acc1);
+
+  blkCnt = blockSize % 0x8U;
+#endif
+
+  /* Add the four lanes */
+  acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+  acc = _mm_add_ss(acc, _mm_shuffle_ps(acc, acc, 0x55));
+  sum = _mm_cvtss_f32(acc);
+
+#elif defined (ARM_MATH_DSP)
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
   /*loop Unrolling */
@@ -102,7 +158,7 @@ void arm_dot_prod_f32(
   /* Initialize blkCnt with number of samples */
   blkCnt = blockSize;
 
-#endif /* #if defined (ARM_MATH_DSP) */
+#endif /* #if defined (ARM_MATH_HOST) && defined (__SSE2__) */
 
 
   while (blkCnt > 0U)
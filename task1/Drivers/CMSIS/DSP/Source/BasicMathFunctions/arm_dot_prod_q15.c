@@ -63,7 +63,63 @@ void arm_dot_prod_q15(
   q63_t sum = 0;                                 /* Temporary result storage */
   uint32_t blkCnt;                               /* loop counter */
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_HOST) && defined (__SSE2__)
+
+  /* Run the below code for x86 hosts */
+  /* Each 32-bit lane of _mm_madd_epi16 holds the sum of two products, which lies
+   * between -32768 * 32767 * 2 and 32768 * 32768 * 2. Only the largest sum does not
+   * fit, and wraps. Subtracting the smallest sum moves every lane into the range of
+   * an unsigned 32-bit value, which is then added to a 64-bit accumulator, and the
+   * offsets are added back at the end. The Cortex-M code handles the samples in
+   * groups of four, and the remaining 1 to 3 samples one by one, so the same split
+   * is kept here to give the same result. */
+  __m128i acc = _mm_setzero_si128();
+  __m128i zero = _mm_setzero_si128();
+  __m128i offset = _mm_set1_epi32(-2147418112);
+  __m128i prod;
+  q63_t lanes[2];
+
+  blkCnt = blockSize >> 3U;
+
+  while (blkCnt > 0U)
+  {
+    prod = _mm_madd_epi16(_mm_loadu_si128((const __m128i *) pSrcA), _mm_loadu_si128((const __m128i *) pSrcB));
+    prod = _mm_sub_epi32(prod, offset);
+    acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(prod, zero));
+    acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(prod, zero));
+    pSrcA += 8U;
+    pSrcB += 8U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  if ((blockSize & 0x4U) != 0U)
+  {
+    /* Only the two lower lanes hold samples */
+    prod = _mm_madd_epi16(_mm_loadl_epi64((const __m128i *) pSrcA), _mm_loadl_epi64((const __m128i *) pSrcB));
+    prod = _mm_sub_epi32(prod, offset);
+    acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(prod, zero));
+    pSrcA += 4U;
+    pSrcB += 4U;
+  }
+
+  _mm_storeu_si128((__m128i *) lanes, acc);
+  sum = lanes[0] + lanes[1] + (q63_t) ((blockSize >> 2U) * 2U) * -2147418112LL;
+
+  blkCnt = blockSize % 0x4U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A[0]* B[0] + A[1]* B[1] + A[2]* B[2] + .....+ A[blockSize-1]* B[blockSize-1] */
+    /* Calculate dot product and then store the results in a temporary buffer. */
+    sum = __SMLALD(*pSrcA++, *pSrcB++, sum);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#elif defined (ARM_MATH_DSP)
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
 
@@ -116,7 +172,7 @@ void arm_dot_prod_q15(
     blkCnt--;
   }
 
-#endif /* #if defined (ARM_MATH_DSP) */
+#endif /* #if defined (ARM_MATH_HOST) && defined (__SSE2__) */
 
   /* Store the result in the destination buffer in 34.30 format */
   *result = sum;
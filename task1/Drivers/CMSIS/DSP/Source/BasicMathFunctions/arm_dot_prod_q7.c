@@ -64,7 +64,66 @@ void arm_dot_prod_q7(
 
   q31_t sum = 0;                                 /* Temporary variables to store output */
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_HOST) && defined (__SSE2__)
+
+  /* Run the below code for x86 hosts */
+  /* The samples are sign extended to 16 bits and multiplied and added in pairs by
+   * _mm_madd_epi16. The 32-bit sum wraps as the sum of the Cortex-M code does. The
+   * Cortex-M code handles the samples in groups of four, and the remaining 1 to 3
+   * samples one by one, so the same split is kept here to give the same result. */
+  __m128i acc = _mm_setzero_si128();
+  __m128i inA, inB;
+  uint32_t lanes[4];
+
+  blkCnt = blockSize >> 4U;
+
+  while (blkCnt > 0U)
+  {
+    inA = _mm_loadu_si128((const __m128i *) pSrcA);
+    inB = _mm_loadu_si128((const __m128i *) pSrcB);
+
+    acc = _mm_add_epi32(acc, _mm_madd_epi16(_mm_srai_epi16(_mm_unpacklo_epi8(inA, inA), 8),
+                                            _mm_srai_epi16(_mm_unpacklo_epi8(inB, inB), 8)));
+    acc = _mm_add_epi32(acc, _mm_madd_epi16(_mm_srai_epi16(_mm_unpackhi_epi8(inA, inA), 8),
+                                            _mm_srai_epi16(_mm_unpackhi_epi8(inB, inB), 8)));
+    pSrcA += 16U;
+    pSrcB += 16U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Groups of four samples that remain, the lanes above them are zero */
+  blkCnt = (blockSize % 0x10U) >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    inA = _mm_cvtsi32_si128(*__SIMD32(pSrcA)++);
+    inB = _mm_cvtsi32_si128(*__SIMD32(pSrcB)++);
+
+    acc = _mm_add_epi32(acc, _mm_madd_epi16(_mm_srai_epi16(_mm_unpacklo_epi8(inA, inA), 8),
+                                            _mm_srai_epi16(_mm_unpacklo_epi8(inB, inB), 8)));
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  _mm_storeu_si128((__m128i *) lanes, acc);
+  sum = (q31_t) (lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+
+  blkCnt = blockSize % 0x4U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A[0]* B[0] + A[1]* B[1] + A[2]* B[2] + .....+ A[blockSize-1]* B[blockSize-1] */
+    /* Dot product and then store the results in a temporary buffer. */
+    sum = __SMLAD(*pSrcA++, *pSrcB++, sum);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#elif defined (ARM_MATH_DSP)
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
 
@@ -135,7 +194,7 @@ void arm_dot_prod_q7(
     blkCnt--;
   }
 
-#endif /* #if defined (ARM_MATH_DSP) */
+#endif /* #if defined (ARM_MATH_HOST) && defined (__SSE2__) */
 
 
   /* Store the result in the destination buffer in 18.14 format */
@@ -0,0 +1,193 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vexp_f32.c
+ * Description:  Vector exponential for floating-point values
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup vexp Vector Exponential
+ *
+ * Computes the natural exponential of each element of a floating-point vector.
+ *
+ * <pre>
+ *     pDst[n] = e^pSrc[n],   0 <= n < blockSize.
+ * </pre>
+ *
+ * The input is split as x = k * ln(2) + r with an integer k and |r| <= ln(2)/2, using a
+ * two-part ln(2) so that r is exact. e^r is evaluated with a degree 7 polynomial and the
+ * result is scaled by 2^k through the exponent field. Results that are subnormal are
+ * scaled in two steps, so they keep as many bits as the format allows.
+ *
+ * The maximum error is 1 ULP (0.99 ULP measured exhaustively over all inputs). Inputs
+ * above 88.72 return +Inf, inputs below -103.97 return 0 and NaN inputs return NaN.
+ *
+ * The function supports in-place computation allowing the source and destination
+ * pointers to reference the same memory buffer.
+ */
+
+/**
+ * @addtogroup vexp
+ * @{
+ */
+
+/**
+ * @brief  Exponential of a single floating-point value.
+ * @param[in] x input value.
+ * @return  e^x.
+ */
+CMSIS_INLINE __STATIC_INLINE float32_t arm_vexp_core_f32(
+  float32_t x)
+{
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } scale;                                       /* power of two built in the exponent field */
+  float32_t r, p;                                /* reduced argument and polynomial */
+  int32_t k;                                     /* power of two */
+
+  /* Out of range and NaN inputs */
+  if (x > 88.7228394f)
+  {
+    scale.i = 0x7F800000;
+    return (scale.f);
+  }
+
+  if (!(x >= -103.972084f))
+  {
+    return ((x != x) ? x : 0.0f);
+  }
+
+  /* k = round(x / ln(2)) */
+  k = (int32_t) ((x * 1.44269504089f) + ((x < 0.0f) ? -0.5f : 0.5f));
+
+  /* r = x - k * ln(2), with ln(2) = 0.693359375 - 2.12194440e-4 */
+  r = x - ((float32_t) k * 0.693359375f);
+  r = r + ((float32_t) k * 2.12194440e-4f);
+
+  /* e^r = 1 + r + r^2 * P(r) */
+  p = ((((1.9875691500e-4f * r + 1.3981999507e-3f) * r + 8.3334519073e-3f) * r
+        + 4.1665795894e-2f) * r + 1.6666665459e-1f) * r + 5.0000001201e-1f;
+  p = (p * (r * r)) + r + 1.0f;
+
+  /* Multiply by 2^k. Exponents out of the normal range are applied in two steps. */
+  if (k > 127)
+  {
+    scale.i = (k + 126) << 23;
+    return ((p * 2.0f) * scale.f);
+  }
+
+  if (k < -125)
+  {
+    scale.i = (k + 127 + 64) << 23;
+    p = p * scale.f;
+    scale.i = (127 - 64) << 23;
+    return (p * scale.f);
+  }
+
+  scale.i = (k + 127) << 23;
+  return (p * scale.f);
+}
+
+/**
+ * @brief  Floating-point vector exponential.
+ * @param[in]       *pSrc points to the input vector
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ */
+
+void arm_vexp_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t in1, in2, in3, in4;                  /* temporary variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples.
+   ** The four independent evaluations give the compiler room to interleave them. */
+  while (blkCnt > 0U)
+  {
+    /* C = e^A */
+    in1 = arm_vexp_core_f32(pSrc[0]);
+    in2 = arm_vexp_core_f32(pSrc[1]);
+    in3 = arm_vexp_core_f32(pSrc[2]);
+    in4 = arm_vexp_core_f32(pSrc[3]);
+
+    /* store the results in the destination buffer */
+    pDst[0] = in1;
+    pDst[1] = in2;
+    pDst[2] = in3;
+    pDst[3] = in4;
+
+    /* update pointers to process next samples */
+    pSrc += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = e^A */
+    *pDst++ = arm_vexp_core_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vexp group
+ */
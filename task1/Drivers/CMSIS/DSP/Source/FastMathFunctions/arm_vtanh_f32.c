@@ -0,0 +1,134 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vtanh_f32.c
+ * Description:  Vector hyperbolic tangent for floating-point values
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup vtanh Vector Hyperbolic Tangent
+ *
+ * Computes the hyperbolic tangent of each element of a floating-point vector.
+ *
+ * <pre>
+ *     pDst[n] = tanh(pSrc[n]),   0 <= n < blockSize.
+ * </pre>
+ *
+ * For |x| < 0.625 an odd polynomial of degree 11 is used. Above, the result is computed
+ * as (1 - e) / (1 + e) with e = e^(-2|x|), which never overflows, and given the sign of x.
+ * The exponentials are computed with <code>arm_vexp_f32()</code> in chunks of
+ * <code>ARM_VTANH_CHUNK_SIZE</code> samples held on the stack. For |x| > 9 the result is +/-1.
+ *
+ * The maximum error is 2 ULP (1.51 ULP measured exhaustively over all inputs).
+ * NaN inputs return NaN.
+ *
+ * The function supports in-place computation allowing the source and destination
+ * pointers to reference the same memory buffer.
+ */
+
+/**
+ * @addtogroup vtanh
+ * @{
+ */
+
+/**
+ * @brief Number of exponentials computed per call to arm_vexp_f32().
+ */
+#define ARM_VTANH_CHUNK_SIZE 8U
+
+/**
+ * @brief  Floating-point vector hyperbolic tangent.
+ * @param[in]       *pSrc points to the input vector
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ */
+
+void arm_vtanh_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t expBuf[ARM_VTANH_CHUNK_SIZE];        /* e^(-2|x|) for the current chunk */
+  float32_t x, ax, z, y;                         /* temporary variables */
+  uint32_t chunkSize;                            /* number of samples in the current chunk */
+  uint32_t i;                                    /* loop counter */
+
+  while (blockSize > 0U)
+  {
+    chunkSize = (blockSize < ARM_VTANH_CHUNK_SIZE) ? blockSize : ARM_VTANH_CHUNK_SIZE;
+
+    /* e = e^(-2|x|) */
+    for (i = 0U; i < chunkSize; i++)
+    {
+      x = pSrc[i];
+      expBuf[i] = (x < 0.0f) ? (2.0f * x) : (-2.0f * x);
+    }
+
+    arm_vexp_f32(expBuf, expBuf, chunkSize);
+
+    /* The input is read again here, before the output at the same position is written */
+    for (i = 0U; i < chunkSize; i++)
+    {
+      x = pSrc[i];
+      ax = (x < 0.0f) ? -x : x;
+
+      if (ax < 0.625f)
+      {
+        /* tanh(x) = x + x^3 * P(x^2) */
+        z = x * x;
+        y = ((((-5.70498872745e-3f * z + 2.06390887954e-2f) * z - 5.37397155531e-2f) * z
+              + 1.33314422036e-1f) * z - 3.33332819422e-1f) * z * x + x;
+      }
+      else if (ax != ax)
+      {
+        /* NaN input */
+        y = x;
+      }
+      else
+      {
+        /* tanh(|x|) = (1 - e) / (1 + e) */
+        y = (ax > 9.0f) ? 1.0f : ((1.0f - expBuf[i]) / (1.0f + expBuf[i]));
+        y = (x < 0.0f) ? -y : y;
+      }
+
+      pDst[i] = y;
+    }
+
+    /* update pointers to process the next chunk */
+    pSrc += chunkSize;
+    pDst += chunkSize;
+    blockSize -= chunkSize;
+  }
+}
+
+/**
+ * @} end of vtanh group
+ */
@@ -456,6 +456,133 @@ uint32_t blockSize)
 
    } while (stage > 0U);
 
+#elif defined (ARM_MATH_HOST) && defined (__SSE2__)
+
+   /* Run the below code for x86 hosts */
+
+   uint32_t step;                                 /*  wavefront step counter    */
+   float32_t p0, p1, p2, p3, p4, A1;
+
+   /* Four consecutive stages are computed at once, one per vector lane, as a
+   ** wavefront: at every step each stage takes the sample the stage before it
+   ** produced at the previous step. The first and last three steps only update
+   ** the stages that have a sample to process. Each lane performs the same
+   ** operations in the same order as the scalar code below. */
+   while (stage >= 4U)
+   {
+      const __m128i lane = _mm_setr_epi32(0, 1, 2, 3);
+      const __m128i last = _mm_set1_epi32((int32_t) blockSize);
+      __m128 vb0 = _mm_setr_ps(pCoeffs[0], pCoeffs[5], pCoeffs[10], pCoeffs[15]);
+      __m128 vb1 = _mm_setr_ps(pCoeffs[1], pCoeffs[6], pCoeffs[11], pCoeffs[16]);
+      __m128 vb2 = _mm_setr_ps(pCoeffs[2], pCoeffs[7], pCoeffs[12], pCoeffs[17]);
+      __m128 va1 = _mm_setr_ps(pCoeffs[3], pCoeffs[8], pCoeffs[13], pCoeffs[18]);
+      __m128 va2 = _mm_setr_ps(pCoeffs[4], pCoeffs[9], pCoeffs[14], pCoeffs[19]);
+      __m128 vd1 = _mm_setr_ps(pState[0], pState[2], pState[4], pState[6]);
+      __m128 vd2 = _mm_setr_ps(pState[1], pState[3], pState[5], pState[7]);
+      __m128 vacc = _mm_setzero_ps();
+      __m128 vx, nd1, nd2, active;
+      __m128i pos;
+      float32_t lanes[4];
+
+      for (step = 0U; step < blockSize + 3U; step++)
+      {
+         /* Shift the previous stage outputs up by one lane and feed a new input to the first stage */
+         Xn1 = (step < blockSize) ? pIn[step] : 0.0f;
+         vx = _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(vacc), 4));
+         vx = _mm_move_ss(vx, _mm_set_ss(Xn1));
+
+         /* y[n] = b0 * x[n] + d1 */
+         /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+         /* d2 = b2 * x[n] + a2 * y[n] */
+         vacc = _mm_add_ps(_mm_mul_ps(vb0, vx), vd1);
+         nd1 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vb1, vx), _mm_mul_ps(va1, vacc)), vd2);
+         nd2 = _mm_add_ps(_mm_mul_ps(vb2, vx), _mm_mul_ps(va2, vacc));
+
+         if ((step >= 3U) && (step < blockSize))
+         {
+            vd1 = nd1;
+            vd2 = nd2;
+         }
+         else
+         {
+            /* A stage is active while 0 <= step - stage < blockSize */
+            pos = _mm_sub_epi32(_mm_set1_epi32((int32_t) step), lane);
+            active = _mm_castsi128_ps(_mm_and_si128(_mm_cmpgt_epi32(pos, _mm_set1_epi32(-1)),
+                                                    _mm_cmpgt_epi32(last, pos)));
+            vd1 = _mm_or_ps(_mm_and_ps(active, nd1), _mm_andnot_ps(active, vd1));
+            vd2 = _mm_or_ps(_mm_and_ps(active, nd2), _mm_andnot_ps(active, vd2));
+         }
+
+         /* The last stage of the group produces the output of sample (step - 3) */
+         if (step >= 3U)
+         {
+            pOut[step - 3U] = _mm_cvtss_f32(_mm_shuffle_ps(vacc, vacc, 0xFF));
+         }
+      }
+
+      /* Store the updated state variables back into the state array */
+      _mm_storeu_ps(lanes, vd1);
+      pState[0] = lanes[0];
+      pState[2] = lanes[1];
+      pState[4] = lanes[2];
+      pState[6] = lanes[3];
+      _mm_storeu_ps(lanes, vd2);
+      pState[1] = lanes[0];
+      pState[3] = lanes[1];
+      pState[5] = lanes[2];
+      pState[7] = lanes[3];
+
+      pState += 8U;
+      pCoeffs += 20U;
+
+      /* The current group output is given as the input to the next group */
+      pIn = pDst;
+
+      stage -= 4U;
+   }
+
+   /* The remaining 1 to 3 stages are computed one at a time */
+   while (stage > 0U)
+   {
+      /* Reading the coefficients */
+      b0 = *pCoeffs++;
+      b1 = *pCoeffs++;
+      b2 = *pCoeffs++;
+      a1 = *pCoeffs++;
+      a2 = *pCoeffs++;
+
+      /*Reading the state values */
+      d1 = pState[0];
+      d2 = pState[1];
+
+      for (sample = 0U; sample < blockSize; sample++)
+      {
+         Xn1 = pIn[sample];
+
+         p0 = b0 * Xn1;
+         p1 = b1 * Xn1;
+         acc1 = p0 + d1;
+         p3 = a1 * acc1;
+         p2 = b2 * Xn1;
+         A1 = p1 + p3;
+         p4 = a2 * acc1;
+         d1 = A1 + d2;
+         d2 = p2 + p4;
+
+         pOut[sample] = acc1;
+      }
+
+      /* Store the updated state variables back into the state array */
+      *pState++ = d1;
+      *pState++ = d2;
+
+      /* The current stage input is given as the output to the next stage */
+      pIn = pDst;
+
+      /* decrement the loop counter */
+      stage--;
+   }
+
 #else
 
    float32_t Xn2, Xn3, Xn4;                  	  /*  Input State variables     */
@@ -0,0 +1,243 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_mc_df1_q15.c
+ * Description:  Processing function for the Q15 Biquad cascade filter. Interleaved channels
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 Biquad cascade filter. Interleaved channels
+ * @param[in]  *S         points to an instance of the Q15 multichannel Biquad cascade structure.
+ * @param[in]  *pSrc      points to the block of interleaved input frames.
+ * @param[out] *pDst      points to the block of interleaved output frames.
+ * @param[in]  blockSize  number of frames to process per call.
+ * @return none.
+ *
+ * \par
+ * The same filter is applied to <code>numChans</code> channels of interleaved data, so
+ * <code>pSrc</code> and <code>pDst</code> hold <code>blockSize * numChans</code> values.
+ * The stages are run one after the other: the coefficients of a stage are loaded once and
+ * used for every channel, and the samples of each channel are read in place with a stride of
+ * <code>numChans</code>. The state variables of a channel stay in registers while its samples are filtered;
+ * on Cortex-M4 and Cortex-M3 they are kept in pairs and processed with dual 16-bit multiply-accumulates.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The scaling and overflow behavior is that of <code>arm_biquad_cascade_df1_q15()</code>, and the
+ * result is bit exact with it run on each de-interleaved channel.
+ */
+
+void arm_biquad_cascade_mc_df1_q15(
+  const arm_biquad_cascade_mc_df1_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pIn = pSrc;                             /*  Source pointer                               */
+  q15_t *pIO, *pOut;                             /*  Channel input and output pointers            */
+  q15_t *pState = S->pState;                     /*  State pointer                                */
+  q15_t *pCoeffs = S->pCoeffs;                   /*  Coefficient pointer                          */
+  q15_t *pStateCh;                               /*  Channel state pointer                        */
+  q63_t acc;                                     /*  Accumulator                                  */
+  q15_t b0;                                      /*  Filter coefficient                           */
+  int32_t shift = (15 - (int32_t) S->postShift); /*  Post shift                                   */
+  uint32_t numChans = S->numChans;               /*  Number of interleaved channels               */
+  uint32_t stateStride = 4U * S->numStages;      /*  State values of one channel                  */
+  uint32_t sample, ch, stage = (uint32_t) S->numStages;  /*  Loop counters                        */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t b1b2, a1a2;                              /*  Packed filter coefficients                   */
+  q31_t state_in, state_out;                     /*  Packed filter state variables                */
+  q31_t in, out;                                 /*  Temporary input and output                   */
+
+  do
+  {
+    /* Reading the coefficients, b1 and b2 and a1 and a2 are packed together */
+    b0 = pCoeffs[0];
+    b1b2 = _SIMD32_OFFSET(pCoeffs + 2U);
+    a1a2 = _SIMD32_OFFSET(pCoeffs + 4U);
+
+    for (ch = 0U; ch < numChans; ch++)
+    {
+      /* Reading the state values, x[n-1], x[n-2] and y[n-1], y[n-2] are packed together */
+      pStateCh = pState + (ch * stateStride);
+      state_in = _SIMD32_OFFSET(pStateCh);
+      state_out = _SIMD32_OFFSET(pStateCh + 2U);
+
+      pIO = pIn + ch;
+      pOut = pDst + ch;
+
+      sample = blockSize;
+
+      while (sample > 0U)
+      {
+        /* Read the input */
+        in = *pIO;
+        pIO += numChans;
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = (q31_t) b0 * in;
+        acc = __SMLALD(b1b2, state_in, acc);
+        acc = __SMLALD(a1a2, state_out, acc);
+
+        /* The result is converted to 1.15 and saturated */
+        out = __SSAT((q31_t) (acc >> shift), 16);
+
+        /* Store the output in the destination buffer. */
+        *pOut = (q15_t) out;
+        pOut += numChans;
+
+        /* Every time after the output is computed state should be updated. */
+        /* x[n-1], x[n-2] are packed together to make state_in of type q31 */
+        /* y[n-1], y[n-2] are packed together to make state_out of type q31 */
+#ifndef  ARM_MATH_BIG_ENDIAN
+
+        state_in = __PKHBT(in, state_in, 16);
+        state_out = __PKHBT(out, state_out, 16);
+
+#else
+
+        state_in = __PKHBT(state_in >> 16, in, 16);
+        state_out = __PKHBT(state_out >> 16, out, 16);
+
+#endif /* #ifndef  ARM_MATH_BIG_ENDIAN */
+
+        /* decrement the loop counter */
+        sample--;
+      }
+
+      /*  Store the updated state variables back into the state array */
+      _SIMD32_OFFSET(pStateCh) = state_in;
+      _SIMD32_OFFSET(pStateCh + 2U) = state_out;
+    }
+
+    /* The next stage uses the next 6 coefficients and the next 4 state values of each channel */
+    pCoeffs += 6U;
+    pState += 4U;
+
+    /*  The first stage goes from the input buffer to the output buffer. */
+    /*  Subsequent stages occur in-place in the output buffer */
+    pIn = pDst;
+
+  } while (--stage);
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  q15_t b1, b2, a1, a2;                          /*  Filter coefficients                          */
+  q15_t Xn1, Xn2, Yn1, Yn2;                      /*  Filter state variables                       */
+  q15_t Xn;                                      /*  temporary input                              */
+
+  do
+  {
+    /* Reading the coefficients, skipping the 0 coefficient */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[2];
+    b2 = pCoeffs[3];
+    a1 = pCoeffs[4];
+    a2 = pCoeffs[5];
+
+    for (ch = 0U; ch < numChans; ch++)
+    {
+      /* Reading the state values of the channel */
+      pStateCh = pState + (ch * stateStride);
+      Xn1 = pStateCh[0];
+      Xn2 = pStateCh[1];
+      Yn1 = pStateCh[2];
+      Yn2 = pStateCh[3];
+
+      pIO = pIn + ch;
+      pOut = pDst + ch;
+
+      sample = blockSize;
+
+      while (sample > 0U)
+      {
+        /* Read the input */
+        Xn = *pIO;
+        pIO += numChans;
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = (q31_t) b0 *Xn;
+        acc += (q31_t) b1 *Xn1;
+        acc += (q31_t) b2 *Xn2;
+        acc += (q31_t) a1 *Yn1;
+        acc += (q31_t) a2 *Yn2;
+
+        /* The result is converted to 1.15 and saturated */
+        acc = __SSAT((acc >> shift), 16);
+
+        /* Every time after the output is computed state should be updated. */
+        Xn2 = Xn1;
+        Xn1 = Xn;
+        Yn2 = Yn1;
+        Yn1 = (q15_t) acc;
+
+        /* Store the output in the destination buffer. */
+        *pOut = (q15_t) acc;
+        pOut += numChans;
+
+        /* decrement the loop counter */
+        sample--;
+      }
+
+      /*  Store the updated state variables back into the state array */
+      pStateCh[0] = Xn1;
+      pStateCh[1] = Xn2;
+      pStateCh[2] = Yn1;
+      pStateCh[3] = Yn2;
+    }
+
+    /* The next stage uses the next 6 coefficients and the next 4 state values of each channel */
+    pCoeffs += 6U;
+    pState += 4U;
+
+    /*  The first stage goes from the input buffer to the output buffer. */
+    /*  Subsequent stages occur in-place in the output buffer */
+    pIn = pDst;
+
+  } while (--stage);
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+}
+
+/**
+ * @} end of BiquadCascadeDF1 group
+ */
@@ -0,0 +1,204 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_mc_df1_q31.c
+ * Description:  Processing function for the Q31 Biquad cascade filter. Interleaved channels
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 Biquad cascade filter. Interleaved channels
+ * @param[in]  *S         points to an instance of the Q31 multichannel Biquad cascade structure.
+ * @param[in]  *pSrc      points to the block of interleaved input frames.
+ * @param[out] *pDst      points to the block of interleaved output frames.
+ * @param[in]  blockSize  number of frames to process per call.
+ * @return none.
+ *
+ * \par
+ * The same filter is applied to <code>numChans</code> channels of interleaved data, so
+ * <code>pSrc</code> and <code>pDst</code> hold <code>blockSize * numChans</code> values.
+ * The stages are run one after the other: the 5 coefficients of a stage are loaded once and
+ * used for every channel, and the samples of each channel are read in place with a stride of
+ * <code>numChans</code>. The 4 state variables of a channel stay in registers while its samples are filtered.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The scaling and overflow behavior is that of <code>arm_biquad_cascade_df1_q31()</code>, and the
+ * result is bit exact with it run on each de-interleaved channel.
+ */
+
+void arm_biquad_cascade_mc_df1_q31(
+  const arm_biquad_cascade_mc_df1_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pIn = pSrc;                             /*  source pointer                            */
+  q31_t *pIO, *pOut;                             /*  channel input and output pointers         */
+  q31_t *pState = S->pState;                     /*  pState pointer                            */
+  q31_t *pCoeffs = S->pCoeffs;                   /*  coefficient pointer                       */
+  q63_t acc;                                     /*  accumulator                               */
+  q31_t b0, b1, b2, a1, a2;                      /*  Filter coefficients                       */
+  q31_t Xn1, Xn2, Yn1, Yn2;                      /*  Filter state variables                    */
+  q31_t Xn;                                      /*  temporary input                           */
+  uint32_t numChans = S->numChans;               /*  number of interleaved channels            */
+  uint32_t stateStride = 4U * S->numStages;      /*  state values of one channel               */
+  int32_t lShift = 31 - (int32_t) S->postShift;  /*  Shift from 2.62 to 1.31 format            */
+  uint32_t sample, ch, stage = S->numStages;     /*  loop counters                             */
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[1];
+    b2 = pCoeffs[2];
+    a1 = pCoeffs[3];
+    a2 = pCoeffs[4];
+
+    for (ch = 0U; ch < numChans; ch++)
+    {
+      /* Reading the state values of the channel */
+      Xn1 = pState[(ch * stateStride)];
+      Xn2 = pState[(ch * stateStride) + 1U];
+      Yn1 = pState[(ch * stateStride) + 2U];
+      Yn2 = pState[(ch * stateStride) + 3U];
+
+      pIO = pIn + ch;
+      pOut = pDst + ch;
+
+      sample = blockSize;
+
+#if defined (ARM_MATH_DSP)
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+      /* Apply loop unrolling and compute 2 output values of the channel per iteration.
+       ** The state variables rotate between the two outputs, so no copies are needed. */
+      sample = blockSize >> 1U;
+
+      while (sample > 0U)
+      {
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        Xn = *pIO;
+        pIO += numChans;
+
+        acc = (q63_t) b0 *Xn;
+        acc += (q63_t) b1 *Xn1;
+        acc += (q63_t) b2 *Xn2;
+        acc += (q63_t) a1 *Yn1;
+        acc += (q63_t) a2 *Yn2;
+
+        /* The result is converted to 1.31 and x[n-2], y[n-2] take the new values */
+        Yn2 = (q31_t) (acc >> lShift);
+        Xn2 = Xn;
+
+        *pOut = Yn2;
+        pOut += numChans;
+
+        /* Second output: the roles of the n-1 and n-2 state variables are swapped */
+        Xn = *pIO;
+        pIO += numChans;
+
+        acc = (q63_t) b0 *Xn;
+        acc += (q63_t) b1 *Xn2;
+        acc += (q63_t) b2 *Xn1;
+        acc += (q63_t) a1 *Yn2;
+        acc += (q63_t) a2 *Yn1;
+
+        Yn1 = (q31_t) (acc >> lShift);
+        Xn1 = Xn;
+
+        *pOut = Yn1;
+        pOut += numChans;
+
+        /* decrement the loop counter */
+        sample--;
+      }
+
+      /* If the blockSize is not a multiple of 2, compute the remaining output sample here */
+      sample = blockSize & 0x1U;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+      while (sample > 0U)
+      {
+        /* Read the input */
+        Xn = *pIO;
+        pIO += numChans;
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = (q63_t) b0 *Xn;
+        acc += (q63_t) b1 *Xn1;
+        acc += (q63_t) b2 *Xn2;
+        acc += (q63_t) a1 *Yn1;
+        acc += (q63_t) a2 *Yn2;
+
+        /* Every time after the output is computed state should be updated. */
+        Xn2 = Xn1;
+        Xn1 = Xn;
+        Yn2 = Yn1;
+
+        /* The result is converted to 1.31 */
+        Yn1 = (q31_t) (acc >> lShift);
+
+        /* Store the output in the destination buffer. */
+        *pOut = Yn1;
+        pOut += numChans;
+
+        /* decrement the loop counter */
+        sample--;
+      }
+
+      /*  Store the updated state variables back into the pState array */
+      pState[(ch * stateStride)] = Xn1;
+      pState[(ch * stateStride) + 1U] = Xn2;
+      pState[(ch * stateStride) + 2U] = Yn1;
+      pState[(ch * stateStride) + 3U] = Yn2;
+    }
+
+    /* The next stage uses the next 5 coefficients and the next 4 state values of each channel */
+    pCoeffs += 5U;
+    pState += 4U;
+
+    /*  The first stage goes from the input buffer to the output buffer. */
+    /*  Subsequent stages occur in-place in the output buffer */
+    pIn = pDst;
+
+  } while (--stage);
+
+}
+
+/**
+ * @} end of BiquadCascadeDF1 group
+ */
@@ -546,6 +546,164 @@ uint32_t blockSize)
 
 }
 
+#elif defined (ARM_MATH_HOST) && defined (__SSE2__)
+
+/* Run the below code for x86 hosts */
+
+void arm_fir_f32(
+const arm_fir_instance_f32 * S,
+float32_t * pSrc,
+float32_t * pDst,
+uint32_t blockSize)
+{
+   float32_t *pState = S->pState;                 /* State pointer */
+   float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+   float32_t *px;                                 /* Temporary pointer for state buffer */
+   float32_t acc;                                 /* Accumulator */
+   uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+   uint32_t i, blkCnt;                            /* Loop counters */
+
+   /* S->pState points to state array which contains previous frame (numTaps - 1) samples.
+   ** The new input samples are copied after them. */
+   memcpy(&(S->pState[(numTaps - 1U)]), pSrc, blockSize * sizeof(float32_t));
+
+   /* Each vector lane computes one output sample, multiplying each coefficient with
+   ** the state sample that lies as many samples further in the state buffer as the
+   ** lane is to the right. Every output accumulates the taps in the same order as
+   ** in the Cortex-M code, with separate multiplies and adds, so the results are
+   ** the same. Four vectors of outputs are computed at once to hide the latency of
+   ** the adds. */
+   blkCnt = blockSize;
+
+#if defined (__AVX2__)
+   while (blkCnt >= 32U)
+   {
+      __m256 acc0 = _mm256_setzero_ps();
+      __m256 acc1 = _mm256_setzero_ps();
+      __m256 acc2 = _mm256_setzero_ps();
+      __m256 acc3 = _mm256_setzero_ps();
+      __m256 c0;
+
+      px = pState;
+
+      for (i = 0U; i < numTaps; i++)
+      {
+         c0 = _mm256_broadcast_ss(&pCoeffs[i]);
+         acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_loadu_ps(px), c0));
+         acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(_mm256_loadu_ps(px + 8), c0));
+         acc2 = _mm256_add_ps(acc2, _mm256_mul_ps(_mm256_loadu_ps(px + 16), c0));
+         acc3 = _mm256_add_ps(acc3, _mm256_mul_ps(_mm256_loadu_ps(px + 24), c0));
+         px++;
+      }
+
+      _mm256_storeu_ps(pDst, acc0);
+      _mm256_storeu_ps(pDst + 8, acc1);
+      _mm256_storeu_ps(pDst + 16, acc2);
+      _mm256_storeu_ps(pDst + 24, acc3);
+
+      pDst += 32U;
+      pState += 32U;
+      blkCnt -= 32U;
+   }
+
+   while (blkCnt >= 8U)
+   {
+      __m256 acc0 = _mm256_setzero_ps();
+
+      px = pState;
+
+      for (i = 0U; i < numTaps; i++)
+      {
+         acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_loadu_ps(px), _mm256_broadcast_ss(&pCoeffs[i])));
+         px++;
+      }
+
+      _mm256_storeu_ps(pDst, acc0);
+
+      pDst += 8U;
+      pState += 8U;
+      blkCnt -= 8U;
+   }
+#else
+   while (blkCnt >= 16U)
+   {
+      __m128 acc0 = _mm_setzero_ps();
+      __m128 acc1 = _mm_setzero_ps();
+      __m128 acc2 = _mm_setzero_ps();
+      __m128 acc3 = _mm_setzero_ps();
+      __m128 c0;
+
+      px = pState;
+
+      for (i = 0U; i < numTaps; i++)
+      {
+         c0 = _mm_set1_ps(pCoeffs[i]);
+         acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(px), c0));
+         acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(px + 4), c0));
+         acc2 = _mm_add_ps(acc2, _mm_mul_ps(_mm_loadu_ps(px + 8), c0));
+         acc3 = _mm_add_ps(acc3, _mm_mul_ps(_mm_loadu_ps(px + 12), c0));
+         px++;
+      }
+
+      _mm_storeu_ps(pDst, acc0);
+      _mm_storeu_ps(pDst + 4, acc1);
+      _mm_storeu_ps(pDst + 8, acc2);
+      _mm_storeu_ps(pDst + 12, acc3);
+
+      pDst += 16U;
+      pState += 16U;
+      blkCnt -= 16U;
+   }
+#endif
+
+   while (blkCnt >= 4U)
+   {
+      __m128 acc0 = _mm_setzero_ps();
+
+      px = pState;
+
+      for (i = 0U; i < numTaps; i++)
+      {
+         acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(px), _mm_set1_ps(pCoeffs[i])));
+         px++;
+      }
+
+      _mm_storeu_ps(pDst, acc0);
+
+      pDst += 4U;
+      pState += 4U;
+      blkCnt -= 4U;
+   }
+
+   while (blkCnt > 0U)
+   {
+      /* Set the accumulator to zero */
+      acc = 0.0f;
+
+      /* Initialize state pointer */
+      px = pState;
+
+      /* Perform the multiply-accumulates */
+      for (i = 0U; i < numTaps; i++)
+      {
+         acc += *px++ * pCoeffs[i];
+      }
+
+      /* The result is store in the destination buffer. */
+      *pDst++ = acc;
+
+      /* Advance state pointer by 1 for the next sample */
+      pState = pState + 1;
+
+      blkCnt--;
+   }
+
+   /* Processing is complete.
+   ** Now copy the last numTaps - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+   memmove(S->pState, pState, (numTaps - 1U) * sizeof(float32_t));
+}
+
 #else
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
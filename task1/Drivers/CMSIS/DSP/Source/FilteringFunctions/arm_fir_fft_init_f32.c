@@ -0,0 +1,124 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_fft_init_f32.c
+ * Description:  Floating-point FFT-based FIR filter initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+* @ingroup groupFilters
+*/
+
+/**
+* @addtogroup FIR_FFT
+* @{
+*/
+
+/**
+* @details
+*
+* @param[in,out] *S points to an instance of the floating-point FFT-based FIR filter structure.
+* @param[in]     numTaps  Number of filter coefficients in the filter.
+* @param[in]     *pCoeffs points to the filter coefficients, in time reversed order.
+* @param[out]    *pCoeffsFreq points to the partition spectra, of size <code>2*numParts*blockSize</code>.
+* @param[in]     *pState points to the state buffer, of size <code>(2*numParts+1)*blockSize</code>.
+* @param[in]     *pScratch points to the scratch buffer, of size <code>4*blockSize</code>.
+* @param[in]     blockSize partition length, which is the number of samples transformed at a time.
+* Supported lengths are 16, 32, 64, 128, 256, 512, 1024, 2048.
+* @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+* <code>blockSize</code> is not a supported value or <code>numTaps</code> is zero.
+*
+* <b>Description:</b>
+* \par
+* <code>numParts</code> is <code>(numTaps + blockSize - 1) / blockSize</code>.  The last
+* partition is zero padded when <code>numTaps</code> is not a multiple of <code>blockSize</code>.
+* The scratch buffer is used to transform the partitions.
+*/
+
+arm_status arm_fir_fft_init_f32(
+  arm_fir_fft_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pCoeffsFreq,
+  float32_t * pState,
+  float32_t * pScratch,
+  uint32_t blockSize)
+{
+  arm_status status;                             /* status of the real FFT initialization */
+  uint32_t numParts;                             /* number of partitions */
+  uint32_t fftLen = 2U * blockSize;              /* real FFT length */
+  uint32_t part, n, tap;                         /* Loop counters */
+
+  if ((numTaps == 0U) || (blockSize > 2048U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* The real FFT checks the partition length */
+  status = arm_rfft_fast_init_f32(&S->rfft, (uint16_t) fftLen);
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    numParts = ((uint32_t) numTaps + blockSize - 1U) / blockSize;
+
+    /* Assign filter taps, partitions and buffers */
+    S->numTaps = numTaps;
+    S->blockSize = (uint16_t) blockSize;
+    S->numParts = (uint16_t) numParts;
+    S->partIndex = 0U;
+    S->pCoeffsFreq = pCoeffsFreq;
+    S->pState = pState;
+    S->pScratch = pScratch;
+
+    /* Transform each partition, zero padded to the FFT length */
+    for (part = 0U; part < numParts; part++)
+    {
+      arm_fill_f32(0.0f, pScratch, fftLen);
+
+      for (n = 0U; n < blockSize; n++)
+      {
+        /* b[tap] is stored at pCoeffs[numTaps - 1 - tap] */
+        tap = (part * blockSize) + n;
+
+        if (tap < numTaps)
+        {
+          pScratch[n] = pCoeffs[numTaps - 1U - tap];
+        }
+      }
+
+      arm_rfft_fast_f32(&S->rfft, pScratch, pCoeffsFreq + (part * fftLen), 0U);
+    }
+
+    /* Clear the previous input block and the delay line */
+    arm_fill_f32(0.0f, pState, ((2U * numParts) + 1U) * blockSize);
+  }
+
+  return (status);
+}
+
+/**
+* @} end of FIR_FFT group
+*/
@@ -0,0 +1,286 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_f32.c
+ * Description:  Floating-point polyphase rational resampler
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_Resample Finite Impulse Response (FIR) Rational Resampler
+ *
+ * These functions change the sample rate of a signal by a rational factor <code>L/M</code>.
+ * Conceptually, they are equivalent to an FIR interpolator by <code>L</code> followed by a
+ * decimator by <code>M</code>:
+ * the input is upsampled by inserting <code>L-1</code> zeros between samples, filtered with a
+ * lowpass filter, and every <code>M</code>-th sample of the result is kept.
+ * For a 44.1 kHz to 48 kHz conversion, <code>L=160</code> and <code>M=147</code>.
+ *
+ * The resampler functions compute this result without the intermediate signal at <code>L</code> times
+ * the input rate.
+ * Each output sample needs only one of the <code>L</code> polyphase components of the filter,
+ * so the cost per output sample is <code>phaseLength=numTaps/L</code> multiply-accumulates,
+ * whatever the values of <code>L</code> and <code>M</code>.
+ *
+ * The lowpass filter should have a normalized cutoff frequency of <code>1/max(L,M)</code>, to remove
+ * the images of the upsampler and the aliases of the decimator, and a passband gain of <code>L</code>.
+ * The user of the function is responsible for providing the filter coefficients.
+ *
+ * The functions operate on blocks of input data.
+ * Since the number of output samples depends on the position of the block in the stream,
+ * each call returns the number of samples it wrote to <code>pDst</code>.
+ * <code>pDst</code> must hold <code>(blockSize*L+M-1)/M</code> samples.
+ *
+ * The library provides separate functions for Q15 and floating-point data types.
+ *
+ * \par Algorithm:
+ * Output sample <code>m</code> lies at position <code>t=m*M</code> of the upsampled signal.
+ * With <code>n=t/L</code> and <code>p=t%L</code>, it is computed from polyphase component <code>p</code>:
+ * <pre>
+ *    y[m] = b[p] * x[n] + b[p+L] * x[n-1] + ... + b[p+L*(phaseLength-1)] * x[n-phaseLength+1]
+ * </pre>
+ * The functions step <code>n</code> and <code>p</code> from one output sample to the next
+ * without divisions, and carry them across calls.
+ * \par
+ * <code>pCoeffs</code> points to a coefficient array of size <code>numTaps</code>,
+ * stored in time reversed order as for the FIR interpolator:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], ..., b[1], b[0]}
+ * </pre>
+ * <code>numTaps</code> must be a multiple of the interpolation factor <code>L</code> and this is checked by the
+ * initialization functions.
+ * The initialization functions copy the coefficients to <code>pPhaseCoeffs</code>, also of size <code>numTaps</code>,
+ * with the <code>phaseLength</code> coefficients of each polyphase component stored consecutively,
+ * so that the processing functions read them sequentially:
+ * <pre>
+ *    {b[L*(phaseLength-1)], ..., b[L], b[0], b[L*(phaseLength-1)+1], ..., b[L+1], b[1], ...}
+ * </pre>
+ * \par
+ * <code>pState</code> points to a state array of size <code>blockSize + phaseLength - 1</code>,
+ * where <code>blockSize</code> is the largest number of input samples passed to one call.
+ * Samples in the state buffer are stored in the order:
+ * \par
+ * <pre>
+ *    {x[n-phaseLength+1], x[n-phaseLength], x[n-phaseLength-1], x[n-phaseLength-2]....x[0], x[1], ..., x[blockSize-1]}
+ * </pre>
+ * The state variables are updated after each block of data is processed, the coefficients are untouched.
+ *
+ * \par Instance Structure
+ * The coefficients and state variables for a resampler are stored together in an instance data structure.
+ * A separate instance structure must be defined for each resampler.
+ * Per-phase coefficient arrays may be shared among several instances while state variable array should be allocated separately.
+ * There are separate instance structure declarations for each of the 2 supported data types.
+ *
+ * \par Initialization Functions
+ * There is also an associated initialization function for each data type.
+ * The initialization function performs the following operations:
+ * - Checks the resampling factors and the length of the filter.
+ * - Stores the coefficients per polyphase component.
+ * - Sets the values of the internal structure fields.
+ * - Zeros out the values in the state buffer.
+ *
+ * \par Fixed-Point Behavior
+ * Care must be taken when using the fixed-point version of the resampler.
+ * In particular, the overflow and saturation behavior of the accumulator used in each function must be considered.
+ * Refer to the function specific documentation below for usage guidelines.
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point polyphase resampler.
+ * @param[in,out] *S        points to an instance of the floating-point resampler structure.
+ * @param[in]     *pSrc     points to the block of input data.
+ * @param[out]    *pDst     points to the block of output data.
+ * @param[in]     blockSize number of input samples to process.
+ * @return        number of output samples written to <code>pDst</code>.
+ */
+
+uint32_t arm_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Per-phase coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *px, *pb;                            /* Temporary pointers for state and coefficient buffers */
+  float32_t acc0;                                /* Accumulator */
+  uint32_t L = S->L;                             /* Upsample factor */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t n = S->inputOffset;                   /* Input position of the current output sample */
+  uint32_t p = S->phase;                         /* Polyphase component of the current output sample */
+  uint32_t stepInt, stepFrac;                    /* Input and phase increments between output samples */
+  uint32_t outCnt = 0U;                          /* Number of output samples */
+  uint32_t tapCnt, blkCnt;                       /* Loop counters */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  float32_t acc1;                                /* Accumulator */
+  float32_t x0, x1, x2, x3, c0, c1, c2, c3;      /* Temporary variables to hold state and coefficient values */
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  /* Moving by M samples of the upsampled signal advances the input by M/L samples
+   * and the polyphase component by M%L */
+  stepInt = S->M / L;
+  stepFrac = S->M % L;
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (phaseLen - 1U);
+
+  /* Copy the new input samples into the state buffer */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    *pStateCurnt++ = *pSrc++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the output samples that fall within this block of input */
+  while (n < blockSize)
+  {
+    /* x[n-phaseLength+1] is at pState[n] */
+    px = pState + n;
+
+    /* Coefficients of polyphase component p */
+    pb = pCoeffs + (p * phaseLen);
+
+#if defined (ARM_MATH_DSP)
+
+    /* Two accumulators, to keep the multiply-accumulates independent */
+    acc0 = 0.0f;
+    acc1 = 0.0f;
+
+    /* Loop unrolling. Process 4 taps at a time. */
+    tapCnt = phaseLen >> 2U;
+
+    while (tapCnt > 0U)
+    {
+      /* Read the state and coefficient values */
+      x0 = px[0];
+      x1 = px[1];
+      x2 = px[2];
+      x3 = px[3];
+      c0 = pb[0];
+      c1 = pb[1];
+      c2 = pb[2];
+      c3 = pb[3];
+
+      /* Perform the multiply-accumulates */
+      acc0 += x0 * c0;
+      acc1 += x1 * c1;
+      acc0 += x2 * c2;
+      acc1 += x3 * c3;
+
+      px += 4U;
+      pb += 4U;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    acc0 += acc1;
+
+    /* If the polyphase length is not a multiple of 4, compute the remaining filter taps */
+    tapCnt = phaseLen % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    acc0 = 0.0f;
+
+    tapCnt = phaseLen;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (tapCnt > 0U)
+    {
+      /* Perform the multiply-accumulate */
+      acc0 += *px++ * *pb++;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* The result is in the accumulator, store in the destination buffer. */
+    *pDst++ = acc0;
+    outCnt++;
+
+    /* Advance to the next output sample */
+    n += stepInt;
+    p += stepFrac;
+
+    if (p >= L)
+    {
+      p -= L;
+      n++;
+    }
+  }
+
+  /* Positions carry over to the next block */
+  S->inputOffset = n - blockSize;
+  S->phase = (uint16_t) p;
+
+  /* Processing is complete.
+   ** Now copy the last phaseLen - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+  pState = S->pState + blockSize;
+
+  tapCnt = phaseLen - 1U;
+
+  /* copy data */
+  while (tapCnt > 0U)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    tapCnt--;
+  }
+
+  return (outCnt);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
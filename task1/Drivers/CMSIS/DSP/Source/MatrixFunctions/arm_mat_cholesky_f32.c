@@ -0,0 +1,160 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_cholesky_f32.c
+ * Description:  Floating-point Cholesky decomposition
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixChol Cholesky and LDLT Decompositions
+ *
+ * Factorizes a symmetric matrix A into the product of a lower triangular matrix and its transpose.
+ *
+ * The Cholesky decomposition computes A = L * L<sup>T</sup> for a symmetric positive definite A,
+ * where L is lower triangular with a positive diagonal. The LDLT decomposition computes
+ * A = L * D * L<sup>T</sup>, where L is lower triangular with a unit diagonal and D is diagonal.
+ * It needs no square roots, and it also applies to symmetric matrices that are not positive
+ * definite as long as no pivot is zero.
+ *
+ * Together with the triangular solves (see \ref MatrixSolve), the factors solve A * X = B
+ * in about a third of the operations of inverting A and multiplying by B, and with smaller
+ * rounding errors.
+ *
+ * Only the lower triangle of the source matrix is read. The destination matrix may be the
+ * same as the source matrix, in which case the decomposition is done in place.
+ *
+ * \par Algorithm
+ * The Cholesky-Crout method computes L column by column. Element (i, j) of L, with i &ge; j,
+ * is obtained from a(i, j) minus the dot product of the first j elements of rows i and j of L,
+ * divided by l(j, j) when i &gt; j or square-rooted when i = j. If a diagonal element is not
+ * positive, the matrix is not positive definite and the function returns
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code>. The LDLT decomposition follows the same order,
+ * weighting each term of the dot products by the matching element of D. No pivoting is done.
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Floating-point Cholesky decomposition.
+ * @param[in]       *pSrc points to the instance of the input symmetric positive definite matrix
+ * @param[out]      *pDst points to the instance of the output lower triangular matrix, which may be pSrc
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the input matrix is not square or if the size
+ * of the output matrix does not match the size of the input matrix.
+ * If the input matrix is found not to be positive definite, then the function returns
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ */
+
+arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pIn = pSrc->pData;                  /* input data matrix pointer */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float32_t *pRowI, *pRowJ;                      /* pointers to the rows of the output matrix */
+  float32_t sum;                                 /* accumulator */
+  float32_t diag;                                /* diagonal element of the current column */
+  uint32_t n = pSrc->numRows;                    /* size of the matrix */
+  uint32_t i, j, k;                              /* loop counters */
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols)
+     || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+
+    for (j = 0U; j < n; j++)
+    {
+      pRowJ = pOut + (j * n);
+
+      /* l(j,j) = sqrt(a(j,j) - l(j,0)*l(j,0) - ... - l(j,j-1)*l(j,j-1)) */
+      sum = pIn[(j * n) + j];
+
+      for (k = 0U; k < j; k++)
+      {
+        sum -= pRowJ[k] * pRowJ[k];
+      }
+
+      /* The pivot of a positive definite matrix is positive */
+      if (sum <= 0.0f)
+      {
+        return ARM_MATH_DECOMPOSITION_FAILURE;
+      }
+
+      arm_sqrt_f32(sum, &diag);
+      pRowJ[j] = diag;
+
+      /* Element (i, j) of the input is read before element (i, j) of the output is written,
+       * and no input element is read after its output element is written, so that pSrc and
+       * pDst may be the same matrix. */
+      for (i = j + 1U; i < n; i++)
+      {
+        pRowI = pOut + (i * n);
+
+        /* l(i,j) = (a(i,j) - l(i,0)*l(j,0) - ... - l(i,j-1)*l(j,j-1)) / l(j,j) */
+        sum = pIn[(i * n) + j];
+
+        for (k = 0U; k < j; k++)
+        {
+          sum -= pRowI[k] * pRowJ[k];
+        }
+
+        pRowI[j] = sum / diag;
+      }
+
+      /* Writing all zeroes in the upper triangle of row j */
+      for (i = j + 1U; i < n; i++)
+      {
+        pRowJ[i] = 0.0f;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixChol group
+ */
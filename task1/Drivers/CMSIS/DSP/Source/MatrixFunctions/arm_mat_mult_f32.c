@@ -117,8 +117,56 @@ arm_status arm_mat_mult_f32(
 
       j = 0U;
 
+#if defined (ARM_MATH_HOST) && defined (__SSE2__)
+
+      /* On x86 hosts a vector of adjacent output columns is computed at once.
+       ** Every lane accumulates the products in the same order as the scalar loop. */
+#if defined (__AVX2__)
+      while (col >= 8U)
+      {
+        __m256 acc = _mm256_setzero_ps();
+
+        pIn1 = pInA;
+        pIn2 = pSrcB->pData + j;
+
+        for (colCnt = numColsA; colCnt > 0U; colCnt--)
+        {
+          acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_broadcast_ss(pIn1++), _mm256_loadu_ps(pIn2)));
+          pIn2 += numColsB;
+        }
+
+        _mm256_storeu_ps(px, acc);
+        px += 8U;
+        j += 8U;
+        col -= 8U;
+      }
+#endif
+
+      while (col >= 4U)
+      {
+        __m128 acc = _mm_setzero_ps();
+
+        pIn1 = pInA;
+        pIn2 = pSrcB->pData + j;
+
+        for (colCnt = numColsA; colCnt > 0U; colCnt--)
+        {
+          acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(*pIn1++), _mm_loadu_ps(pIn2)));
+          pIn2 += numColsB;
+        }
+
+        _mm_storeu_ps(px, acc);
+        px += 4U;
+        j += 4U;
+        col -= 4U;
+      }
+
+      pIn2 = pSrcB->pData + j;
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__SSE2__) */
+
       /* column loop */
-      do
+      while (col > 0U)
       {
         /* Set the variable sum, that acts as accumulator, to zero */
         sum = 0.0f;
@@ -180,7 +228,7 @@ arm_status arm_mat_mult_f32(
         /* Decrement the column loop counter */
         col--;
 
-      } while (col > 0U);
+      }
 
 #else
 
@@ -0,0 +1,248 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_tiled_f32.c
+ * Description:  Floating-point register-tiled matrix multiplication
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixMult
+ * @{
+ */
+
+/**
+ * @brief Floating-point matrix multiplication with a register-tiled kernel.
+ * @param[in]       *pSrcA points to the first input matrix structure
+ * @param[in]       *pSrcB points to the second input matrix structure
+ * @param[out]      *pDst points to output matrix structure
+ * @param[in]       *pState points to the array for storing a packed panel of pSrcB, of size 4 * numColsA
+ * @return     		The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * @details
+ * The output is computed in blocks of 4 x 4 elements held in registers. Before the blocks of a group of
+ * 4 output columns are computed, the 4 matching columns of pSrcB are packed row by row into
+ * <code>pState</code>. The kernel then reads both inputs sequentially, and every element it loads is
+ * used for 4 multiplications instead of 1. The packed panel is reused for all rows of pSrcA, so on
+ * cores with a data cache it stays in the cache as long as 16 * numColsA bytes fit.
+ *
+ * \par
+ * Every output element accumulates its products in the same order as <code>arm_mat_mult_f32()</code>.
+ * The function is worth using from about 8 x 8 matrices upwards.
+ */
+
+arm_status arm_mat_mult_tiled_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst,
+  float32_t * pState)
+{
+  float32_t *pInA = pSrcA->pData;                /* input data matrix pointer A */
+  float32_t *pInB = pSrcB->pData;                /* input data matrix pointer B */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float32_t *pA0, *pA1, *pA2, *pA3;              /* row pointers of the block of pSrcA */
+  float32_t *pB;                                 /* packed panel pointer */
+  float32_t *px;                                 /* Temporary output data matrix pointer */
+  float32_t a0, a1, a2, a3;                      /* elements of a column of the block of pSrcA */
+  float32_t b0, b1, b2, b3;                      /* elements of a row of the packed panel */
+  float32_t c00, c01, c02, c03;                  /* accumulators of the 4 x 4 output block */
+  float32_t c10, c11, c12, c13;
+  float32_t c20, c21, c22, c23;
+  float32_t c30, c31, c32, c33;
+  uint16_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint16_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  uint16_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t col, row, k, nCols;                   /* loop counters */
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* Loop over the groups of 4 output columns */
+    for (col = 0U; col < numColsB; col += 4U)
+    {
+      /* The last group may have 1 to 3 columns.
+       ** Its panel is padded with zeros and the padded outputs are not stored. */
+      nCols = numColsB - col;
+      if (nCols > 4U)
+      {
+        nCols = 4U;
+      }
+
+      /* Pack the columns of pSrcB: row k of the panel holds B(k, col) to B(k, col + 3) */
+      pB = pState;
+      px = pInB + col;
+
+      for (k = 0U; k < numColsA; k++)
+      {
+        pB[0] = px[0];
+        pB[1] = (nCols > 1U) ? px[1] : 0.0f;
+        pB[2] = (nCols > 2U) ? px[2] : 0.0f;
+        pB[3] = (nCols > 3U) ? px[3] : 0.0f;
+
+        pB += 4U;
+        px += numColsB;
+      }
+
+      pA0 = pInA;
+      px = pOut + col;
+
+      /* Compute the 4 x 4 output blocks */
+      for (row = numRowsA >> 2U; row > 0U; row--)
+      {
+        pA1 = pA0 + numColsA;
+        pA2 = pA1 + numColsA;
+        pA3 = pA2 + numColsA;
+        pB = pState;
+
+        c00 = 0.0f; c01 = 0.0f; c02 = 0.0f; c03 = 0.0f;
+        c10 = 0.0f; c11 = 0.0f; c12 = 0.0f; c13 = 0.0f;
+        c20 = 0.0f; c21 = 0.0f; c22 = 0.0f; c23 = 0.0f;
+        c30 = 0.0f; c31 = 0.0f; c32 = 0.0f; c33 = 0.0f;
+
+        for (k = numColsA; k > 0U; k--)
+        {
+          /* c(m,n) = a(m,1)*b(1,n) + a(m,2) * b(2,n) + .... + a(m,p)*b(p,n) */
+          b0 = pB[0];
+          b1 = pB[1];
+          b2 = pB[2];
+          b3 = pB[3];
+          pB += 4U;
+
+          a0 = *pA0++;
+          a1 = *pA1++;
+          a2 = *pA2++;
+          a3 = *pA3++;
+
+          c00 += a0 * b0;
+          c01 += a0 * b1;
+          c02 += a0 * b2;
+          c03 += a0 * b3;
+          c10 += a1 * b0;
+          c11 += a1 * b1;
+          c12 += a1 * b2;
+          c13 += a1 * b3;
+          c20 += a2 * b0;
+          c21 += a2 * b1;
+          c22 += a2 * b2;
+          c23 += a2 * b3;
+          c30 += a3 * b0;
+          c31 += a3 * b1;
+          c32 += a3 * b2;
+          c33 += a3 * b3;
+        }
+
+        /* Store the block in the destination buffer */
+        if (nCols == 4U)
+        {
+          px[0] = c00; px[1] = c01; px[2] = c02; px[3] = c03;
+          px += numColsB;
+          px[0] = c10; px[1] = c11; px[2] = c12; px[3] = c13;
+          px += numColsB;
+          px[0] = c20; px[1] = c21; px[2] = c22; px[3] = c23;
+          px += numColsB;
+          px[0] = c30; px[1] = c31; px[2] = c32; px[3] = c33;
+          px += numColsB;
+        }
+        else
+        {
+          px[0] = c00; px[numColsB] = c10; px[2U * numColsB] = c20; px[3U * numColsB] = c30;
+          if (nCols > 1U)
+          {
+            px[1] = c01; px[numColsB + 1U] = c11; px[2U * numColsB + 1U] = c21; px[3U * numColsB + 1U] = c31;
+          }
+          if (nCols > 2U)
+          {
+            px[2] = c02; px[numColsB + 2U] = c12; px[2U * numColsB + 2U] = c22; px[3U * numColsB + 2U] = c32;
+          }
+          px += 4U * numColsB;
+        }
+
+        /* pA3 now points to the first row of the next block */
+        pA0 = pA3;
+      }
+
+      /* Compute the remaining 1 to 3 rows one at a time */
+      for (row = numRowsA & 3U; row > 0U; row--)
+      {
+        pB = pState;
+
+        c00 = 0.0f; c01 = 0.0f; c02 = 0.0f; c03 = 0.0f;
+
+        for (k = numColsA; k > 0U; k--)
+        {
+          a0 = *pA0++;
+
+          c00 += a0 * pB[0];
+          c01 += a0 * pB[1];
+          c02 += a0 * pB[2];
+          c03 += a0 * pB[3];
+          pB += 4U;
+        }
+
+        px[0] = c00;
+        if (nCols > 1U)
+        {
+          px[1] = c01;
+        }
+        if (nCols > 2U)
+        {
+          px[2] = c02;
+        }
+        if (nCols > 3U)
+        {
+          px[3] = c03;
+        }
+        px += numColsB;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixMult group
+ */
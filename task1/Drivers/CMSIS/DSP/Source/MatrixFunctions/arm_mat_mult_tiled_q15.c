@@ -0,0 +1,239 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_tiled_q15.c
+ * Description:  Q15 register-tiled matrix multiplication
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixMult
+ * @{
+ */
+
+/**
+ * @brief Q15 matrix multiplication with a register-tiled kernel.
+ * @param[in]       *pSrcA points to the first input matrix structure
+ * @param[in]       *pSrcB points to the second input matrix structure
+ * @param[out]      *pDst points to output matrix structure
+ * @param[in]       *pState points to the word aligned array for storing a packed panel of pSrcB,
+ *                  of size 2 * numColsA rounded up to a multiple of 4
+ * @return     		The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * @details
+ * The output is computed in blocks of 2 x 2 elements, with the four 64-bit accumulators held in
+ * registers. Before the blocks of a pair of output columns are computed, the 2 matching columns of
+ * pSrcB are packed into <code>pState</code> as pairs of consecutive rows, so that on Cortex-M4 and
+ * Cortex-M7 each 32-bit load of pSrcA or of the panel feeds two dual multiply-accumulates.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The scaling is the same as in <code>arm_mat_mult_q15()</code>: the 2.30 products are accumulated in
+ * a 64-bit accumulator in 34.30 format, which is truncated to 34.15 format by discarding the low
+ * 15 bits and then saturated to 1.15 format.
+ */
+
+arm_status arm_mat_mult_tiled_q15(
+  const arm_matrix_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB,
+  arm_matrix_instance_q15 * pDst,
+  q15_t * pState)
+{
+  q15_t *pInA = pSrcA->pData;                    /* input data matrix pointer A */
+  q15_t *pInB = pSrcB->pData;                    /* input data matrix pointer B */
+  q15_t *pOut = pDst->pData;                     /* output data matrix pointer */
+  q15_t *pA0, *pA1;                              /* row pointers of the block of pSrcA */
+  q15_t *pB;                                     /* packed panel pointer */
+  q15_t *px;                                     /* Temporary output data matrix pointer */
+  q63_t c00, c01, c10, c11;                      /* accumulators of the 2 x 2 output block */
+  uint16_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint16_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  uint16_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t col, row, k;                          /* loop counters */
+  arm_status status;                             /* status of matrix multiplication */
+
+#if defined (ARM_MATH_DSP) && !defined (UNALIGNED_SUPPORT_DISABLE)
+
+  q31_t inA0, inA1, inB0, inB1;                  /* Temporary variables to hold pairs of inputs */
+
+#else
+
+  q15_t a0, a1;                                  /* Temporary variables to hold the inputs */
+
+#endif
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* Loop over the pairs of output columns */
+    for (col = 0U; col < numColsB; col += 2U)
+    {
+      /* Pack the columns of pSrcB: for each pair of rows k and k + 1 the panel holds
+       ** B(k, col), B(k + 1, col), B(k, col + 1) and B(k + 1, col + 1).
+       ** A last single row or column is padded with zeros and the padded outputs are not stored. */
+      pB = pState;
+      px = pInB + col;
+
+      for (k = 0U; k < numColsA; k += 2U)
+      {
+        pB[0] = px[0];
+        pB[1] = (k + 1U < numColsA) ? px[numColsB] : 0;
+        pB[2] = (col + 1U < numColsB) ? px[1] : 0;
+        pB[3] = ((k + 1U < numColsA) && (col + 1U < numColsB)) ? px[numColsB + 1U] : 0;
+
+        pB += 4U;
+        px += 2U * numColsB;
+      }
+
+      pA0 = pInA;
+      px = pOut + col;
+
+      /* Compute the 2 x 2 output blocks */
+      for (row = numRowsA >> 1U; row > 0U; row--)
+      {
+        pA1 = pA0 + numColsA;
+        pB = pState;
+
+        c00 = 0;
+        c01 = 0;
+        c10 = 0;
+        c11 = 0;
+
+#if defined (ARM_MATH_DSP) && !defined (UNALIGNED_SUPPORT_DISABLE)
+
+        /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+        for (k = numColsA >> 1U; k > 0U; k--)
+        {
+          /* c(m,n) = a(m,1)*b(1,n) + a(m,2) * b(2,n) + .... + a(m,p)*b(p,n) */
+          inA0 = *__SIMD32(pA0)++;
+          inA1 = *__SIMD32(pA1)++;
+          inB0 = *__SIMD32(pB)++;
+          inB1 = *__SIMD32(pB)++;
+
+          c00 = __SMLALD(inA0, inB0, c00);
+          c01 = __SMLALD(inA0, inB1, c01);
+          c10 = __SMLALD(inA1, inB0, c10);
+          c11 = __SMLALD(inA1, inB1, c11);
+        }
+
+        /* The last column of pSrcA if the number of columns is odd */
+        if ((numColsA & 1U) != 0U)
+        {
+          c00 += (q31_t) *pA0 * pB[0];
+          c01 += (q31_t) *pA0++ * pB[2];
+          c10 += (q31_t) *pA1 * pB[0];
+          c11 += (q31_t) *pA1++ * pB[2];
+        }
+
+#else
+
+        /* Run the below code for Cortex-M0 */
+
+        for (k = 0U; k < numColsA; k++)
+        {
+          /* c(m,n) = a(m,1)*b(1,n) + a(m,2) * b(2,n) + .... + a(m,p)*b(p,n) */
+          a0 = *pA0++;
+          a1 = *pA1++;
+
+          c00 += (q31_t) a0 * pB[(k & 1U)];
+          c01 += (q31_t) a0 * pB[(k & 1U) + 2U];
+          c10 += (q31_t) a1 * pB[(k & 1U)];
+          c11 += (q31_t) a1 * pB[(k & 1U) + 2U];
+
+          pB += (k & 1U) << 2U;
+        }
+
+#endif /* #if defined (ARM_MATH_DSP) && !defined (UNALIGNED_SUPPORT_DISABLE) */
+
+        /* Convert the result from 34.30 to 1.15 format and store it in the destination buffer */
+        px[0] = (q15_t) __SSAT((q31_t) (c00 >> 15), 16);
+        px[numColsB] = (q15_t) __SSAT((q31_t) (c10 >> 15), 16);
+
+        if (col + 1U < numColsB)
+        {
+          px[1] = (q15_t) __SSAT((q31_t) (c01 >> 15), 16);
+          px[numColsB + 1U] = (q15_t) __SSAT((q31_t) (c11 >> 15), 16);
+        }
+
+        px += 2U * numColsB;
+
+        /* pA1 now points to the first row of the next block */
+        pA0 = pA1;
+      }
+
+      /* Compute the last row if the number of rows is odd */
+      if ((numRowsA & 1U) != 0U)
+      {
+        pB = pState;
+
+        c00 = 0;
+        c01 = 0;
+
+        for (k = 0U; k < numColsA; k++)
+        {
+          c00 += (q31_t) *pA0 * pB[(k & 1U)];
+          c01 += (q31_t) *pA0++ * pB[(k & 1U) + 2U];
+
+          pB += (k & 1U) << 2U;
+        }
+
+        px[0] = (q15_t) __SSAT((q31_t) (c00 >> 15), 16);
+
+        if (col + 1U < numColsB)
+        {
+          px[1] = (q15_t) __SSAT((q31_t) (c01 >> 15), 16);
+        }
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixMult group
+ */
@@ -0,0 +1,195 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_tiled_q31.c
+ * Description:  Q31 register-tiled matrix multiplication
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixMult
+ * @{
+ */
+
+/**
+ * @brief Q31 matrix multiplication with a register-tiled kernel.
+ * @param[in]       *pSrcA points to the first input matrix structure
+ * @param[in]       *pSrcB points to the second input matrix structure
+ * @param[out]      *pDst points to output matrix structure
+ * @param[in]       *pState points to the array for storing a packed panel of pSrcB, of size 2 * numColsA
+ * @return     		The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * @details
+ * The output is computed in blocks of 2 x 2 elements, with the four 64-bit accumulators held in
+ * registers. Before the blocks of a pair of output columns are computed, the 2 matching columns of
+ * pSrcB are packed row by row into <code>pState</code>, so the kernel reads both inputs sequentially
+ * and loads one element per multiply-accumulate instead of two.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The scaling is the same as in <code>arm_mat_mult_q31()</code>: the products are accumulated in a
+ * 2.62 accumulator, which is right shifted by 31 bits and saturated to 1.31 format.
+ */
+
+arm_status arm_mat_mult_tiled_q31(
+  const arm_matrix_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+  arm_matrix_instance_q31 * pDst,
+  q31_t * pState)
+{
+  q31_t *pInA = pSrcA->pData;                    /* input data matrix pointer A */
+  q31_t *pInB = pSrcB->pData;                    /* input data matrix pointer B */
+  q31_t *pOut = pDst->pData;                     /* output data matrix pointer */
+  q31_t *pA0, *pA1;                              /* row pointers of the block of pSrcA */
+  q31_t *pB;                                     /* packed panel pointer */
+  q31_t *px;                                     /* Temporary output data matrix pointer */
+  q31_t a0, a1, b0, b1;                          /* Temporary variables to hold the inputs */
+  q63_t c00, c01, c10, c11;                      /* accumulators of the 2 x 2 output block */
+  uint16_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint16_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  uint16_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t col, row, k;                          /* loop counters */
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* Loop over the pairs of output columns */
+    for (col = 0U; col < numColsB; col += 2U)
+    {
+      /* Pack the columns of pSrcB: row k of the panel holds B(k, col) and B(k, col + 1).
+       ** A last single column is padded with zeros and the padded outputs are not stored. */
+      pB = pState;
+      px = pInB + col;
+
+      for (k = 0U; k < numColsA; k++)
+      {
+        pB[0] = px[0];
+        pB[1] = (col + 1U < numColsB) ? px[1] : 0;
+
+        pB += 2U;
+        px += numColsB;
+      }
+
+      pA0 = pInA;
+      px = pOut + col;
+
+      /* Compute the 2 x 2 output blocks */
+      for (row = numRowsA >> 1U; row > 0U; row--)
+      {
+        pA1 = pA0 + numColsA;
+        pB = pState;
+
+        c00 = 0;
+        c01 = 0;
+        c10 = 0;
+        c11 = 0;
+
+        for (k = numColsA; k > 0U; k--)
+        {
+          /* c(m,n) = a(m,1)*b(1,n) + a(m,2) * b(2,n) + .... + a(m,p)*b(p,n) */
+          b0 = pB[0];
+          b1 = pB[1];
+          pB += 2U;
+
+          a0 = *pA0++;
+          a1 = *pA1++;
+
+          c00 += (q63_t) a0 * b0;
+          c01 += (q63_t) a0 * b1;
+          c10 += (q63_t) a1 * b0;
+          c11 += (q63_t) a1 * b1;
+        }
+
+        /* Convert the result from 2.62 to 1.31 format and store it in the destination buffer */
+        px[0] = clip_q63_to_q31(c00 >> 31);
+        px[numColsB] = clip_q63_to_q31(c10 >> 31);
+
+        if (col + 1U < numColsB)
+        {
+          px[1] = clip_q63_to_q31(c01 >> 31);
+          px[numColsB + 1U] = clip_q63_to_q31(c11 >> 31);
+        }
+
+        px += 2U * numColsB;
+
+        /* pA1 now points to the first row of the next block */
+        pA0 = pA1;
+      }
+
+      /* Compute the last row if the number of rows is odd */
+      if ((numRowsA & 1U) != 0U)
+      {
+        pB = pState;
+
+        c00 = 0;
+        c01 = 0;
+
+        for (k = numColsA; k > 0U; k--)
+        {
+          a0 = *pA0++;
+
+          c00 += (q63_t) a0 * pB[0];
+          c01 += (q63_t) a0 * pB[1];
+          pB += 2U;
+        }
+
+        px[0] = clip_q63_to_q31(c00 >> 31);
+
+        if (col + 1U < numColsB)
+        {
+          px[1] = clip_q63_to_q31(c01 >> 31);
+        }
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixMult group
+ */
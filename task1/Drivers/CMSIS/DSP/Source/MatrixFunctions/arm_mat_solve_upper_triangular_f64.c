@@ -0,0 +1,118 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_solve_upper_triangular_f64.c
+ * Description:  Floating-point upper triangular solve
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSolve
+ * @{
+ */
+
+/**
+ * @brief Floating-point upper triangular solve.
+ * @param[in]       *pSrcU points to the instance of the upper triangular matrix
+ * @param[in]       *pSrcB points to the instance of the right-hand side matrix
+ * @param[out]      *pDst points to the instance of the solution matrix, which may be pSrcB
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the sizes of the matrices do not match.
+ * If a diagonal element of the triangular matrix is zero, then the function returns
+ * <code>ARM_MATH_SINGULAR</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ */
+
+arm_status arm_mat_solve_upper_triangular_f64(
+  const arm_matrix_instance_f64 * pSrcU,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst)
+{
+  float64_t *pInU = pSrcU->pData;                /* triangular matrix pointer */
+  float64_t *pInB = pSrcB->pData;                /* right-hand side matrix pointer */
+  float64_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float64_t *pRowU;                              /* pointer to the current row of the triangular matrix */
+  float64_t *pX;                                 /* pointer to the current column of the output matrix */
+  float64_t sum;                                 /* accumulator */
+  uint32_t n = pSrcU->numRows;                   /* size of the triangular matrix */
+  uint32_t numCols = pSrcB->numCols;             /* number of columns of the solution */
+  uint32_t i, j, k;                              /* loop counters */
+  arm_status status;                             /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcU->numRows != pSrcU->numCols) || (pSrcB->numRows != pSrcU->numRows)
+     || (pDst->numRows != pSrcB->numRows) || (pDst->numCols != pSrcB->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+
+    /* Back substitution, from the last row to the first */
+    for (i = n; i > 0U; i--)
+    {
+      pRowU = pInU + ((i - 1U) * n);
+
+      if (pRowU[i - 1U] == 0.0)
+      {
+        return ARM_MATH_SINGULAR;
+      }
+
+      for (j = 0U; j < numCols; j++)
+      {
+        pX = pOut + (i * numCols) + j;
+
+        /* x(i,j) = (b(i,j) - u(i,i+1)*x(i+1,j) - ... - u(i,n-1)*x(n-1,j)) / u(i,i) */
+        sum = pInB[((i - 1U) * numCols) + j];
+
+        for (k = i; k < n; k++)
+        {
+          sum -= pRowU[k] * *pX;
+          pX += numCols;
+        }
+
+        /* b(i,j) is not read again, so that pSrcB and pDst may be the same matrix */
+        pOut[((i - 1U) * numCols) + j] = sum / pRowU[i - 1U];
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixSolve group
+ */
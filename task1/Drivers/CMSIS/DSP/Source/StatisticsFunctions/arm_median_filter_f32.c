@@ -0,0 +1,268 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_median_filter_f32.c
+ * Description:  Floating-point running median filter
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup Median Running Median Filter
+ *
+ * Computes the median of the last <code>windowLen</code> input samples, for each input sample.
+ * A median filter removes impulsive noise and outliers while preserving steps in the signal.
+ *
+ * \par
+ * Sorting the window for every sample takes O(N<sup>2</sup>) operations with an insertion sort, or O(N) to insert
+ * the new sample in a sorted copy of the window. This filter keeps the window in a circular buffer and splits its
+ * samples in two heaps of indices: a max-heap holding the lower half of the window and a min-heap holding the upper half.
+ * The lower half has one more sample for odd window lengths. The median is at the top of the lower heap, or is the
+ * mean of both tops for even window lengths.
+ * \par
+ * The new sample overwrites the oldest one and takes its place in the heap, then it is sifted up or down that heap.
+ * If the tops of the heaps are then out of order, they are exchanged and sifted down. Each sample costs
+ * O(log N) comparisons and moves, for a window of N samples.
+ *
+ * \par
+ * The heap buffer holds the <code>windowLen</code> heap entries, followed by the heap position of each
+ * sample of the window. The lengths are:
+ * <pre>
+ *     pState: windowLen samples
+ *     pHeap:  2*windowLen entries
+ * </pre>
+ * The window starts filled with zeros.
+ *
+ * \par Fixed-Point Behavior
+ * The output is one of the input samples for odd window lengths. For even window lengths, the sum of the
+ * two middle samples is computed with guard bits and shifted right by one bit.
+ *
+ * There are separate functions for floating-point, Q31, and Q15 data types.
+ */
+
+/**
+ * @addtogroup Median
+ * @{
+ */
+
+/**
+ * @brief  Moves an entry of the lower max-heap to its place.
+ */
+static void arm_median_heap_low_f32(
+  float32_t * pState,
+  uint16_t * pHeap,
+  uint16_t * pPos,
+  uint32_t heapLen,
+  uint32_t i)
+{
+  float32_t value;                               /* Sample of the entry being moved */
+  uint32_t parent, child;                        /* Heap positions */
+  uint16_t item;                                 /* Index of the sample being moved */
+
+  item = pHeap[i];
+  value = pState[item];
+
+  /* Sift up while the parent is smaller */
+  while (i > 0U)
+  {
+    parent = (i - 1U) >> 1U;
+
+    if (pState[pHeap[parent]] >= value)
+    {
+      break;
+    }
+
+    pHeap[i] = pHeap[parent];
+    pPos[pHeap[i]] = (uint16_t) i;
+    i = parent;
+  }
+
+  /* Sift down while the larger child is larger */
+  while ((child = (2U * i) + 1U) < heapLen)
+  {
+    if (((child + 1U) < heapLen) && (pState[pHeap[child + 1U]] > pState[pHeap[child]]))
+    {
+      child++;
+    }
+
+    if (pState[pHeap[child]] <= value)
+    {
+      break;
+    }
+
+    pHeap[i] = pHeap[child];
+    pPos[pHeap[i]] = (uint16_t) i;
+    i = child;
+  }
+
+  pHeap[i] = item;
+  pPos[item] = (uint16_t) i;
+}
+
+/**
+ * @brief  Moves an entry of the upper min-heap to its place.
+ *
+ * The upper heap starts at entry <code>offset</code> of the heap buffer.
+ */
+static void arm_median_heap_high_f32(
+  float32_t * pState,
+  uint16_t * pHeap,
+  uint16_t * pPos,
+  uint32_t offset,
+  uint32_t heapLen,
+  uint32_t i)
+{
+  float32_t value;                               /* Sample of the entry being moved */
+  uint32_t parent, child;                        /* Heap positions */
+  uint16_t item;                                 /* Index of the sample being moved */
+
+  pHeap += offset;
+  item = pHeap[i];
+  value = pState[item];
+
+  /* Sift up while the parent is larger */
+  while (i > 0U)
+  {
+    parent = (i - 1U) >> 1U;
+
+    if (pState[pHeap[parent]] <= value)
+    {
+      break;
+    }
+
+    pHeap[i] = pHeap[parent];
+    pPos[pHeap[i]] = (uint16_t) (offset + i);
+    i = parent;
+  }
+
+  /* Sift down while the smaller child is smaller */
+  while ((child = (2U * i) + 1U) < heapLen)
+  {
+    if (((child + 1U) < heapLen) && (pState[pHeap[child + 1U]] < pState[pHeap[child]]))
+    {
+      child++;
+    }
+
+    if (pState[pHeap[child]] >= value)
+    {
+      break;
+    }
+
+    pHeap[i] = pHeap[child];
+    pPos[pHeap[i]] = (uint16_t) (offset + i);
+    i = child;
+  }
+
+  pHeap[i] = item;
+  pPos[item] = (uint16_t) (offset + i);
+}
+
+/**
+ * @brief Processing function for the floating-point running median filter.
+ * @param[in,out] *S        points to an instance of the floating-point median filter structure.
+ * @param[in]     *pSrc     points to the block of input data.
+ * @param[out]    *pDst     points to the block of output data.
+ * @param[in]     blockSize number of samples to process.
+ * @return none.
+ */
+
+void arm_median_filter_f32(
+  arm_median_filter_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  uint16_t *pHeap = S->pHeap;                    /* Heap entries */
+  uint16_t *pPos = pHeap + S->windowLen;         /* Heap position of each sample */
+  uint32_t windowLen = S->windowLen;             /* Number of samples in the window */
+  uint32_t lowLen = (windowLen + 1U) >> 1U;      /* Number of samples in the lower half */
+  uint32_t highLen = windowLen - lowLen;         /* Number of samples in the upper half */
+  uint32_t index = S->stateIndex;                /* Position of the oldest sample */
+  uint32_t pos;                                  /* Heap position of the new sample */
+  uint32_t blkCnt;                               /* Loop counter */
+  uint16_t low, high;                            /* Indices of the samples at the tops of the heaps */
+
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    /* The new sample replaces the oldest one in the window and in its heap */
+    pState[index] = *pSrc++;
+    pos = pPos[index];
+
+    if (pos < lowLen)
+    {
+      arm_median_heap_low_f32(pState, pHeap, pPos, lowLen, pos);
+    }
+    else
+    {
+      arm_median_heap_high_f32(pState, pHeap, pPos, lowLen, highLen, pos - lowLen);
+    }
+
+    if (highLen > 0U)
+    {
+      low = pHeap[0];
+      high = pHeap[lowLen];
+
+      /* A sample that crossed the median is exchanged with the top of the other heap */
+      if (pState[low] > pState[high])
+      {
+        pHeap[0] = high;
+        pPos[high] = 0U;
+        pHeap[lowLen] = low;
+        pPos[low] = (uint16_t) lowLen;
+
+        arm_median_heap_low_f32(pState, pHeap, pPos, lowLen, 0U);
+        arm_median_heap_high_f32(pState, pHeap, pPos, lowLen, highLen, 0U);
+      }
+    }
+
+    /* The median is the largest sample of the lower half, or the mean of both middle samples */
+    if (lowLen == highLen)
+    {
+      *pDst++ = 0.5f * (pState[pHeap[0]] + pState[pHeap[lowLen]]);
+    }
+    else
+    {
+      *pDst++ = pState[pHeap[0]];
+    }
+
+    /* Advance to the next oldest sample */
+    index = (index + 1U < windowLen) ? (index + 1U) : 0U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->stateIndex = (uint16_t) index;
+}
+
+/**
+ * @} end of Median group
+ */
@@ -0,0 +1,178 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_percentile_q31.c
+ * Description:  Percentile of a Q31 vector
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Percentile
+ * @{
+ */
+
+/* Ranges up to this length are finished by an insertion sort */
+#define PERCENTILE_Q31_SORT_LEN 8U
+
+/**
+ * @brief  Exchanges two samples.
+ */
+CMSIS_INLINE __STATIC_INLINE void arm_select_swap_q31(
+  q31_t * pA,
+  q31_t * pB)
+{
+  q31_t in = *pA;
+
+  *pA = *pB;
+  *pB = in;
+}
+
+/**
+ * @brief  Finds the k-th smallest sample by quickselect, reordering the buffer.
+ */
+static q31_t arm_select_q31(
+  q31_t * pData,
+  uint32_t blockSize,
+  uint32_t k)
+{
+  q31_t pivot, in;                               /* Partitioning value and temporary variable */
+  uint32_t lo, hi, i, j;                         /* Limits of the range holding the k-th sample */
+
+  lo = 0U;
+  hi = blockSize - 1U;
+
+  while ((hi - lo) > PERCENTILE_Q31_SORT_LEN)
+  {
+    /* Median of three: order the first, middle and last samples */
+    i = lo + ((hi - lo) >> 1U);
+
+    if (pData[i] < pData[lo])
+    {
+      arm_select_swap_q31(&pData[i], &pData[lo]);
+    }
+    if (pData[hi] < pData[i])
+    {
+      arm_select_swap_q31(&pData[hi], &pData[i]);
+
+      if (pData[i] < pData[lo])
+      {
+        arm_select_swap_q31(&pData[i], &pData[lo]);
+      }
+    }
+
+    pivot = pData[i];
+
+    /* Hoare partition. The first and last samples stop the scans, and samples
+     * equal to the pivot are spread over both sides. */
+    i = lo;
+    j = hi;
+
+    while (1)
+    {
+      do
+      {
+        i++;
+      } while (pData[i] < pivot);
+
+      do
+      {
+        j--;
+      } while (pData[j] > pivot);
+
+      if (i >= j)
+      {
+        break;
+      }
+
+      arm_select_swap_q31(&pData[i], &pData[j]);
+    }
+
+    /* Samples up to j are not larger than the pivot, the others not smaller */
+    if (k <= j)
+    {
+      hi = j;
+    }
+    else
+    {
+      lo = j + 1U;
+    }
+  }
+
+  /* Insertion sort of the remaining range */
+  for (i = lo + 1U; i <= hi; i++)
+  {
+    in = pData[i];
+
+    for (j = i; (j > lo) && (pData[j - 1U] > in); j--)
+    {
+      pData[j] = pData[j - 1U];
+    }
+
+    pData[j] = in;
+  }
+
+  return (pData[k]);
+}
+
+/**
+ * @brief Percentile of a Q31 vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       *pScratch points to a buffer of blockSize samples
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       percentile fraction of the samples below the result, in 1.31 format
+ * @param[out]      *pResult percentile value returned here
+ * @return none.
+ *
+ * \par
+ * The result is the sample at index <code>floor(percentile * blockSize)</code> of the sorted vector.
+ * Negative fractions select the minimum.
+ */
+
+void arm_percentile_q31(
+  q31_t * pSrc,
+  q31_t * pScratch,
+  uint32_t blockSize,
+  q31_t percentile,
+  q31_t * pResult)
+{
+  uint32_t k;                                    /* Index of the result in the sorted vector */
+
+  if (pScratch != pSrc)
+  {
+    memcpy(pScratch, pSrc, blockSize * sizeof(q31_t));
+  }
+
+  k = (percentile > 0) ? (uint32_t) (((uint64_t) percentile * blockSize) >> 31U) : 0U;
+
+  *pResult = arm_select_q31(pScratch, blockSize, k);
+}
+
+/**
+ * @} end of Percentile group
+ */
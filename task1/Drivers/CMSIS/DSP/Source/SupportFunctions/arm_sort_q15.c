@@ -0,0 +1,202 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sort_q15.c
+ * Description:  Sorts the elements of a Q15 vector
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Sort
+ * @{
+ */
+
+/* Vectors up to this length are sorted by the bitonic network, longer ones by the radix sort */
+#define SORT_Q15_BITONIC_MAX_LEN 32U
+
+/**
+ * @brief  Orders two samples.
+ */
+CMSIS_INLINE __STATIC_INLINE void arm_sort_exchange_q15(
+  q15_t * pA,
+  q15_t * pB)
+{
+  q15_t a = *pA;
+  q15_t b = *pB;
+
+  /* Both samples are stored back, so that the selection compiles without branches */
+  *pA = (a < b) ? a : b;
+  *pB = (a < b) ? b : a;
+}
+
+/**
+ * @brief  In-place bitonic sorting network.
+ */
+static void arm_sort_bitonic_q15(
+  q15_t * pData,
+  uint32_t blockSize)
+{
+  q15_t *pA, *pB;                                /* Pointers to the two samples of a comparator */
+  uint32_t size, half, base, i, start, stop;     /* Loop counters and limits */
+
+  for (size = 2U; (size >> 1U) < blockSize; size <<= 1U)
+  {
+    half = size >> 1U;
+
+    /* Merge the sorted runs of half samples by pairs: each sample of the first
+     * run is compared with its mirror image in the second run. Comparators past
+     * the end of the vector are skipped, as if it was padded with +inf. */
+    for (base = 0U; (base + half) < blockSize; base += size)
+    {
+      start = ((base + size) > blockSize) ? ((base + size) - blockSize) : 0U;
+      pA = pData + base + start;
+      pB = pData + ((base + size) - 1U - start);
+
+      for (i = start; i < half; i++)
+      {
+        arm_sort_exchange_q15(pA++, pB--);
+      }
+    }
+
+    /* The half-cleaners sort each bitonic run */
+    for (half >>= 1U; half > 0U; half >>= 1U)
+    {
+      for (base = 0U; (base + half) < blockSize; base += 2U * half)
+      {
+        stop = blockSize - base - half;
+        stop = (stop < half) ? stop : half;
+        pA = pData + base;
+        pB = pA + half;
+
+        for (i = 0U; i < stop; i++)
+        {
+          arm_sort_exchange_q15(pA++, pB++);
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief  LSD radix sort with 8-bit digits.
+ */
+static void arm_sort_radix_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  q15_t * pScratch,
+  uint32_t blockSize)
+{
+  uint32_t count[256];                           /* Histogram, then start position of each digit */
+  q15_t *pIn, *pOut;                             /* Source and destination of the current pass */
+  q15_t in;                                      /* Temporary variable to hold the input sample */
+  uint32_t shift, flip, digit, sum, i;           /* Digit position and loop variables */
+
+  pIn = pSrc;
+
+  for (shift = 0U; shift < 16U; shift += 8U)
+  {
+    /* The sign bit is flipped in the top digit, so that negative values come first */
+    flip = (shift == 8U) ? 0x80U : 0U;
+
+    memset(count, 0, sizeof(count));
+
+    for (i = 0U; i < blockSize; i++)
+    {
+      count[(((uint16_t) pIn[i] >> shift) & 0xFFU) ^ flip]++;
+    }
+
+    /* A digit shared by all samples leaves their order unchanged */
+    if (count[(((uint16_t) pIn[0] >> shift) & 0xFFU) ^ flip] == blockSize)
+    {
+      continue;
+    }
+
+    sum = 0U;
+    for (digit = 0U; digit < 256U; digit++)
+    {
+      i = count[digit];
+      count[digit] = sum;
+      sum += i;
+    }
+
+    /* Alternate between the scratch and the destination buffers */
+    pOut = (pIn == pScratch) ? pDst : pScratch;
+
+    for (i = 0U; i < blockSize; i++)
+    {
+      in = pIn[i];
+      pOut[count[(((uint16_t) in >> shift) & 0xFFU) ^ flip]++] = in;
+    }
+
+    pIn = pOut;
+  }
+
+  if (pIn != pDst)
+  {
+    memcpy(pDst, pIn, blockSize * sizeof(q15_t));
+  }
+}
+
+/**
+ * @brief Sorts the elements of a Q15 vector in ascending order.
+ * @param[in]       *pSrc points to input vector
+ * @param[out]      *pDst points to output vector
+ * @param[in]       *pScratch points to a scratch buffer of blockSize samples
+ * @param[in]       blockSize length of the input vector
+ * @return none.
+ *
+ * \par
+ * Vectors of up to 32 samples are sorted by a bitonic network in <code>pDst</code> and <code>pScratch</code> is not used.
+ * Longer vectors are sorted by two radix passes over 8-bit digits, that are skipped when all samples share the digit.
+ */
+
+void arm_sort_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  q15_t * pScratch,
+  uint32_t blockSize)
+{
+  if (blockSize <= SORT_Q15_BITONIC_MAX_LEN)
+  {
+    if (pDst != pSrc)
+    {
+      memcpy(pDst, pSrc, blockSize * sizeof(q15_t));
+    }
+
+    arm_sort_bitonic_q15(pDst, blockSize);
+  }
+  else
+  {
+    arm_sort_radix_q15(pSrc, pDst, pScratch, blockSize);
+  }
+}
+
+/**
+ * @} end of Sort group
+ */
@@ -128,15 +128,18 @@ extern void arm_bitreversal_32(
 *   }
 * \endcode
 * \par Q15 and Q31
-* The floating-point complex FFT uses a mixed-radix algorithm.  Multiple radix-4
-* stages are performed along with a single radix-2 stage, as needed.
+* The fixed-point complex FFT uses a mixed-radix decimation in frequency algorithm.
+* A radix-2 or radix-4 stage is performed as needed, followed by radix-8 stages and
+* a final radix-2 stage.  The final stage writes its outputs directly in natural
+* order, so no separate bit reversal pass is performed; with
+* <code>bitReverseFlag=0</code> the output is left in bit reversed order instead.
 * The algorithm supports lengths of [16, 32, 64, ..., 4096] and each length uses
 * a different twiddle factor table.
 * \par
-* The function uses the standard FFT definition and output values may grow by a
-* factor of <code>fftLen</code> when computing the forward transform.  The
-* inverse transform includes a scale of <code>1/fftLen</code> as part of the
-* calculation and this matches the textbook definition of the inverse FFT.
+* Both the forward and the inverse transforms include a scale of
+* <code>1/fftLen</code>, applied as right shifts at the inputs of the stages so
+* that the intermediate values cannot overflow.  The Q15 butterflies compute in
+* 1.31 format and truncate their results back to Q15 once per stage.
 * \par
 * Pre-initialized data structures containing twiddle factors and bit reversal
 * tables are provided and defined in <code>arm_const_structs.h</code>.  Include
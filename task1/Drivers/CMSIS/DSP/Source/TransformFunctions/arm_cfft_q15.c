@@ -1,7 +1,7 @@
 /* ----------------------------------------------------------------------
  * Project:      CMSIS DSP Library
  * Title:        arm_cfft_q15.c
- * Description:  Combined Radix Decimation in Q15 Frequency CFFT processing function
+ * Description:  Mixed radix-8/4/2 decimation in frequency Q15 CFFT processing function
  *
  * $Date:        27. January 2017
  * $Revision:    V.1.5.1
@@ -28,318 +28,602 @@
 
 #include "arm_math.h"
 
-extern void arm_radix4_butterfly_q15(
-    q15_t * pSrc,
-    uint32_t fftLen,
-    q15_t * pCoef,
-    uint32_t twidCoefModifier);
-
-extern void arm_radix4_butterfly_inverse_q15(
-    q15_t * pSrc,
-    uint32_t fftLen,
-    q15_t * pCoef,
-    uint32_t twidCoefModifier);
-
-extern void arm_bitreversal_16(
-    uint16_t * pSrc,
-    const uint16_t bitRevLen,
-    const uint16_t * pBitRevTable);
-
-void arm_cfft_radix4by2_q15(
-    q15_t * pSrc,
-    uint32_t fftLen,
-    const q15_t * pCoef);
-
-void arm_cfft_radix4by2_inverse_q15(
-    q15_t * pSrc,
-    uint32_t fftLen,
-    const q15_t * pCoef);
+/* cos(pi/4) in 1.31 format */
+#define CFFT_Q15_COS_PI_4   0x5A82799A
+
+/*
+ * The stages below take the offsets of the real and imaginary parts of each
+ * complex value as the constants re and im.  The inverse transform swaps them,
+ * which runs the forward butterflies on the data with the real and imaginary
+ * parts exchanged: that is the inverse transform with the same scaling.
+ *
+ * The butterflies promote their Q15 inputs to 1.31 format, so that only the
+ * results of each stage are truncated back to Q15.
+ */
 
 /**
-* @ingroup groupTransforms
-*/
+ * @brief  Multiplies a butterfly output by a twiddle factor and stores it.
+ * @param[out] *pOut  points to the output complex value.
+ * @param[in]  xr     real part of the butterfly output, in 1.31 format.
+ * @param[in]  xi     imaginary part of the butterfly output, in 1.31 format.
+ * @param[in]  *pTw   points to the twiddle factor {cos, sin}, or is NULL for W^0.
+ * @param[in]  re     offset of the real part.
+ * @param[in]  im     offset of the imaginary part.
+ * @return none.
+ */
+CMSIS_INLINE __STATIC_INLINE void arm_cfft_store_q15(
+  q15_t * pOut,
+  q31_t xr,
+  q31_t xi,
+  const q31_t * pTw,
+  uint32_t re,
+  uint32_t im)
+{
+  if (pTw == NULL)
+  {
+    pOut[re] = (q15_t) (xr >> 16);
+    pOut[im] = (q15_t) (xi >> 16);
+  }
+  else
+  {
+    pOut[re] = (q15_t) (((q63_t) xr * pTw[0] + (q63_t) xi * pTw[1]) >> 31);
+    pOut[im] = (q15_t) (((q63_t) xi * pTw[0] - (q63_t) xr * pTw[1]) >> 31);
+  }
+}
 
 /**
-* @addtogroup ComplexFFT
-* @{
-*/
+ * @brief  Radix-2 first stage, used when log2(fftLen) - 1 is one more than a
+ *         multiple of 3.  The inputs are scaled down by 4.
+ * @param[in, out] *pSrc   points to the complex data buffer.
+ * @param[in]      fftLen  length of the FFT.
+ * @param[in]      *pCoef  points to the twiddle coefficient buffer.
+ * @param[in]      re      offset of the real part.
+ * @param[in]      im      offset of the imaginary part.
+ * @return none.
+ */
+CMSIS_INLINE __STATIC_INLINE void arm_cfft_radix2_first_q15(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  const q15_t * pCoef,
+  uint32_t re,
+  uint32_t im)
+{
+  q15_t *p0 = pSrc;                              /* Input pointers */
+  q15_t *p1 = pSrc + fftLen;
+  q31_t a0r, a0i, a1r, a1i;                      /* Temporary variables for the inputs */
+  q31_t tw[2];                                   /* Twiddle factor */
+  uint32_t i;                                    /* Loop counter */
+
+  for (i = 0U; i < (fftLen >> 1U); i++)
+  {
+    a0r = (q31_t) p0[re] << 14;
+    a0i = (q31_t) p0[im] << 14;
+    a1r = (q31_t) p1[re] << 14;
+    a1i = (q31_t) p1[im] << 14;
+
+    tw[0] = pCoef[2U * i];
+    tw[1] = pCoef[(2U * i) + 1U];
+
+    p0[re] = (q15_t) ((a0r + a1r) >> 16);
+    p0[im] = (q15_t) ((a0i + a1i) >> 16);
+    arm_cfft_store_q15(p1, a0r - a1r, a0i - a1i, tw, re, im);
+
+    p0 += 2U;
+    p1 += 2U;
+  }
+}
 
 /**
-* @details
-* @brief       Processing function for the Q15 complex FFT.
-* @param[in]      *S    points to an instance of the Q15 CFFT structure.
-* @param[in, out] *p1   points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
-* @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
-* @param[in]     bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
-* @return none.
-*/
+ * @brief  Radix-4 first stage, used when log2(fftLen) - 1 is two more than a
+ *         multiple of 3.  The inputs are scaled down by 8 and the outputs are
+ *         stored in bit reversed order X0, X2, X1, X3.
+ * @param[in, out] *pSrc   points to the complex data buffer.
+ * @param[in]      fftLen  length of the FFT.
+ * @param[in]      *pCoef  points to the twiddle coefficient buffer.
+ * @param[in]      re      offset of the real part.
+ * @param[in]      im      offset of the imaginary part.
+ * @return none.
+ */
+CMSIS_INLINE __STATIC_INLINE void arm_cfft_radix4_first_q15(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  const q15_t * pCoef,
+  uint32_t re,
+  uint32_t im)
+{
+  q15_t *p0 = pSrc;                              /* Input pointers */
+  q15_t *p1 = p0 + (fftLen >> 1U);
+  q15_t *p2 = p1 + (fftLen >> 1U);
+  q15_t *p3 = p2 + (fftLen >> 1U);
+  q31_t a0r, a0i, a1r, a1i, a2r, a2i, a3r, a3i; /* Temporary variables for the inputs */
+  q31_t s0r, s0i, s1r, s1i;                      /* Temporary variables for the sums */
+  q31_t tw[6];                                   /* Twiddle factors W^i, W^2i, W^3i */
+  uint32_t i;                                    /* Loop counter */
+
+  for (i = 0U; i < (fftLen >> 2U); i++)
+  {
+    tw[0] = pCoef[2U * i];
+    tw[1] = pCoef[(2U * i) + 1U];
+    tw[2] = pCoef[4U * i];
+    tw[3] = pCoef[(4U * i) + 1U];
+    tw[4] = pCoef[6U * i];
+    tw[5] = pCoef[(6U * i) + 1U];
+
+    a0r = (q31_t) p0[re] << 13;
+    a0i = (q31_t) p0[im] << 13;
+    a1r = (q31_t) p1[re] << 13;
+    a1i = (q31_t) p1[im] << 13;
+    a2r = (q31_t) p2[re] << 13;
+    a2i = (q31_t) p2[im] << 13;
+    a3r = (q31_t) p3[re] << 13;
+    a3i = (q31_t) p3[im] << 13;
+
+    /* X0 and X2 = (a0 + a2) +/- (a1 + a3) */
+    s0r = a0r + a2r;
+    s0i = a0i + a2i;
+    s1r = a1r + a3r;
+    s1i = a1i + a3i;
+    p0[re] = (q15_t) ((s0r + s1r) >> 16);
+    p0[im] = (q15_t) ((s0i + s1i) >> 16);
+    arm_cfft_store_q15(p1, s0r - s1r, s0i - s1i, &tw[2], re, im);
+
+    /* X1 and X3 = (a0 - a2) -/+ j * (a1 - a3) */
+    s0r = a0r - a2r;
+    s0i = a0i - a2i;
+    s1r = a1r - a3r;
+    s1i = a1i - a3i;
+    arm_cfft_store_q15(p2, s0r + s1i, s0i - s1r, &tw[0], re, im);
+    arm_cfft_store_q15(p3, s0r - s1i, s0i + s1r, &tw[4], re, im);
+
+    p0 += 2U;
+    p1 += 2U;
+    p2 += 2U;
+    p3 += 2U;
+  }
+}
 
-void arm_cfft_q15(
-    const arm_cfft_instance_q15 * S,
-    q15_t * p1,
-    uint8_t ifftFlag,
-    uint8_t bitReverseFlag)
+/**
+ * @brief  Radix-8 butterfly.  The outputs are stored in bit reversed order
+ *         X0, X4, X2, X6, X1, X5, X3, X7.
+ * @param[in, out] *pSrc   points to the first input.
+ * @param[in]      n8      distance between the inputs, in halfwords.
+ * @param[in]      *pTw    points to the twiddle factors W^j .. W^7j, or is NULL for j = 0.
+ * @param[in]      shift   right shift applied to the inputs in 1.31 format.
+ * @param[in]      re      offset of the real part.
+ * @param[in]      im      offset of the imaginary part.
+ * @return none.
+ */
+CMSIS_INLINE __STATIC_INLINE void arm_cfft_radix8_butterfly_q15(
+  q15_t * pSrc,
+  uint32_t n8,
+  const q31_t * pTw,
+  uint32_t shift,
+  uint32_t re,
+  uint32_t im)
 {
-    uint32_t L = S->fftLen;
+  q15_t *p0 = pSrc, *p4 = pSrc + (4U * n8);      /* Input pointers */
+  q31_t b0r, b0i, b1r, b1i, b2r, b2i, b3r, b3i; /* Temporary variables for the sums */
+  q31_t xr, xi, yr, yi;                          /* Temporary variables */
+  q31_t c[8];                                    /* Rotated differences */
+  uint32_t up = 16U - shift;                     /* Left shift of the Q15 inputs */
+
+  /*
+   * First level: b_m = a_m + a_(m+4) is kept for the even outputs, while
+   * (a_m - a_(m+4)) * W8^m is set aside for the odd outputs, so that only
+   * one half of the butterfly is in registers at a time.
+   */
+  xr = (q31_t) p0[re] << up;
+  xi = (q31_t) p0[im] << up;
+  yr = (q31_t) p4[re] << up;
+  yi = (q31_t) p4[im] << up;
+  b0r = xr + yr;
+  b0i = xi + yi;
+  c[0] = xr - yr;
+  c[1] = xi - yi;
+  p0 += n8;
+  p4 += n8;
+
+  /* W8^1 = (1 - j) / sqrt(2) */
+  xr = (q31_t) p0[re] << up;
+  xi = (q31_t) p0[im] << up;
+  yr = (q31_t) p4[re] << up;
+  yi = (q31_t) p4[im] << up;
+  b1r = xr + yr;
+  b1i = xi + yi;
+  xr = xr - yr;
+  xi = xi - yi;
+  c[2] = (q31_t) (((q63_t) (xr + xi) * CFFT_Q15_COS_PI_4) >> 31);
+  c[3] = (q31_t) (((q63_t) (xi - xr) * CFFT_Q15_COS_PI_4) >> 31);
+  p0 += n8;
+  p4 += n8;
+
+  /* W8^2 = -j */
+  xr = (q31_t) p0[re] << up;
+  xi = (q31_t) p0[im] << up;
+  yr = (q31_t) p4[re] << up;
+  yi = (q31_t) p4[im] << up;
+  b2r = xr + yr;
+  b2i = xi + yi;
+  c[4] = xi - yi;
+  c[5] = yr - xr;
+  p0 += n8;
+  p4 += n8;
+
+  /* W8^3 = (-1 - j) / sqrt(2) */
+  xr = (q31_t) p0[re] << up;
+  xi = (q31_t) p0[im] << up;
+  yr = (q31_t) p4[re] << up;
+  yi = (q31_t) p4[im] << up;
+  b3r = xr + yr;
+  b3i = xi + yi;
+  xr = xr - yr;
+  xi = xi - yi;
+  c[6] = (q31_t) (((q63_t) (xi - xr) * CFFT_Q15_COS_PI_4) >> 31);
+  c[7] = (q31_t) (((q63_t) (-xr - xi) * CFFT_Q15_COS_PI_4) >> 31);
+
+  /* Second level: radix-4 on the sums gives the even outputs X0, X4, X2, X6 */
+  p0 = pSrc;
+  xr = b0r + b2r;
+  xi = b0i + b2i;
+  yr = b1r + b3r;
+  yi = b1i + b3i;
+  p0[re] = (q15_t) ((xr + yr) >> 16);
+  p0[im] = (q15_t) ((xi + yi) >> 16);
+  p0 += n8;
+  arm_cfft_store_q15(p0, xr - yr, xi - yi, (pTw == NULL) ? NULL : &pTw[6], re, im);
+  p0 += n8;
+
+  xr = b0r - b2r;
+  xi = b0i - b2i;
+  yr = b1r - b3r;
+  yi = b1i - b3i;
+  arm_cfft_store_q15(p0, xr + yi, xi - yr, (pTw == NULL) ? NULL : &pTw[2], re, im);
+  p0 += n8;
+  arm_cfft_store_q15(p0, xr - yi, xi + yr, (pTw == NULL) ? NULL : &pTw[10], re, im);
+  p0 += n8;
+
+  /* and radix-4 on the rotated differences gives the odd outputs X1, X5, X3, X7 */
+  b0r = c[0];
+  b0i = c[1];
+  b1r = c[2];
+  b1i = c[3];
+  b2r = c[4];
+  b2i = c[5];
+  b3r = c[6];
+  b3i = c[7];
+
+  xr = b0r + b2r;
+  xi = b0i + b2i;
+  yr = b1r + b3r;
+  yi = b1i + b3i;
+  arm_cfft_store_q15(p0, xr + yr, xi + yi, pTw, re, im);
+  p0 += n8;
+  arm_cfft_store_q15(p0, xr - yr, xi - yi, (pTw == NULL) ? NULL : &pTw[8], re, im);
+  p0 += n8;
+
+  xr = b0r - b2r;
+  xi = b0i - b2i;
+  yr = b1r - b3r;
+  yi = b1i - b3i;
+  arm_cfft_store_q15(p0, xr + yi, xi - yr, (pTw == NULL) ? NULL : &pTw[4], re, im);
+  p0 += n8;
+  arm_cfft_store_q15(p0, xr - yi, xi + yr, (pTw == NULL) ? NULL : &pTw[12], re, im);
+}
 
-    if (ifftFlag == 1U)
+/**
+ * @brief  Radix-8 stage.
+ * @param[in, out] *pSrc   points to the complex data buffer.
+ * @param[in]      fftLen  length of the FFT.
+ * @param[in]      subLen  length of the sub-transforms computed by the stage.
+ * @param[in]      *pCoef  points to the twiddle coefficient buffer.
+ * @param[in]      shift   right shift applied to the inputs in 1.31 format.
+ * @param[in]      re      offset of the real part.
+ * @param[in]      im      offset of the imaginary part.
+ * @return none.
+ */
+CMSIS_INLINE __STATIC_INLINE void arm_cfft_radix8_stage_q15(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  uint32_t subLen,
+  const q15_t * pCoef,
+  uint32_t shift,
+  uint32_t re,
+  uint32_t im)
+{
+  q31_t tw[14];                                  /* Twiddle factors W^j .. W^7j */
+  const q15_t *pW;                               /* Twiddle factor pointer */
+  uint32_t n8 = subLen >> 2U;                    /* Distance between the inputs, in halfwords */
+  uint32_t step = 2U * (fftLen / subLen);        /* Twiddle step of W_subLen, in halfwords */
+  uint32_t i, j, k;                              /* Loop counters */
+
+  /* All the twiddle factors of the first butterfly of each sub-transform are 1 */
+  for (i = 0U; i < fftLen; i += subLen)
+  {
+    arm_cfft_radix8_butterfly_q15(pSrc + (2U * i), n8, NULL, shift, re, im);
+  }
+
+  for (j = 1U; j < (subLen >> 3U); j++)
+  {
+    /* The twiddle factors are shared by the butterflies of all the
+       sub-transforms.  W^kj is in the table for k < 7, W^7j may be past its
+       3/4 length and is then -W^(7j - N/2). */
+    pW = pCoef;
+    for (k = 0U; k < 12U; k += 2U)
     {
-        switch (L)
-        {
-        case 16:
-        case 64:
-        case 256:
-        case 1024:
-        case 4096:
-            arm_radix4_butterfly_inverse_q15  ( p1, L, (q15_t*)S->pTwiddle, 1 );
-            break;
-
-        case 32:
-        case 128:
-        case 512:
-        case 2048:
-            arm_cfft_radix4by2_inverse_q15  ( p1, L, S->pTwiddle );
-            break;
-        }
+      pW += j * step;
+      tw[k] = pW[0];
+      tw[k + 1U] = pW[1];
+    }
+
+    pW += j * step;
+    if (pW < (pCoef + fftLen))
+    {
+      tw[12] = pW[0];
+      tw[13] = pW[1];
     }
     else
     {
-        switch (L)
-        {
-        case 16:
-        case 64:
-        case 256:
-        case 1024:
-        case 4096:
-            arm_radix4_butterfly_q15  ( p1, L, (q15_t*)S->pTwiddle, 1 );
-            break;
-
-        case 32:
-        case 128:
-        case 512:
-        case 2048:
-            arm_cfft_radix4by2_q15  ( p1, L, S->pTwiddle );
-            break;
-        }
+      tw[12] = -pW[-(int32_t) fftLen];
+      tw[13] = -pW[1 - (int32_t) fftLen];
     }
 
-    if ( bitReverseFlag )
-        arm_bitreversal_16((uint16_t*)p1,S->bitRevLength,S->pBitRevTable);
+    for (i = j; i < fftLen; i += subLen)
+    {
+      arm_cfft_radix8_butterfly_q15(pSrc + (2U * i), n8, tw, shift, re, im);
+    }
+  }
 }
 
 /**
-* @} end of ComplexFFT group
-*/
-
-void arm_cfft_radix4by2_q15(
-    q15_t * pSrc,
-    uint32_t fftLen,
-    const q15_t * pCoef)
+ * @brief  Final radix-2 stage.  Its butterflies need no twiddle factors nor
+ *         scaling, and are the same for both directions; they saturate.  When
+ *         bit reversal is enabled the outputs are written straight to their
+ *         natural order positions, so that no separate reordering pass is needed.
+ * @param[in, out] *pSrc           points to the complex data buffer.
+ * @param[in]      fftLen          length of the FFT.
+ * @param[in]      bitReverseFlag  flag that enables the reordering of the output.
+ * @return none.
+ */
+static void arm_cfft_radix2_last_q15(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  uint8_t bitReverseFlag)
 {
-    uint32_t i;
-    uint32_t n2;
-    q15_t p0, p1, p2, p3;
 #if defined (ARM_MATH_DSP)
-    q31_t T, S, R;
-    q31_t coeff, out1, out2;
-    const q15_t *pC = pCoef;
-    q15_t *pSi = pSrc;
-    q15_t *pSl = pSrc + fftLen;
-#else
-    uint32_t ia, l;
-    q15_t xt, yt, cosVal, sinVal;
-#endif
 
-    n2 = fftLen >> 1;
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t a0, a1, a2, a3;                          /* Inputs of quad h, packed */
+  q31_t b0, b1, b2, b3;                          /* Inputs of quad g, packed */
 
-#if defined (ARM_MATH_DSP)
+#else
 
-    for (i = n2; i > 0; i--)
-    {
-        coeff = _SIMD32_OFFSET(pC);
-        pC += 2;
+  /* Run the below code for Cortex-M0 */
+  q31_t a0r, a0i, a1r, a1i, a2r, a2i, a3r, a3i; /* Inputs of quad h */
+  q31_t b0r, b0i, b1r, b1i, b2r, b2i, b3r, b3i; /* Inputs of quad g */
+
+#endif /* #if defined (ARM_MATH_DSP) */
 
-        T = _SIMD32_OFFSET(pSi);
-        T = __SHADD16(T, 0); // this is just a SIMD arithmetic shift right by 1
+  q15_t *ph, *pg;                                /* Quad pointers */
+  uint32_t n4 = fftLen >> 2U;                    /* Number of quads */
+  uint32_t h, g, bit;                            /* Quad indexes */
 
-        S = _SIMD32_OFFSET(pSl);
-        S = __SHADD16(S, 0); // this is just a SIMD arithmetic shift right by 1
+  if (bitReverseFlag == 0U)
+  {
+    ph = pSrc;
 
-        R = __QSUB16(T, S);
+    for (h = 0U; h < (fftLen >> 1U); h++)
+    {
+#if defined (ARM_MATH_DSP)
 
-        _SIMD32_OFFSET(pSi) = __SHADD16(T, S);
-        pSi += 2;
+      a0 = _SIMD32_OFFSET(ph);
+      a1 = _SIMD32_OFFSET(ph + 2U);
 
-    #ifndef ARM_MATH_BIG_ENDIAN
+      _SIMD32_OFFSET(ph) = __QADD16(a0, a1);
+      _SIMD32_OFFSET(ph + 2U) = __QSUB16(a0, a1);
 
-        out1 = __SMUAD(coeff, R) >> 16;
-        out2 = __SMUSDX(coeff, R);
+#else
 
-    #else
+      a0r = ph[0];
+      a0i = ph[1];
+      a1r = ph[2];
+      a1i = ph[3];
 
-        out1 = __SMUSDX(R, coeff) >> 16U;
-        out2 = __SMUAD(coeff, R);
+      ph[0] = (q15_t) __SSAT(a0r + a1r, 16);
+      ph[1] = (q15_t) __SSAT(a0i + a1i, 16);
+      ph[2] = (q15_t) __SSAT(a0r - a1r, 16);
+      ph[3] = (q15_t) __SSAT(a0i - a1i, 16);
 
-    #endif //     #ifndef ARM_MATH_BIG_ENDIAN
+#endif /* #if defined (ARM_MATH_DSP) */
 
-        _SIMD32_OFFSET(pSl) =
-        (q31_t) ((out2) & 0xFFFF0000) | (out1 & 0x0000FFFF);
-        pSl += 2;
+      ph += 4U;
     }
 
-#else //    #if defined (ARM_MATH_DSP)
+    return;
+  }
+
+  /*
+   * Quad h holds the butterflies on the complex values {2h, 2h + 1} and
+   * {2h + N/2, 2h + 1 + N/2}.  Their outputs go to 2g, 2g + N/2, 2g + 1 and
+   * 2g + 1 + N/2, with g the (log2(N) - 2)-bit reversal of h, which are the
+   * inputs of quad g: the two quads are loaded before either is written.
+   */
+  g = 0U;
 
-    ia = 0;
-    for (i = 0; i < n2; i++)
+  for (h = 0U; h < n4; h++)
+  {
+    if (g >= h)
     {
-        cosVal = pCoef[ia * 2];
-        sinVal = pCoef[(ia * 2) + 1];
-        ia++;
+      ph = pSrc + (4U * h);
+      pg = pSrc + (4U * g);
 
-        l = i + n2;
+#if defined (ARM_MATH_DSP)
 
-        xt = (pSrc[2 * i] >> 1U) - (pSrc[2 * l] >> 1U);
-        pSrc[2 * i] = ((pSrc[2 * i] >> 1U) + (pSrc[2 * l] >> 1U)) >> 1U;
+      a0 = _SIMD32_OFFSET(ph);
+      a1 = _SIMD32_OFFSET(ph + 2U);
+      a2 = _SIMD32_OFFSET(ph + fftLen);
+      a3 = _SIMD32_OFFSET(ph + fftLen + 2U);
 
-        yt = (pSrc[2 * i + 1] >> 1U) - (pSrc[2 * l + 1] >> 1U);
-        pSrc[2 * i + 1] =
-        ((pSrc[2 * l + 1] >> 1U) + (pSrc[2 * i + 1] >> 1U)) >> 1U;
+      b0 = _SIMD32_OFFSET(pg);
+      b1 = _SIMD32_OFFSET(pg + 2U);
+      b2 = _SIMD32_OFFSET(pg + fftLen);
+      b3 = _SIMD32_OFFSET(pg + fftLen + 2U);
 
-        pSrc[2U * l] = (((int16_t) (((q31_t) xt * cosVal) >> 16)) +
-                  ((int16_t) (((q31_t) yt * sinVal) >> 16)));
+      _SIMD32_OFFSET(pg) = __QADD16(a0, a1);
+      _SIMD32_OFFSET(pg + 2U) = __QADD16(a2, a3);
+      _SIMD32_OFFSET(pg + fftLen) = __QSUB16(a0, a1);
+      _SIMD32_OFFSET(pg + fftLen + 2U) = __QSUB16(a2, a3);
 
-        pSrc[2U * l + 1U] = (((int16_t) (((q31_t) yt * cosVal) >> 16)) -
-                       ((int16_t) (((q31_t) xt * sinVal) >> 16)));
-    }
+      _SIMD32_OFFSET(ph) = __QADD16(b0, b1);
+      _SIMD32_OFFSET(ph + 2U) = __QADD16(b2, b3);
+      _SIMD32_OFFSET(ph + fftLen) = __QSUB16(b0, b1);
+      _SIMD32_OFFSET(ph + fftLen + 2U) = __QSUB16(b2, b3);
 
-#endif //    #if defined (ARM_MATH_DSP)
+#else
 
-    // first col
-    arm_radix4_butterfly_q15( pSrc, n2, (q15_t*)pCoef, 2U);
-    // second col
-    arm_radix4_butterfly_q15( pSrc + fftLen, n2, (q15_t*)pCoef, 2U);
+      a0r = ph[0];
+      a0i = ph[1];
+      a1r = ph[2];
+      a1i = ph[3];
+      a2r = ph[fftLen];
+      a2i = ph[fftLen + 1U];
+      a3r = ph[fftLen + 2U];
+      a3i = ph[fftLen + 3U];
+
+      b0r = pg[0];
+      b0i = pg[1];
+      b1r = pg[2];
+      b1i = pg[3];
+      b2r = pg[fftLen];
+      b2i = pg[fftLen + 1U];
+      b3r = pg[fftLen + 2U];
+      b3i = pg[fftLen + 3U];
+
+      pg[0] = (q15_t) __SSAT(a0r + a1r, 16);
+      pg[1] = (q15_t) __SSAT(a0i + a1i, 16);
+      pg[2] = (q15_t) __SSAT(a2r + a3r, 16);
+      pg[3] = (q15_t) __SSAT(a2i + a3i, 16);
+      pg[fftLen] = (q15_t) __SSAT(a0r - a1r, 16);
+      pg[fftLen + 1U] = (q15_t) __SSAT(a0i - a1i, 16);
+      pg[fftLen + 2U] = (q15_t) __SSAT(a2r - a3r, 16);
+      pg[fftLen + 3U] = (q15_t) __SSAT(a2i - a3i, 16);
+
+      ph[0] = (q15_t) __SSAT(b0r + b1r, 16);
+      ph[1] = (q15_t) __SSAT(b0i + b1i, 16);
+      ph[2] = (q15_t) __SSAT(b2r + b3r, 16);
+      ph[3] = (q15_t) __SSAT(b2i + b3i, 16);
+      ph[fftLen] = (q15_t) __SSAT(b0r - b1r, 16);
+      ph[fftLen + 1U] = (q15_t) __SSAT(b0i - b1i, 16);
+      ph[fftLen + 2U] = (q15_t) __SSAT(b2r - b3r, 16);
+      ph[fftLen + 3U] = (q15_t) __SSAT(b2i - b3i, 16);
+
+#endif /* #if defined (ARM_MATH_DSP) */
+    }
 
-    for (i = 0; i < fftLen >> 1; i++)
+    /* Bit reversed increment of g */
+    bit = n4 >> 1U;
+    while ((g & bit) != 0U)
     {
-        p0 = pSrc[4*i+0];
-        p1 = pSrc[4*i+1];
-        p2 = pSrc[4*i+2];
-        p3 = pSrc[4*i+3];
-
-        p0 <<= 1;
-        p1 <<= 1;
-        p2 <<= 1;
-        p3 <<= 1;
-
-        pSrc[4*i+0] = p0;
-        pSrc[4*i+1] = p1;
-        pSrc[4*i+2] = p2;
-        pSrc[4*i+3] = p3;
+      g ^= bit;
+      bit >>= 1U;
     }
+    g |= bit;
+  }
 }
 
-void arm_cfft_radix4by2_inverse_q15(
-    q15_t * pSrc,
-    uint32_t fftLen,
-    const q15_t * pCoef)
+/**
+ * @brief  Mixed radix pipeline for one direction.
+ * @param[in, out] *pSrc   points to the complex data buffer.
+ * @param[in]      fftLen  length of the FFT.
+ * @param[in]      *pCoef  points to the twiddle coefficient buffer.
+ * @param[in]      re      offset of the real part.
+ * @param[in]      im      offset of the imaginary part.
+ * @return none.
+ */
+CMSIS_INLINE __STATIC_INLINE void arm_cfft_mixed_radix_q15(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  const q15_t * pCoef,
+  uint32_t re,
+  uint32_t im)
 {
-    uint32_t i;
-    uint32_t n2;
-    q15_t p0, p1, p2, p3;
-#if defined (ARM_MATH_DSP)
-    q31_t T, S, R;
-    q31_t coeff, out1, out2;
-    const q15_t *pC = pCoef;
-    q15_t *pSi = pSrc;
-    q15_t *pSl = pSrc + fftLen;
-#else
-    uint32_t ia, l;
-    q15_t xt, yt, cosVal, sinVal;
-#endif
-
-    n2 = fftLen >> 1;
-
-#if defined (ARM_MATH_DSP)
-
-    for (i = n2; i > 0; i--)
-    {
-        coeff = _SIMD32_OFFSET(pC);
-        pC += 2;
-
-        T = _SIMD32_OFFSET(pSi);
-        T = __SHADD16(T, 0); // this is just a SIMD arithmetic shift right by 1
-
-        S = _SIMD32_OFFSET(pSl);
-        S = __SHADD16(S, 0); // this is just a SIMD arithmetic shift right by 1
-
-        R = __QSUB16(T, S);
-
-        _SIMD32_OFFSET(pSi) = __SHADD16(T, S);
-        pSi += 2;
-
-    #ifndef ARM_MATH_BIG_ENDIAN
-
-        out1 = __SMUSD(coeff, R) >> 16;
-        out2 = __SMUADX(coeff, R);
-    #else
+  uint32_t log2Len = 0U;                         /* log2 of the FFT length */
+  uint32_t subLen;                               /* Length of the sub-transforms */
+  uint32_t shift;                                /* Scaling of the stage inputs */
+
+  while ((1U << log2Len) < fftLen)
+  {
+    log2Len++;
+  }
+
+  /* The first stage takes one more bit of headroom than its radix and the final
+     radix-2 stage none, so that the output is scaled by 1/fftLen */
+  switch ((log2Len - 1U) % 3U)
+  {
+  case 0U:
+    subLen = fftLen;
+    shift = 4U;
+    break;
+
+  case 1U:
+    arm_cfft_radix2_first_q15(pSrc, fftLen, pCoef, re, im);
+    subLen = fftLen >> 1U;
+    shift = 3U;
+    break;
+
+  default:
+    arm_cfft_radix4_first_q15(pSrc, fftLen, pCoef, re, im);
+    subLen = fftLen >> 2U;
+    shift = 3U;
+    break;
+  }
+
+  while (subLen > 2U)
+  {
+    arm_cfft_radix8_stage_q15(pSrc, fftLen, subLen, pCoef, shift, re, im);
+    subLen >>= 3U;
+    shift = 3U;
+  }
+}
 
-        out1 = __SMUADX(R, coeff) >> 16U;
-        out2 = __SMUSD(__QSUB(0, coeff), R);
+/**
+* @ingroup groupTransforms
+*/
 
-    #endif //     #ifndef ARM_MATH_BIG_ENDIAN
+/**
+* @addtogroup ComplexFFT
+* @{
+*/
 
-        _SIMD32_OFFSET(pSl) =
-        (q31_t) ((out2) & 0xFFFF0000) | (out1 & 0x0000FFFF);
-        pSl += 2;
-    }
+/**
+* @details
+* @brief       Processing function for the fixed-point complex FFT in Q15 format.
+* @param[in]      *S    points to an instance of the fixed-point CFFT structure.
+* @param[in, out] *p1   points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+* @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+* @param[in]     bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
+* @return none.
+*/
 
-#else //    #if defined (ARM_MATH_DSP)
+void arm_cfft_q15(
+    const arm_cfft_instance_q15 * S,
+    q15_t * p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag)
+{
+    uint32_t L = S->fftLen;
 
-    ia = 0;
-    for (i = 0; i < n2; i++)
+    if (ifftFlag == 1U)
     {
-        cosVal = pCoef[ia * 2];
-        sinVal = pCoef[(ia * 2) + 1];
-        ia++;
-
-        l = i + n2;
-        xt = (pSrc[2 * i] >> 1U) - (pSrc[2 * l] >> 1U);
-        pSrc[2 * i] = ((pSrc[2 * i] >> 1U) + (pSrc[2 * l] >> 1U)) >> 1U;
-
-        yt = (pSrc[2 * i + 1] >> 1U) - (pSrc[2 * l + 1] >> 1U);
-        pSrc[2 * i + 1] =
-          ((pSrc[2 * l + 1] >> 1U) + (pSrc[2 * i + 1] >> 1U)) >> 1U;
-
-        pSrc[2U * l] = (((int16_t) (((q31_t) xt * cosVal) >> 16)) -
-                        ((int16_t) (((q31_t) yt * sinVal) >> 16)));
-
-        pSrc[2U * l + 1U] = (((int16_t) (((q31_t) yt * cosVal) >> 16)) +
-                           ((int16_t) (((q31_t) xt * sinVal) >> 16)));
+        arm_cfft_mixed_radix_q15(p1, L, S->pTwiddle, 1U, 0U);
     }
-
-#endif //    #if defined (ARM_MATH_DSP)
-
-    // first col
-    arm_radix4_butterfly_inverse_q15( pSrc, n2, (q15_t*)pCoef, 2U);
-    // second col
-    arm_radix4_butterfly_inverse_q15( pSrc + fftLen, n2, (q15_t*)pCoef, 2U);
-
-    for (i = 0; i < fftLen >> 1; i++)
+    else
     {
-        p0 = pSrc[4*i+0];
-        p1 = pSrc[4*i+1];
-        p2 = pSrc[4*i+2];
-        p3 = pSrc[4*i+3];
-
-        p0 <<= 1;
-        p1 <<= 1;
-        p2 <<= 1;
-        p3 <<= 1;
-
-        pSrc[4*i+0] = p0;
-        pSrc[4*i+1] = p1;
-        pSrc[4*i+2] = p2;
-        pSrc[4*i+3] = p3;
+        arm_cfft_mixed_radix_q15(p1, L, S->pTwiddle, 0U, 1U);
     }
+
+    arm_cfft_radix2_last_q15(p1, L, bitReverseFlag);
 }
 
+/**
+* @} end of ComplexFFT group
+*/
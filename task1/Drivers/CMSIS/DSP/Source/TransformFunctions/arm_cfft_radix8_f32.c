@@ -42,6 +42,149 @@
 * @return none.
 */
 
+#if defined (ARM_MATH_HOST) && defined (__SSE2__)
+
+/* Run the below code for x86 hosts */
+
+/*
+* Each vector holds two complex samples, so a pair of butterflies is computed
+* at once: the one at pA and the one at pB. The real and imaginary parts go
+* through the same additions, and every multiplication by -j is done as a swap
+* and a sign change, so each value is computed with the same operations in the
+* same order as in the scalar code below. pTw holds the twiddle factors of the
+* two butterflies, or is NULL for the butterflies that are not rotated. pA may
+* be equal to pB when only one butterfly is left.
+*/
+
+static void arm_radix8_butterfly_pair_f32(
+float32_t * pA,
+float32_t * pB,
+uint32_t n2,
+const __m128 * pTw)
+{
+   const __m128 negIm = _mm_castsi128_ps(_mm_setr_epi32(0, (int32_t) 0x80000000, 0, (int32_t) 0x80000000));
+   const __m128 C81 = _mm_set1_ps(0.70710678118f);
+   __m128 x[8];
+   __m128 a1, a2, a3, a4, a5, a6, a7, a8;
+   __m128 t, d, e, f, g, h, k;
+   __m128 y[8];
+   uint32_t i;
+
+   for (i = 0U; i < 8U; i++)
+   {
+      x[i] = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), (const __m64 *) (pA + 2U * i * n2)),
+                          (const __m64 *) (pB + 2U * i * n2));
+   }
+
+   a1 = _mm_add_ps(x[0], x[4]);
+   a5 = _mm_sub_ps(x[0], x[4]);
+   a2 = _mm_add_ps(x[1], x[5]);
+   a6 = _mm_sub_ps(x[1], x[5]);
+   a3 = _mm_add_ps(x[2], x[6]);
+   a7 = _mm_sub_ps(x[2], x[6]);
+   a4 = _mm_add_ps(x[3], x[7]);
+   a8 = _mm_sub_ps(x[3], x[7]);
+   t  = _mm_sub_ps(a1, a3);
+   a1 = _mm_add_ps(a1, a3);
+   a3 = _mm_sub_ps(a2, a4);
+   a2 = _mm_add_ps(a2, a4);
+
+   /* (re, im) * -j = (im, -re) */
+   a3 = _mm_xor_ps(_mm_shuffle_ps(a3, a3, 0xB1), negIm);
+
+   y[0] = _mm_add_ps(a1, a2);
+   y[4] = _mm_sub_ps(a1, a2);
+   y[2] = _mm_add_ps(t, a3);
+   y[6] = _mm_sub_ps(t, a3);
+
+   d = _mm_mul_ps(_mm_sub_ps(a6, a8), C81);
+   e = _mm_mul_ps(_mm_add_ps(a6, a8), C81);
+   f = _mm_sub_ps(a5, d);
+   g = _mm_add_ps(a5, d);
+   h = _mm_sub_ps(a7, e);
+   k = _mm_add_ps(a7, e);
+   k = _mm_xor_ps(_mm_shuffle_ps(k, k, 0xB1), negIm);
+   h = _mm_xor_ps(_mm_shuffle_ps(h, h, 0xB1), negIm);
+
+   y[1] = _mm_add_ps(g, k);
+   y[7] = _mm_sub_ps(g, k);
+   y[5] = _mm_add_ps(f, h);
+   y[3] = _mm_sub_ps(f, h);
+
+   if (pTw != NULL)
+   {
+      /* (re, im) * (co, -si) = (co * re + si * im, co * im - si * re) */
+      for (i = 1U; i < 8U; i++)
+      {
+         y[i] = _mm_add_ps(_mm_mul_ps(pTw[2U * (i - 1U)], y[i]),
+                           _mm_mul_ps(pTw[2U * (i - 1U) + 1U], _mm_shuffle_ps(y[i], y[i], 0xB1)));
+      }
+   }
+
+   for (i = 0U; i < 8U; i++)
+   {
+      _mm_storel_pi((__m64 *) (pA + 2U * i * n2), y[i]);
+      _mm_storeh_pi((__m64 *) (pB + 2U * i * n2), y[i]);
+   }
+}
+
+void arm_radix8_butterfly_f32(
+float32_t * pSrc,
+uint16_t fftLen,
+const float32_t * pCoef,
+uint16_t twidCoefModifier)
+{
+   uint32_t ia, ib;
+   uint32_t i1, j, jb, m;
+   uint32_t n1, n2;
+   __m128 tw[14];
+
+   n2 = fftLen;
+
+   do
+   {
+      n1 = n2;
+      n2 = n2 >> 3;
+
+      /* The first butterfly of every group has no twiddle factors.
+       ** Butterflies of neighbouring groups are paired. */
+      for (i1 = 0U; i1 < fftLen; i1 += 2U * n1)
+      {
+         ib = (i1 + n1 < fftLen) ? (i1 + n1) : i1;
+         arm_radix8_butterfly_pair_f32(&pSrc[2U * i1], &pSrc[2U * ib], n2, NULL);
+      }
+
+      if (n2 < 8)
+         break;
+
+      /* The remaining butterflies of every group are paired with their
+       ** right neighbour, which uses the next set of twiddle factors */
+      for (j = 1U; j < n2; j += 2U)
+      {
+         jb = (j + 1U < n2) ? (j + 1U) : j;
+
+         for (m = 1U; m < 8U; m++)
+         {
+            ia = m * j * twidCoefModifier;
+            ib = m * jb * twidCoefModifier;
+            tw[2U * (m - 1U)] = _mm_setr_ps(pCoef[2U * ia], pCoef[2U * ia],
+                                            pCoef[2U * ib], pCoef[2U * ib]);
+            tw[2U * (m - 1U) + 1U] = _mm_setr_ps(pCoef[2U * ia + 1U], -pCoef[2U * ia + 1U],
+                                                 pCoef[2U * ib + 1U], -pCoef[2U * ib + 1U]);
+         }
+
+         for (i1 = j; i1 < fftLen; i1 += n1)
+         {
+            arm_radix8_butterfly_pair_f32(&pSrc[2U * i1], &pSrc[2U * (i1 + jb - j)], n2, tw);
+         }
+      }
+
+      twidCoefModifier <<= 3;
+   } while (n2 > 7);
+}
+
+#else
+
 void arm_radix8_butterfly_f32(
 float32_t * pSrc,
 uint16_t fftLen,
@@ -283,3 +426,5 @@ uint16_t twidCoefModifier)
       twidCoefModifier <<= 3;
    } while (n2 > 7);
 }
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__SSE2__) */
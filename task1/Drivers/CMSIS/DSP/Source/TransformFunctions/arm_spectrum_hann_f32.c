@@ -0,0 +1,89 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_spectrum_hann_f32.c
+ * Description:  Periodic Hann window for the floating-point streaming spectrum estimator
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Spectrum
+ * @{
+ */
+
+/**
+ * @brief  Generates a periodic Hann window.
+ * @param[out]    *pDst    points to the window of length <code>fftLen</code>.
+ * @param[in]     fftLen   length of the window. Supported lengths are 32, 64, 128, 256, 512, 1024, 2048, 4096.
+ * @return        The function returns ARM_MATH_SUCCESS if the window is generated or ARM_MATH_ARGUMENT_ERROR if
+ * <code>fftLen</code> is not supported.
+ *
+ * \par
+ * The window is
+ * <pre>
+ *     w[n] = 0.5 - 0.5 * cos(2*pi*n / fftLen),   0 <= n < fftLen.
+ * </pre>
+ * The cosines are read from the twiddle table of the real FFT of the same length, whose
+ * imaginary parts are cos(2*pi*n / fftLen) for n < fftLen/2. The window is symmetric about
+ * n = fftLen/2, so the second half is a mirror of the first half.
+ */
+
+arm_status arm_spectrum_hann_f32(
+  float32_t * pDst,
+  uint16_t fftLen)
+{
+  arm_rfft_fast_instance_f32 rfft;               /* real FFT instance that selects the twiddle table */
+  arm_status status;                             /* status of the real FFT initialization */
+  const float32_t *pTwiddle;                     /* twiddle table of the real FFT */
+  uint32_t n;                                    /* loop counter */
+  uint32_t halfLen = (uint32_t) fftLen >> 1U;    /* half of the window length */
+
+  status = arm_rfft_fast_init_f32(&rfft, fftLen);
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    pTwiddle = rfft.pTwiddleRFFT;
+
+    pDst[0] = 0.0f;
+    pDst[halfLen] = 1.0f;
+
+    for (n = 1U; n < halfLen; n++)
+    {
+      /* w[n] = w[fftLen - n] = 0.5 - 0.5 * cos(2*pi*n / fftLen) */
+      pDst[n] = 0.5f - 0.5f * pTwiddle[(2U * n) + 1U];
+      pDst[fftLen - n] = pDst[n];
+    }
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Spectrum group
+ */
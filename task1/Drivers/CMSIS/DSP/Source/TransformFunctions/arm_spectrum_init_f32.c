@@ -0,0 +1,183 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_spectrum_init_f32.c
+ * Description:  Floating-point streaming spectrum estimator initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup Spectrum Streaming Spectrum Estimation
+ *
+ * \par
+ * These functions estimate the power spectrum of a continuous stream of real samples.
+ * The stream is pushed in blocks of any size. It is cut into frames of <code>fftLen</code>
+ * samples, and consecutive frames overlap by a configurable number of samples, so a new
+ * frame starts every <code>hopSize = fftLen - overlap</code> samples. Each frame is
+ * multiplied by a window and transformed with the real FFT.
+ * \par
+ * Two estimators use the same instance:
+ * - arm_spectrum_welch_f32() adds the squared magnitude of every frame to an accumulator,
+ *   and arm_spectrum_psd_f32() returns their average (Welch's method).
+ * - arm_spectrum_stft_f32() returns the power spectrum of every frame (a spectrogram).
+ * \par
+ * The outputs are one-sided power spectral densities of <code>fftLen/2+1</code> bins, from
+ * DC to the Nyquist frequency:
+ * <pre>
+ *     P[k] = c[k] * |X[k]|^2 / sum(w[n]^2)
+ * </pre>
+ * where X is the FFT of the windowed frame, and c[k] is 1 for DC and Nyquist and 2 for the
+ * other bins. The densities are per unit of normalized frequency; divide them by the
+ * sample rate to get densities per Hz.
+ *
+ * \par Memory
+ * The input history is kept in a circular buffer, so a frame is never shifted. Windowing
+ * reads the circular buffer and writes the first half of the scratch buffer, which the
+ * real FFT uses as its input and work area. The spectrum is written to the second half of
+ * the scratch buffer, and the squared magnitudes are computed in the same pass that
+ * accumulates or scales them. The buffers are:
+ * <pre>
+ *     pState     fftLen samples
+ *     pScratch   2*fftLen samples
+ *     pAccum     fftLen/2+1 samples, only for arm_spectrum_welch_f32()
+ *     pWindow    fftLen samples, may be placed in read-only memory
+ * </pre>
+ *
+ * \par Initialization Functions
+ * There is an associated initialization function, arm_spectrum_init_f32(), which checks the
+ * arguments, initializes the real FFT, computes the window energy and clears the buffers.
+ * The window is computed once, before initialization; arm_spectrum_hann_f32() generates a
+ * periodic Hann window from the real FFT twiddle tables.
+ */
+
+/**
+ * @addtogroup Spectrum
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point streaming spectrum estimator.
+ * @param[in,out] *S         points to an instance of the spectrum estimator structure.
+ * @param[in]     fftLen     length of each frame. Supported lengths are 32, 64, 128, 256, 512, 1024, 2048, 4096.
+ * @param[in]     overlap    number of samples shared by consecutive frames, less than <code>fftLen</code>.
+ * @param[in]     *pWindow   points to the window of length <code>fftLen</code>.
+ * @param[in]     *pState    points to the state buffer of length <code>fftLen</code>.
+ * @param[in]     *pScratch  points to the scratch buffer of length <code>2*fftLen</code>.
+ * @param[in]     *pAccum    points to the accumulator of length <code>fftLen/2+1</code>, or NULL when only arm_spectrum_stft_f32() is used.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+ * <code>fftLen</code> is not supported, <code>overlap</code> is not less than <code>fftLen</code> or the window is zero.
+ */
+
+arm_status arm_spectrum_init_f32(
+  arm_spectrum_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t overlap,
+  const float32_t * pWindow,
+  float32_t * pState,
+  float32_t * pScratch,
+  float32_t * pAccum)
+{
+  arm_status status;                             /* status of the initialization */
+  float32_t energy;                              /* sum of the squared window samples */
+
+  if (overlap >= fftLen)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Initialize the real FFT, which checks the frame length */
+  status = arm_rfft_fast_init_f32(&S->rfft, fftLen);
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    /* The densities are normalized by the window energy */
+    arm_power_f32((float32_t *) pWindow, fftLen, &energy);
+
+    if (energy <= 0.0f)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    S->fftLen = fftLen;
+    S->hopSize = fftLen - overlap;
+    S->pWindow = pWindow;
+    S->pState = pState;
+    S->pScratch = pScratch;
+    S->pAccum = pAccum;
+    S->scale = 1.0f / energy;
+
+    /* The first frame needs fftLen samples */
+    S->stateIndex = 0U;
+    S->pending = fftLen;
+    S->numFrames = 0U;
+
+    /* Clear the state and the accumulator */
+    arm_fill_f32(0.0f, pState, fftLen);
+
+    if (pAccum != NULL)
+    {
+      arm_fill_f32(0.0f, pAccum, (fftLen >> 1U) + 1U);
+    }
+  }
+
+  return (status);
+}
+
+/**
+ * @brief  Windows and transforms the frame held in the state buffer.
+ * @param[in,out] *S  points to an instance of the spectrum estimator structure.
+ * @return        pointer to the packed real FFT of the frame, in the second half of the scratch buffer.
+ *
+ * The oldest sample of the frame is at <code>stateIndex</code>, so the frame is read from
+ * the circular buffer in two parts, which are multiplied by the matching parts of the window.
+ */
+
+float32_t *arm_spectrum_frame_f32(
+  arm_spectrum_instance_f32 * S)
+{
+  uint32_t fftLen = S->fftLen;                   /* frame length */
+  uint32_t tail = fftLen - S->stateIndex;        /* samples from the oldest one to the end of the buffer */
+  float32_t *pFrame = S->pScratch;               /* windowed frame, used as the FFT work area */
+  float32_t *pSpec = S->pScratch + fftLen;       /* packed spectrum */
+
+  arm_mult_f32(S->pState + S->stateIndex, (float32_t *) S->pWindow, pFrame, tail);
+
+  if (S->stateIndex != 0U)
+  {
+    arm_mult_f32(S->pState, (float32_t *) S->pWindow + tail, pFrame + tail, S->stateIndex);
+  }
+
+  arm_rfft_fast_f32(&S->rfft, pFrame, pSpec, 0U);
+
+  return (pSpec);
+}
+
+/**
+ * @} end of Spectrum group
+ */
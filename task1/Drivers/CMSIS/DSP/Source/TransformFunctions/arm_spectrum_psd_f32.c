@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_spectrum_psd_f32.c
+ * Description:  Floating-point Welch power spectral density function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Spectrum
+ * @{
+ */
+
+/**
+ * @brief  Returns the Welch power spectral density and restarts the average.
+ * @param[in,out] *S      points to an instance of the spectrum estimator structure.
+ * @param[out]    *pDst   points to the power spectral density of length <code>fftLen/2+1</code>.
+ * @return        number of frames in the average.
+ *
+ * \par
+ * The accumulated squared magnitudes are divided by the number of frames and the window
+ * energy. The accumulator is then cleared, and the next average starts with the frames
+ * completed after this call. The state buffer is kept, so the frames of the next average
+ * overlap the last frame of this one. When no frame has been accumulated the output is zero.
+ */
+
+uint32_t arm_spectrum_psd_f32(
+  arm_spectrum_instance_f32 * S,
+  float32_t * pDst)
+{
+  uint32_t numBins = ((uint32_t) S->fftLen >> 1U) + 1U;    /* number of output bins */
+  uint32_t numFrames = S->numFrames;             /* frames in the average */
+  float32_t scale;                               /* scale of the complex bins */
+
+  if (numFrames == 0U)
+  {
+    arm_fill_f32(0.0f, pDst, numBins);
+  }
+  else
+  {
+    /* The complex bins are counted twice, for the negative frequencies */
+    scale = (2.0f * S->scale) / (float32_t) numFrames;
+
+    arm_scale_f32(S->pAccum, scale, pDst, numBins);
+
+    /* DC and Nyquist are real and counted once */
+    pDst[0] *= 0.5f;
+    pDst[numBins - 1U] *= 0.5f;
+
+    /* Restart the average */
+    arm_fill_f32(0.0f, S->pAccum, numBins);
+    S->numFrames = 0U;
+  }
+
+  return (numFrames);
+}
+
+/**
+ * @} end of Spectrum group
+ */
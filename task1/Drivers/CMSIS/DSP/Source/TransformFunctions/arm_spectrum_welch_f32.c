@@ -0,0 +1,191 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_spectrum_welch_f32.c
+ * Description:  Floating-point Welch power spectrum accumulation function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern float32_t *arm_spectrum_frame_f32(
+  arm_spectrum_instance_f32 * S);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Spectrum
+ * @{
+ */
+
+/**
+ * @brief  Adds the squared magnitudes of a packed real FFT to the accumulator.
+ * @param[in]     *pSpec   points to the packed spectrum of length <code>fftLen</code>.
+ * @param[in,out] *pAccum  points to the accumulator of length <code>fftLen/2+1</code>.
+ * @param[in]     fftLen   length of the frame.
+ *
+ * This is arm_cmplx_mag_squared_f32() followed by arm_add_f32(), in one pass over the
+ * spectrum. The packed spectrum holds the real DC and Nyquist values in its first two
+ * samples, followed by the complex bins 1 to fftLen/2-1.
+ */
+
+static void arm_spectrum_accumulate_f32(
+  const float32_t * pSpec,
+  float32_t * pAccum,
+  uint32_t fftLen)
+{
+  uint32_t blkCnt;                               /* loop counter */
+  float32_t real, imag;                          /* temporary variables */
+  float32_t *pAcc = pAccum + 1;                  /* accumulator of bin 1 */
+  const float32_t *pIn = pSpec + 2;              /* real part of bin 1 */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t acc0, acc1, acc2, acc3;              /* accumulators */
+
+  /*loop Unrolling */
+  blkCnt = ((fftLen >> 1U) - 1U) >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C[k] += A[2k]^2 + A[2k+1]^2 */
+    real = pIn[0];
+    imag = pIn[1];
+    acc0 = pAcc[0] + (real * real) + (imag * imag);
+    real = pIn[2];
+    imag = pIn[3];
+    acc1 = pAcc[1] + (real * real) + (imag * imag);
+    real = pIn[4];
+    imag = pIn[5];
+    acc2 = pAcc[2] + (real * real) + (imag * imag);
+    real = pIn[6];
+    imag = pIn[7];
+    acc3 = pAcc[3] + (real * real) + (imag * imag);
+
+    pAcc[0] = acc0;
+    pAcc[1] = acc1;
+    pAcc[2] = acc2;
+    pAcc[3] = acc3;
+
+    pIn += 8U;
+    pAcc += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the number of bins is not a multiple of 4, compute any remaining bins here.
+   ** No loop unrolling is used. */
+  blkCnt = ((fftLen >> 1U) - 1U) % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = (fftLen >> 1U) - 1U;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C[k] += A[2k]^2 + A[2k+1]^2 */
+    real = *pIn++;
+    imag = *pIn++;
+    *pAcc++ += (real * real) + (imag * imag);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* DC and Nyquist */
+  pAccum[0] += pSpec[0] * pSpec[0];
+  pAccum[fftLen >> 1U] += pSpec[1] * pSpec[1];
+}
+
+/**
+ * @brief  Pushes samples into the Welch power spectrum estimator.
+ * @param[in,out] *S          points to an instance of the spectrum estimator structure.
+ * @param[in]     *pSrc       points to the block of input samples.
+ * @param[in]     blockSize   number of samples in the block.
+ * @return        number of frames completed and added to the accumulator by this call.
+ *
+ * \par
+ * The squared magnitude of each completed frame is added to the accumulator. The average is
+ * read with arm_spectrum_psd_f32(). Samples that do not complete a frame are kept in the
+ * state buffer for the next call.
+ */
+
+uint32_t arm_spectrum_welch_f32(
+  arm_spectrum_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize)
+{
+  uint32_t fftLen = S->fftLen;                   /* frame length */
+  uint32_t numFrames = 0U;                       /* frames completed by this call */
+  uint32_t blkCnt;                               /* samples copied in one pass */
+  float32_t *pSpec;                              /* packed spectrum of a frame */
+
+  while (blockSize > 0U)
+  {
+    /* Copy the samples the next frame still needs, up to the end of the circular buffer */
+    blkCnt = S->pending;
+    blkCnt = (blkCnt < blockSize) ? blkCnt : blockSize;
+    blkCnt = (blkCnt < (fftLen - S->stateIndex)) ? blkCnt : (fftLen - S->stateIndex);
+
+    arm_copy_f32(pSrc, S->pState + S->stateIndex, blkCnt);
+
+    pSrc += blkCnt;
+    blockSize -= blkCnt;
+    S->pending -= blkCnt;
+    S->stateIndex += blkCnt;
+
+    if (S->stateIndex == fftLen)
+    {
+      S->stateIndex = 0U;
+    }
+
+    if (S->pending == 0U)
+    {
+      /* A frame is complete: window it and compute its spectrum */
+      pSpec = arm_spectrum_frame_f32(S);
+
+      arm_spectrum_accumulate_f32(pSpec, S->pAccum, fftLen);
+      S->numFrames++;
+
+      /* The next frame starts hopSize samples later */
+      S->pending = S->hopSize;
+      numFrames++;
+    }
+  }
+
+  return (numFrames);
+}
+
+/**
+ * @} end of Spectrum group
+ */
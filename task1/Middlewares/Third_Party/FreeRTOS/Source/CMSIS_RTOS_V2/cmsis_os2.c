@@ -31,6 +31,9 @@
 #include "task.h"                       // ARM.FreeRTOS::RTOS:Core
 #include "event_groups.h"               // ARM.FreeRTOS::RTOS:Event Groups
 #include "semphr.h"                     // ARM.FreeRTOS::RTOS:Core
+#include "atomic.h"                     // ARM.FreeRTOS::RTOS:Core
+#include "static_pools.h"               // ARM.FreeRTOS::RTOS:Core
+#include "freertos_mpool.h"              // ARM.FreeRTOS::RTOS:Core
 
 /*---------------------------------------------------------------------------*/
 #ifndef __ARM_ARCH_6M__
@@ -80,6 +83,13 @@
 #define THREAD_FLAGS_INVALID_BITS (~((1UL << MAX_BITS_TASK_NOTIFY)  - 1U))
 #define EVENT_FLAGS_INVALID_BITS  (~((1UL << MAX_BITS_EVENT_GROUPS) - 1U))
 
+/* Task notification index used for thread flags. With more than one entry in
+   the notification array, thread flags do not share a notification with
+   stream buffers or with application use of xTaskNotify(). */
+#ifndef THREAD_FLAGS_NOTIFY_INDEX
+#define THREAD_FLAGS_NOTIFY_INDEX ((UBaseType_t)configTASK_NOTIFICATION_ARRAY_ENTRIES - 1U)
+#endif
+
 /* Kernel version and identification string definition */
 #define KERNEL_VERSION            (((uint32_t)tskKERNEL_VERSION_MAJOR * 10000000UL) | \
                                    ((uint32_t)tskKERNEL_VERSION_MINOR *    10000UL) | \
@@ -96,6 +106,22 @@ typedef struct {
 /* Kernel initialization state */
 static osKernelState_t KernelState;
 
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 0)
+/* Without a heap osThreadEnumerate collects the task states here. Only used
+   while the scheduler is suspended, so it is never shared. */
+#ifndef OS_THREAD_ENUMERATE_MAX
+#define OS_THREAD_ENUMERATE_MAX   8U
+#endif
+static TaskStatus_t ThreadEnumerateState[OS_THREAD_ENUMERATE_MAX];
+
+#if (configUSE_STATIC_POOLS == 1) && (configSTATIC_POOL_TIMERS > 0)
+/* Callback information of the timers taken from the static timer pool. Taken
+   together with the timer, so never more than configSTATIC_POOL_TIMERS. */
+static TimerCallback_t TimerCallbackPool[configSTATIC_POOL_TIMERS];
+static uint32_t        TimerCallbackCount;
+#endif
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
 /* Heap region definition used by heap_5 variant */
 #if defined(USE_FreeRTOS_HEAP_5)
 #if (configAPPLICATION_ALLOCATED_HEAP == 1)
@@ -401,9 +427,18 @@ osThreadId_t osThreadNew (osThreadFunc_t func, void *argument, const osThreadAtt
     }
     else {
       if (mem == 0) {
+        #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
         if (xTaskCreate ((TaskFunction_t)func, name, (uint16_t)stack, argument, prio, &hTask) != pdPASS) {
           hTask = NULL;
         }
+        #elif (configUSE_STATIC_POOLS == 1)
+        StaticTask_t *tcb;
+        StackType_t  *stk;
+
+        if (xStaticPoolTakeTask (stack, &tcb, &stk) == pdPASS) {
+          hTask = xTaskCreateStatic ((TaskFunction_t)func, name, stack, argument, prio, stk, tcb);
+        }
+        #endif
       }
     }
   }
@@ -619,7 +654,11 @@ uint32_t osThreadEnumerate (osThreadId_t *thread_array, uint32_t array_items) {
     vTaskSuspendAll();
 
     count = uxTaskGetNumberOfTasks();
+    #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
     task  = pvPortMalloc (count * sizeof(TaskStatus_t));
+    #else
+    task  = (count <= OS_THREAD_ENUMERATE_MAX) ? ThreadEnumerateState : NULL;
+    #endif
 
     if (task != NULL) {
       count = uxTaskGetSystemState (task, count, NULL);
@@ -631,7 +670,9 @@ uint32_t osThreadEnumerate (osThreadId_t *thread_array, uint32_t array_items) {
     }
     (void)xTaskResumeAll();
 
+    #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
     vPortFree (task);
+    #endif
   }
 
   return (count);
@@ -651,14 +692,14 @@ uint32_t osThreadFlagsSet (osThreadId_t thread_id, uint32_t flags) {
     if (IS_IRQ()) {
       yield = pdFALSE;
 
-      (void)xTaskNotifyFromISR (hTask, flags, eSetBits, &yield);
-      (void)xTaskNotifyAndQueryFromISR (hTask, 0, eNoAction, &rflags, NULL);
+      (void)xTaskNotifyIndexedFromISR (hTask, THREAD_FLAGS_NOTIFY_INDEX, flags, eSetBits, &yield);
+      (void)xTaskNotifyAndQueryIndexedFromISR (hTask, THREAD_FLAGS_NOTIFY_INDEX, 0, eNoAction, &rflags, NULL);
 
       portYIELD_FROM_ISR (yield);
     }
     else {
-      (void)xTaskNotify (hTask, flags, eSetBits);
-      (void)xTaskNotifyAndQuery (hTask, 0, eNoAction, &rflags);
+      (void)xTaskNotifyIndexed (hTask, THREAD_FLAGS_NOTIFY_INDEX, flags, eSetBits);
+      (void)xTaskNotifyAndQueryIndexed (hTask, THREAD_FLAGS_NOTIFY_INDEX, 0, eNoAction, &rflags);
     }
   }
   /* Return flags after setting */
@@ -678,11 +719,11 @@ uint32_t osThreadFlagsClear (uint32_t flags) {
   else {
     hTask = xTaskGetCurrentTaskHandle();
 
-    if (xTaskNotifyAndQuery (hTask, 0, eNoAction, &cflags) == pdPASS) {
+    if (xTaskNotifyAndQueryIndexed (hTask, THREAD_FLAGS_NOTIFY_INDEX, 0, eNoAction, &cflags) == pdPASS) {
       rflags = cflags;
       cflags &= ~flags;
 
-      if (xTaskNotify (hTask, cflags, eSetValueWithOverwrite) != pdPASS) {
+      if (xTaskNotifyIndexed (hTask, THREAD_FLAGS_NOTIFY_INDEX, cflags, eSetValueWithOverwrite) != pdPASS) {
         rflags = (uint32_t)osError;
       }
     }
@@ -705,7 +746,7 @@ uint32_t osThreadFlagsGet (void) {
   else {
     hTask = xTaskGetCurrentTaskHandle();
 
-    if (xTaskNotifyAndQuery (hTask, 0, eNoAction, &rflags) != pdPASS) {
+    if (xTaskNotifyAndQueryIndexed (hTask, THREAD_FLAGS_NOTIFY_INDEX, 0, eNoAction, &rflags) != pdPASS) {
       rflags = (uint32_t)osError;
     }
   }
@@ -737,7 +778,7 @@ uint32_t osThreadFlagsWait (uint32_t flags, uint32_t options, uint32_t timeout)
 
     t0 = xTaskGetTickCount();
     do {
-      rval = xTaskNotifyWait (0, clear, &nval, tout);
+      rval = xTaskNotifyWaitIndexed (THREAD_FLAGS_NOTIFY_INDEX, 0, clear, &nval, tout);
 
       if (rval == pdPASS) {
         rflags &= flags;
@@ -844,49 +885,81 @@ osTimerId_t osTimerNew (osTimerFunc_t func, osTimerType_t type, void *argument,
   hTimer = NULL;
 
   if (!IS_IRQ() && (func != NULL)) {
+    #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
     /* Allocate memory to store callback function and argument */
     callb = pvPortMalloc (sizeof(TimerCallback_t));
+    #else
+    /* Without a heap, callback function and argument are stored after the
+       timer control block, or next to a timer taken from the static pool */
+    callb = NULL;
+
+    if ((attr != NULL) && (attr->cb_mem != NULL) && (attr->cb_size >= (sizeof(StaticTimer_t) + sizeof(TimerCallback_t)))) {
+      callb = (TimerCallback_t *)((uint8_t *)attr->cb_mem + sizeof(StaticTimer_t));
+    }
+    #endif
 
     if (callb != NULL) {
       callb->func = func;
       callb->arg  = argument;
+    }
 
-      if (type == osTimerOnce) {
-        reload = pdFALSE;
-      } else {
-        reload = pdTRUE;
-      }
+    if (type == osTimerOnce) {
+      reload = pdFALSE;
+    } else {
+      reload = pdTRUE;
+    }
 
-      mem  = -1;
-      name = NULL;
+    mem  = -1;
+    name = NULL;
 
-      if (attr != NULL) {
-        if (attr->name != NULL) {
-          name = attr->name;
-        }
+    if (attr != NULL) {
+      if (attr->name != NULL) {
+        name = attr->name;
+      }
 
-        if ((attr->cb_mem != NULL) && (attr->cb_size >= sizeof(StaticTimer_t))) {
-          mem = 1;
-        }
-        else {
-          if ((attr->cb_mem == NULL) && (attr->cb_size == 0U)) {
-            mem = 0;
-          }
-        }
+      if ((attr->cb_mem != NULL) && (attr->cb_size >= sizeof(StaticTimer_t))) {
+        mem = 1;
       }
       else {
-        mem = 0;
+        if ((attr->cb_mem == NULL) && (attr->cb_size == 0U)) {
+          mem = 0;
+        }
       }
+    }
+    else {
+      mem = 0;
+    }
 
-      if (mem == 1) {
+    if (mem == 1) {
+      if (callb != NULL) {
         hTimer = xTimerCreateStatic (name, 1, reload, callb, TimerCallback, (StaticTimer_t *)attr->cb_mem);
       }
-      else {
-        if (mem == 0) {
+    }
+    else {
+      if (mem == 0) {
+        #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+        if (callb != NULL) {
           hTimer = xTimerCreate (name, 1, reload, callb, TimerCallback);
         }
+        #elif (configUSE_STATIC_POOLS == 1) && (configSTATIC_POOL_TIMERS > 0)
+        StaticTimer_t *cb = pxStaticPoolTakeTimer ();
+
+        if (cb != NULL) {
+          callb = &TimerCallbackPool[ulAtomicAdd (&TimerCallbackCount, 1U)];
+          callb->func = func;
+          callb->arg  = argument;
+
+          hTimer = xTimerCreateStatic (name, 1, reload, callb, TimerCallback, cb);
+        }
+        #endif
       }
     }
+
+    #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+    if ((hTimer == NULL) && (callb != NULL)) {
+      vPortFree (callb);
+    }
+    #endif
   }
 
   return ((osTimerId_t)hTimer);
@@ -981,7 +1054,11 @@ osStatus_t osTimerDelete (osTimerId_t timer_id) {
     callb = (TimerCallback_t *)pvTimerGetTimerID (hTimer);
 
     if (xTimerDelete (hTimer, 0) == pdPASS) {
+      #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
       vPortFree (callb);
+      #else
+      (void)callb;
+      #endif
       stat = osOK;
     } else {
       stat = osErrorResource;
@@ -1024,7 +1101,15 @@ osEventFlagsId_t osEventFlagsNew (const osEventFlagsAttr_t *attr) {
     }
     else {
       if (mem == 0) {
+        #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
         hEventGroup = xEventGroupCreate();
+        #elif (configUSE_STATIC_POOLS == 1)
+        StaticEventGroup_t *cb = pxStaticPoolTakeEventGroup ();
+
+        if (cb != NULL) {
+          hEventGroup = xEventGroupCreateStatic (cb);
+        }
+        #endif
       }
     }
   }
@@ -1220,11 +1305,23 @@ osMutexId_t osMutexNew (const osMutexAttr_t *attr) {
       }
       else {
         if (mem == 0) {
+          #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
           if (rmtx != 0U) {
             hMutex = xSemaphoreCreateRecursiveMutex ();
           } else {
             hMutex = xSemaphoreCreateMutex ();
           }
+          #elif (configUSE_STATIC_POOLS == 1)
+          StaticSemaphore_t *cb = pxStaticPoolTakeSemaphore ();
+
+          if (cb != NULL) {
+            if (rmtx != 0U) {
+              hMutex = xSemaphoreCreateRecursiveMutexStatic (cb);
+            } else {
+              hMutex = xSemaphoreCreateMutexStatic (cb);
+            }
+          }
+          #endif
         }
       }
 
@@ -1368,6 +1465,7 @@ osStatus_t osMutexDelete (osMutexId_t mutex_id) {
 
 osSemaphoreId_t osSemaphoreNew (uint32_t max_count, uint32_t initial_count, const osSemaphoreAttr_t *attr) {
   SemaphoreHandle_t hSemaphore;
+  StaticSemaphore_t *cb;
   int32_t mem;
   #if (configQUEUE_REGISTRY_SIZE > 0)
   const char *name;
@@ -1392,14 +1490,31 @@ osSemaphoreId_t osSemaphoreNew (uint32_t max_count, uint32_t initial_count, cons
       mem = 0;
     }
 
+    cb = NULL;
+
+    if (mem == 1) {
+      cb = (StaticSemaphore_t *)attr->cb_mem;
+    }
+    #if (configSUPPORT_DYNAMIC_ALLOCATION == 0)
+    else if (mem == 0) {
+      /* Without a heap the control block is taken from the static pool */
+      #if (configUSE_STATIC_POOLS == 1)
+      cb = pxStaticPoolTakeSemaphore ();
+      #endif
+      mem = (cb != NULL) ? 1 : -1;
+    }
+    #endif
+
     if (mem != -1) {
       if (max_count == 1U) {
         if (mem == 1) {
-          hSemaphore = xSemaphoreCreateBinaryStatic ((StaticSemaphore_t *)attr->cb_mem);
+          hSemaphore = xSemaphoreCreateBinaryStatic (cb);
         }
+        #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
         else {
           hSemaphore = xSemaphoreCreateBinary();
         }
+        #endif
 
         if ((hSemaphore != NULL) && (initial_count != 0U)) {
           if (xSemaphoreGive (hSemaphore) != pdPASS) {
@@ -1410,11 +1525,13 @@ osSemaphoreId_t osSemaphoreNew (uint32_t max_count, uint32_t initial_count, cons
       }
       else {
         if (mem == 1) {
-          hSemaphore = xSemaphoreCreateCountingStatic (max_count, initial_count, (StaticSemaphore_t *)attr->cb_mem);
+          hSemaphore = xSemaphoreCreateCountingStatic (max_count, initial_count, cb);
         }
+        #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
         else {
           hSemaphore = xSemaphoreCreateCounting (max_count, initial_count);
         }
+        #endif
       }
 
       #if (configQUEUE_REGISTRY_SIZE > 0)
@@ -1542,6 +1659,379 @@ osStatus_t osSemaphoreDelete (osSemaphoreId_t semaphore_id) {
 
 /*---------------------------------------------------------------------------*/
 
+/* Memory pool status flags */
+#define MPOOL_STATUS_CB_DYNAMIC   0x01U   /* Control block allocated by osMemoryPoolNew */
+#define MPOOL_STATUS_MEM_DYNAMIC  0x02U   /* Pool memory allocated by osMemoryPoolNew   */
+
+/* Free list head encoding */
+#define MPOOL_HEAD_INDEX_MASK     0x0000FFFFU
+#define MPOOL_HEAD_TAG_INC        0x00010000U
+
+/*
+  Remove the first block from the pool free list. Returns NULL when the pool
+  is exhausted.
+*/
+static void *MemPoolPop (MemPool_t *mp) {
+  uint32_t head, next, idx;
+  void *block;
+
+  do {
+    head = mp->head;
+    idx  = head & MPOOL_HEAD_INDEX_MASK;
+
+    if (idx == 0U) {
+      block = NULL;
+      break;
+    }
+
+    block = &mp->mem_arr[(idx - 1U) * mp->bl_sz];
+    /* Block may be allocated by someone else meanwhile, in which case next is
+       stale but the tag in head has changed and the swap fails */
+    next  = *(volatile uint32_t *)block;
+  }
+  while (ulAtomicCompareAndSwap (&mp->head, ((head & ~MPOOL_HEAD_INDEX_MASK) + MPOOL_HEAD_TAG_INC) | next, head) != atomicCOMPARE_AND_SWAP_SUCCESS);
+
+  if (block != NULL) {
+    (void)ulAtomicAdd (&mp->n, 1U);
+  }
+
+  return (block);
+}
+
+/*
+  Return a block to the pool free list.
+*/
+static void MemPoolPush (MemPool_t *mp, void *block) {
+  uint32_t head, idx;
+
+  idx = (((uint32_t)((uint8_t *)block - mp->mem_arr)) / mp->bl_sz) + 1U;
+
+  (void)ulAtomicAdd (&mp->n, (uint32_t)-1);
+
+  do {
+    head = mp->head;
+    *(volatile uint32_t *)block = head & MPOOL_HEAD_INDEX_MASK;
+    portMEMORY_BARRIER();
+  }
+  while (ulAtomicCompareAndSwap (&mp->head, ((head & ~MPOOL_HEAD_INDEX_MASK) + MPOOL_HEAD_TAG_INC) | idx, head) != atomicCOMPARE_AND_SWAP_SUCCESS);
+}
+
+osMemoryPoolId_t osMemoryPoolNew (uint32_t block_count, uint32_t block_size, const osMemoryPoolAttr_t *attr) {
+  MemPool_t *mp;
+  const char *name;
+  int32_t mem_cb, mem_mp;
+  uint32_t sz, i;
+
+  mp = NULL;
+
+  if (!IS_IRQ() && (block_count > 0U) && (block_count <= MPOOL_MAX_BLOCKS) && (block_size > 0U)) {
+    /* Blocks hold the free list link while free, so are word aligned */
+    sz = MEMPOOL_ARR_SIZE (block_count, block_size);
+
+    name   = NULL;
+    mem_cb = -1;
+    mem_mp = -1;
+
+    if (attr != NULL) {
+      if (attr->name != NULL) {
+        name = attr->name;
+      }
+
+      if ((attr->cb_mem != NULL) && (attr->cb_size >= sizeof(MemPool_t))) {
+        mem_cb = 1;
+      }
+      else {
+        if ((attr->cb_mem == NULL) && (attr->cb_size == 0U)) {
+          mem_cb = 0;
+        }
+      }
+
+      if ((attr->mp_mem != NULL) && (attr->mp_size >= sz) && (((uint32_t)attr->mp_mem & 3U) == 0U)) {
+        mem_mp = 1;
+      }
+      else {
+        if ((attr->mp_mem == NULL) && (attr->mp_size == 0U)) {
+          mem_mp = 0;
+        }
+      }
+    }
+    else {
+      mem_cb = 0;
+      mem_mp = 0;
+    }
+
+    if ((mem_cb != -1) && (mem_mp != -1)) {
+      if (mem_cb == 1) {
+        mp = attr->cb_mem;
+        mp->status = MPOOL_STATUS;
+      }
+      else {
+        #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+        mp = pvPortMalloc (sizeof(MemPool_t));
+
+        if (mp != NULL) {
+          mp->status = MPOOL_STATUS | MPOOL_STATUS_CB_DYNAMIC;
+        }
+        #else
+        /* Without a heap the control block must be provided */
+        mp = NULL;
+        #endif
+      }
+
+      if (mp != NULL) {
+        if (mem_mp == 1) {
+          mp->mem_arr = attr->mp_mem;
+        }
+        else {
+          #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+          mp->mem_arr = pvPortMalloc (sz);
+
+          if (mp->mem_arr != NULL) {
+            mp->status |= MPOOL_STATUS_MEM_DYNAMIC;
+          }
+          #else
+          /* Without a heap the pool memory must be provided */
+          mp->mem_arr = NULL;
+          #endif
+        }
+
+        if (mp->mem_arr != NULL) {
+          mp->sem = xSemaphoreCreateCountingStatic (block_count, 0U, &mp->mem_sem);
+        }
+
+        if ((mp->mem_arr == NULL) || (mp->sem == NULL)) {
+          #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+          if ((mp->mem_arr != NULL) && ((mp->status & MPOOL_STATUS_MEM_DYNAMIC) != 0U)) {
+            vPortFree (mp->mem_arr);
+          }
+          if ((mp->status & MPOOL_STATUS_CB_DYNAMIC) != 0U) {
+            vPortFree (mp);
+          }
+          else {
+            mp->status = 0U;
+          }
+          #else
+          mp->status = 0U;
+          #endif
+          mp = NULL;
+        }
+      }
+
+      if (mp != NULL) {
+        mp->name    = name;
+        mp->mem_sz  = sz;
+        mp->bl_sz   = sz / block_count;
+        mp->bl_cnt  = block_count;
+        mp->n       = 0U;
+        mp->waiting = 0U;
+
+        /* Link all blocks in address order, last block terminates the list */
+        for (i = 0U; i < block_count; i++) {
+          *(uint32_t *)&mp->mem_arr[i * mp->bl_sz] = (i + 1U < block_count) ? (i + 2U) : 0U;
+        }
+        mp->head = 1U;
+      }
+    }
+  }
+
+  return ((osMemoryPoolId_t)mp);
+}
+
+const char *osMemoryPoolGetName (osMemoryPoolId_t mp_id) {
+  MemPool_t *mp = (MemPool_t *)mp_id;
+  const char *p;
+
+  if (IS_IRQ() || (mp == NULL) || ((mp->status & MPOOL_STATUS) != MPOOL_STATUS)) {
+    p = NULL;
+  } else {
+    p = mp->name;
+  }
+
+  return (p);
+}
+
+void *osMemoryPoolAlloc (osMemoryPoolId_t mp_id, uint32_t timeout) {
+  MemPool_t *mp = (MemPool_t *)mp_id;
+  TimeOut_t xTimeOut;
+  TickType_t ticks;
+  void *block;
+
+  block = NULL;
+
+  if ((mp == NULL) || ((mp->status & MPOOL_STATUS) != MPOOL_STATUS)) {
+    block = NULL;
+  }
+  else if (IS_IRQ()) {
+    if (timeout == 0U) {
+      block = MemPoolPop (mp);
+    }
+  }
+  else {
+    block = MemPoolPop (mp);
+
+    if ((block == NULL) && (timeout != 0U)) {
+      ticks = (TickType_t)timeout;
+      vTaskSetTimeOutState (&xTimeOut);
+
+      do {
+        /* Register as waiting before checking the pool again, so a block
+           freed after the check always signals the semaphore */
+        (void)ulAtomicAdd (&mp->waiting, 1U);
+        portMEMORY_BARRIER();
+
+        block = MemPoolPop (mp);
+
+        if (block == NULL) {
+          (void)xSemaphoreTake (mp->sem, ticks);
+        }
+
+        (void)ulAtomicAdd (&mp->waiting, (uint32_t)-1);
+
+        if (block == NULL) {
+          block = MemPoolPop (mp);
+        }
+      }
+      while ((block == NULL) && (xTaskCheckForTimeOut (&xTimeOut, &ticks) == pdFALSE));
+    }
+  }
+
+  return (block);
+}
+
+osStatus_t osMemoryPoolFree (osMemoryPoolId_t mp_id, void *block) {
+  MemPool_t *mp = (MemPool_t *)mp_id;
+  osStatus_t stat;
+  BaseType_t yield;
+  uint32_t offs;
+
+  if ((mp == NULL) || (block == NULL)) {
+    stat = osErrorParameter;
+  }
+  else if ((mp->status & MPOOL_STATUS) != MPOOL_STATUS) {
+    /* Pool not initialized or already deleted */
+    stat = osErrorParameter;
+  }
+  else if (((uint8_t *)block < mp->mem_arr) || ((uint8_t *)block >= &mp->mem_arr[mp->mem_sz])) {
+    /* Block does not belong to this pool */
+    stat = osErrorParameter;
+  }
+  else {
+    offs = (uint32_t)((uint8_t *)block - mp->mem_arr);
+
+    if ((offs % mp->bl_sz) != 0U) {
+      /* Not the start of a block */
+      stat = osErrorParameter;
+    }
+    else if (mp->n == 0U) {
+      /* All blocks are already free */
+      stat = osErrorResource;
+    }
+    else {
+      stat = osOK;
+      MemPoolPush (mp, block);
+      portMEMORY_BARRIER();
+
+      if (mp->waiting != 0U) {
+        if (IS_IRQ()) {
+          yield = pdFALSE;
+          (void)xSemaphoreGiveFromISR (mp->sem, &yield);
+          portYIELD_FROM_ISR (yield);
+        } else {
+          (void)xSemaphoreGive (mp->sem);
+        }
+      }
+    }
+  }
+
+  return (stat);
+}
+
+uint32_t osMemoryPoolGetCapacity (osMemoryPoolId_t mp_id) {
+  MemPool_t *mp = (MemPool_t *)mp_id;
+  uint32_t n;
+
+  if ((mp == NULL) || ((mp->status & MPOOL_STATUS) != MPOOL_STATUS)) {
+    n = 0U;
+  } else {
+    n = mp->bl_cnt;
+  }
+
+  return (n);
+}
+
+uint32_t osMemoryPoolGetBlockSize (osMemoryPoolId_t mp_id) {
+  MemPool_t *mp = (MemPool_t *)mp_id;
+  uint32_t sz;
+
+  if ((mp == NULL) || ((mp->status & MPOOL_STATUS) != MPOOL_STATUS)) {
+    sz = 0U;
+  } else {
+    sz = mp->bl_sz;
+  }
+
+  return (sz);
+}
+
+uint32_t osMemoryPoolGetCount (osMemoryPoolId_t mp_id) {
+  MemPool_t *mp = (MemPool_t *)mp_id;
+  uint32_t n;
+
+  if ((mp == NULL) || ((mp->status & MPOOL_STATUS) != MPOOL_STATUS)) {
+    n = 0U;
+  } else {
+    n = mp->n;
+  }
+
+  return (n);
+}
+
+uint32_t osMemoryPoolGetSpace (osMemoryPoolId_t mp_id) {
+  MemPool_t *mp = (MemPool_t *)mp_id;
+  uint32_t n;
+
+  if ((mp == NULL) || ((mp->status & MPOOL_STATUS) != MPOOL_STATUS)) {
+    n = 0U;
+  } else {
+    n = mp->bl_cnt - mp->n;
+  }
+
+  return (n);
+}
+
+osStatus_t osMemoryPoolDelete (osMemoryPoolId_t mp_id) {
+  MemPool_t *mp = (MemPool_t *)mp_id;
+  osStatus_t stat;
+
+  if (IS_IRQ()) {
+    stat = osErrorISR;
+  }
+  else if ((mp == NULL) || ((mp->status & MPOOL_STATUS) != MPOOL_STATUS)) {
+    stat = osErrorParameter;
+  }
+  else {
+    stat = osOK;
+    vSemaphoreDelete (mp->sem);
+
+#if !defined(USE_FreeRTOS_HEAP_1) && (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+    if ((mp->status & MPOOL_STATUS_MEM_DYNAMIC) != 0U) {
+      vPortFree (mp->mem_arr);
+    }
+    if ((mp->status & MPOOL_STATUS_CB_DYNAMIC) != 0U) {
+      vPortFree (mp);
+    }
+    else {
+      mp->status = 0U;
+    }
+#else
+    mp->status = 0U;
+#endif
+  }
+
+  return (stat);
+}
+
+/*---------------------------------------------------------------------------*/
+
 osMessageQueueId_t osMessageQueueNew (uint32_t msg_count, uint32_t msg_size, const osMessageQueueAttr_t *attr) {
   QueueHandle_t hQueue;
   int32_t mem;
@@ -1575,7 +2065,18 @@ osMessageQueueId_t osMessageQueueNew (uint32_t msg_count, uint32_t msg_size, con
     }
     else {
       if (mem == 0) {
+        #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
         hQueue = xQueueCreate (msg_count, msg_size);
+        #elif (configUSE_STATIC_POOLS == 1)
+        StaticQueue_t *cb;
+        uint8_t       *mq;
+
+        cb = pxStaticPoolTakeQueue ((size_t)msg_count * msg_size, &mq);
+
+        if (cb != NULL) {
+          hQueue = xQueueCreateStatic (msg_count, msg_size, mq, cb);
+        }
+        #endif
       }
     }
 
@@ -1829,7 +2330,7 @@ __WEAK void vApplicationDaemonTaskStartupHook (void){}
 /**
   Dummy implementation of the callback function vApplicationStackOverflowHook().
 */
-#if (configCHECK_FOR_STACK_OVERFLOW > 0)
+#if (configCHECK_FOR_STACK_OVERFLOW > 0) || (configUSE_MPU_STACK_GUARD == 1)
 __WEAK void vApplicationStackOverflowHook (TaskHandle_t xTask, signed char *pcTaskName) {
   (void)xTask;
   (void)pcTaskName;
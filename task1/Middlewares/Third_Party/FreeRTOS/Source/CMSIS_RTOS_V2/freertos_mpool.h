@@ -0,0 +1,72 @@
+/* --------------------------------------------------------------------------
+ * Portions Copyright © 2017 STMicroelectronics International N.V. All rights reserved.
+ * Portions Copyright (c) 2013-2017 ARM Limited. All rights reserved.
+ * --------------------------------------------------------------------------
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *      Name:    freertos_mpool.h
+ *      Purpose: CMSIS RTOS2 wrapper for FreeRTOS
+ *
+ *---------------------------------------------------------------------------*/
+
+#ifndef FREERTOS_MPOOL_H_
+#define FREERTOS_MPOOL_H_
+
+#include <stdint.h>
+#include "FreeRTOS.h"
+#include "semphr.h"
+
+/* Memory Pool implementation definitions */
+#define MPOOL_STATUS              0x5EED0000U
+
+/* Maximum number of blocks in a memory pool (block index width) */
+#define MPOOL_MAX_BLOCKS          0xFFFFU
+
+/* Memory Pool control block.
+
+   Free blocks form an intrusive singly linked list: the first word of a free
+   block holds the index (plus one) of the next free block. The list head holds
+   the index (plus one) of the first free block in the low 16 bits and a
+   modification counter in the high 16 bits, so it can be updated with a single
+   32-bit compare and swap from threads and interrupts without the ABA problem.
+
+   Applications that provide control block memory (osMemoryPoolAttr_t::cb_mem)
+   must provide at least sizeof(MemPool_t) bytes.
+*/
+typedef struct MemPoolDef_t {
+  volatile uint32_t  head;      /* Free list head (tag and block index) */
+  volatile uint32_t  n;         /* Number of allocated blocks           */
+  volatile uint32_t  waiting;   /* Number of threads waiting for blocks */
+  uint8_t           *mem_arr;   /* Pool memory array                    */
+  uint32_t           mem_sz;    /* Pool memory array size               */
+  const char        *name;      /* Pointer to name string               */
+  uint32_t           bl_sz;     /* Size of a single block               */
+  uint32_t           bl_cnt;    /* Number of blocks                     */
+  volatile uint32_t  status;    /* Object status flags                  */
+  SemaphoreHandle_t  sem;       /* Signals waiting threads on free      */
+  StaticSemaphore_t  mem_sem;   /* Semaphore object memory              */
+} MemPool_t;
+
+/* No need to hide static object type, just align to coding style */
+#define StaticMemPool_t         MemPool_t
+
+/* Define memory pool control block size */
+#define MEMPOOL_CB_SIZE         (sizeof(StaticMemPool_t))
+
+/* Define size of the byte array required to create count of blocks of given size */
+#define MEMPOOL_ARR_SIZE(bl_count, bl_size) (((((bl_size) + (4 - 1)) / 4) * 4)*(bl_count))
+
+#endif /* FREERTOS_MPOOL_H_ */
@@ -0,0 +1,921 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "atomic.h"
+#include "active_object.h"
+
+#if ( configUSE_ACTIVE_OBJECTS == 1 ) && ( configUSE_TASK_NOTIFICATIONS != 1 )
+	#error configUSE_TASK_NOTIFICATIONS must be set to 1 to use active objects.
+#endif
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+
+/* This entire source file will be skipped if the application is not configured
+to include active object functionality.  This #if is closed at the very bottom
+of this file.  If you want to include active objects then ensure
+configUSE_ACTIVE_OBJECTS is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_ACTIVE_OBJECTS == 1 )
+
+/* The head of a pool's free list holds the index of the first free block in
+its low 16 bits, and a tag that is incremented by every update in its high 16
+bits. */
+#define aoINDEX_MASK		( ( uint32_t ) 0x0000ffffUL )
+#define aoTAG_INCREMENT		( ( uint32_t ) 0x00010000UL )
+#define aoNO_BLOCK			aoINDEX_MASK
+
+/* Adding aoDECREMENT to an unsigned value subtracts one. */
+#define aoDECREMENT			( ( uint32_t ) 0xffffffffUL )
+
+#ifndef configAO_RUNNER_NAME
+	#define configAO_RUNNER_NAME "AO"
+#endif
+
+/* A fixed block event pool.  While a block is free, the ulRefCount member of
+its AOEvent_t header holds the index of the next free block. */
+typedef struct xAO_EVENT_POOL
+{
+	volatile uint32_t ulHead;			/* Tag and index of the first free block.  Only updated by compare and swap. */
+	volatile uint32_t ulFree;			/* The number of free blocks. */
+	volatile uint32_t ulMinimumFree;	/* The smallest value ulFree has held. */
+	uint8_t *pucStorage;
+	size_t xBlockSize;
+} AOEventPool_t;
+
+/* A runner task and the set of active objects that have events pending. */
+typedef struct xAO_RUNNER
+{
+	volatile uint32_t ulReady;		/* Bit n is set if the active object with identifier n may have events pending. */
+	TaskHandle_t xTaskHandle;
+} AORunner_t;
+
+/*lint -save -e956 A manual analysis and inspection has been used to determine
+which static variables must be declared volatile. */
+
+PRIVILEGED_DATA static AOEventPool_t xEventPools[ configAO_MAX_EVENT_POOLS ];
+PRIVILEGED_DATA static UBaseType_t uxEventPoolsAdded = ( UBaseType_t ) 0;
+PRIVILEGED_DATA static AORunner_t xRunners[ configAO_RUNNERS ];
+PRIVILEGED_DATA static ActiveObject_t * volatile pxActiveObjects[ configAO_MAX_ACTIVE_OBJECTS ];
+
+/* Bit n of ulSubscribers[ x ] is set if the active object with identifier n
+is subscribed to signal x. */
+PRIVILEGED_DATA static volatile uint32_t ulSubscribers[ configAO_MAX_PUBLISH_SIGNALS ];
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+	PRIVILEGED_DATA static StaticTask_t xRunnerTCBs[ configAO_RUNNERS ];
+	PRIVILEGED_DATA static StackType_t xRunnerStacks[ configAO_RUNNERS ][ configAO_RUNNER_STACK_DEPTH ];
+#endif
+
+/*lint -restore */
+
+/* The events sent to state handlers by the dispatcher, indexed by signal. */
+static const AOEvent_t xReservedEvents[ aoSIG_USER ] =
+{
+	{ aoSIG_EMPTY, 0U, 0U, 0UL },
+	{ aoSIG_ENTRY, 0U, 0U, 0UL },
+	{ aoSIG_EXIT, 0U, 0U, 0UL },
+	{ aoSIG_INIT, 0U, 0U, 0UL }
+};
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The runner task.  pvParameters points to the runner's AORunner_t
+ * structure.
+ */
+static void prvRunnerTask( void *pvParameters ) PRIVILEGED_FUNCTION;
+
+/*
+ * Dispatches one event to an active object's state machine, running it to
+ * completion, including any transition it causes.
+ */
+static void prvDispatch( ActiveObject_t * const pxAO, const AOEvent_t * const pxEvent ) PRIVILEGED_FUNCTION;
+
+/*
+ * Enters the states from just below pxFrom down to pxTarget, which must be a
+ * substate of pxFrom, then takes initial transitions from pxTarget until a
+ * leaf state is reached.  xResult is the value returned by the state that took
+ * the transition to pxTarget.  Returns the leaf state.
+ */
+static AOStateHandler_t prvEnterTarget( ActiveObject_t * const pxAO, AOStateHandler_t pxFrom, BaseType_t xResult ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the superstate of pxState, or NULL if pxState is the top state.
+ */
+static AOStateHandler_t prvSuperstate( ActiveObject_t * const pxAO, AOStateHandler_t pxState ) PRIVILEGED_FUNCTION;
+
+/*
+ * Queues an event for an active object and makes the active object ready in
+ * its runner.  If xFromISR is pdFALSE pxHigherPriorityTaskWoken is not used.
+ */
+static BaseType_t prvDeliver( ActiveObject_t * const pxAO, const AOEvent_t * const pxEvent, BaseType_t xFromISR, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * Delivers an event to each of its signal's subscribers.
+ */
+static UBaseType_t prvPublish( const AOEvent_t * const pxEvent, BaseType_t xFromISR, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * Adjust the reference count of a pool event.  prvReleaseEvent() returns the
+ * event to its pool when the count reaches zero.
+ */
+static void prvRetainEvent( const AOEvent_t * const pxEvent ) PRIVILEGED_FUNCTION;
+static void prvReleaseEvent( const AOEvent_t * const pxEvent ) PRIVILEGED_FUNCTION;
+
+/*
+ * Remove a block from, and return a block to, an event pool's free list.
+ */
+static AOEvent_t *prvPoolAllocate( AOEventPool_t * const pxPool ) PRIVILEGED_FUNCTION;
+static void prvPoolFree( AOEventPool_t * const pxPool, AOEvent_t * const pxBlock ) PRIVILEGED_FUNCTION;
+
+/*
+ * Set and clear an active object's bit in a runner's ready set.
+ * prvSetReady() returns the value the ready set held before the bit was set.
+ */
+static uint32_t prvSetReady( AORunner_t * const pxRunner, UBaseType_t uxId ) PRIVILEGED_FUNCTION;
+static void prvClearReady( AORunner_t * const pxRunner, UBaseType_t uxId ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the index of the most significant set bit of ulBits, which must not
+ * be zero.
+ */
+static UBaseType_t prvHighestBit( uint32_t ulBits ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+BaseType_t xActiveObjectTop( ActiveObject_t *pxAO, const AOEvent_t *pxEvent )
+{
+	( void ) pxAO;
+	( void ) pxEvent;
+
+	return aoIGNORED();
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xActiveObjectInit( void )
+{
+BaseType_t xReturn = pdPASS;
+UBaseType_t uxRunner;
+
+	for( uxRunner = 0; uxRunner < ( UBaseType_t ) configAO_RUNNERS; uxRunner++ )
+	{
+		/* Must not be initialised twice. */
+		configASSERT( xRunners[ uxRunner ].xTaskHandle == NULL );
+
+		#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+		{
+			if( xTaskCreate( prvRunnerTask,
+							 configAO_RUNNER_NAME,
+							 configAO_RUNNER_STACK_DEPTH,
+							 ( void * ) &( xRunners[ uxRunner ] ),
+							 ( ( UBaseType_t ) configAO_RUNNER_PRIORITY + uxRunner ) | portPRIVILEGE_BIT,
+							 &( xRunners[ uxRunner ].xTaskHandle ) ) != pdPASS )
+			{
+				xReturn = pdFAIL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#else
+		{
+			xRunners[ uxRunner ].xTaskHandle = xTaskCreateStatic( prvRunnerTask,
+																  configAO_RUNNER_NAME,
+																  configAO_RUNNER_STACK_DEPTH,
+																  ( void * ) &( xRunners[ uxRunner ] ),
+																  ( ( UBaseType_t ) configAO_RUNNER_PRIORITY + uxRunner ) | portPRIVILEGE_BIT,
+																  xRunnerStacks[ uxRunner ],
+																  &( xRunnerTCBs[ uxRunner ] ) );
+
+			if( xRunners[ uxRunner ].xTaskHandle == NULL )
+			{
+				xReturn = pdFAIL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+	}
+
+	configASSERT( xReturn );
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xActiveObjectPoolInit( void *pvPoolStorage, size_t xBlockSize, UBaseType_t uxBlocks )
+{
+AOEventPool_t *pxPool;
+AOEvent_t *pxBlock;
+uint32_t ulIndex;
+BaseType_t xReturn = pdFAIL;
+
+	configASSERT( pvPoolStorage );
+	configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pvPoolStorage ) & ( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) == 0UL );
+	configASSERT( xBlockSize >= sizeof( AOEvent_t ) );
+	configASSERT( ( xBlockSize & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
+	configASSERT( ( uxBlocks > ( UBaseType_t ) 0 ) && ( uxBlocks < ( UBaseType_t ) aoNO_BLOCK ) );
+
+	taskENTER_CRITICAL();
+	{
+		if( uxEventPoolsAdded < ( UBaseType_t ) configAO_MAX_EVENT_POOLS )
+		{
+			/* Pools must be added in increasing order of block size, as
+			pxActiveObjectNewEvent() uses the first pool that is large
+			enough. */
+			configASSERT( ( uxEventPoolsAdded == ( UBaseType_t ) 0 ) || ( xBlockSize > xEventPools[ uxEventPoolsAdded - 1 ].xBlockSize ) );
+
+			pxPool = &( xEventPools[ uxEventPoolsAdded ] );
+			pxPool->pucStorage = ( uint8_t * ) pvPoolStorage;
+			pxPool->xBlockSize = xBlockSize;
+
+			for( ulIndex = 0; ulIndex < ( uint32_t ) uxBlocks; ulIndex++ )
+			{
+				pxBlock = ( AOEvent_t * ) &( pxPool->pucStorage[ ulIndex * xBlockSize ] ); /*lint !e9087 !e826 Blocks are aligned to portBYTE_ALIGNMENT. */
+				pxBlock->ulRefCount = ( ulIndex + 1UL < ( uint32_t ) uxBlocks ) ? ( ulIndex + 1UL ) : aoNO_BLOCK;
+			}
+
+			pxPool->ulHead = 0UL;
+			pxPool->ulFree = ( uint32_t ) uxBlocks;
+			pxPool->ulMinimumFree = ( uint32_t ) uxBlocks;
+
+			uxEventPoolsAdded++;
+			xReturn = pdPASS;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	configASSERT( xReturn );
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxActiveObjectPoolGetMinimumFree( UBaseType_t uxPool )
+{
+	configASSERT( uxPool < uxEventPoolsAdded );
+
+	return ( UBaseType_t ) xEventPools[ uxPool ].ulMinimumFree;
+}
+/*-----------------------------------------------------------*/
+
+AOEvent_t *pxActiveObjectNewEvent( size_t xEventSize, AOSignal_t xSignal )
+{
+AOEvent_t *pxEvent = NULL;
+UBaseType_t uxPool;
+
+	for( uxPool = 0; uxPool < uxEventPoolsAdded; uxPool++ )
+	{
+		if( xEventPools[ uxPool ].xBlockSize >= xEventSize )
+		{
+			break;
+		}
+	}
+
+	/* An event that does not fit in any pool is a design error, whereas an
+	exhausted pool is a run time condition the caller handles. */
+	configASSERT( uxPool < uxEventPoolsAdded );
+
+	if( uxPool < uxEventPoolsAdded )
+	{
+		pxEvent = prvPoolAllocate( &( xEventPools[ uxPool ] ) );
+
+		if( pxEvent != NULL )
+		{
+			pxEvent->xSignal = xSignal;
+			pxEvent->ucPoolId = ( uint8_t ) ( uxPool + 1 );
+			pxEvent->ucReserved = 0U;
+			pxEvent->ulRefCount = 0UL;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pxEvent;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xActiveObjectStart( ActiveObject_t *pxAO, UBaseType_t uxId, UBaseType_t uxRunner, const AOEvent_t **ppxQueueStorage, UBaseType_t uxQueueLength, AOStateHandler_t pxInitial )
+{
+BaseType_t xReturn = pdFAIL;
+
+	configASSERT( pxAO );
+	configASSERT( pxInitial );
+	configASSERT( uxId < ( UBaseType_t ) configAO_MAX_ACTIVE_OBJECTS );
+	configASSERT( pxActiveObjects[ uxId ] == NULL );
+	configASSERT( uxRunner < ( UBaseType_t ) configAO_RUNNERS );
+
+	/* xActiveObjectInit() must be called first. */
+	configASSERT( xRunners[ uxRunner ].xTaskHandle );
+
+	pxAO->uxId = uxId;
+	pxAO->uxRunner = uxRunner;
+	pxAO->xQueue = NULL;
+
+	#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	{
+		if( ppxQueueStorage != NULL )
+		{
+			pxAO->xQueue = xQueueCreateStatic( uxQueueLength, ( UBaseType_t ) sizeof( const AOEvent_t * ), ( uint8_t * ) ppxQueueStorage, &( pxAO->xQueueBuffer ) ); /*lint !e9079 !e9087 The storage is an array of event pointers. */
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+	#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	{
+		if( ppxQueueStorage == NULL )
+		{
+			pxAO->xQueue = xQueueCreate( uxQueueLength, ( UBaseType_t ) sizeof( const AOEvent_t * ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+	if( pxAO->xQueue != NULL )
+	{
+		/* The scheduler is suspended so the runner cannot dispatch an event
+		posted by an entry action before the initial transition is
+		complete. */
+		vTaskSuspendAll();
+		{
+			pxActiveObjects[ uxId ] = pxAO;
+			pxAO->pxState = xActiveObjectTop;
+			pxAO->pxState = prvEnterTarget( pxAO, xActiveObjectTop, pxInitial( pxAO, &( xReservedEvents[ aoSIG_INIT ] ) ) );
+		}
+		( void ) xTaskResumeAll();
+
+		xReturn = pdPASS;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	configASSERT( xReturn );
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xActiveObjectPost( ActiveObject_t *pxAO, const AOEvent_t *pxEvent )
+{
+	configASSERT( pxAO );
+	configASSERT( pxEvent );
+
+	return prvDeliver( pxAO, pxEvent, pdFALSE, NULL );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xActiveObjectPostFromISR( ActiveObject_t *pxAO, const AOEvent_t *pxEvent, BaseType_t *pxHigherPriorityTaskWoken )
+{
+	configASSERT( pxAO );
+	configASSERT( pxEvent );
+
+	return prvDeliver( pxAO, pxEvent, pdTRUE, pxHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+void vActiveObjectSubscribe( ActiveObject_t *pxAO, AOSignal_t xSignal )
+{
+	configASSERT( pxAO );
+	configASSERT( xSignal < ( AOSignal_t ) configAO_MAX_PUBLISH_SIGNALS );
+
+	taskENTER_CRITICAL();
+	{
+		ulSubscribers[ xSignal ] |= ( 1UL << pxAO->uxId );
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vActiveObjectUnsubscribe( ActiveObject_t *pxAO, AOSignal_t xSignal )
+{
+	configASSERT( pxAO );
+	configASSERT( xSignal < ( AOSignal_t ) configAO_MAX_PUBLISH_SIGNALS );
+
+	taskENTER_CRITICAL();
+	{
+		ulSubscribers[ xSignal ] &= ~( 1UL << pxAO->uxId );
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxActiveObjectPublish( const AOEvent_t *pxEvent )
+{
+	return prvPublish( pxEvent, pdFALSE, NULL );
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxActiveObjectPublishFromISR( const AOEvent_t *pxEvent, BaseType_t *pxHigherPriorityTaskWoken )
+{
+	return prvPublish( pxEvent, pdTRUE, pxHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvPublish( const AOEvent_t * const pxEvent, BaseType_t xFromISR, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+uint32_t ulPending;
+UBaseType_t uxId, uxDelivered = 0;
+
+	configASSERT( pxEvent );
+	configASSERT( pxEvent->xSignal < ( AOSignal_t ) configAO_MAX_PUBLISH_SIGNALS );
+
+	ulPending = ulSubscribers[ pxEvent->xSignal ];
+
+	/* Hold a reference while the event is multicast, so a subscriber that
+	processes the event before it has been delivered to every subscriber
+	cannot return it to its pool. */
+	prvRetainEvent( pxEvent );
+
+	while( ulPending != 0UL )
+	{
+		uxId = prvHighestBit( ulPending );
+		ulPending &= ~( 1UL << uxId );
+
+		if( prvDeliver( pxActiveObjects[ uxId ], pxEvent, xFromISR, pxHigherPriorityTaskWoken ) == pdPASS )
+		{
+			uxDelivered++;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	/* Returns the event to its pool if it had no subscribers. */
+	prvReleaseEvent( pxEvent );
+
+	return uxDelivered;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvDeliver( ActiveObject_t * const pxAO, const AOEvent_t * const pxEvent, BaseType_t xFromISR, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+AORunner_t * const pxRunner = &( xRunners[ pxAO->uxRunner ] );
+BaseType_t xReturn;
+
+	configASSERT( pxAO->xQueue );
+
+	prvRetainEvent( pxEvent );
+
+	if( xFromISR != pdFALSE )
+	{
+		xReturn = xQueueSendFromISR( pxAO->xQueue, &pxEvent, pxHigherPriorityTaskWoken );
+	}
+	else
+	{
+		xReturn = xQueueSend( pxAO->xQueue, &pxEvent, ( TickType_t ) 0 );
+	}
+
+	if( xReturn == pdPASS )
+	{
+		/* The runner only needs to be notified if it had nothing to do,
+		otherwise it will find the active object ready before it waits
+		again. */
+		if( prvSetReady( pxRunner, pxAO->uxId ) == 0UL )
+		{
+			if( xFromISR != pdFALSE )
+			{
+				vTaskNotifyGiveFromISR( pxRunner->xTaskHandle, pxHigherPriorityTaskWoken );
+			}
+			else
+			{
+				( void ) xTaskNotifyGive( pxRunner->xTaskHandle );
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		/* The queue was full. */
+		prvReleaseEvent( pxEvent );
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRunnerTask( void *pvParameters )
+{
+AORunner_t * const pxRunner = ( AORunner_t * ) pvParameters;
+ActiveObject_t *pxAO;
+const AOEvent_t *pxEvent;
+uint32_t ulReady;
+UBaseType_t uxId;
+
+	for( ;; )
+	{
+		( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+		for( ;; )
+		{
+			ulReady = pxRunner->ulReady;
+
+			if( ulReady == 0UL )
+			{
+				break;
+			}
+
+			uxId = prvHighestBit( ulReady );
+			pxAO = pxActiveObjects[ uxId ];
+
+			/* The bit is cleared before the queue is read.  An event posted
+			after the read sets it again, so is never missed. */
+			prvClearReady( pxRunner, uxId );
+
+			/* One event is dispatched per pass, so an event posted to a
+			higher priority active object is dispatched next. */
+			if( xQueueReceive( pxAO->xQueue, &pxEvent, ( TickType_t ) 0 ) == pdPASS )
+			{
+				prvDispatch( pxAO, pxEvent );
+				prvReleaseEvent( pxEvent );
+
+				if( uxQueueMessagesWaiting( pxAO->xQueue ) != ( UBaseType_t ) 0 )
+				{
+					( void ) prvSetReady( pxRunner, uxId );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvDispatch( ActiveObject_t * const pxAO, const AOEvent_t * const pxEvent )
+{
+AOStateHandler_t pxPath[ configAO_MAX_NEST_DEPTH ];
+AOStateHandler_t pxSource, pxTarget, pxState;
+BaseType_t xResult;
+UBaseType_t uxDepth, uxIndex;
+
+	/* Offer the event to the current state, then to each of its superstates
+	in turn, until one handles it. */
+	pxSource = pxAO->pxState;
+
+	for( ;; )
+	{
+		xResult = pxSource( pxAO, pxEvent );
+
+		if( xResult != aoRET_SUPER )
+		{
+			break;
+		}
+
+		pxSource = pxAO->pxTemp;
+	}
+
+	if( xResult == aoRET_TRAN )
+	{
+		pxTarget = pxAO->pxTemp;
+
+		/* Exit from the current state up to the state that took the
+		transition. */
+		for( pxState = pxAO->pxState; pxState != pxSource; pxState = prvSuperstate( pxAO, pxState ) )
+		{
+			( void ) pxState( pxAO, &( xReservedEvents[ aoSIG_EXIT ] ) );
+		}
+
+		/* Record the path from the target up to the top state. */
+		uxDepth = 0;
+
+		for( pxState = pxTarget; pxState != NULL; pxState = prvSuperstate( pxAO, pxState ) )
+		{
+			configASSERT( uxDepth < ( UBaseType_t ) configAO_MAX_NEST_DEPTH );
+			pxPath[ uxDepth ] = pxState;
+			uxDepth++;
+		}
+
+		/* A transition to self exits and re-enters the source state. */
+		pxState = pxSource;
+
+		if( pxSource == pxTarget )
+		{
+			( void ) pxState( pxAO, &( xReservedEvents[ aoSIG_EXIT ] ) );
+			pxState = prvSuperstate( pxAO, pxState );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Exit from the source state until the least common ancestor of the
+		source and target is reached.  The top state is on every path, so the
+		search always ends. */
+		for( ;; )
+		{
+			for( uxIndex = 0; uxIndex < uxDepth; uxIndex++ )
+			{
+				if( pxPath[ uxIndex ] == pxState )
+				{
+					break;
+				}
+			}
+
+			if( uxIndex < uxDepth )
+			{
+				break;
+			}
+
+			( void ) pxState( pxAO, &( xReservedEvents[ aoSIG_EXIT ] ) );
+			pxState = prvSuperstate( pxAO, pxState );
+		}
+
+		/* Enter the states below the least common ancestor down to the
+		target. */
+		while( uxIndex > ( UBaseType_t ) 0 )
+		{
+			uxIndex--;
+			( void ) pxPath[ uxIndex ]( pxAO, &( xReservedEvents[ aoSIG_ENTRY ] ) );
+		}
+
+		pxAO->pxState = prvEnterTarget( pxAO, pxTarget, pxTarget( pxAO, &( xReservedEvents[ aoSIG_INIT ] ) ) );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static AOStateHandler_t prvEnterTarget( ActiveObject_t * const pxAO, AOStateHandler_t pxFrom, BaseType_t xResult )
+{
+AOStateHandler_t pxPath[ configAO_MAX_NEST_DEPTH ];
+AOStateHandler_t pxState;
+UBaseType_t uxDepth;
+
+	while( xResult == aoRET_TRAN )
+	{
+		/* Record the path from the target up to, but not including,
+		pxFrom. */
+		configASSERT( pxAO->pxTemp != pxFrom );
+		uxDepth = 0;
+
+		for( pxState = pxAO->pxTemp; pxState != pxFrom; pxState = prvSuperstate( pxAO, pxState ) )
+		{
+			/* The target of an initial transition must be a substate. */
+			configASSERT( pxState != NULL );
+			configASSERT( uxDepth < ( UBaseType_t ) configAO_MAX_NEST_DEPTH );
+			pxPath[ uxDepth ] = pxState;
+			uxDepth++;
+		}
+
+		pxFrom = pxPath[ 0 ];
+
+		while( uxDepth > ( UBaseType_t ) 0 )
+		{
+			uxDepth--;
+			( void ) pxPath[ uxDepth ]( pxAO, &( xReservedEvents[ aoSIG_ENTRY ] ) );
+		}
+
+		xResult = pxFrom( pxAO, &( xReservedEvents[ aoSIG_INIT ] ) );
+	}
+
+	return pxFrom;
+}
+/*-----------------------------------------------------------*/
+
+static AOStateHandler_t prvSuperstate( ActiveObject_t * const pxAO, AOStateHandler_t pxState )
+{
+AOStateHandler_t pxReturn = NULL;
+
+	if( pxState != xActiveObjectTop )
+	{
+		/* Every state other than the top state returns aoSUPER() for the
+		empty signal. */
+		if( pxState( pxAO, &( xReservedEvents[ aoSIG_EMPTY ] ) ) == aoRET_SUPER )
+		{
+			pxReturn = pxAO->pxTemp;
+		}
+		else
+		{
+			configASSERT( pdFALSE );
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pxReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRetainEvent( const AOEvent_t * const pxEvent )
+{
+	/* The reference count is the only member of an event the framework
+	modifies, and static events do not have one. */
+	if( pxEvent->ucPoolId != 0U )
+	{
+		( void ) ulAtomicAdd( ( uint32_t volatile * ) &( pxEvent->ulRefCount ), 1UL ); /*lint !e9005 The reference count is not part of the immutable event. */
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvReleaseEvent( const AOEvent_t * const pxEvent )
+{
+	if( pxEvent->ucPoolId != 0U )
+	{
+		configASSERT( pxEvent->ucPoolId <= uxEventPoolsAdded );
+		configASSERT( pxEvent->ulRefCount != 0UL );
+
+		if( ulAtomicAdd( ( uint32_t volatile * ) &( pxEvent->ulRefCount ), aoDECREMENT ) == 1UL ) /*lint !e9005 The reference count is not part of the immutable event. */
+		{
+			prvPoolFree( &( xEventPools[ pxEvent->ucPoolId - 1U ] ), ( AOEvent_t * ) pxEvent ); /*lint !e9005 The last reference has gone, so the event is no longer in use. */
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static AOEvent_t *prvPoolAllocate( AOEventPool_t * const pxPool )
+{
+AOEvent_t *pxBlock;
+uint32_t ulHead, ulIndex, ulFree, ulMinimumFree;
+
+	for( ;; )
+	{
+		ulHead = pxPool->ulHead;
+		ulIndex = ulHead & aoINDEX_MASK;
+
+		if( ulIndex == aoNO_BLOCK )
+		{
+			pxBlock = NULL;
+			break;
+		}
+
+		pxBlock = ( AOEvent_t * ) &( pxPool->pucStorage[ ulIndex * pxPool->xBlockSize ] ); /*lint !e9087 !e826 Blocks are aligned to portBYTE_ALIGNMENT. */
+
+		/* If another caller takes the block before the swap then the index
+		of the next block read here may be stale, but the tag in ulHead has
+		then changed, so the swap fails. */
+		if( ulAtomicCompareAndSwap( &( pxPool->ulHead ), ( ( ulHead + aoTAG_INCREMENT ) & ~aoINDEX_MASK ) | ( pxBlock->ulRefCount & aoINDEX_MASK ), ulHead ) == atomicCOMPARE_AND_SWAP_SUCCESS )
+		{
+			break;
+		}
+	}
+
+	if( pxBlock != NULL )
+	{
+		ulFree = ulAtomicAdd( &( pxPool->ulFree ), aoDECREMENT ) - 1UL;
+
+		do
+		{
+			ulMinimumFree = pxPool->ulMinimumFree;
+
+			if( ulFree >= ulMinimumFree )
+			{
+				break;
+			}
+		} while( ulAtomicCompareAndSwap( &( pxPool->ulMinimumFree ), ulFree, ulMinimumFree ) != atomicCOMPARE_AND_SWAP_SUCCESS );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pxBlock;
+}
+/*-----------------------------------------------------------*/
+
+static void prvPoolFree( AOEventPool_t * const pxPool, AOEvent_t * const pxBlock )
+{
+uint32_t ulHead, ulIndex;
+
+	ulIndex = ( uint32_t ) ( ( ( uint8_t * ) pxBlock - pxPool->pucStorage ) / ( ptrdiff_t ) pxPool->xBlockSize ); /*lint !e946 !e947 The block is from this pool. */
+
+	do
+	{
+		ulHead = pxPool->ulHead;
+		pxBlock->ulRefCount = ulHead & aoINDEX_MASK;
+	} while( ulAtomicCompareAndSwap( &( pxPool->ulHead ), ( ( ulHead + aoTAG_INCREMENT ) & ~aoINDEX_MASK ) | ulIndex, ulHead ) != atomicCOMPARE_AND_SWAP_SUCCESS );
+
+	( void ) ulAtomicAdd( &( pxPool->ulFree ), 1UL );
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvSetReady( AORunner_t * const pxRunner, UBaseType_t uxId )
+{
+uint32_t ulReady;
+
+	do
+	{
+		ulReady = pxRunner->ulReady;
+	} while( ulAtomicCompareAndSwap( &( pxRunner->ulReady ), ulReady | ( 1UL << uxId ), ulReady ) != atomicCOMPARE_AND_SWAP_SUCCESS );
+
+	return ulReady;
+}
+/*-----------------------------------------------------------*/
+
+static void prvClearReady( AORunner_t * const pxRunner, UBaseType_t uxId )
+{
+uint32_t ulReady;
+
+	do
+	{
+		ulReady = pxRunner->ulReady;
+	} while( ulAtomicCompareAndSwap( &( pxRunner->ulReady ), ulReady & ~( 1UL << uxId ), ulReady ) != atomicCOMPARE_AND_SWAP_SUCCESS );
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvHighestBit( uint32_t ulBits )
+{
+UBaseType_t uxBit;
+
+	#if( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 )
+	{
+		portGET_HIGHEST_PRIORITY( uxBit, ulBits );
+	}
+	#else
+	{
+		uxBit = ( UBaseType_t ) configAO_MAX_ACTIVE_OBJECTS - ( UBaseType_t ) 1;
+
+		while( ( ulBits & ( 1UL << uxBit ) ) == 0UL )
+		{
+			uxBit--;
+		}
+	}
+	#endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+
+	return uxBit;
+}
+
+/* This entire source file will be skipped if the application is not configured
+to include active object functionality.  This #if is closed at the very bottom
+of this file.  If you want to include active objects then ensure
+configUSE_ACTIVE_OBJECTS is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_ACTIVE_OBJECTS == 1 */
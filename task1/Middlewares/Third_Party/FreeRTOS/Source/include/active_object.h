@@ -0,0 +1,391 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * Active objects are event driven state machines that share the processor
+ * without sharing data.  Each active object owns one event queue and
+ * processes the events posted to it one at a time, run-to-completion:
+ *
+ * + Events are pointers to immutable structures that are allocated from fixed
+ *   block event pools.  Posting or publishing an event copies the pointer,
+ *   never the event.  Each event carries a reference count, so an event
+ *   published to several subscribers is delivered to all of them and returned
+ *   to its pool after the last one has processed it.
+ *
+ * + The behaviour of an active object is a hierarchical state machine.  Each
+ *   state is a function that either handles an event, or passes it to its
+ *   superstate by returning aoSUPER().  Transitions taken with aoTRAN() run
+ *   the exit actions up to the least common ancestor of the source and target
+ *   states, then the entry actions and initial transitions down to the new
+ *   leaf state.
+ *
+ * + Active objects do not need a task each.  Every active object is assigned
+ *   to one of configAO_RUNNERS runner tasks, and a runner dispatches events
+ *   to its active objects in priority order.  Because dispatching never
+ *   blocks, active objects that share a runner also share its stack.
+ *
+ * Set configUSE_ACTIVE_OBJECTS to 1 in FreeRTOSConfig.h to use active
+ * objects, then call xActiveObjectInit() followed by
+ * xActiveObjectPoolInit() and xActiveObjectStart() before starting the
+ * scheduler.
+ */
+
+#ifndef ACTIVE_OBJECT_H
+#define ACTIVE_OBJECT_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h must appear in source files before include active_object.h"
+#endif
+
+/*lint -save -e537 This headers are only multiply included if the application code
+happens to also be including task.h. */
+#include "task.h"
+#include "queue.h"
+/*lint -restore */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Event signals.  Signals below aoSIG_USER are reserved for the state
+machine dispatcher. */
+typedef uint16_t AOSignal_t;
+
+#define aoSIG_EMPTY		( ( AOSignal_t ) 0 )	/* Sent to a state to discover its superstate. */
+#define aoSIG_ENTRY		( ( AOSignal_t ) 1 )	/* Sent to a state when it is entered. */
+#define aoSIG_EXIT		( ( AOSignal_t ) 2 )	/* Sent to a state when it is exited. */
+#define aoSIG_INIT		( ( AOSignal_t ) 3 )	/* Sent to a state to take its initial transition. */
+#define aoSIG_USER		( ( AOSignal_t ) 4 )	/* The first signal available to the application. */
+
+/**
+ * The header of every event.  An application event type places an AOEvent_t
+ * as its first member, followed by its parameters:
+ *
+ * typedef struct
+ * {
+ *     AOEvent_t xHeader;
+ *     uint8_t ucLed;
+ * } LedEvent_t;
+ *
+ * Events allocated with pxActiveObjectNewEvent() are reference counted and
+ * returned to their pool automatically.  Events that are not allocated from
+ * a pool, for example const events that carry no parameters, must have
+ * ucPoolId set to 0 and are never reference counted.  An event must not be
+ * modified once it has been posted or published.
+ */
+typedef struct xAO_EVENT
+{
+	AOSignal_t xSignal;
+	uint8_t ucPoolId;				/* The pool the event was allocated from, plus one, or 0 if the event is not from a pool. */
+	uint8_t ucReserved;
+	volatile uint32_t ulRefCount;	/* The number of queues that still hold the event.  Only accessed by the framework. */
+} AOEvent_t;
+
+struct xACTIVE_OBJECT;
+
+/* The type of a state handler function.  A state handler returns one of the
+aoRET_ values, normally through the aoHANDLED(), aoIGNORED(), aoTRAN() and
+aoSUPER() macros. */
+typedef BaseType_t ( *AOStateHandler_t )( struct xACTIVE_OBJECT *pxAO, const AOEvent_t *pxEvent );
+
+#define aoRET_HANDLED	( ( BaseType_t ) 0 )
+#define aoRET_IGNORED	( ( BaseType_t ) 1 )
+#define aoRET_TRAN		( ( BaseType_t ) 2 )
+#define aoRET_SUPER		( ( BaseType_t ) 3 )
+
+/* The event was handled. */
+#define aoHANDLED()					( aoRET_HANDLED )
+
+/* The event was deliberately discarded.  Only returned by the top state. */
+#define aoIGNORED()					( aoRET_IGNORED )
+
+/* The event was handled, and the state machine must transition to the state
+pxTarget. */
+#define aoTRAN( pxAO, pxTarget )	( ( ( struct xACTIVE_OBJECT * ) ( pxAO ) )->pxTemp = ( AOStateHandler_t ) ( pxTarget ), aoRET_TRAN )
+
+/* The event was not handled by this state, and must be passed to the
+superstate pxSuper.  Every state other than the top state returns aoSUPER()
+for the signals it does not handle, including aoSIG_EMPTY. */
+#define aoSUPER( pxAO, pxSuper )	( ( ( struct xACTIVE_OBJECT * ) ( pxAO ) )->pxTemp = ( AOStateHandler_t ) ( pxSuper ), aoRET_SUPER )
+
+/**
+ * An active object.  An application active object type places an
+ * ActiveObject_t as its first member, followed by its own data, which only
+ * its state handlers access.  The members of ActiveObject_t are private to
+ * the framework.
+ */
+typedef struct xACTIVE_OBJECT
+{
+	AOStateHandler_t pxState;		/* The current leaf state. */
+	AOStateHandler_t pxTemp;		/* The target of aoTRAN() or the superstate of aoSUPER(). */
+	QueueHandle_t xQueue;			/* The event queue, which holds pointers to events. */
+	UBaseType_t uxId;				/* Unique identifier, which is also the priority within the runner. */
+	UBaseType_t uxRunner;			/* The runner task that dispatches events to the active object. */
+	#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+		StaticQueue_t xQueueBuffer;
+	#endif
+} ActiveObject_t;
+
+/**
+ * active_object.h
+ * <pre>
+ * BaseType_t xActiveObjectTop( ActiveObject_t *pxAO, const AOEvent_t *pxEvent );
+ * </pre>
+ *
+ * The top state, which is the root of every state hierarchy.  It ignores
+ * every event.  The outermost states of an application state machine return
+ * aoSUPER( pxAO, xActiveObjectTop ) for the signals they do not handle.
+ *
+ * \defgroup xActiveObjectTop xActiveObjectTop
+ * \ingroup ActiveObject
+ */
+BaseType_t xActiveObjectTop( ActiveObject_t *pxAO, const AOEvent_t *pxEvent ) PRIVILEGED_FUNCTION;
+
+/**
+ * active_object.h
+ * <pre>
+ * BaseType_t xActiveObjectInit( void );
+ * </pre>
+ *
+ * Creates the runner tasks, one per runner.  Runner n runs at priority
+ * configAO_RUNNER_PRIORITY + n.  Must be called once, before any event pool
+ * is initialised or any active object is started.
+ *
+ * @return pdPASS if the runner tasks were created, otherwise pdFAIL.
+ *
+ * \defgroup xActiveObjectInit xActiveObjectInit
+ * \ingroup ActiveObject
+ */
+BaseType_t xActiveObjectInit( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * active_object.h
+ * <pre>
+ * BaseType_t xActiveObjectPoolInit( void *pvPoolStorage,
+ *                                   size_t xBlockSize,
+ *                                   UBaseType_t uxBlocks );
+ * </pre>
+ *
+ * Adds an event pool.  Up to configAO_MAX_EVENT_POOLS pools can be added, and
+ * they must be added in increasing order of block size.
+ * pxActiveObjectNewEvent() allocates each event from the first pool whose
+ * blocks are large enough to hold it.
+ *
+ * Allocating and freeing blocks uses a single compare and swap, so events can
+ * be allocated, posted and published from interrupts.
+ *
+ * @param pvPoolStorage Storage for the pool, which must be at least
+ * xBlockSize * uxBlocks bytes and must be aligned to portBYTE_ALIGNMENT.
+ *
+ * @param xBlockSize The size of each block in bytes.  Must be a multiple of
+ * portBYTE_ALIGNMENT and at least sizeof( AOEvent_t ).
+ *
+ * @param uxBlocks The number of blocks in the pool, up to 65535.
+ *
+ * @return pdPASS if the pool was added, otherwise pdFAIL.
+ *
+ * \defgroup xActiveObjectPoolInit xActiveObjectPoolInit
+ * \ingroup ActiveObject
+ */
+BaseType_t xActiveObjectPoolInit( void *pvPoolStorage, size_t xBlockSize, UBaseType_t uxBlocks ) PRIVILEGED_FUNCTION;
+
+/**
+ * active_object.h
+ * <pre>
+ * UBaseType_t uxActiveObjectPoolGetMinimumFree( UBaseType_t uxPool );
+ * </pre>
+ *
+ * Returns the smallest number of free blocks pool uxPool has had since it was
+ * added, which can be used to size the pool.  Pools are numbered from 0 in
+ * the order in which they were added.
+ *
+ * \defgroup uxActiveObjectPoolGetMinimumFree uxActiveObjectPoolGetMinimumFree
+ * \ingroup ActiveObject
+ */
+UBaseType_t uxActiveObjectPoolGetMinimumFree( UBaseType_t uxPool ) PRIVILEGED_FUNCTION;
+
+/**
+ * active_object.h
+ * <pre>
+ * AOEvent_t *pxActiveObjectNewEvent( size_t xEventSize, AOSignal_t xSignal );
+ * </pre>
+ *
+ * Allocates an event from an event pool.  The caller fills in the event's
+ * parameters, then posts or publishes it.  The event is returned to its pool
+ * after the last active object it was delivered to has processed it, or
+ * immediately if it could not be delivered to any active object.
+ *
+ * Can be called from tasks and from interrupts.
+ *
+ * @param xEventSize The size of the event, including its AOEvent_t header.
+ *
+ * @param xSignal The event's signal.
+ *
+ * @return The event, or NULL if no pool with large enough blocks has a free
+ * block.
+ *
+ * \defgroup pxActiveObjectNewEvent pxActiveObjectNewEvent
+ * \ingroup ActiveObject
+ */
+AOEvent_t *pxActiveObjectNewEvent( size_t xEventSize, AOSignal_t xSignal ) PRIVILEGED_FUNCTION;
+
+/**
+ * active_object.h
+ * <pre>
+ * BaseType_t xActiveObjectStart( ActiveObject_t *pxAO,
+ *                                UBaseType_t uxId,
+ *                                UBaseType_t uxRunner,
+ *                                const AOEvent_t **ppxQueueStorage,
+ *                                UBaseType_t uxQueueLength,
+ *                                AOStateHandler_t pxInitial );
+ * </pre>
+ *
+ * Creates the event queue of an active object, takes the initial transition
+ * of its state machine, and assigns it to a runner task.  The initial
+ * transition runs in the context of the caller.
+ *
+ * @param pxAO The active object to start.
+ *
+ * @param uxId A unique identifier, from 0 to configAO_MAX_ACTIVE_OBJECTS - 1.
+ * When events are pending for several active objects that share a runner,
+ * the runner dispatches to the one with the highest identifier first.
+ *
+ * @param uxRunner The runner task that dispatches events to the active
+ * object, from 0 to configAO_RUNNERS - 1.  Active objects that must preempt
+ * long run-to-completion steps of other active objects are assigned to a
+ * higher runner.
+ *
+ * @param ppxQueueStorage Storage for uxQueueLength event pointers.  If
+ * ppxQueueStorage is NULL the queue is allocated from the FreeRTOS heap.
+ *
+ * @param uxQueueLength The maximum number of events the queue can hold.
+ *
+ * @param pxInitial The initial pseudo-state.  It must return aoTRAN() to the
+ * state the state machine starts in.
+ *
+ * @return pdPASS if the active object was started, otherwise pdFAIL.
+ *
+ * \defgroup xActiveObjectStart xActiveObjectStart
+ * \ingroup ActiveObject
+ */
+BaseType_t xActiveObjectStart( ActiveObject_t *pxAO, UBaseType_t uxId, UBaseType_t uxRunner, const AOEvent_t **ppxQueueStorage, UBaseType_t uxQueueLength, AOStateHandler_t pxInitial ) PRIVILEGED_FUNCTION;
+
+/**
+ * active_object.h
+ * <pre>
+ * BaseType_t xActiveObjectPost( ActiveObject_t *pxAO, const AOEvent_t *pxEvent );
+ * </pre>
+ *
+ * Posts an event directly to one active object.  Never blocks.
+ *
+ * @param pxAO The active object to post to.
+ *
+ * @param pxEvent The event to post.
+ *
+ * @return pdPASS if the event was queued.  pdFAIL if the active object's
+ * queue was full, in which case the event is returned to its pool if no other
+ * active object holds it.
+ *
+ * \defgroup xActiveObjectPost xActiveObjectPost
+ * \ingroup ActiveObject
+ */
+BaseType_t xActiveObjectPost( ActiveObject_t *pxAO, const AOEvent_t *pxEvent ) PRIVILEGED_FUNCTION;
+
+/**
+ * active_object.h
+ * <pre>
+ * BaseType_t xActiveObjectPostFromISR( ActiveObject_t *pxAO,
+ *                                      const AOEvent_t *pxEvent,
+ *                                      BaseType_t *pxHigherPriorityTaskWoken );
+ * </pre>
+ *
+ * Version of xActiveObjectPost() that can be called from an interrupt
+ * service routine.  *pxHigherPriorityTaskWoken is set to pdTRUE if posting
+ * the event unblocked a runner task that has a priority above that of the
+ * interrupted task.
+ *
+ * \defgroup xActiveObjectPostFromISR xActiveObjectPostFromISR
+ * \ingroup ActiveObject
+ */
+BaseType_t xActiveObjectPostFromISR( ActiveObject_t *pxAO, const AOEvent_t *pxEvent, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * active_object.h
+ * <pre>
+ * void vActiveObjectSubscribe( ActiveObject_t *pxAO, AOSignal_t xSignal );
+ * void vActiveObjectUnsubscribe( ActiveObject_t *pxAO, AOSignal_t xSignal );
+ * </pre>
+ *
+ * Adds or removes an active object from the subscribers of a signal.  Only
+ * signals below configAO_MAX_PUBLISH_SIGNALS can be subscribed to.
+ *
+ * \defgroup vActiveObjectSubscribe vActiveObjectSubscribe
+ * \ingroup ActiveObject
+ */
+void vActiveObjectSubscribe( ActiveObject_t *pxAO, AOSignal_t xSignal ) PRIVILEGED_FUNCTION;
+void vActiveObjectUnsubscribe( ActiveObject_t *pxAO, AOSignal_t xSignal ) PRIVILEGED_FUNCTION;
+
+/**
+ * active_object.h
+ * <pre>
+ * UBaseType_t uxActiveObjectPublish( const AOEvent_t *pxEvent );
+ * </pre>
+ *
+ * Delivers an event to every active object subscribed to its signal, highest
+ * identifier first.  The event is not copied - each subscriber's queue
+ * receives a pointer to the same event, and the event's reference count
+ * keeps it allocated until every subscriber has processed it.  Never blocks.
+ *
+ * @param pxEvent The event to publish.
+ *
+ * @return The number of subscribers the event was delivered to.  Subscribers
+ * whose queues were full are skipped.
+ *
+ * \defgroup uxActiveObjectPublish uxActiveObjectPublish
+ * \ingroup ActiveObject
+ */
+UBaseType_t uxActiveObjectPublish( const AOEvent_t *pxEvent ) PRIVILEGED_FUNCTION;
+
+/**
+ * active_object.h
+ * <pre>
+ * UBaseType_t uxActiveObjectPublishFromISR( const AOEvent_t *pxEvent,
+ *                                           BaseType_t *pxHigherPriorityTaskWoken );
+ * </pre>
+ *
+ * Version of uxActiveObjectPublish() that can be called from an interrupt
+ * service routine.
+ *
+ * \defgroup uxActiveObjectPublishFromISR uxActiveObjectPublishFromISR
+ * \ingroup ActiveObject
+ */
+UBaseType_t uxActiveObjectPublishFromISR( const AOEvent_t *pxEvent, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* ACTIVE_OBJECT_H */
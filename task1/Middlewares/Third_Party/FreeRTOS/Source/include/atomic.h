@@ -0,0 +1,122 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * Atomic operations used by the lock-free kernel objects.
+ *
+ * If the port defines portATOMIC_COMPARE_AND_SWAP_U32() (for example using
+ * the exclusive load/store instructions of an ARMv7-M core) then it is used,
+ * and the operations below never mask interrupts.  Otherwise each operation is
+ * performed inside a short interrupt mask, which is safe from both tasks and
+ * interrupts but only on single core devices.
+ */
+
+#ifndef ATOMIC_H
+#define ATOMIC_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h must appear in source files before include atomic.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef portFORCE_INLINE
+	#define atomicINLINE portFORCE_INLINE
+#else
+	#define atomicINLINE portINLINE
+#endif
+
+#ifndef portMEMORY_BARRIER
+	#define portMEMORY_BARRIER()
+#endif
+
+#define atomicCOMPARE_AND_SWAP_SUCCESS	( ( uint32_t ) 1U )
+#define atomicCOMPARE_AND_SWAP_FAILURE	( ( uint32_t ) 0U )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Sets *pulDestination to ulExchange if, and only if, *pulDestination equals
+ * ulComparand.  Returns atomicCOMPARE_AND_SWAP_SUCCESS if the value was set,
+ * otherwise atomicCOMPARE_AND_SWAP_FAILURE.
+ */
+static atomicINLINE uint32_t ulAtomicCompareAndSwap( uint32_t volatile * pulDestination, uint32_t ulExchange, uint32_t ulComparand )
+{
+uint32_t ulReturn;
+
+	#ifdef portATOMIC_COMPARE_AND_SWAP_U32
+	{
+		ulReturn = portATOMIC_COMPARE_AND_SWAP_U32( pulDestination, ulExchange, ulComparand );
+	}
+	#else
+	{
+	UBaseType_t uxSavedInterruptStatus;
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			if( *pulDestination == ulComparand )
+			{
+				*pulDestination = ulExchange;
+				ulReturn = atomicCOMPARE_AND_SWAP_SUCCESS;
+			}
+			else
+			{
+				ulReturn = atomicCOMPARE_AND_SWAP_FAILURE;
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+	#endif
+
+	return ulReturn;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Adds ulCount to *pulAddend and returns the value *pulAddend held before the
+ * addition.
+ */
+static atomicINLINE uint32_t ulAtomicAdd( uint32_t volatile * pulAddend, uint32_t ulCount )
+{
+uint32_t ulCurrent;
+
+	do
+	{
+		ulCurrent = *pulAddend;
+	} while( ulAtomicCompareAndSwap( pulAddend, ulCurrent + ulCount, ulCurrent ) != atomicCOMPARE_AND_SWAP_SUCCESS );
+
+	return ulCurrent;
+}
+/*-----------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ATOMIC_H */
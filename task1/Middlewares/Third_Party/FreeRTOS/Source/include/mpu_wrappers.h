@@ -63,6 +63,9 @@ only for ports that are using the MPU. */
 		#define vTaskSuspendAll							MPU_vTaskSuspendAll
 		#define xTaskResumeAll							MPU_xTaskResumeAll
 		#define xTaskGetTickCount						MPU_xTaskGetTickCount
+		#define ullTaskGetTickCount64					MPU_ullTaskGetTickCount64
+		#define ullTaskGetTimestamp						MPU_ullTaskGetTimestamp
+		#define ullTaskGetTimestampUs					MPU_ullTaskGetTimestampUs
 		#define uxTaskGetNumberOfTasks					MPU_uxTaskGetNumberOfTasks
 		#define pcTaskGetName							MPU_pcTaskGetName
 		#define xTaskGetHandle							MPU_xTaskGetHandle
@@ -77,9 +80,9 @@ only for ports that are using the MPU. */
 		#define vTaskList								MPU_vTaskList
 		#define vTaskGetRunTimeStats					MPU_vTaskGetRunTimeStats
 		#define xTaskGenericNotify						MPU_xTaskGenericNotify
-		#define xTaskNotifyWait							MPU_xTaskNotifyWait
-		#define ulTaskNotifyTake						MPU_ulTaskNotifyTake
-		#define xTaskNotifyStateClear					MPU_xTaskNotifyStateClear
+		#define xTaskGenericNotifyWait					MPU_xTaskGenericNotifyWait
+		#define ulTaskGenericNotifyTake					MPU_ulTaskGenericNotifyTake
+		#define xTaskGenericNotifyStateClear			MPU_xTaskGenericNotifyStateClear
 
 		#define xTaskGetCurrentTaskHandle				MPU_xTaskGetCurrentTaskHandle
 		#define vTaskSetTimeOutState					MPU_vTaskSetTimeOutState
@@ -152,6 +155,12 @@ only for ports that are using the MPU. */
 		#define xStreamBufferSetTriggerLevel			MPU_xStreamBufferSetTriggerLevel
 		#define xStreamBufferGenericCreate				MPU_xStreamBufferGenericCreate
 		#define xStreamBufferGenericCreateStatic		MPU_xStreamBufferGenericCreateStatic
+		#define xStreamBufferSendV						MPU_xStreamBufferSendV
+		#define xStreamBufferReceiveV					MPU_xStreamBufferReceiveV
+		#define xStreamBufferWriteReserve				MPU_xStreamBufferWriteReserve
+		#define vStreamBufferWriteCommit				MPU_vStreamBufferWriteCommit
+		#define xStreamBufferReadReserve				MPU_xStreamBufferReadReserve
+		#define vStreamBufferReadCommit					MPU_vStreamBufferReadCommit
 
 
 		/* Remove the privileged function macro, but keep the PRIVILEGED_DATA
@@ -63,6 +63,19 @@ extern "C" {
  */
 typedef void * StreamBufferHandle_t;
 
+/**
+ * Describes one contiguous block of memory.  Arrays of segments are passed to
+ * xStreamBufferSendV() and xStreamBufferReceiveV() to gather data from, or
+ * scatter data to, several blocks in one call, and are returned by
+ * xStreamBufferWriteReserve() and xStreamBufferReadReserve() to describe the
+ * part of the stream buffer's own storage area that can be accessed in place.
+ */
+typedef struct StreamBufferSegment
+{
+	void *pvData;		/* The start of the block. */
+	size_t xLength;		/* The length of the block in bytes. */
+} StreamBufferSegment_t;
+
 
 /**
  * message_buffer.h
@@ -828,6 +841,209 @@ BaseType_t xStreamBufferReceiveCompletedFromISR( StreamBufferHandle_t xStreamBuf
  */
 BaseType_t xStreamBufferReceiveCompletedFromISR( StreamBufferHandle_t xStreamBuffer, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferSendV( StreamBufferHandle_t xStreamBuffer,
+						   const StreamBufferSegment_t * const pxSegments,
+						   size_t xSegmentCount,
+						   TickType_t xTicksToWait );
+</pre>
+ *
+ * Gather version of xStreamBufferSend().  Sends the data described by an array
+ * of segments to a stream buffer, in array order, as if the segments were one
+ * contiguous block, so data that is split between (for example) a header and a
+ * payload does not first have to be copied into a temporary buffer.
+ *
+ * If the stream buffer is being used as a message buffer then the segments are
+ * written as a single message, and the message is only written if there is
+ * enough space for all of it.  Otherwise as many bytes as will fit are written.
+ * The data only becomes visible to the reader once all of it has been written.
+ *
+ * The same single writer restrictions as xStreamBufferSend() apply.
+ *
+ * @param xStreamBuffer The handle of the stream buffer to which data is being
+ * sent.
+ *
+ * @param pxSegments The array of segments that describe the data to send.
+ * Segments that have a length of zero are skipped.
+ *
+ * @param xSegmentCount The number of segments in the pxSegments array.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for enough space to become available in the stream
+ * buffer.  See xStreamBufferSend().
+ *
+ * @return The number of bytes written to the stream buffer.
+ *
+ * \defgroup xStreamBufferSendV xStreamBufferSendV
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferSendV( StreamBufferHandle_t xStreamBuffer,
+						   const StreamBufferSegment_t * const pxSegments,
+						   size_t xSegmentCount,
+						   TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferReceiveV( StreamBufferHandle_t xStreamBuffer,
+							  const StreamBufferSegment_t * const pxSegments,
+							  size_t xSegmentCount,
+							  TickType_t xTicksToWait );
+</pre>
+ *
+ * Scatter version of xStreamBufferReceive().  Receives bytes from a stream
+ * buffer into the blocks described by an array of segments, filling each
+ * segment in turn before moving to the next.
+ *
+ * If the stream buffer is being used as a message buffer then a single message
+ * is received, and the message is left in the buffer (and zero is returned) if
+ * it is longer than the total length of the segments.
+ *
+ * The same single reader restrictions as xStreamBufferReceive() apply.
+ *
+ * @param xStreamBuffer The handle of the stream buffer from which bytes are to
+ * be received.
+ *
+ * @param pxSegments The array of segments into which the received bytes will be
+ * copied.
+ *
+ * @param xSegmentCount The number of segments in the pxSegments array.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for data to become available if the stream buffer is
+ * empty.  See xStreamBufferReceive().
+ *
+ * @return The number of bytes received.
+ *
+ * \defgroup xStreamBufferReceiveV xStreamBufferReceiveV
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReceiveV( StreamBufferHandle_t xStreamBuffer,
+							  const StreamBufferSegment_t * const pxSegments,
+							  size_t xSegmentCount,
+							  TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferWriteReserve( StreamBufferHandle_t xStreamBuffer,
+								  StreamBufferSegment_t pxSegments[ 2 ] );
+void vStreamBufferWriteCommit( StreamBufferHandle_t xStreamBuffer, size_t xBytesWritten );
+void vStreamBufferWriteCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+									  size_t xBytesWritten,
+									  BaseType_t * const pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * Zero copy write.  xStreamBufferWriteReserve() returns the free space in the
+ * stream buffer as up to two segments of the stream buffer's own storage area
+ * (the second segment has a length of zero unless the free space wraps around
+ * the end of the storage area).  The writer, or a DMA transfer started by the
+ * writer, fills the segments in place, in order, then calls
+ * vStreamBufferWriteCommit() (from a task) or vStreamBufferWriteCommitFromISR()
+ * (from an interrupt) to make the bytes available to the reader and unblock a
+ * reader that is waiting for data.
+ *
+ * Neither function blocks, so both the reserve and the commit can be called
+ * from a task or an interrupt.  Only one reservation can be outstanding at a
+ * time, and the same single writer restrictions as xStreamBufferSend() apply.
+ * Zero copy access is only available to stream buffers, not message buffers.
+ *
+ * @param xStreamBuffer The handle of the stream buffer being written to.
+ *
+ * @param pxSegments An array of two segments, set to describe the free space.
+ *
+ * @param xBytesWritten The number of bytes written to the segments, starting
+ * at the start of the first segment.  Must not be greater than the value
+ * returned by the matching call to xStreamBufferWriteReserve().
+ *
+ * @param pxHigherPriorityTaskWoken See xStreamBufferSendFromISR().
+ *
+ * @return xStreamBufferWriteReserve() returns the total length of the two
+ * segments, which is the number of bytes that can be written.
+ *
+ * Example usage:
+<pre>
+void vUARTRxDMAStart( StreamBufferHandle_t xStreamBuffer )
+{
+StreamBufferSegment_t xSegments[ 2 ];
+
+	// Receive straight into the stream buffer.  Only the first segment is
+	// used, the wrapped part of the free space is used by the next transfer.
+	if( xStreamBufferWriteReserve( xStreamBuffer, xSegments ) > 0 )
+	{
+		vStartDMA( xSegments[ 0 ].pvData, xSegments[ 0 ].xLength );
+	}
+}
+
+void vUARTRxDMACompleteISR( StreamBufferHandle_t xStreamBuffer, size_t xReceived )
+{
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	vStreamBufferWriteCommitFromISR( xStreamBuffer, xReceived, &xHigherPriorityTaskWoken );
+	portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
+</pre>
+ * \defgroup xStreamBufferWriteReserve xStreamBufferWriteReserve
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferWriteReserve( StreamBufferHandle_t xStreamBuffer,
+								  StreamBufferSegment_t pxSegments[ 2 ] ) PRIVILEGED_FUNCTION;
+void vStreamBufferWriteCommit( StreamBufferHandle_t xStreamBuffer, size_t xBytesWritten ) PRIVILEGED_FUNCTION;
+void vStreamBufferWriteCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+									  size_t xBytesWritten,
+									  BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferReadReserve( StreamBufferHandle_t xStreamBuffer,
+								 StreamBufferSegment_t pxSegments[ 2 ] );
+void vStreamBufferReadCommit( StreamBufferHandle_t xStreamBuffer, size_t xBytesRead );
+void vStreamBufferReadCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+									 size_t xBytesRead,
+									 BaseType_t * const pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * Zero copy read.  xStreamBufferReadReserve() returns the data in the stream
+ * buffer as up to two segments of the stream buffer's own storage area, in the
+ * order in which the bytes were written.  The reader processes the bytes in
+ * place, then calls vStreamBufferReadCommit() (from a task) or
+ * vStreamBufferReadCommitFromISR() (from an interrupt) to release the space the
+ * bytes occupied and unblock a writer that is waiting for space.
+ *
+ * Neither function blocks.  Only one reservation can be outstanding at a time,
+ * and the same single reader restrictions as xStreamBufferReceive() apply.
+ * Zero copy access is only available to stream buffers, not message buffers.
+ *
+ * @param xStreamBuffer The handle of the stream buffer being read from.
+ *
+ * @param pxSegments An array of two segments, set to describe the data.
+ *
+ * @param xBytesRead The number of bytes consumed, starting at the start of the
+ * first segment.  Must not be greater than the value returned by the matching
+ * call to xStreamBufferReadReserve().
+ *
+ * @param pxHigherPriorityTaskWoken See xStreamBufferReceiveFromISR().
+ *
+ * @return xStreamBufferReadReserve() returns the total length of the two
+ * segments, which is the number of bytes that can be read.
+ *
+ * \defgroup xStreamBufferReadReserve xStreamBufferReadReserve
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReadReserve( StreamBufferHandle_t xStreamBuffer,
+								 StreamBufferSegment_t pxSegments[ 2 ] ) PRIVILEGED_FUNCTION;
+void vStreamBufferReadCommit( StreamBufferHandle_t xStreamBuffer, size_t xBytesRead ) PRIVILEGED_FUNCTION;
+void vStreamBufferReadCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+									 size_t xBytesRead,
+									 BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
 /* Functions below here are not part of the public API. */
 StreamBufferHandle_t xStreamBufferGenericCreate( size_t xBufferSizeBytes,
 												 size_t xTriggerLevelBytes,
@@ -33,6 +33,10 @@
 #include "FreeRTOS.h"
 #include "task.h"
 
+#if( configUSE_CRITICAL_SECTION_PROFILER == 1 )
+	#include "critical_profiler.h"
+#endif
+
 #ifndef __TARGET_FPU_VFP
 	#error This port can only be used when the project options are configured to enable hardware floating point support.
 #endif
@@ -41,6 +45,12 @@
 	#error configMAX_SYSCALL_INTERRUPT_PRIORITY must not be set to 0.  See http://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html
 #endif
 
+#if( ( configUSE_TIMESTAMP == 1 ) && ( configUSE_TICKLESS_IDLE == 1 ) )
+	/* Tickless idle reprograms the SysTick reload value, so the SysTick count
+	no longer measures the time since the last tick. */
+	#error configUSE_TIMESTAMP cannot be used with configUSE_TICKLESS_IDLE in this port.
+#endif
+
 #ifndef configSYSTICK_CLOCK_HZ
 	#define configSYSTICK_CLOCK_HZ configCPU_CLOCK_HZ
 	/* Ensure the SysTick is clocked at the same frequency as the core. */
@@ -71,6 +81,7 @@ is defined. */
 #define portNVIC_SYSTICK_COUNT_FLAG_BIT		( 1UL << 16UL )
 #define portNVIC_PENDSVCLEAR_BIT 			( 1UL << 27UL )
 #define portNVIC_PEND_SYSTICK_CLEAR_BIT		( 1UL << 25UL )
+#define portNVIC_PEND_SYSTICK_SET_BIT		( 1UL << 26UL )
 
 /* Constants used to detect a Cortex-M7 r0p1 core, which should use the ARM_CM7
 r0p1 port. */
@@ -114,6 +125,30 @@ calculations. */
 have bit-0 clear, as it is loaded into the PC on exit from an ISR. */
 #define portSTART_ADDRESS_MASK		( ( StackType_t ) 0xfffffffeUL )
 
+/* Constants required to set up the MPU stack guard. */
+#define portMPU_TYPE_REG					( * ( ( volatile uint32_t * ) 0xe000ed90 ) )
+#define portMPU_CTRL_REG					( * ( ( volatile uint32_t * ) 0xe000ed94 ) )
+#define portMPU_REGION_NUMBER_REG			( * ( ( volatile uint32_t * ) 0xe000ed98 ) )
+#define portMPU_REGION_ATTRIBUTE_REG		( * ( ( volatile uint32_t * ) 0xe000eda0 ) )
+#define portNVIC_SYS_CTRL_STATE_REG			( * ( ( volatile uint32_t * ) 0xe000ed24 ) )
+#define portNVIC_MEM_FAULT_ENABLE			( 1UL << 16UL )
+#define portMPU_ENABLE						( 0x01UL )
+#define portMPU_BACKGROUND_ENABLE			( 1UL << 2UL )
+#define portMPU_REGION_ENABLE				( 0x01UL )
+#define portMPU_REGION_EXECUTE_NEVER		( 0x01UL << 28UL )
+#define portMPU_REGION_NO_ACCESS			( 0x00UL << 24UL )
+#define portMPU_REGION_SIZE_32_BYTES		( 0x04UL << 1UL )
+#define portMPU_TYPE_DREGION_SHIFT			( 8UL )
+#define portMPU_TYPE_DREGION_MASK			( 0xffUL )
+
+/* Constants required to enable the DWT cycle counter used by the critical
+section profiler. */
+#define portDEMCR_REG						( * ( ( volatile uint32_t * ) 0xe000edfc ) )
+#define portDEMCR_TRCENA					( 1UL << 24UL )
+#define portDWT_CTRL_REG					( * ( ( volatile uint32_t * ) 0xe0001000 ) )
+#define portDWT_CYCCNT_REG					( * ( ( volatile uint32_t * ) 0xe0001004 ) )
+#define portDWT_CTRL_CYCCNTENA				( 1UL << 0UL )
+
 /*
  * Setup the timer to generate the tick interrupts.  The implementation in this
  * file is weak to allow application writers to change the timer used to
@@ -143,6 +178,13 @@ static void prvEnableVFP( void );
  */
 static void prvTaskExitError( void );
 
+/*
+ * Configure the MPU region used as the stack guard, and enable the MPU.
+ */
+#if( configUSE_MPU_STACK_GUARD == 1 )
+	static void prvSetupStackGuard( void );
+#endif /* configUSE_MPU_STACK_GUARD */
+
 /*-----------------------------------------------------------*/
 
 /* Each task maintains its own interrupt status in the critical nesting
@@ -392,6 +434,22 @@ BaseType_t xPortStartScheduler( void )
 	/* Lazy save always. */
 	*( portFPCCR ) |= portASPEN_AND_LSPEN_BITS;
 
+	#if( configUSE_MPU_STACK_GUARD == 1 )
+	{
+		prvSetupStackGuard();
+	}
+	#endif /* configUSE_MPU_STACK_GUARD */
+
+	#if( configUSE_CRITICAL_SECTION_PROFILER == 1 )
+	{
+		/* Start the cycle counter.  No critical section has been timed yet, as
+		uxCriticalNesting was not zero until now. */
+		portDEMCR_REG |= portDEMCR_TRCENA;
+		portDWT_CYCCNT_REG = 0UL;
+		portDWT_CTRL_REG |= portDWT_CTRL_CYCCNTENA;
+	}
+	#endif /* configUSE_CRITICAL_SECTION_PROFILER */
+
 	/* Start the first task. */
 	prvStartFirstTask();
 
@@ -400,6 +458,34 @@ BaseType_t xPortStartScheduler( void )
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_MPU_STACK_GUARD == 1 )
+
+	static void prvSetupStackGuard( void )
+	{
+		/* The guard region must be implemented by the MPU. */
+		configASSERT( ( ( portMPU_TYPE_REG >> portMPU_TYPE_DREGION_SHIFT ) & portMPU_TYPE_DREGION_MASK ) > configMPU_STACK_GUARD_REGION );
+
+		/* The base address of the region has already been set for the first
+		task by vTaskStartScheduler(), and is moved on each context switch, so
+		only the attributes are set here.  The region is no access for both
+		privileged and unprivileged code, and must not be executed. */
+		portMPU_REGION_NUMBER_REG = configMPU_STACK_GUARD_REGION;
+		portMPU_REGION_ATTRIBUTE_REG = portMPU_REGION_EXECUTE_NEVER |
+									   portMPU_REGION_NO_ACCESS |
+									   portMPU_REGION_SIZE_32_BYTES |
+									   portMPU_REGION_ENABLE;
+
+		/* Tasks run privileged, so the default memory map is used everywhere
+		other than in the guard region. */
+		portNVIC_SYS_CTRL_STATE_REG |= portNVIC_MEM_FAULT_ENABLE;
+		portMPU_CTRL_REG |= ( portMPU_BACKGROUND_ENABLE | portMPU_ENABLE );
+		__dsb( portSY_FULL_READ_WRITE );
+		__isb( portSY_FULL_READ_WRITE );
+	}
+
+#endif /* configUSE_MPU_STACK_GUARD */
+/*-----------------------------------------------------------*/
+
 void vPortEndScheduler( void )
 {
 	/* Not implemented in ports where there is nothing to return to.
@@ -421,6 +507,12 @@ void vPortEnterCritical( void )
 	if( uxCriticalNesting == 1 )
 	{
 		configASSERT( ( portNVIC_INT_CTRL_REG & portVECTACTIVE_MASK ) == 0 );
+
+		#if( configUSE_CRITICAL_SECTION_PROFILER == 1 )
+		{
+			vCriticalProfilerSectionEnter( ( const void * ) __return_address() );
+		}
+		#endif
 	}
 }
 /*-----------------------------------------------------------*/
@@ -431,11 +523,49 @@ void vPortExitCritical( void )
 	uxCriticalNesting--;
 	if( uxCriticalNesting == 0 )
 	{
+		#if( configUSE_CRITICAL_SECTION_PROFILER == 1 )
+		{
+			vCriticalProfilerSectionExit();
+		}
+		#endif
+
 		portENABLE_INTERRUPTS();
 	}
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_CRITICAL_SECTION_PROFILER == 1 )
+
+	uint32_t ulPortSetInterruptMaskFromISR( void )
+	{
+	uint32_t ulReturn;
+
+		ulReturn = ulPortRaiseBASEPRI();
+
+		/* Only the outermost mask is timed.  If interrupts were already masked
+		then the enclosing critical section is being timed already. */
+		if( ulReturn == 0UL )
+		{
+			vCriticalProfilerSectionEnter( ( const void * ) __return_address() );
+		}
+
+		return ulReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortClearInterruptMaskFromISR( uint32_t ulNewMaskValue )
+	{
+		if( ulNewMaskValue == 0UL )
+		{
+			vCriticalProfilerSectionExit();
+		}
+
+		vPortSetBASEPRI( ulNewMaskValue );
+	}
+
+#endif /* configUSE_CRITICAL_SECTION_PROFILER */
+/*-----------------------------------------------------------*/
+
 __asm void xPortPendSVHandler( void )
 {
 	extern uxCriticalNesting;
@@ -500,6 +630,13 @@ __asm void xPortPendSVHandler( void )
 
 void xPortSysTickHandler( void )
 {
+#if( configUSE_CRITICAL_SECTION_PROFILER == 1 )
+	/* The SysTick counts down from the reload value and the interrupt is
+	pended when it reaches zero, so the count since the reload is the time it
+	took to enter this handler. */
+	const uint32_t ulTickLatency = ( portNVIC_SYSTICK_LOAD_REG - portNVIC_SYSTICK_CURRENT_VALUE_REG ) * ( configCPU_CLOCK_HZ / configSYSTICK_CLOCK_HZ );
+#endif
+
 	/* The SysTick runs at the lowest interrupt priority, so when this interrupt
 	executes all interrupts must be unmasked.  There is therefore no need to
 	save and then restore the interrupt mask value as its value is already
@@ -507,6 +644,13 @@ void xPortSysTickHandler( void )
 	in place of portSET_INTERRUPT_MASK_FROM_ISR(). */
 	vPortRaiseBASEPRI();
 	{
+		#if( configUSE_CRITICAL_SECTION_PROFILER == 1 )
+		{
+			vCriticalProfilerRecordLatency( cpLATENCY_SOURCE_TICK, ulTickLatency );
+			vCriticalProfilerSectionEnter( ( const void * ) xPortSysTickHandler );
+		}
+		#endif
+
 		/* Increment the RTOS tick. */
 		if( xTaskIncrementTick() != pdFALSE )
 		{
@@ -514,11 +658,49 @@ void xPortSysTickHandler( void )
 			the PendSV interrupt.  Pend the PendSV interrupt. */
 			portNVIC_INT_CTRL_REG = portNVIC_PENDSVSET_BIT;
 		}
+
+		#if( configUSE_CRITICAL_SECTION_PROFILER == 1 )
+		{
+			vCriticalProfilerSectionExit();
+		}
+		#endif
 	}
 	vPortClearBASEPRIFromISR();
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_TIMESTAMP == 1 )
+
+	uint32_t ulPortGetTickElapsedCounts( void )
+	{
+	uint32_t ulCurrentValue, ulElapsed = 0UL;
+
+		ulCurrentValue = portNVIC_SYSTICK_CURRENT_VALUE_REG;
+
+		/* If the SysTick has reached zero but its interrupt has not executed
+		yet then the tick has not been counted, and the value read above may
+		be from before or after the reload.  Read it again, as it is now known
+		to be from after the reload, and add the whole period that has not
+		been counted. */
+		if( ( portNVIC_INT_CTRL_REG & portNVIC_PEND_SYSTICK_SET_BIT ) != 0UL )
+		{
+			ulCurrentValue = portNVIC_SYSTICK_CURRENT_VALUE_REG;
+			ulElapsed = portNVIC_SYSTICK_LOAD_REG + 1UL;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* The SysTick counts down from the reload value. */
+		ulElapsed += portNVIC_SYSTICK_LOAD_REG - ulCurrentValue;
+
+		return ulElapsed;
+	}
+
+#endif /* configUSE_TIMESTAMP */
+/*-----------------------------------------------------------*/
+
 #if( configUSE_TICKLESS_IDLE == 1 )
 
 	__weak void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
@@ -67,11 +67,47 @@ structure member). */
 #define uxQueueType						pcHead
 #define queueQUEUE_IS_MUTEX				NULL
 
+/* The uxCeilingPriority member of a mutex that uses priority inheritance, or of
+a queue that is not a mutex, is set to queueNO_PRIORITY_CEILING.  A priority
+ceiling cannot be the idle priority, so zero is used as the marker. */
+#define queueNO_PRIORITY_CEILING		( ( UBaseType_t ) 0U )
+
+#if( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+	#define prvIsCeilingMutex( pxQueue ) ( ( ( pxQueue )->uxCeilingPriority != queueNO_PRIORITY_CEILING ) ? pdTRUE : pdFALSE )
+#else
+	#define prvIsCeilingMutex( pxQueue ) pdFALSE
+#endif
+
 /* Semaphores do not actually store or copy data, so have an item size of
 zero. */
 #define queueSEMAPHORE_QUEUE_ITEM_LENGTH ( ( UBaseType_t ) 0 )
 #define queueMUTEX_GIVE_BLOCK_TIME		 ( ( TickType_t ) 0U )
 
+#if ( configUSE_QUEUE_SETS == 1 )
+	/* The storage area of a queue set holds a pointer to the member in each
+	slot, followed by a bitmap with a bit set for each slot whose member may
+	contain data.  The uxLength member of a queue set holds the number of
+	slots. */
+	#define queueSET_BITS_PER_WORD			( ( UBaseType_t ) 32U )
+	#define queueSET_READY_WORDS( uxSlots )	( ( ( uxSlots ) + queueSET_BITS_PER_WORD - ( UBaseType_t ) 1U ) / queueSET_BITS_PER_WORD )
+	#define queueSET_MEMBERS( pxQueueSet )	( ( Queue_t ** ) ( pxQueueSet )->pcHead ) /*lint !e9087 !e740 The storage area of a queue set is an array of Queue_t pointers. */
+	#define queueSET_READY_BITS( pxQueueSet ) ( ( uint32_t * ) &( queueSET_MEMBERS( pxQueueSet )[ ( pxQueueSet )->uxLength ] ) ) /*lint !e9087 !e740 The ready bitmap follows the member pointers. */
+
+	#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 )
+		/* Isolate the lowest set bit, then find its position with the port's
+		count leading zeros instruction. */
+		#define queueGET_LOWEST_SET_BIT( uxBit, ulBits ) portGET_HIGHEST_PRIORITY( uxBit, ( ( ulBits ) & ( ~( ulBits ) + 1UL ) ) )
+	#else
+		#define queueGET_LOWEST_SET_BIT( uxBit, ulBits )							\
+		{																			\
+			for( uxBit = 0; ( ( ulBits ) & ( 1UL << uxBit ) ) == 0UL; uxBit++ )	\
+			{																		\
+				/* Find the lowest set bit. */									\
+			}																		\
+		}
+	#endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+#endif /* configUSE_QUEUE_SETS */
+
 #if( configUSE_PREEMPTION == 0 )
 	/* If the cooperative scheduler is being used then a yield should not be
 	performed just because a higher priority task has been woken. */
@@ -113,13 +149,25 @@ typedef struct QueueDefinition
 
 	#if ( configUSE_QUEUE_SETS == 1 )
 		struct QueueDefinition *pxQueueSetContainer;
+		UBaseType_t uxQueueSetIndex;	/*< The member slot, and ready bit, the queue uses in pxQueueSetContainer. */
 	#endif
 
 	#if ( configUSE_TRACE_FACILITY == 1 )
 		UBaseType_t uxQueueNumber;
+	#endif
+
+	#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_QUEUE_SETS == 1 ) )
 		uint8_t ucQueueType;
 	#endif
 
+	#if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+		UBaseType_t uxCeilingPriority;	/*< The priority the holder of a priority ceiling mutex is raised to when it takes the mutex.  queueNO_PRIORITY_CEILING if the structure is not used as a priority ceiling mutex. */
+	#endif
+
+	#if ( configUSE_ADAPTIVE_SEMAPHORE_SPIN == 1 )
+		UBaseType_t uxSpinBudget;		/*< The number of times xQueueSemaphoreTake() polls the semaphore count before blocking.  Adjusted after every spin. */
+	#endif
+
 } xQUEUE;
 
 /* The old xQUEUE name is maintained above then typedefed to the new Queue_t
@@ -192,10 +240,18 @@ static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer
 
 #if ( configUSE_QUEUE_SETS == 1 )
 	/*
-	 * Checks to see if a queue is a member of a queue set, and if so, notifies
-	 * the queue set that the queue contains data.
+	 * Sets the ready bit of a queue in the queue set that contains it, and
+	 * unblocks the highest priority task waiting on the set, if any.
+	 */
+	static BaseType_t prvNotifyQueueSetContainer( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Returns the lowest index member of a queue set that contains data, or
+	 * NULL if no member contains data.  Ready bits of members that have since
+	 * been emptied are cleared on the way.  Must be called from a critical
+	 * section.
 	 */
-	static BaseType_t prvNotifyQueueSetContainer( const Queue_t * const pxQueue, const BaseType_t xCopyPosition ) PRIVILEGED_FUNCTION;
+	static Queue_t *prvGetReadySetMember( Queue_t * const pxQueueSet ) PRIVILEGED_FUNCTION;
 #endif
 
 /*
@@ -213,6 +269,31 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 	static void prvInitialiseMutex( Queue_t *pxNewQueue ) PRIVILEGED_FUNCTION;
 #endif
 
+#if( configUSE_ADAPTIVE_SEMAPHORE_SPIN == 1 )
+	/*
+	 * Polls the count of a semaphore that is currently zero for up to the
+	 * semaphore's spin budget.  If the count became non-zero in time the budget
+	 * is moved towards the number of iterations that took.  If not, the budget
+	 * is left for prvAdjustSpinBudgetAfterBlock() to adjust once the length of
+	 * the block that follows is known.  Called outside of any critical section.
+	 *
+	 * @return pdTRUE if the count became non-zero while spinning, otherwise
+	 * pdFALSE.
+	 */
+	static BaseType_t prvSpinForSemaphore( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Adjusts the spin budget of a semaphore after a spin that ran out of
+	 * budget was followed by a block.  xShortBlock is pdTRUE if the semaphore
+	 * was obtained in the same tick as the spin gave up, in which case the hold
+	 * time was probably only a little longer than the budget and the budget is
+	 * doubled, up to configSEMAPHORE_SPIN_MAX_ITERATIONS.  Otherwise spinning
+	 * was wasted and the budget is halved, down to
+	 * configSEMAPHORE_SPIN_MIN_ITERATIONS.
+	 */
+	static void prvAdjustSpinBudgetAfterBlock( Queue_t * const pxQueue, const BaseType_t xShortBlock ) PRIVILEGED_FUNCTION;
+#endif
+
 #if( configUSE_MUTEXES == 1 )
 	/*
 	 * If a task waiting for a mutex causes the mutex holder to inherit a
@@ -281,6 +362,22 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
+
+			#if ( configUSE_QUEUE_SETS == 1 )
+			{
+				/* Resetting a queue set discards its pending events, as it did
+				when the events were queued, so no member is ready until data
+				is next sent to it.  The members stay in the set. */
+				if( pxQueue->ucQueueType == queueQUEUE_TYPE_SET )
+				{
+					( void ) memset( ( void * ) queueSET_READY_BITS( pxQueue ), 0x00, ( size_t ) queueSET_READY_WORDS( pxQueue->uxLength ) * sizeof( uint32_t ) );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configUSE_QUEUE_SETS */
 		}
 		else
 		{
@@ -431,11 +528,11 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 	pxNewQueue->uxItemSize = uxItemSize;
 	( void ) xQueueGenericReset( pxNewQueue, pdTRUE );
 
-	#if ( configUSE_TRACE_FACILITY == 1 )
+	#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_QUEUE_SETS == 1 ) )
 	{
 		pxNewQueue->ucQueueType = ucQueueType;
 	}
-	#endif /* configUSE_TRACE_FACILITY */
+	#endif /* configUSE_TRACE_FACILITY || configUSE_QUEUE_SETS */
 
 	#if( configUSE_QUEUE_SETS == 1 )
 	{
@@ -443,6 +540,18 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 	}
 	#endif /* configUSE_QUEUE_SETS */
 
+	#if( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+	{
+		pxNewQueue->uxCeilingPriority = queueNO_PRIORITY_CEILING;
+	}
+	#endif /* configUSE_PRIORITY_CEILING_MUTEXES */
+
+	#if( configUSE_ADAPTIVE_SEMAPHORE_SPIN == 1 )
+	{
+		pxNewQueue->uxSpinBudget = ( UBaseType_t ) configSEMAPHORE_SPIN_MIN_ITERATIONS;
+	}
+	#endif /* configUSE_ADAPTIVE_SEMAPHORE_SPIN */
+
 	traceQUEUE_CREATE( pxNewQueue );
 }
 /*-----------------------------------------------------------*/
@@ -513,6 +622,66 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 #endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
+#if( ( configUSE_PRIORITY_CEILING_MUTEXES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+	QueueHandle_t xQueueCreateCeilingMutex( const UBaseType_t uxCeilingPriority )
+	{
+	Queue_t *pxNewQueue;
+	const UBaseType_t uxMutexLength = ( UBaseType_t ) 1, uxMutexSize = ( UBaseType_t ) 0;
+
+		configASSERT( uxCeilingPriority != queueNO_PRIORITY_CEILING );
+		configASSERT( uxCeilingPriority < ( UBaseType_t ) configMAX_PRIORITIES );
+
+		pxNewQueue = ( Queue_t * ) xQueueGenericCreate( uxMutexLength, uxMutexSize, queueQUEUE_TYPE_CEILING_MUTEX );
+
+		if( pxNewQueue != NULL )
+		{
+			/* Must be set before the mutex is given for the first time by
+			prvInitialiseMutex(). */
+			pxNewQueue->uxCeilingPriority = uxCeilingPriority;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		prvInitialiseMutex( pxNewQueue );
+
+		return pxNewQueue;
+	}
+
+#endif /* configUSE_PRIORITY_CEILING_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_PRIORITY_CEILING_MUTEXES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+	QueueHandle_t xQueueCreateCeilingMutexStatic( const UBaseType_t uxCeilingPriority, StaticQueue_t *pxStaticQueue )
+	{
+	Queue_t *pxNewQueue;
+	const UBaseType_t uxMutexLength = ( UBaseType_t ) 1, uxMutexSize = ( UBaseType_t ) 0;
+
+		configASSERT( uxCeilingPriority != queueNO_PRIORITY_CEILING );
+		configASSERT( uxCeilingPriority < ( UBaseType_t ) configMAX_PRIORITIES );
+
+		pxNewQueue = ( Queue_t * ) xQueueGenericCreateStatic( uxMutexLength, uxMutexSize, NULL, pxStaticQueue, queueQUEUE_TYPE_CEILING_MUTEX );
+
+		if( pxNewQueue != NULL )
+		{
+			pxNewQueue->uxCeilingPriority = uxCeilingPriority;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		prvInitialiseMutex( pxNewQueue );
+
+		return pxNewQueue;
+	}
+
+#endif /* configUSE_PRIORITY_CEILING_MUTEXES */
+/*-----------------------------------------------------------*/
+
 #if ( ( configUSE_MUTEXES == 1 ) && ( INCLUDE_xSemaphoreGetMutexHolder == 1 ) )
 
 	void* xQueueGetMutexHolder( QueueHandle_t xSemaphore )
@@ -758,7 +927,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 				{
 					if( pxQueue->pxQueueSetContainer != NULL )
 					{
-						if( prvNotifyQueueSetContainer( pxQueue, xCopyPosition ) != pdFALSE )
+						if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
 						{
 							/* The queue is a member of a queue set, and posting
 							to the queue set caused a higher priority task to
@@ -974,7 +1143,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 				{
 					if( pxQueue->pxQueueSetContainer != NULL )
 					{
-						if( prvNotifyQueueSetContainer( pxQueue, xCopyPosition ) != pdFALSE )
+						if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
 						{
 							/* The queue is a member of a queue set, and posting
 							to the queue set caused a higher priority task to
@@ -1139,7 +1308,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 				{
 					if( pxQueue->pxQueueSetContainer != NULL )
 					{
-						if( prvNotifyQueueSetContainer( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
+						if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
 						{
 							/* The semaphore is a member of a queue set, and
 							posting	to the queue set caused a higher priority
@@ -1387,6 +1556,11 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 	BaseType_t xInheritanceOccurred = pdFALSE;
 #endif
 
+#if( configUSE_ADAPTIVE_SEMAPHORE_SPIN == 1 )
+	BaseType_t xSpinAttempted = pdFALSE, xSpinFailed = pdFALSE;
+	TickType_t xSpinEndTick = ( TickType_t ) 0;
+#endif
+
 	/* Check the queue pointer is not NULL. */
 	configASSERT( ( pxQueue ) );
 
@@ -1431,6 +1605,23 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 						/* Record the information required to implement
 						priority inheritance should it become necessary. */
 						pxQueue->pxMutexHolder = ( int8_t * ) pvTaskIncrementMutexHeldCount(); /*lint !e961 Cast is not redundant as TaskHandle_t is a typedef. */
+
+						#if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+						{
+							if( prvIsCeilingMutex( pxQueue ) != pdFALSE )
+							{
+								/* Immediate priority ceiling protocol - the
+								new holder runs at the ceiling for as long as
+								it holds the mutex, so no other task that uses
+								the mutex can preempt it and then block on it. */
+								vTaskPriorityRaiseToCeiling( pxQueue->uxCeilingPriority );
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						#endif /* configUSE_PRIORITY_CEILING_MUTEXES */
 					}
 					else
 					{
@@ -1457,6 +1648,22 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 					mtCOVERAGE_TEST_MARKER();
 				}
 
+				#if( configUSE_ADAPTIVE_SEMAPHORE_SPIN == 1 )
+				{
+					/* If an earlier spin in this call ran out of budget, use
+					how long the semaphore then took to arrive to tune the
+					budget. */
+					if( xSpinFailed != pdFALSE )
+					{
+						prvAdjustSpinBudgetAfterBlock( pxQueue, ( xTaskGetTickCount() == xSpinEndTick ) ? pdTRUE : pdFALSE );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_ADAPTIVE_SEMAPHORE_SPIN */
+
 				taskEXIT_CRITICAL();
 				return pdPASS;
 			}
@@ -1485,6 +1692,23 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 					so configure the timeout structure ready to block. */
 					vTaskInternalSetTimeOutState( &xTimeOut );
 					xEntryTimeSet = pdTRUE;
+
+					#if( ( configUSE_ADAPTIVE_SEMAPHORE_SPIN == 1 ) && ( configUSE_MUTEXES == 1 ) )
+					{
+						/* A mutex holder with a lower priority than this task
+						cannot run, so cannot give the mutex, while this task
+						spins.  Block straight away instead, which also lets
+						the holder inherit this task's priority. */
+						if( ( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX ) && ( xTaskPriorityIsBelowCurrent( ( void * ) pxQueue->pxMutexHolder ) != pdFALSE ) )
+						{
+							xSpinAttempted = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					#endif
 				}
 				else
 				{
@@ -1498,6 +1722,37 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 		/* Interrupts and other tasks can give to and take from the semaphore
 		now the critical section has been exited. */
 
+		#if( configUSE_ADAPTIVE_SEMAPHORE_SPIN == 1 )
+		{
+			/* Before paying for a block and a context switch, poll the count
+			for a short time in case the semaphore is about to be given by an
+			interrupt (or by a task running on another core).  Only spin once
+			per call so a long block time is not extended by repeated spins. */
+			if( xSpinAttempted == pdFALSE )
+			{
+				xSpinAttempted = pdTRUE;
+
+				if( prvSpinForSemaphore( pxQueue ) != pdFALSE )
+				{
+					/* The count is no longer zero, so return to the top of the
+					loop to attempt to take the semaphore without blocking. */
+					continue;
+				}
+				else
+				{
+					/* Note when the spin gave up, so the budget can be tuned
+					once the semaphore is obtained or the call times out. */
+					xSpinFailed = pdTRUE;
+					xSpinEndTick = xTaskGetTickCount();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_ADAPTIVE_SEMAPHORE_SPIN */
+
 		vTaskSuspendAll();
 		prvLockQueue( pxQueue );
 
@@ -1514,7 +1769,9 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 
 				#if ( configUSE_MUTEXES == 1 )
 				{
-					if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+					/* A priority ceiling mutex holder is already running at
+					the ceiling, so there is nothing to inherit. */
+					if( ( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX ) && ( prvIsCeilingMutex( pxQueue ) == pdFALSE ) )
 					{
 						taskENTER_CRITICAL();
 						{
@@ -1584,6 +1841,21 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 				}
 				#endif /* configUSE_MUTEXES */
 
+				#if( configUSE_ADAPTIVE_SEMAPHORE_SPIN == 1 )
+				{
+					/* The semaphore did not arrive within the block time, so
+					the spin was wasted. */
+					if( xSpinFailed != pdFALSE )
+					{
+						prvAdjustSpinBudgetAfterBlock( pxQueue, pdFALSE );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_ADAPTIVE_SEMAPHORE_SPIN */
+
 				traceQUEUE_RECEIVE_FAILED( pxQueue );
 				return errQUEUE_EMPTY;
 			}
@@ -1944,6 +2216,20 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 	configASSERT( pxQueue );
 	traceQUEUE_DELETE( pxQueue );
 
+	#if ( configUSE_QUEUE_SETS == 1 )
+	{
+		/* The queue set holds a pointer to each of its members. */
+		if( pxQueue->pxQueueSetContainer != NULL )
+		{
+			( void ) xQueueRemoveFromSet( ( QueueSetMemberHandle_t ) pxQueue, ( QueueSetHandle_t ) pxQueue->pxQueueSetContainer );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+
 	#if ( configQUEUE_REGISTRY_SIZE > 0 )
 	{
 		vQueueUnregisterQueue( pxQueue );
@@ -2009,6 +2295,114 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 #endif /* configUSE_TRACE_FACILITY */
 /*-----------------------------------------------------------*/
 
+#if( configUSE_ADAPTIVE_SEMAPHORE_SPIN == 1 )
+
+	static BaseType_t prvSpinForSemaphore( Queue_t * const pxQueue )
+	{
+	UBaseType_t uxIterations, uxBudget = pxQueue->uxSpinBudget;
+	BaseType_t xReturn = pdFALSE;
+
+		for( uxIterations = ( UBaseType_t ) 0; uxIterations < uxBudget; uxIterations++ )
+		{
+			/* uxMessagesWaiting is volatile, so is re-read each iteration. */
+			if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+			{
+				xReturn = pdTRUE;
+				break;
+			}
+			else
+			{
+				portSPIN_WAIT_HINT();
+			}
+		}
+
+		if( xReturn != pdFALSE )
+		{
+			/* The semaphore was given while spinning.  Move the budget half way
+			towards twice the number of iterations it took, so the budget
+			tracks recent hold times with some headroom. */
+			uxBudget = ( uxBudget + ( uxIterations << 1 ) ) >> 1;
+
+			if( uxBudget > ( UBaseType_t ) configSEMAPHORE_SPIN_MAX_ITERATIONS )
+			{
+				uxBudget = ( UBaseType_t ) configSEMAPHORE_SPIN_MAX_ITERATIONS;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( uxBudget < ( UBaseType_t ) configSEMAPHORE_SPIN_MIN_ITERATIONS )
+			{
+				uxBudget = ( UBaseType_t ) configSEMAPHORE_SPIN_MIN_ITERATIONS;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Written outside of a critical section.  A lost update only
+			affects the length of the next spin, never correctness. */
+			pxQueue->uxSpinBudget = uxBudget;
+		}
+		else
+		{
+			/* The spin ran out of budget.  Whether the budget was too short or
+			spinning was pointless is only known once the block that follows
+			ends, so the budget is adjusted by prvAdjustSpinBudgetAfterBlock(). */
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+/*-----------------------------------------------------------*/
+
+	static void prvAdjustSpinBudgetAfterBlock( Queue_t * const pxQueue, const BaseType_t xShortBlock )
+	{
+	UBaseType_t uxBudget = pxQueue->uxSpinBudget;
+
+		if( xShortBlock != pdFALSE )
+		{
+			/* The semaphore arrived soon after the spin gave up.  Doubling the
+			budget is the only way it can grow past the hold time, as a spin
+			that succeeds only moves the budget towards twice the iterations
+			it took. */
+			uxBudget <<= 1;
+
+			if( uxBudget > ( UBaseType_t ) configSEMAPHORE_SPIN_MAX_ITERATIONS )
+			{
+				uxBudget = ( UBaseType_t ) configSEMAPHORE_SPIN_MAX_ITERATIONS;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			/* The wait lasted at least a tick, much longer than any spin, so
+			halve the budget.  It never falls below the minimum so a change in
+			hold times can still be detected. */
+			uxBudget >>= 1;
+
+			if( uxBudget < ( UBaseType_t ) configSEMAPHORE_SPIN_MIN_ITERATIONS )
+			{
+				uxBudget = ( UBaseType_t ) configSEMAPHORE_SPIN_MIN_ITERATIONS;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		/* Not written from a critical section on every path.  A lost update
+		only affects the length of the next spin, never correctness. */
+		pxQueue->uxSpinBudget = uxBudget;
+	}
+
+#endif /* configUSE_ADAPTIVE_SEMAPHORE_SPIN */
+/*-----------------------------------------------------------*/
+
 #if( configUSE_MUTEXES == 1 )
 
 	static UBaseType_t prvGetDisinheritPriorityAfterTimeout( const Queue_t * const pxQueue )
@@ -2154,7 +2548,7 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
 			{
 				if( pxQueue->pxQueueSetContainer != NULL )
 				{
-					if( prvNotifyQueueSetContainer( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
+					if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
 					{
 						/* The queue is a member of a queue set, and posting to
 						the queue set caused a higher priority task to unblock.
@@ -2733,13 +3127,31 @@ BaseType_t xReturn;
 
 #if( ( configUSE_QUEUE_SETS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
-	QueueSetHandle_t xQueueCreateSet( const UBaseType_t uxEventQueueLength )
+	QueueSetHandle_t xQueueCreateSet( const UBaseType_t uxMaxMembers )
 	{
-	QueueSetHandle_t pxQueue;
+	Queue_t *pxQueue;
+	UBaseType_t uxStorageItems;
+
+		configASSERT( uxMaxMembers > ( UBaseType_t ) 0 );
+
+		/* The storage area is allocated as enough pointer sized items to hold
+		a pointer to each member followed by the ready bitmap. */
+		uxStorageItems = uxMaxMembers + ( UBaseType_t ) ( ( ( queueSET_READY_WORDS( uxMaxMembers ) * sizeof( uint32_t ) ) + sizeof( Queue_t * ) - ( size_t ) 1 ) / sizeof( Queue_t * ) );
 
-		pxQueue = xQueueGenericCreate( uxEventQueueLength, ( UBaseType_t ) sizeof( Queue_t * ), queueQUEUE_TYPE_SET );
+		pxQueue = ( Queue_t * ) xQueueGenericCreate( uxStorageItems, ( UBaseType_t ) sizeof( Queue_t * ), queueQUEUE_TYPE_SET );
 
-		return pxQueue;
+		if( pxQueue != NULL )
+		{
+			/* No slots are used and no members are ready. */
+			( void ) memset( ( void * ) pxQueue->pcHead, 0x00, ( size_t ) uxStorageItems * sizeof( Queue_t * ) );
+			pxQueue->uxLength = uxMaxMembers;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return ( QueueSetHandle_t ) pxQueue;
 	}
 
 #endif /* configUSE_QUEUE_SETS */
@@ -2750,24 +3162,63 @@ BaseType_t xReturn;
 	BaseType_t xQueueAddToSet( QueueSetMemberHandle_t xQueueOrSemaphore, QueueSetHandle_t xQueueSet )
 	{
 	BaseType_t xReturn;
+	Queue_t * const pxQueueOrSemaphore = ( Queue_t * ) xQueueOrSemaphore;
+	Queue_t * const pxQueueSet = ( Queue_t * ) xQueueSet;
+	Queue_t ** const ppxMembers = queueSET_MEMBERS( pxQueueSet );
+	UBaseType_t uxIndex;
+
+		configASSERT( pxQueueOrSemaphore );
+		configASSERT( pxQueueSet );
 
 		taskENTER_CRITICAL();
 		{
-			if( ( ( Queue_t * ) xQueueOrSemaphore )->pxQueueSetContainer != NULL )
+			if( pxQueueOrSemaphore->pxQueueSetContainer != NULL )
 			{
 				/* Cannot add a queue/semaphore to more than one queue set. */
 				xReturn = pdFAIL;
 			}
-			else if( ( ( Queue_t * ) xQueueOrSemaphore )->uxMessagesWaiting != ( UBaseType_t ) 0 )
-			{
-				/* Cannot add a queue/semaphore to a queue set if there are already
-				items in the queue/semaphore. */
-				xReturn = pdFAIL;
-			}
 			else
 			{
-				( ( Queue_t * ) xQueueOrSemaphore )->pxQueueSetContainer = xQueueSet;
-				xReturn = pdPASS;
+				/* Use the lowest free slot, so members are selected in the
+				order they were added. */
+				for( uxIndex = 0; uxIndex < pxQueueSet->uxLength; uxIndex++ )
+				{
+					if( ppxMembers[ uxIndex ] == NULL )
+					{
+						break;
+					}
+				}
+
+				if( uxIndex < pxQueueSet->uxLength )
+				{
+					ppxMembers[ uxIndex ] = pxQueueOrSemaphore;
+					pxQueueOrSemaphore->pxQueueSetContainer = pxQueueSet;
+					pxQueueOrSemaphore->uxQueueSetIndex = uxIndex;
+					xReturn = pdPASS;
+
+					/* A queue that already contains data is ready straight
+					away. */
+					if( pxQueueOrSemaphore->uxMessagesWaiting != ( UBaseType_t ) 0 )
+					{
+						if( prvNotifyQueueSetContainer( pxQueueOrSemaphore ) != pdFALSE )
+						{
+							queueYIELD_IF_USING_PREEMPTION();
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					/* Every slot is in use. */
+					xReturn = pdFAIL;
+				}
 			}
 		}
 		taskEXIT_CRITICAL();
@@ -2784,29 +3235,32 @@ BaseType_t xReturn;
 	{
 	BaseType_t xReturn;
 	Queue_t * const pxQueueOrSemaphore = ( Queue_t * ) xQueueOrSemaphore;
+	Queue_t * const pxQueueSet = ( Queue_t * ) xQueueSet;
+	UBaseType_t uxIndex;
 
-		if( pxQueueOrSemaphore->pxQueueSetContainer != xQueueSet )
-		{
-			/* The queue was not a member of the set. */
-			xReturn = pdFAIL;
-		}
-		else if( pxQueueOrSemaphore->uxMessagesWaiting != ( UBaseType_t ) 0 )
-		{
-			/* It is dangerous to remove a queue from a set when the queue is
-			not empty because the queue set will still hold pending events for
-			the queue. */
-			xReturn = pdFAIL;
-		}
-		else
+		configASSERT( pxQueueOrSemaphore );
+
+		taskENTER_CRITICAL();
 		{
-			taskENTER_CRITICAL();
+			if( pxQueueOrSemaphore->pxQueueSetContainer != pxQueueSet )
 			{
+				/* The queue was not a member of the set. */
+				xReturn = pdFAIL;
+			}
+			else
+			{
+				/* The set only holds the slot and the ready bit of the queue,
+				so the queue can be removed even if it contains data. */
+				uxIndex = pxQueueOrSemaphore->uxQueueSetIndex;
+				queueSET_MEMBERS( pxQueueSet )[ uxIndex ] = NULL;
+				queueSET_READY_BITS( pxQueueSet )[ uxIndex / queueSET_BITS_PER_WORD ] &= ~( 1UL << ( uxIndex % queueSET_BITS_PER_WORD ) );
+
 				/* The queue is no longer contained in the set. */
 				pxQueueOrSemaphore->pxQueueSetContainer = NULL;
+				xReturn = pdPASS;
 			}
-			taskEXIT_CRITICAL();
-			xReturn = pdPASS;
 		}
+		taskEXIT_CRITICAL();
 
 		return xReturn;
 	} /*lint !e818 xQueueSet could not be declared as pointing to const as it is a typedef. */
@@ -2818,10 +3272,68 @@ BaseType_t xReturn;
 
 	QueueSetMemberHandle_t xQueueSelectFromSet( QueueSetHandle_t xQueueSet, TickType_t const xTicksToWait )
 	{
-	QueueSetMemberHandle_t xReturn = NULL;
+	Queue_t * const pxQueueSet = ( Queue_t * ) xQueueSet;
+	Queue_t *pxMember;
+	TickType_t xTicksRemaining = xTicksToWait;
+	TimeOut_t xTimeOut;
+	BaseType_t xEntryTimeSet = pdFALSE;
 
-		( void ) xQueueReceive( ( QueueHandle_t ) xQueueSet, &xReturn, xTicksToWait ); /*lint !e961 Casting from one typedef to another is not redundant. */
-		return xReturn;
+		configASSERT( pxQueueSet );
+
+		/* Cannot block if the scheduler is suspended. */
+		#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+		{
+			configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+		}
+		#endif
+
+		/* This function relaxes the coding standard somewhat to allow return
+		statements within the function itself.  This is done in the interest
+		of execution time efficiency. */
+		for( ;; )
+		{
+			/* The ready bits are only set with interrupts masked, so checking
+			them and placing the task on the event list in the same critical
+			section means a member cannot become ready in between without
+			unblocking the task. */
+			taskENTER_CRITICAL();
+			{
+				pxMember = prvGetReadySetMember( pxQueueSet );
+
+				if( pxMember != NULL )
+				{
+					taskEXIT_CRITICAL();
+					return ( QueueSetMemberHandle_t ) pxMember;
+				}
+				else if( xTicksToWait == ( TickType_t ) 0 )
+				{
+					taskEXIT_CRITICAL();
+					return NULL;
+				}
+				else if( xEntryTimeSet == pdFALSE )
+				{
+					vTaskInternalSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+					traceBLOCKING_ON_QUEUE_RECEIVE( pxQueueSet );
+					vTaskPlaceOnEventList( &( pxQueueSet->xTasksWaitingToReceive ), xTicksRemaining );
+				}
+				else if( xTaskCheckForTimeOut( &xTimeOut, &xTicksRemaining ) == pdFALSE )
+				{
+					/* Unblocked, but another task received the data first. */
+					traceBLOCKING_ON_QUEUE_RECEIVE( pxQueueSet );
+					vTaskPlaceOnEventList( &( pxQueueSet->xTasksWaitingToReceive ), xTicksRemaining );
+				}
+				else
+				{
+					/* Timed out. */
+					taskEXIT_CRITICAL();
+					return NULL;
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			portYIELD_WITHIN_API();
+		}
 	}
 
 #endif /* configUSE_QUEUE_SETS */
@@ -2831,10 +3343,21 @@ BaseType_t xReturn;
 
 	QueueSetMemberHandle_t xQueueSelectFromSetFromISR( QueueSetHandle_t xQueueSet )
 	{
-	QueueSetMemberHandle_t xReturn = NULL;
+	Queue_t *pxMember;
+	UBaseType_t uxSavedInterruptStatus;
 
-		( void ) xQueueReceiveFromISR( ( QueueHandle_t ) xQueueSet, &xReturn, NULL ); /*lint !e961 Casting from one typedef to another is not redundant. */
-		return xReturn;
+		configASSERT( xQueueSet );
+
+		/* See the comments in xQueueReceiveFromISR(). */
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			pxMember = prvGetReadySetMember( ( Queue_t * ) xQueueSet );
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return ( QueueSetMemberHandle_t ) pxMember;
 	}
 
 #endif /* configUSE_QUEUE_SETS */
@@ -2842,47 +3365,78 @@ BaseType_t xReturn;
 
 #if ( configUSE_QUEUE_SETS == 1 )
 
-	static BaseType_t prvNotifyQueueSetContainer( const Queue_t * const pxQueue, const BaseType_t xCopyPosition )
+	static Queue_t *prvGetReadySetMember( Queue_t * const pxQueueSet )
 	{
-	Queue_t *pxQueueSetContainer = pxQueue->pxQueueSetContainer;
-	BaseType_t xReturn = pdFALSE;
-
-		/* This function must be called form a critical section. */
-
-		configASSERT( pxQueueSetContainer );
-		configASSERT( pxQueueSetContainer->uxMessagesWaiting < pxQueueSetContainer->uxLength );
+	Queue_t ** const ppxMembers = queueSET_MEMBERS( pxQueueSet );
+	uint32_t * const pulReadyBits = queueSET_READY_BITS( pxQueueSet );
+	const UBaseType_t uxWords = queueSET_READY_WORDS( pxQueueSet->uxLength );
+	Queue_t *pxMember = NULL;
+	UBaseType_t uxWord, uxBit;
 
-		if( pxQueueSetContainer->uxMessagesWaiting < pxQueueSetContainer->uxLength )
+		/* A ready bit is set each time data is sent to the member, but is not
+		cleared when the data is received, as that would add work to every
+		receive.  Instead a member whose bit is set but that is found to be
+		empty here has its bit cleared, so each bit is only skipped once per
+		time it was set. */
+		for( uxWord = 0; ( uxWord < uxWords ) && ( pxMember == NULL ); uxWord++ )
 		{
-			const int8_t cTxLock = pxQueueSetContainer->cTxLock;
-
-			traceQUEUE_SEND( pxQueueSetContainer );
+			while( ( pulReadyBits[ uxWord ] != 0UL ) && ( pxMember == NULL ) )
+			{
+				queueGET_LOWEST_SET_BIT( uxBit, pulReadyBits[ uxWord ] );
+				pxMember = ppxMembers[ ( uxWord * queueSET_BITS_PER_WORD ) + uxBit ];
 
-			/* The data copied is the handle of the queue that contains data. */
-			xReturn = prvCopyDataToQueue( pxQueueSetContainer, &pxQueue, xCopyPosition );
+				configASSERT( pxMember );
 
-			if( cTxLock == queueUNLOCKED )
-			{
-				if( listLIST_IS_EMPTY( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) == pdFALSE )
+				if( pxMember->uxMessagesWaiting == ( UBaseType_t ) 0 )
 				{
-					if( xTaskRemoveFromEventList( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) != pdFALSE )
-					{
-						/* The task waiting has a higher priority. */
-						xReturn = pdTRUE;
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+					pulReadyBits[ uxWord ] &= ~( 1UL << uxBit );
+					pxMember = NULL;
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
 			}
+		}
+
+		return pxMember;
+	}
+
+#endif /* configUSE_QUEUE_SETS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_SETS == 1 )
+
+	static BaseType_t prvNotifyQueueSetContainer( const Queue_t * const pxQueue )
+	{
+	Queue_t *pxQueueSetContainer = pxQueue->pxQueueSetContainer;
+	uint32_t *pulReadyBits;
+	BaseType_t xReturn = pdFALSE;
+
+		/* This function must be called form a critical section. */
+
+		configASSERT( pxQueueSetContainer );
+		configASSERT( pxQueue->uxQueueSetIndex < pxQueueSetContainer->uxLength );
+
+		/* Every access to the ready bits is made with interrupts masked, so the
+		bit can be set without an atomic operation.  The bit is set each time
+		data is sent, so it does not matter if it is already set. */
+		pulReadyBits = queueSET_READY_BITS( pxQueueSetContainer );
+		pulReadyBits[ pxQueue->uxQueueSetIndex / queueSET_BITS_PER_WORD ] |= ( 1UL << ( pxQueue->uxQueueSetIndex % queueSET_BITS_PER_WORD ) );
+
+		/* The tasks waiting on the set only place themselves on the event list
+		from a critical section, so the set is never locked and the event list
+		can be updated from here. */
+		if( listLIST_IS_EMPTY( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) == pdFALSE )
+		{
+			if( xTaskRemoveFromEventList( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) != pdFALSE )
+			{
+				/* The task waiting has a higher priority. */
+				xReturn = pdTRUE;
+			}
 			else
 			{
-				pxQueueSetContainer->cTxLock = ( int8_t ) ( cTxLock + 1 );
+				mtCOVERAGE_TEST_MARKER();
 			}
 		}
 		else
@@ -0,0 +1,452 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * Tests the active object framework in active_object.c on the host
+ * simulator: the transitions of a hierarchical state machine, delivery of a
+ * published event to several subscribers, event reference counting, pool
+ * exhaustion, and the release of events that do not fit in a full queue.
+ *
+ * The runner task has a higher priority than the test task, so an event
+ * posted or published by the test task has been dispatched by the time the
+ * call returns, unless the test suspends the scheduler.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <string.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "active_object.h"
+
+#include "host_support.h"
+
+#define testSIG_A			( ( AOSignal_t ) ( aoSIG_USER + 0U ) )
+#define testSIG_B			( ( AOSignal_t ) ( aoSIG_USER + 1U ) )
+#define testSIG_C			( ( AOSignal_t ) ( aoSIG_USER + 2U ) )
+#define testSIG_D			( ( AOSignal_t ) ( aoSIG_USER + 3U ) )
+#define testSIG_E			( ( AOSignal_t ) ( aoSIG_USER + 4U ) )
+#define testSIG_MULTICAST	( ( AOSignal_t ) ( aoSIG_USER + 5U ) )
+#define testSIG_SMALL		( ( AOSignal_t ) ( aoSIG_USER + 6U ) )
+#define testSIG_UNUSED		( ( AOSignal_t ) ( aoSIG_USER + 7U ) )
+
+#define testMACHINE_ID		( 0U )
+#define testSMALL_ID		( 4U )
+#define testSUBSCRIBERS		( 3U )
+#define testPOOL_BLOCKS		( 4U )
+#define testBLOCK_SIZE		( 16U )
+#define testQUEUE_LENGTH	( 4U )
+#define testSMALL_LENGTH	( 2U )
+#define testMAX_RECEIVED	( 16U )
+
+/*-----------------------------------------------------------*/
+
+typedef struct TestEvent
+{
+	AOEvent_t xHeader;
+	uint32_t ulValue;
+} TestEvent_t;
+
+/* An event as seen by a subscriber. */
+typedef struct TestReceipt
+{
+	UBaseType_t uxId;
+	const AOEvent_t *pxEvent;
+	uint32_t ulValue;
+	uint32_t ulRefCount;
+} TestReceipt_t;
+
+/*
+ * The states of the hierarchical state machine:
+ *
+ *   top
+ *    +- S
+ *    |   +- S1 (initial)
+ *    |   |   +- S11 (initial)
+ *    |   +- S2
+ *    +- T
+ */
+static BaseType_t prvMachineInitial( ActiveObject_t *pxAO, const AOEvent_t *pxEvent );
+static BaseType_t prvS( ActiveObject_t *pxAO, const AOEvent_t *pxEvent );
+static BaseType_t prvS1( ActiveObject_t *pxAO, const AOEvent_t *pxEvent );
+static BaseType_t prvS11( ActiveObject_t *pxAO, const AOEvent_t *pxEvent );
+static BaseType_t prvS2( ActiveObject_t *pxAO, const AOEvent_t *pxEvent );
+static BaseType_t prvT( ActiveObject_t *pxAO, const AOEvent_t *pxEvent );
+
+static BaseType_t prvSubscriberInitial( ActiveObject_t *pxAO, const AOEvent_t *pxEvent );
+static BaseType_t prvSubscriber( ActiveObject_t *pxAO, const AOEvent_t *pxEvent );
+
+/*-----------------------------------------------------------*/
+
+static ActiveObject_t xMachine, xSmall;
+static ActiveObject_t xSubscribers[ testSUBSCRIBERS ];
+
+static uint8_t ucPool[ testPOOL_BLOCKS * testBLOCK_SIZE ] __attribute__( ( aligned( portBYTE_ALIGNMENT ) ) );
+
+/* The entry and exit actions executed by the state machine. */
+static char cTrace[ 128 ];
+
+static TestReceipt_t xReceived[ testMAX_RECEIVED ];
+static UBaseType_t uxReceived = 0;
+
+/*-----------------------------------------------------------*/
+
+static void prvTrace( const char *pcAction )
+{
+	if( cTrace[ 0 ] != '\0' )
+	{
+		strncat( cTrace, " ", sizeof( cTrace ) - strlen( cTrace ) - 1U );
+	}
+
+	strncat( cTrace, pcAction, sizeof( cTrace ) - strlen( cTrace ) - 1U );
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvMachineInitial( ActiveObject_t *pxAO, const AOEvent_t *pxEvent )
+{
+	( void ) pxEvent;
+	return aoTRAN( pxAO, prvS );
+}
+
+static BaseType_t prvS( ActiveObject_t *pxAO, const AOEvent_t *pxEvent )
+{
+	switch( pxEvent->xSignal )
+	{
+		case aoSIG_ENTRY:	prvTrace( "S+" ); return aoHANDLED();
+		case aoSIG_EXIT:	prvTrace( "S-" ); return aoHANDLED();
+		case aoSIG_INIT:	return aoTRAN( pxAO, prvS1 );
+		case testSIG_C:		return aoTRAN( pxAO, prvT );
+		default:			break;
+	}
+
+	return aoSUPER( pxAO, xActiveObjectTop );
+}
+
+static BaseType_t prvS1( ActiveObject_t *pxAO, const AOEvent_t *pxEvent )
+{
+	switch( pxEvent->xSignal )
+	{
+		case aoSIG_ENTRY:	prvTrace( "S1+" ); return aoHANDLED();
+		case aoSIG_EXIT:	prvTrace( "S1-" ); return aoHANDLED();
+		case aoSIG_INIT:	return aoTRAN( pxAO, prvS11 );
+		default:			break;
+	}
+
+	return aoSUPER( pxAO, prvS );
+}
+
+static BaseType_t prvS11( ActiveObject_t *pxAO, const AOEvent_t *pxEvent )
+{
+	switch( pxEvent->xSignal )
+	{
+		case aoSIG_ENTRY:	prvTrace( "S11+" ); return aoHANDLED();
+		case aoSIG_EXIT:	prvTrace( "S11-" ); return aoHANDLED();
+		case testSIG_A:		return aoTRAN( pxAO, prvS2 );
+		default:			break;
+	}
+
+	return aoSUPER( pxAO, prvS1 );
+}
+
+static BaseType_t prvS2( ActiveObject_t *pxAO, const AOEvent_t *pxEvent )
+{
+	switch( pxEvent->xSignal )
+	{
+		case aoSIG_ENTRY:	prvTrace( "S2+" ); return aoHANDLED();
+		case aoSIG_EXIT:	prvTrace( "S2-" ); return aoHANDLED();
+		case testSIG_B:		return aoTRAN( pxAO, prvS2 );
+		default:			break;
+	}
+
+	return aoSUPER( pxAO, prvS );
+}
+
+static BaseType_t prvT( ActiveObject_t *pxAO, const AOEvent_t *pxEvent )
+{
+	switch( pxEvent->xSignal )
+	{
+		case aoSIG_ENTRY:	prvTrace( "T+" ); return aoHANDLED();
+		case aoSIG_EXIT:	prvTrace( "T-" ); return aoHANDLED();
+		case testSIG_D:		return aoTRAN( pxAO, prvS );
+		default:			break;
+	}
+
+	return aoSUPER( pxAO, xActiveObjectTop );
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvSubscriberInitial( ActiveObject_t *pxAO, const AOEvent_t *pxEvent )
+{
+	( void ) pxEvent;
+	vActiveObjectSubscribe( pxAO, ( pxAO == &xSmall ) ? testSIG_SMALL : testSIG_MULTICAST );
+	return aoTRAN( pxAO, prvSubscriber );
+}
+
+static BaseType_t prvSubscriber( ActiveObject_t *pxAO, const AOEvent_t *pxEvent )
+{
+	if( ( pxEvent->xSignal == testSIG_MULTICAST ) || ( pxEvent->xSignal == testSIG_SMALL ) )
+	{
+		configASSERT( uxReceived < testMAX_RECEIVED );
+		xReceived[ uxReceived ].uxId = pxAO->uxId;
+		xReceived[ uxReceived ].pxEvent = pxEvent;
+		xReceived[ uxReceived ].ulValue = ( ( const TestEvent_t * ) pxEvent )->ulValue;
+		xReceived[ uxReceived ].ulRefCount = pxEvent->ulRefCount;
+		uxReceived++;
+		return aoHANDLED();
+	}
+
+	return aoSUPER( pxAO, xActiveObjectTop );
+}
+/*-----------------------------------------------------------*/
+
+static TestEvent_t *prvNewEvent( AOSignal_t xSignal, uint32_t ulValue )
+{
+TestEvent_t *pxEvent = ( TestEvent_t * ) pxActiveObjectNewEvent( sizeof( TestEvent_t ), xSignal );
+
+	if( pxEvent != NULL )
+	{
+		pxEvent->ulValue = ulValue;
+	}
+
+	return pxEvent;
+}
+/*-----------------------------------------------------------*/
+
+/* Returns the number of free blocks in the pool, by allocating them all, then
+publishing them to a signal with no subscribers, which frees them. */
+static UBaseType_t prvFreeBlocks( void )
+{
+TestEvent_t *pxEvents[ testPOOL_BLOCKS ];
+UBaseType_t uxFree = 0, ux;
+
+	while( uxFree < testPOOL_BLOCKS )
+	{
+		pxEvents[ uxFree ] = prvNewEvent( testSIG_UNUSED, 0UL );
+
+		if( pxEvents[ uxFree ] == NULL )
+		{
+			break;
+		}
+
+		uxFree++;
+	}
+
+	for( ux = 0; ux < uxFree; ux++ )
+	{
+		configASSERT( uxActiveObjectPublish( &( pxEvents[ ux ]->xHeader ) ) == 0U );
+	}
+
+	return uxFree;
+}
+/*-----------------------------------------------------------*/
+
+static void prvPost( AOSignal_t xSignal )
+{
+AOEvent_t xEvent = { xSignal, 0U, 0U, 0UL };
+
+	cTrace[ 0 ] = '\0';
+	configASSERT( xActiveObjectPost( &xMachine, &xEvent ) == pdPASS );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestStateMachine( void )
+{
+	cTrace[ 0 ] = '\0';
+	configASSERT( xActiveObjectStart( &xMachine, testMACHINE_ID, 0U, NULL, testQUEUE_LENGTH, prvMachineInitial ) == pdPASS );
+
+	/* Initial transitions drill down to the leaf state. */
+	hostCHECK( strcmp( cTrace, "S+ S1+ S11+" ) == 0 );
+	hostCHECK( xMachine.pxState == prvS11 );
+
+	/* To a sibling of an ancestor: exit up to the least common ancestor. */
+	prvPost( testSIG_A );
+	hostCHECK( strcmp( cTrace, "S11- S1- S2+" ) == 0 );
+	hostCHECK( xMachine.pxState == prvS2 );
+
+	/* To self: exit and enter again. */
+	prvPost( testSIG_B );
+	hostCHECK( strcmp( cTrace, "S2- S2+" ) == 0 );
+
+	/* Handled by a superstate: exit from the leaf state up to the top. */
+	prvPost( testSIG_C );
+	hostCHECK( strcmp( cTrace, "S2- S- T+" ) == 0 );
+	hostCHECK( xMachine.pxState == prvT );
+
+	/* To a composite state: enter it and follow its initial transitions. */
+	prvPost( testSIG_D );
+	hostCHECK( strcmp( cTrace, "T- S+ S1+ S11+" ) == 0 );
+	hostCHECK( xMachine.pxState == prvS11 );
+
+	/* Not handled by any state. */
+	prvPost( testSIG_E );
+	hostCHECK( cTrace[ 0 ] == '\0' );
+	hostCHECK( xMachine.pxState == prvS11 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestMulticast( void )
+{
+TestEvent_t *pxEvent;
+UBaseType_t ux;
+
+	for( ux = 0; ux < testSUBSCRIBERS; ux++ )
+	{
+		configASSERT( xActiveObjectStart( &( xSubscribers[ ux ] ), ux + 1U, 0U, NULL, testQUEUE_LENGTH, prvSubscriberInitial ) == pdPASS );
+	}
+
+	/* The runner dispatches each delivery before the next is made, so the
+	reference held by the publish keeps the event allocated. */
+	uxReceived = 0;
+	pxEvent = prvNewEvent( testSIG_MULTICAST, 42UL );
+	configASSERT( pxEvent );
+	hostCHECK( uxActiveObjectPublish( &( pxEvent->xHeader ) ) == testSUBSCRIBERS );
+	hostCHECK( uxReceived == testSUBSCRIBERS );
+
+	for( ux = 0; ux < uxReceived; ux++ )
+	{
+		/* Highest identifier first. */
+		hostCHECK( xReceived[ ux ].uxId == ( testSUBSCRIBERS - ux ) );
+		hostCHECK( xReceived[ ux ].pxEvent == &( pxEvent->xHeader ) );
+		hostCHECK( xReceived[ ux ].ulValue == 42UL );
+		hostCHECK( xReceived[ ux ].ulRefCount == 2UL );
+	}
+
+	hostCHECK( prvFreeBlocks() == testPOOL_BLOCKS );
+
+	/* With the scheduler suspended every subscriber holds a reference until
+	it has processed the event. */
+	uxReceived = 0;
+	pxEvent = prvNewEvent( testSIG_MULTICAST, 7UL );
+	configASSERT( pxEvent );
+	vTaskSuspendAll();
+	{
+		hostCHECK( uxActiveObjectPublish( &( pxEvent->xHeader ) ) == testSUBSCRIBERS );
+		hostCHECK( pxEvent->xHeader.ulRefCount == testSUBSCRIBERS );
+		hostCHECK( prvFreeBlocks() == ( testPOOL_BLOCKS - 1U ) );
+	}
+	( void ) xTaskResumeAll();
+
+	hostCHECK( uxReceived == testSUBSCRIBERS );
+	hostCHECK( ( xReceived[ 0 ].ulRefCount == 3UL ) && ( xReceived[ 2 ].ulRefCount == 1UL ) );
+	hostCHECK( prvFreeBlocks() == testPOOL_BLOCKS );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestPoolExhaustion( void )
+{
+TestEvent_t *pxEvents[ testPOOL_BLOCKS ];
+UBaseType_t ux;
+
+	for( ux = 0; ux < testPOOL_BLOCKS; ux++ )
+	{
+		pxEvents[ ux ] = prvNewEvent( testSIG_UNUSED, 0UL );
+		hostCHECK( pxEvents[ ux ] != NULL );
+	}
+
+	hostCHECK( prvNewEvent( testSIG_UNUSED, 0UL ) == NULL );
+	hostCHECK( uxActiveObjectPoolGetMinimumFree( 0 ) == 0U );
+
+	for( ux = 0; ux < testPOOL_BLOCKS; ux++ )
+	{
+		configASSERT( uxActiveObjectPublish( &( pxEvents[ ux ]->xHeader ) ) == 0U );
+	}
+
+	hostCHECK( prvFreeBlocks() == testPOOL_BLOCKS );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestQueueFull( void )
+{
+TestEvent_t *pxEvent;
+UBaseType_t ux;
+
+	configASSERT( xActiveObjectStart( &xSmall, testSMALL_ID, 0U, NULL, testSMALL_LENGTH, prvSubscriberInitial ) == pdPASS );
+
+	/* An event that does not fit in the queue is returned to the pool. */
+	uxReceived = 0;
+	vTaskSuspendAll();
+	{
+		for( ux = 0; ux <= testSMALL_LENGTH; ux++ )
+		{
+			pxEvent = prvNewEvent( testSIG_SMALL, ( uint32_t ) ux );
+			configASSERT( pxEvent );
+			hostCHECK( uxActiveObjectPublish( &( pxEvent->xHeader ) ) == ( ( ux < testSMALL_LENGTH ) ? 1U : 0U ) );
+		}
+
+		hostCHECK( prvFreeBlocks() == ( testPOOL_BLOCKS - testSMALL_LENGTH ) );
+	}
+	( void ) xTaskResumeAll();
+
+	hostCHECK( uxReceived == testSMALL_LENGTH );
+	hostCHECK( ( xReceived[ 0 ].ulValue == 0UL ) && ( xReceived[ 1 ].ulValue == 1UL ) );
+	hostCHECK( prvFreeBlocks() == testPOOL_BLOCKS );
+}
+/*-----------------------------------------------------------*/
+
+static void prvPublishInterrupt( void )
+{
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+TestEvent_t *pxEvent;
+
+	pxEvent = prvNewEvent( testSIG_MULTICAST, 99UL );
+	configASSERT( pxEvent );
+	hostCHECK( uxActiveObjectPublishFromISR( &( pxEvent->xHeader ), &xHigherPriorityTaskWoken ) == testSUBSCRIBERS );
+	hostCHECK( xHigherPriorityTaskWoken != pdFALSE );
+	portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
+
+static void prvTestPublishFromISR( void )
+{
+	uxReceived = 0;
+	vPortSimulateInterrupt( prvPublishInterrupt );
+	hostCHECK( ( uxReceived == testSUBSCRIBERS ) && ( xReceived[ 0 ].ulValue == 99UL ) );
+	hostCHECK( prvFreeBlocks() == testPOOL_BLOCKS );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTest( void )
+{
+	configASSERT( xActiveObjectInit() == pdPASS );
+	configASSERT( xActiveObjectPoolInit( ucPool, testBLOCK_SIZE, testPOOL_BLOCKS ) == pdPASS );
+
+	prvTestStateMachine();
+	prvTestMulticast();
+	prvTestPoolExhaustion();
+	prvTestQueueFull();
+	prvTestPublishFromISR();
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+int iReturn = iHostRunTest( prvTest, tskIDLE_PRIORITY + 1 );
+
+	printf( "active_object_test: %s\n", ( iReturn == 0 ) ? "PASS" : "FAIL" );
+	return iReturn;
+}
@@ -0,0 +1,179 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * Measures xSemaphoreTake() on a semaphore that is given by an interrupt a
+ * short time after the take starts, with configUSE_ADAPTIVE_SEMAPHORE_SPIN set
+ * to 0 (block at once) or 1 (spin before blocking).  Build the kernel and the
+ * benchmark with each setting and compare the output.  See readme.txt.
+ *
+ * The simulator has one core, so a task that holds a lock cannot release it
+ * while another task spins.  The release is therefore made by a simulated
+ * interrupt, as on a single core target, when a virtual clock reaches the end
+ * of the hold time.  The clock advances by one unit on each pass of the spin
+ * loop (through pxPortSpinWaitHook) and, while the taking task is blocked, on
+ * each pass of a lower priority background task, so the hold time is the same
+ * whether the taking task spins or blocks.
+ *
+ * For each pattern of hold times the benchmark reports the context switches
+ * per take, the spin iterations per take, and the time per take.  The
+ * simulator's context switch includes a system call, which exaggerates the
+ * cost of blocking compared with a target, so the times are only useful for
+ * comparing the two builds.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+#include "host_support.h"
+
+#define benchBACKGROUND_PRIORITY	( tskIDLE_PRIORITY + 1 )
+#define benchTAKE_PRIORITY			( tskIDLE_PRIORITY + 2 )
+
+#define benchTAKES					( 20000UL )
+
+/*-----------------------------------------------------------*/
+
+/* Hold times, in clock units, used in turn by successive takes. */
+typedef struct BenchPattern
+{
+	const char *pcName;
+	uint32_t ulHolds[ 2 ];
+} BenchPattern_t;
+
+static SemaphoreHandle_t xSemaphore = NULL;
+static volatile uint32_t ulClock = 0;
+static volatile uint32_t ulReleaseAt = 0;
+static volatile BaseType_t xReleasePending = pdFALSE;
+static uint32_t ulSpinIterations = 0;
+
+/*-----------------------------------------------------------*/
+
+static void prvReleaseInterrupt( void )
+{
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	xReleasePending = pdFALSE;
+	( void ) xSemaphoreGiveFromISR( xSemaphore, &xHigherPriorityTaskWoken );
+	portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+/* Advances the clock by one unit, and raises the release interrupt at the end
+of the hold time. */
+static void prvAdvanceClock( void )
+{
+	ulClock++;
+
+	if( ( xReleasePending != pdFALSE ) && ( ( int32_t ) ( ulClock - ulReleaseAt ) >= 0 ) )
+	{
+		vPortSimulateInterrupt( prvReleaseInterrupt );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSpinWaitHook( void )
+{
+	ulSpinIterations++;
+	prvAdvanceClock();
+}
+/*-----------------------------------------------------------*/
+
+/* Only runs while the taking task is blocked. */
+static void prvBackgroundTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		prvAdvanceClock();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvMeasure( const BenchPattern_t *pxPattern )
+{
+uint64_t ullStart, ullTime;
+uint32_t ulSwitches, ulSpins, ul;
+
+	ulSwitches = ulPortGetContextSwitchCount();
+	ulSpins = ulSpinIterations;
+	ullStart = ullHostGetNanoseconds();
+
+	for( ul = 0; ul < benchTAKES; ul++ )
+	{
+		ulReleaseAt = ulClock + pxPattern->ulHolds[ ul & 1UL ];
+		xReleasePending = pdTRUE;
+		configASSERT( xSemaphoreTake( xSemaphore, portMAX_DELAY ) == pdPASS );
+		configASSERT( xReleasePending == pdFALSE );
+	}
+
+	ullTime = ullHostGetNanoseconds() - ullStart;
+	ulSwitches = ulPortGetContextSwitchCount() - ulSwitches;
+	ulSpins = ulSpinIterations - ulSpins;
+
+	printf( "  %-28s %8.2f %8.1f %8.0f ns\n", pxPattern->pcName, ( double ) ulSwitches / ( double ) benchTAKES, ( double ) ulSpins / ( double ) benchTAKES, ( double ) ullTime / ( double ) benchTAKES );
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchmark( void )
+{
+static const BenchPattern_t xPatterns[] =
+{
+	{ "hold 4", { 4UL, 4UL } },
+	{ "hold 100", { 100UL, 100UL } },
+	{ "hold 2000", { 2000UL, 2000UL } },
+	{ "hold 4 and 2000 alternately", { 4UL, 2000UL } }
+};
+size_t x;
+
+	xSemaphore = xSemaphoreCreateBinary();
+	configASSERT( xSemaphore );
+	pxPortSpinWaitHook = prvSpinWaitHook;
+	configASSERT( xTaskCreate( prvBackgroundTask, "Background", configMINIMAL_STACK_SIZE, NULL, benchBACKGROUND_PRIORITY, NULL ) == pdPASS );
+
+	printf( "Interrupt released take, configUSE_ADAPTIVE_SEMAPHORE_SPIN %d, %lu takes:\n", configUSE_ADAPTIVE_SEMAPHORE_SPIN, benchTAKES );
+	printf( "  %-28s %8s %8s %11s\n", "", "switches", "spins", "time" );
+
+	for( x = 0; x < ( sizeof( xPatterns ) / sizeof( xPatterns[ 0 ] ) ); x++ )
+	{
+		prvMeasure( &( xPatterns[ x ] ) );
+	}
+
+	pxPortSpinWaitHook = NULL;
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+	return iHostRunTest( prvBenchmark, benchTAKE_PRIORITY );
+}
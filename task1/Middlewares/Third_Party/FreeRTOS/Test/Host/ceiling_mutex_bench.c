@@ -0,0 +1,206 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * Compares a priority ceiling mutex (xSemaphoreCreateCeilingMutex()) with a
+ * priority inheritance mutex (xSemaphoreCreateMutex()), and with a binary
+ * semaphore, which has neither protocol, in the classic three task priority
+ * inversion on the host simulator.
+ *
+ * On each round the low priority task takes the lock and, part way through
+ * its critical section, a simulated interrupt wakes the high priority task,
+ * which then takes the lock, and the medium priority task, which does not use
+ * the lock but executes for longer than the critical section.  The benchmark
+ * reports the context switches per round and, for the time from the interrupt
+ * to the high priority task holding the lock, the context switches, the worst
+ * amount of work executed by other tasks, and the mean time.  With the binary
+ * semaphore the medium priority task runs before the low priority task can
+ * give the lock back.  With inheritance the high priority task preempts the
+ * low priority task, blocks on the lock, and is switched back in when the lock
+ * is given.  With the ceiling the low priority task already runs at the
+ * ceiling, so the high priority task is not switched in until the lock is
+ * free.  Work is counted rather than timed for the worst case, as host
+ * scheduling makes the worst measured time meaningless.  The simulator's
+ * context switch includes a system call, so the mean times are only useful for
+ * comparing the three.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+#include "host_support.h"
+
+#if( configUSE_PRIORITY_CEILING_MUTEXES != 1 )
+	#error This benchmark needs configUSE_PRIORITY_CEILING_MUTEXES set to 1.
+#endif
+
+#define benchLOW_PRIORITY		( tskIDLE_PRIORITY + 1 )
+#define benchMEDIUM_PRIORITY	( tskIDLE_PRIORITY + 2 )
+#define benchHIGH_PRIORITY		( tskIDLE_PRIORITY + 3 )
+
+#define benchROUNDS				( 20000UL )
+
+/* Units of work in each half of the low priority task's critical section, and
+executed by the medium priority task on each round.  prvWork() counts the
+units executed. */
+#define benchLOW_WORK			( 500UL )
+#define benchMEDIUM_WORK		( 5000UL )
+
+/*-----------------------------------------------------------*/
+
+static SemaphoreHandle_t xLock = NULL;
+static TaskHandle_t xHighTask = NULL, xMediumTask = NULL;
+static uint64_t ullEventTime = 0, ullLatencyTotal = 0;
+static uint32_t ulEventWork = 0, ulEventSwitches = 0, ulWorkDone = 0;
+static uint32_t ulWorstWork = 0, ulSwitchesToLock = 0, ulHighRounds = 0;
+
+/*-----------------------------------------------------------*/
+
+static void prvWork( uint32_t ulUnits )
+{
+volatile uint32_t ulCount;
+
+	for( ulCount = 0; ulCount < ulUnits; ulCount++ )
+	{
+	}
+
+	ulWorkDone += ulUnits;
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventInterrupt( void )
+{
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	ullEventTime = ullHostGetNanoseconds();
+	ulEventWork = ulWorkDone;
+	ulEventSwitches = ulPortGetContextSwitchCount();
+	vTaskNotifyGiveFromISR( xHighTask, &xHigherPriorityTaskWoken );
+	vTaskNotifyGiveFromISR( xMediumTask, &xHigherPriorityTaskWoken );
+	portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+static void prvHighTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+		configASSERT( xSemaphoreTake( xLock, portMAX_DELAY ) == pdPASS );
+
+		ullLatencyTotal += ullHostGetNanoseconds() - ullEventTime;
+		ulSwitchesToLock += ulPortGetContextSwitchCount() - ulEventSwitches;
+
+		if( ( ulWorkDone - ulEventWork ) > ulWorstWork )
+		{
+			ulWorstWork = ulWorkDone - ulEventWork;
+		}
+
+		ulHighRounds++;
+		configASSERT( xSemaphoreGive( xLock ) == pdPASS );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvMediumTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+		prvWork( benchMEDIUM_WORK );
+	}
+}
+/*-----------------------------------------------------------*/
+
+/* Executed by the low priority task. */
+static void prvMeasure( const char *pcName, SemaphoreHandle_t xNewLock )
+{
+uint32_t ulSwitches, ul;
+
+	configASSERT( xNewLock );
+	xLock = xNewLock;
+	ullLatencyTotal = 0;
+	ulWorstWork = 0;
+	ulSwitchesToLock = 0;
+	ulHighRounds = 0;
+	ulSwitches = ulPortGetContextSwitchCount();
+
+	for( ul = 0; ul < benchROUNDS; ul++ )
+	{
+		configASSERT( xSemaphoreTake( xLock, portMAX_DELAY ) == pdPASS );
+		prvWork( benchLOW_WORK );
+		vPortSimulateInterrupt( prvEventInterrupt );
+		prvWork( benchLOW_WORK );
+		configASSERT( xSemaphoreGive( xLock ) == pdPASS );
+
+		/* The high and medium priority tasks have run and blocked again. */
+		configASSERT( uxTaskPriorityGet( NULL ) == benchLOW_PRIORITY );
+	}
+
+	ulSwitches = ulPortGetContextSwitchCount() - ulSwitches;
+
+	printf( "  %-26s %9.1f %11.1f %10lu %9.0f ns\n", pcName, ( double ) ulSwitches / ( double ) benchROUNDS, ( double ) ulSwitchesToLock / ( double ) benchROUNDS, ( unsigned long ) ulWorstWork, ( double ) ullLatencyTotal / ( double ) benchROUNDS );
+	hostCHECK( ulHighRounds == benchROUNDS );
+
+	vSemaphoreDelete( xLock );
+	xLock = NULL;
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchmark( void )
+{
+SemaphoreHandle_t xBinary;
+
+	configASSERT( xTaskCreate( prvHighTask, "High", configMINIMAL_STACK_SIZE, NULL, benchHIGH_PRIORITY, &xHighTask ) == pdPASS );
+	configASSERT( xTaskCreate( prvMediumTask, "Medium", configMINIMAL_STACK_SIZE, NULL, benchMEDIUM_PRIORITY, &xMediumTask ) == pdPASS );
+
+	printf( "Three task priority inversion, %lu rounds.  \"To lock\" is from the interrupt to the high\npriority task holding the lock.\n", benchROUNDS );
+	printf( "  %-26s %9s %11s %10s %12s\n", "", "switches", "switches", "worst work", "mean time" );
+	printf( "  %-26s %9s %11s %10s %12s\n", "", "per round", "to lock", "to lock", "to lock" );
+
+	xBinary = xSemaphoreCreateBinary();
+	configASSERT( xBinary );
+	( void ) xSemaphoreGive( xBinary );
+	prvMeasure( "binary semaphore", xBinary );
+	prvMeasure( "priority inheritance mutex", xSemaphoreCreateMutex() );
+	prvMeasure( "priority ceiling mutex", xSemaphoreCreateCeilingMutex( benchHIGH_PRIORITY ) );
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+	return iHostRunTest( prvBenchmark, benchLOW_PRIORITY );
+}
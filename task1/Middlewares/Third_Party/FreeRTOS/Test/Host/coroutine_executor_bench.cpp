@@ -0,0 +1,296 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * Measures the RAM used by a logical task, and the latency of resuming one,
+ * for coroutines on a coroutine executor and for FreeRTOS tasks, on the host
+ * simulator.
+ *
+ * RAM: the smallest arena block that holds the frame of a typical coroutine,
+ * including the frame header, is found by trying to create the coroutine with
+ * increasing block sizes.  A task needs a StaticTask_t plus its stack.
+ *
+ * Latency: the time from the call that wakes a waiting logical task, made by a
+ * lower priority task, to the logical task running and waiting again, and the
+ * number of context switches.  The simulator's context switch includes a
+ * system call, so the times are only useful for comparing the two.
+ */
+
+/* Standard includes. */
+#include <cstdio>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "stream_buffer.h"
+
+#include "coroutine_executor.hpp"
+#include "host_support.h"
+
+using namespace freertos::coro;
+
+#define benchHIGH_PRIORITY		( tskIDLE_PRIORITY + 2 )
+#define benchEVENTS				( 200000UL )
+#define benchYIELD_COROUTINES	( 32UL )
+#define benchYIELDS				( 2000000UL )
+#define benchIDLE_WAITERS		( 32UL )
+#define benchEVENT_BIT			( 0x1UL )
+
+/* The stack depth of the tasks in the STM32F3 projects, which is 512 bytes. */
+#define benchTARGET_STACK_BYTES	( 128U * 4U )
+
+/*-----------------------------------------------------------*/
+
+static uint32_t ulEvents = 0;
+
+static void prvExecutorTask( void *pvParameters )
+{
+	static_cast< Executor * >( pvParameters )->run();
+}
+
+static Task prvBlink( Executor &, TickType_t xPeriod )
+{
+	for( ;; )
+	{
+		ulEvents++;
+		co_await delay( xPeriod );
+	}
+}
+
+static Task prvReceiver( Executor &, QueueHandle_t xQueue, StreamBufferHandle_t xStreamBuffer )
+{
+uint32_t ulItem;
+uint8_t ucBytes[ 16 ];
+
+	for( ;; )
+	{
+		if( co_await notifyWait( benchEVENT_BIT, pdMS_TO_TICKS( 100 ) ) != 0 )
+		{
+			ulEvents++;
+		}
+
+		if( co_await queueReceive( xQueue, &ulItem ) == pdPASS )
+		{
+			ulEvents += ulItem;
+		}
+
+		ulEvents += ( uint32_t ) co_await streamReceive( xStreamBuffer, ucBytes, sizeof( ucBytes ) );
+	}
+}
+
+static Task prvYielder( Executor &, uint32_t ulYields )
+{
+	for( uint32_t ul = 0; ul < ulYields; ul++ )
+	{
+		ulEvents++;
+		co_await yield();
+	}
+}
+
+static Task prvNotifyWaiter( Executor &, uint32_t ulBits )
+{
+	for( ;; )
+	{
+		( void ) co_await notifyWait( ulBits );
+		ulEvents++;
+	}
+}
+
+static Task prvQueueWaiter( Executor &, QueueHandle_t xQueue )
+{
+uint32_t ulItem;
+
+	for( ;; )
+	{
+		( void ) co_await queueReceive( xQueue, &ulItem );
+		ulEvents++;
+	}
+}
+
+static void prvNotifyTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		( void ) xTaskNotifyWait( 0, benchEVENT_BIT, NULL, portMAX_DELAY );
+		ulEvents++;
+	}
+}
+
+static void prvQueueTask( void *pvParameters )
+{
+QueueHandle_t xQueue = static_cast< QueueHandle_t >( pvParameters );
+uint32_t ulItem;
+
+	for( ;; )
+	{
+		( void ) xQueueReceive( xQueue, &ulItem, portMAX_DELAY );
+		ulEvents++;
+	}
+}
+
+/*-----------------------------------------------------------*/
+
+/* Returns the smallest block size that holds the frame created by xCreate. */
+template< typename Create >
+static size_t prvFrameBlockSize( Create xCreate )
+{
+alignas( std::max_align_t ) static uint8_t ucStorage[ 4096 ];
+size_t xBlockSize, xReturn = 0;
+
+	for( xBlockSize = alignof( std::max_align_t ); ( xBlockSize <= sizeof( ucStorage ) ) && ( xReturn == 0 ); xBlockSize += alignof( std::max_align_t ) )
+	{
+		FrameArena xArena( ucStorage, sizeof( ucStorage ), xBlockSize );
+		Executor xExecutor( xArena );
+		Task xTask = xCreate( xExecutor );
+
+		if( xTask )
+		{
+			xReturn = xBlockSize;
+		}
+	}
+
+	return xReturn;
+}
+
+static void prvMeasureRAM( void )
+{
+QueueHandle_t xQueue = xQueueCreate( 1, sizeof( uint32_t ) );
+StreamBufferHandle_t xStreamBuffer = xStreamBufferCreate( 16, 1 );
+size_t xBlink, xReceiver, xYielder;
+
+	xBlink = prvFrameBlockSize( []( Executor &xExecutor ) { return prvBlink( xExecutor, 500 ); } );
+	xReceiver = prvFrameBlockSize( [=]( Executor &xExecutor ) { return prvReceiver( xExecutor, xQueue, xStreamBuffer ); } );
+	xYielder = prvFrameBlockSize( []( Executor &xExecutor ) { return prvYielder( xExecutor, 1 ); } );
+
+	printf( "RAM per logical task (bytes, %u byte pointers):\n", ( unsigned ) sizeof( void * ) );
+	printf( "  coroutine, delay loop:                   %4u (frame header %u)\n", ( unsigned ) xBlink, ( unsigned ) alignof( std::max_align_t ) );
+	printf( "  coroutine, yield loop:                   %4u\n", ( unsigned ) xYielder );
+	printf( "  coroutine, notify, queue and stream:     %4u\n", ( unsigned ) xReceiver );
+	printf( "  task, StaticTask_t + %u byte stack:     %4u\n", ( unsigned ) benchTARGET_STACK_BYTES, ( unsigned ) ( sizeof( StaticTask_t ) + benchTARGET_STACK_BYTES ) );
+
+	hostCHECK( ( xBlink != 0 ) && ( xReceiver != 0 ) && ( xYielder != 0 ) );
+
+	vStreamBufferDelete( xStreamBuffer );
+	vQueueDelete( xQueue );
+}
+/*-----------------------------------------------------------*/
+
+/* Calls xWake benchEVENTS times and reports the time and context switches per
+call.  Each call must make the woken logical task count one event. */
+template< typename Wake >
+static void prvMeasureWake( const char *pcName, Wake xWake )
+{
+uint64_t ullStart, ullTime;
+uint32_t ulSwitches, ul;
+
+	ulEvents = 0;
+	ulSwitches = ulPortGetContextSwitchCount();
+	ullStart = ullHostGetNanoseconds();
+
+	for( ul = 0; ul < benchEVENTS; ul++ )
+	{
+		xWake();
+	}
+
+	ullTime = ullHostGetNanoseconds() - ullStart;
+	ulSwitches = ulPortGetContextSwitchCount() - ulSwitches;
+
+	printf( "  %-44s %6.0f ns  %4.1f switches\n", pcName, ( double ) ullTime / ( double ) benchEVENTS, ( double ) ulSwitches / ( double ) benchEVENTS );
+	hostCHECK( ulEvents == benchEVENTS );
+}
+
+static void prvMeasureLatency( void )
+{
+static StaticFrameArena< 128, benchYIELD_COROUTINES > xYieldArena;
+static StaticFrameArena< 256, 2 + benchIDLE_WAITERS > xEventArena, xBusyArena;
+static Executor xYieldExecutor( xYieldArena ), xEventExecutor( xEventArena ), xBusyExecutor( xBusyArena );
+QueueHandle_t xTaskQueue, xEventQueue, xBusyQueue;
+TaskHandle_t xNotifyTask, xEventTask, xBusyTask;
+uint64_t ullStart, ullTime;
+uint32_t ul, ulItem = 0;
+
+	/* Resuming a coroutine from another coroutine on the same executor. */
+	for( ul = 0; ul < benchYIELD_COROUTINES; ul++ )
+	{
+		configASSERT( xYieldExecutor.spawn( prvYielder( xYieldExecutor, benchYIELDS / benchYIELD_COROUTINES ) ) == pdPASS );
+	}
+
+	ulEvents = 0;
+	ullStart = ullHostGetNanoseconds();
+	configASSERT( xTaskCreate( prvExecutorTask, "Yield", configMINIMAL_STACK_SIZE, &xYieldExecutor, benchHIGH_PRIORITY, NULL ) == pdPASS );
+	ullTime = ullHostGetNanoseconds() - ullStart;
+
+	printf( "Resume latency:\n" );
+	printf( "  %-44s %6.1f ns\n", "coroutine from coroutine, co_await yield()", ( double ) ullTime / ( double ) benchYIELDS );
+	hostCHECK( ( ulEvents == benchYIELDS ) && ( xYieldExecutor.liveCoroutines() == 0 ) );
+
+	/* Resuming a logical task from a lower priority task.  The busy executor
+	also has benchIDLE_WAITERS coroutines waiting for other notification bits,
+	which it checks on every wake. */
+	xTaskQueue = xQueueCreate( 1, sizeof( uint32_t ) );
+	xEventQueue = xQueueCreate( 1, sizeof( uint32_t ) );
+	xBusyQueue = xQueueCreate( 1, sizeof( uint32_t ) );
+	configASSERT( xTaskQueue && xEventQueue && xBusyQueue );
+
+	configASSERT( xEventExecutor.spawn( prvNotifyWaiter( xEventExecutor, benchEVENT_BIT ) ) == pdPASS );
+	configASSERT( xEventExecutor.spawn( prvQueueWaiter( xEventExecutor, xEventQueue ) ) == pdPASS );
+	configASSERT( xBusyExecutor.spawn( prvNotifyWaiter( xBusyExecutor, benchEVENT_BIT ) ) == pdPASS );
+	configASSERT( xBusyExecutor.spawn( prvQueueWaiter( xBusyExecutor, xBusyQueue ) ) == pdPASS );
+
+	for( ul = 0; ul < benchIDLE_WAITERS; ul++ )
+	{
+		configASSERT( xBusyExecutor.spawn( prvNotifyWaiter( xBusyExecutor, benchEVENT_BIT << ( ( ul % 30UL ) + 1UL ) ) ) == pdPASS );
+	}
+
+	configASSERT( xTaskCreate( prvNotifyTask, "Notify", configMINIMAL_STACK_SIZE, NULL, benchHIGH_PRIORITY, &xNotifyTask ) == pdPASS );
+	configASSERT( xTaskCreate( prvQueueTask, "Queue", configMINIMAL_STACK_SIZE, xTaskQueue, benchHIGH_PRIORITY, NULL ) == pdPASS );
+	configASSERT( xTaskCreate( prvExecutorTask, "Event", configMINIMAL_STACK_SIZE, &xEventExecutor, benchHIGH_PRIORITY, &xEventTask ) == pdPASS );
+	configASSERT( xTaskCreate( prvExecutorTask, "Busy", configMINIMAL_STACK_SIZE, &xBusyExecutor, benchHIGH_PRIORITY, &xBusyTask ) == pdPASS );
+
+	prvMeasureWake( "task, xTaskNotify()", [=]() { ( void ) xTaskNotify( xNotifyTask, benchEVENT_BIT, eSetBits ); } );
+	prvMeasureWake( "coroutine, xTaskNotify()", [=]() { ( void ) xTaskNotify( xEventTask, benchEVENT_BIT, eSetBits ); } );
+	prvMeasureWake( "coroutine, xTaskNotify(), 32 other waiters", [=]() { ( void ) xTaskNotify( xBusyTask, benchEVENT_BIT, eSetBits ); } );
+	prvMeasureWake( "task, xQueueSend()", [&]() { ( void ) xQueueSend( xTaskQueue, &ulItem, 0 ); } );
+	prvMeasureWake( "coroutine, xQueueSend() + wake()", [&]() { ( void ) xQueueSend( xEventQueue, &ulItem, 0 ); xEventExecutor.wake(); } );
+	prvMeasureWake( "coroutine, xQueueSend() + wake(), 32 others", [&]() { ( void ) xQueueSend( xBusyQueue, &ulItem, 0 ); xBusyExecutor.wake(); } );
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchmark( void )
+{
+	prvMeasureRAM();
+	prvMeasureLatency();
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+	return iHostRunTest( prvBenchmark, tskIDLE_PRIORITY + 1 );
+}
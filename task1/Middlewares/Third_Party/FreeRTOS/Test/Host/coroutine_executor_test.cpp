@@ -0,0 +1,308 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * Tests the coroutine executor in coroutine_executor.hpp on the host
+ * simulator.  The coroutines run on two executors, each with its own arena,
+ * in tasks of a higher priority than the test task, so a coroutine woken by
+ * the test task has run by the time the call that woke it returns.
+ *
+ * Once an executor is running, coroutines can only be spawned from another
+ * coroutine on the same executor, so the test task hands them to a launcher
+ * coroutine on each executor.
+ */
+
+/* Standard includes. */
+#include <cstdio>
+#include <cstring>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "stream_buffer.h"
+
+#include "coroutine_executor.hpp"
+#include "host_support.h"
+
+using namespace freertos::coro;
+
+#define testEXECUTOR_PRIORITY	( tskIDLE_PRIORITY + 2 )
+#define testBLOCK_BYTES			( 512U )
+#define testBLOCKS				( 8U )
+#define testLAUNCH_BIT			( 0x80000000UL )
+
+/* The launcher's frame is always allocated. */
+#define testBLOCKS_FREE			( testBLOCKS - 1U )
+
+struct Launch
+{
+	Task *pxTask;
+	BaseType_t xResult;
+};
+
+static StaticFrameArena< testBLOCK_BYTES, testBLOCKS > xArenaA, xArenaB;
+static Executor xExecutorA( xArenaA ), xExecutorB( xArenaB );
+static Launch xLaunchA, xLaunchB;
+
+/*-----------------------------------------------------------*/
+
+static void prvExecutorTask( void *pvParameters )
+{
+	static_cast< Executor * >( pvParameters )->run();
+}
+
+static Task prvLauncher( Executor &xExecutor, Launch *pxLaunch )
+{
+	for( ;; )
+	{
+		( void ) co_await notifyWait( testLAUNCH_BIT );
+		pxLaunch->xResult = xExecutor.spawn( static_cast< Task && >( *( pxLaunch->pxTask ) ) );
+	}
+}
+
+/* Spawns xTask on xExecutor and runs it until it first waits. */
+static BaseType_t prvSpawn( Executor &xExecutor, Task &&xTask )
+{
+Launch * const pxLaunch = ( &xExecutor == &xExecutorA ) ? &xLaunchA : &xLaunchB;
+
+	pxLaunch->pxTask = &xTask;
+	pxLaunch->xResult = -1;
+	( void ) xTaskNotify( xExecutor.taskHandle(), testLAUNCH_BIT, eSetBits );
+
+	return pxLaunch->xResult;
+}
+
+static Task prvDelay( Executor &, TickType_t xTicks, TickType_t *pxElapsed )
+{
+TickType_t xStart = xTaskGetTickCount();
+
+	co_await delay( xTicks );
+	*pxElapsed = xTaskGetTickCount() - xStart;
+}
+
+static Task prvYield( Executor &, char cName, char *pcLog, size_t *pxLogged )
+{
+	for( int i = 0; i < 3; i++ )
+	{
+		pcLog[ ( *pxLogged )++ ] = cName;
+		co_await yield();
+	}
+}
+
+/* Spawning from a coroutine queues the new coroutines behind the ready ones. */
+static Task prvYieldPair( Executor &xExecutor, char *pcLog, size_t *pxLogged )
+{
+	configASSERT( xExecutor.spawn( prvYield( xExecutor, 'a', pcLog, pxLogged ) ) == pdPASS );
+	configASSERT( xExecutor.spawn( prvYield( xExecutor, 'b', pcLog, pxLogged ) ) == pdPASS );
+	co_return;
+}
+
+static Task prvNotify( Executor &, uint32_t ulBits, TickType_t xTicks, uint32_t *pulReceived, BaseType_t *pxDone )
+{
+	*pulReceived = co_await notifyWait( ulBits, xTicks );
+	*pxDone = pdTRUE;
+}
+
+static Task prvQueue( Executor &, QueueHandle_t xQueue, TickType_t xTicks, BaseType_t *pxResult, uint32_t *pulItem )
+{
+	*pxResult = co_await queueReceive( xQueue, pulItem, xTicks );
+}
+
+static Task prvStream( Executor &, StreamBufferHandle_t xStreamBuffer, size_t *pxReceived, char *pcData )
+{
+	*pxReceived = co_await streamReceive( xStreamBuffer, pcData, 8 );
+}
+
+/* The frame of this coroutine does not fit in a block. */
+static Task prvTooLarge( Executor & )
+{
+volatile uint8_t ucLarge[ testBLOCK_BYTES ];
+
+	ucLarge[ 0 ] = 0;
+	co_await yield();
+	ucLarge[ 1 ] = ucLarge[ 0 ];
+}
+
+struct Counter
+{
+	UBaseType_t uxCount = 0;
+
+	Task count( Executor &, UBaseType_t uxTimes )
+	{
+		for( UBaseType_t ux = 0; ux < uxTimes; ux++ )
+		{
+			uxCount++;
+			co_await yield();
+		}
+	}
+};
+
+/*-----------------------------------------------------------*/
+
+static void prvTestArenas( void )
+{
+TickType_t xElapsedA = 0, xElapsedB = 0;
+
+	/* Each executor allocates frames from its own arena. */
+	hostCHECK( prvSpawn( xExecutorA, prvDelay( xExecutorA, 3, &xElapsedA ) ) == pdPASS );
+	hostCHECK( ( xArenaA.blocksFree() == ( testBLOCKS_FREE - 1U ) ) && ( xArenaB.blocksFree() == testBLOCKS_FREE ) );
+	hostCHECK( prvSpawn( xExecutorB, prvDelay( xExecutorB, 5, &xElapsedB ) ) == pdPASS );
+	hostCHECK( ( xArenaA.blocksFree() == ( testBLOCKS_FREE - 1U ) ) && ( xArenaB.blocksFree() == ( testBLOCKS_FREE - 1U ) ) );
+
+	vTaskDelay( 10 );
+
+	/* And returns them there when the coroutines complete. */
+	hostCHECK( ( xElapsedA == 3 ) && ( xElapsedB == 5 ) );
+	hostCHECK( ( xArenaA.blocksFree() == testBLOCKS_FREE ) && ( xArenaB.blocksFree() == testBLOCKS_FREE ) );
+	hostCHECK( ( xExecutorA.liveCoroutines() == 1 ) && ( xExecutorB.liveCoroutines() == 1 ) );
+
+	/* A frame that does not fit cannot be spawned. */
+	hostCHECK( prvSpawn( xExecutorA, prvTooLarge( xExecutorA ) ) == pdFAIL );
+	hostCHECK( xArenaA.blocksFree() == testBLOCKS_FREE );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestYield( void )
+{
+char cLog[ 8 ] = { 0 };
+size_t xLogged = 0;
+Counter xCounter;
+
+	hostCHECK( prvSpawn( xExecutorA, prvYieldPair( xExecutorA, cLog, &xLogged ) ) == pdPASS );
+	hostCHECK( ( xLogged == 6 ) && ( memcmp( cLog, "ababab", 6 ) == 0 ) );
+
+	/* Member function coroutines take the executor after the object. */
+	hostCHECK( prvSpawn( xExecutorA, xCounter.count( xExecutorA, 4 ) ) == pdPASS );
+	hostCHECK( xCounter.uxCount == 4 );
+	hostCHECK( xExecutorA.liveCoroutines() == 1 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestNotify( void )
+{
+uint32_t ulReceived = 0xffffffffUL;
+BaseType_t xDone = pdFALSE;
+TickType_t xStart;
+
+	hostCHECK( prvSpawn( xExecutorA, prvNotify( xExecutorA, 0x6, portMAX_DELAY, &ulReceived, &xDone ) ) == pdPASS );
+	hostCHECK( xDone == pdFALSE );
+
+	/* Bits that are not waited for do not resume the coroutine. */
+	( void ) xTaskNotify( xExecutorA.taskHandle(), 0x1, eSetBits );
+	hostCHECK( xDone == pdFALSE );
+
+	( void ) xTaskNotify( xExecutorA.taskHandle(), 0x4, eSetBits );
+	hostCHECK( ( xDone != pdFALSE ) && ( ulReceived == 0x4 ) );
+
+	/* A wait that times out returns 0. */
+	xDone = pdFALSE;
+	xStart = xTaskGetTickCount();
+	hostCHECK( prvSpawn( xExecutorA, prvNotify( xExecutorA, 0x8, 4, &ulReceived, &xDone ) ) == pdPASS );
+
+	while( xDone == pdFALSE )
+	{
+		vTaskDelay( 1 );
+	}
+
+	hostCHECK( ( ulReceived == 0 ) && ( ( xTaskGetTickCount() - xStart ) == 4 ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestQueue( void )
+{
+QueueHandle_t xQueue = xQueueCreate( 2, sizeof( uint32_t ) );
+BaseType_t xResult = -1;
+uint32_t ulItem = 0, ulSent = 42;
+uint32_t ulSwitches;
+
+	configASSERT( xQueue );
+	hostCHECK( prvSpawn( xExecutorA, prvQueue( xExecutorA, xQueue, portMAX_DELAY, &xResult, &ulItem ) ) == pdPASS );
+
+	/* A coroutine waiting on a queue does not make the executor poll, so the
+	executor does not run while the test task is delayed. */
+	ulSwitches = ulPortGetContextSwitchCount();
+	vTaskDelay( 20 );
+	hostCHECK( ( ulPortGetContextSwitchCount() - ulSwitches ) == 2 );
+
+	/* Nor is the coroutine resumed by the send alone, but it is when the
+	executor is woken. */
+	hostCHECK( xQueueSend( xQueue, &ulSent, 0 ) == pdPASS );
+	hostCHECK( xResult == -1 );
+	xExecutorA.wake();
+	hostCHECK( ( xResult == pdPASS ) && ( ulItem == 42 ) );
+
+	/* A wait that times out returns pdFAIL. */
+	xResult = -1;
+	hostCHECK( prvSpawn( xExecutorA, prvQueue( xExecutorA, xQueue, 3, &xResult, &ulItem ) ) == pdPASS );
+	vTaskDelay( 4 );
+	hostCHECK( xResult == pdFAIL );
+
+	vQueueDelete( xQueue );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestStream( void )
+{
+StreamBufferHandle_t xStreamBuffer = xStreamBufferCreate( 16, 1 );
+size_t xReceived = 1234;
+char cData[ 8 ] = { 0 };
+
+	configASSERT( xStreamBuffer );
+	hostCHECK( prvSpawn( xExecutorB, prvStream( xExecutorB, xStreamBuffer, &xReceived, cData ) ) == pdPASS );
+
+	hostCHECK( xStreamBufferSend( xStreamBuffer, "abc", 3, 0 ) == 3 );
+	xExecutorB.wake();
+	hostCHECK( ( xReceived == 3 ) && ( memcmp( cData, "abc", 3 ) == 0 ) );
+
+	vStreamBufferDelete( xStreamBuffer );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTest( void )
+{
+	/* Coroutines can be spawned before the executor runs. */
+	configASSERT( xExecutorA.spawn( prvLauncher( xExecutorA, &xLaunchA ) ) == pdPASS );
+	configASSERT( xExecutorB.spawn( prvLauncher( xExecutorB, &xLaunchB ) ) == pdPASS );
+	configASSERT( xTaskCreate( prvExecutorTask, "ExecA", configMINIMAL_STACK_SIZE, &xExecutorA, testEXECUTOR_PRIORITY, NULL ) == pdPASS );
+	configASSERT( xTaskCreate( prvExecutorTask, "ExecB", configMINIMAL_STACK_SIZE, &xExecutorB, testEXECUTOR_PRIORITY, NULL ) == pdPASS );
+
+	prvTestArenas();
+	prvTestYield();
+	prvTestNotify();
+	prvTestQueue();
+	prvTestStream();
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+int iReturn = iHostRunTest( prvTest, tskIDLE_PRIORITY + 1 );
+
+	printf( "coroutine_executor_test: %s\n", ( iReturn == 0 ) ? "PASS" : "FAIL" );
+	return iReturn;
+}
@@ -0,0 +1,125 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "host_support.h"
+
+/*
+ * The task that calls the function passed to iHostRunTest().
+ */
+static void prvTestTask( void *pvParameters );
+
+/*-----------------------------------------------------------*/
+
+static UBaseType_t uxFailures = 0;
+
+/*-----------------------------------------------------------*/
+
+int iHostRunTest( void ( *pxTest )( void ), UBaseType_t uxPriority )
+{
+	configASSERT( xTaskCreate( prvTestTask, "Test", configMINIMAL_STACK_SIZE, ( void * ) pxTest, uxPriority, NULL ) == pdPASS );
+
+	/* Returns when prvTestTask() ends the scheduler. */
+	vTaskStartScheduler();
+
+	return ( uxFailures == 0 ) ? 0 : 1;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestTask( void *pvParameters )
+{
+void ( *pxTest )( void ) = ( void ( * )( void ) ) pvParameters;
+
+	pxTest();
+	vTaskEndScheduler();
+}
+/*-----------------------------------------------------------*/
+
+void vHostCheck( BaseType_t xCondition, const char *pcCondition, const char *pcFile, unsigned long ulLine )
+{
+	if( xCondition == pdFALSE )
+	{
+		uxFailures++;
+		printf( "FAIL %s:%lu: %s\n", pcFile, ulLine, pcCondition );
+	}
+}
+/*-----------------------------------------------------------*/
+
+uint64_t ullHostGetNanoseconds( void )
+{
+struct timespec xNow;
+
+	( void ) clock_gettime( CLOCK_MONOTONIC, &xNow );
+	return ( ( uint64_t ) xNow.tv_sec * 1000000000ULL ) + ( uint64_t ) xNow.tv_nsec;
+}
+/*-----------------------------------------------------------*/
+
+void vAssertCalled( const char *pcFile, unsigned long ulLine )
+{
+	printf( "ASSERT %s:%lu\n", pcFile, ulLine );
+	( void ) fflush( stdout );
+	abort();
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationIdleHook( void )
+{
+	/* Time passes while every other task is blocked. */
+	vPortSimulateTick();
+}
+/*-----------------------------------------------------------*/
+
+/* Weak so that programs built with cmsis_os2.c, which also provides the idle
+and timer task memory, link. */
+__attribute__( ( weak ) ) void vApplicationGetIdleTaskMemory( StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint32_t *pulIdleTaskStackSize )
+{
+static StaticTask_t xIdleTaskTCB;
+static StackType_t uxIdleTaskStack[ configMINIMAL_STACK_SIZE ];
+
+	*ppxIdleTaskTCBBuffer = &xIdleTaskTCB;
+	*ppxIdleTaskStackBuffer = uxIdleTaskStack;
+	*pulIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+}
+/*-----------------------------------------------------------*/
+
+__attribute__( ( weak ) ) void vApplicationGetTimerTaskMemory( StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer, uint32_t *pulTimerTaskStackSize )
+{
+static StaticTask_t xTimerTaskTCB;
+static StackType_t uxTimerTaskStack[ configTIMER_TASK_STACK_DEPTH ];
+
+	*ppxTimerTaskTCBBuffer = &xTimerTaskTCB;
+	*ppxTimerTaskStackBuffer = uxTimerTaskStack;
+	*pulTimerTaskStackSize = configTIMER_TASK_STACK_DEPTH;
+}
@@ -0,0 +1,66 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * Functions shared by the host simulator tests and benchmarks.
+ */
+
+#ifndef HOST_SUPPORT_H
+#define HOST_SUPPORT_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h must appear in source files before include host_support.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Creates a task of priority uxPriority that calls pxTest, starts the
+ * scheduler, and returns when pxTest returns.  Can only be called once.
+ * Returns 0 if every check passed, 1 otherwise, for use as the exit status of
+ * the program.
+ */
+int iHostRunTest( void ( *pxTest )( void ), UBaseType_t uxPriority );
+
+/*
+ * Records a failed check if xCondition is pdFALSE.
+ */
+#define hostCHECK( xCondition ) vHostCheck( ( BaseType_t ) ( ( xCondition ) ? pdTRUE : pdFALSE ), #xCondition, __FILE__, __LINE__ )
+void vHostCheck( BaseType_t xCondition, const char *pcCondition, const char *pcFile, unsigned long ulLine );
+
+/*
+ * Returns the time of the host's monotonic clock, in nanoseconds.
+ */
+uint64_t ullHostGetNanoseconds( void );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_SUPPORT_H */
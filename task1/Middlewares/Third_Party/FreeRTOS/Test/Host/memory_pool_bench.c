@@ -0,0 +1,244 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * Compares the CMSIS-RTOS2 memory pool in cmsis_os2.c (osMemoryPoolAlloc() and
+ * osMemoryPoolFree()) with the heap_4 allocator (pvPortMalloc() and
+ * vPortFree()) on the host simulator, for blocks of one size.
+ *
+ * Time: the mean time of an allocate and free pair when each block is freed
+ * straight away, and when benchLIVE_BLOCKS blocks are held and about half of
+ * them are freed in a pseudo random order before they are allocated again,
+ * which leaves heap_4 with a free list of many small blocks to walk.  The pool is also timed from a simulated interrupt, where heap_4 cannot
+ * be used.  The host executes the pool's compare and swap as a locked
+ * instruction, and the simulator's critical sections are function calls, so
+ * the times are only useful for comparing the two on the host.
+ *
+ * RAM: the memory used to hold benchLIVE_BLOCKS blocks.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "cmsis_os2.h"
+#include "freertos_mpool.h"
+#include "host_support.h"
+
+#define benchBLOCK_SIZE		( 24UL )
+#define benchLIVE_BLOCKS	( 64UL )
+#define benchPAIRS			( 2000000UL )
+#define benchISR_PAIRS		( 1000UL )
+
+/*-----------------------------------------------------------*/
+
+/* An allocator under test. */
+typedef struct BenchAllocator
+{
+	const char *pcName;
+	void *( *pvAlloc )( void );
+	void ( *vFree )( void *pvBlock );
+} BenchAllocator_t;
+
+static osMemoryPoolId_t xPool = NULL;
+static void *pvBlocks[ benchLIVE_BLOCKS ];
+static uint32_t ulISRFailures = 0;
+
+/*-----------------------------------------------------------*/
+
+static void *prvPoolAlloc( void )
+{
+	return osMemoryPoolAlloc( xPool, 0U );
+}
+
+static void prvPoolFree( void *pvBlock )
+{
+	configASSERT( osMemoryPoolFree( xPool, pvBlock ) == osOK );
+}
+
+static void *prvHeapAlloc( void )
+{
+	return pvPortMalloc( benchBLOCK_SIZE );
+}
+
+static void prvHeapFree( void *pvBlock )
+{
+	vPortFree( pvBlock );
+}
+/*-----------------------------------------------------------*/
+
+/* Returns the next value of a fixed sequence, so every run frees blocks in the
+same order. */
+static uint32_t prvNextRandom( void )
+{
+static uint32_t ulState = 1UL;
+
+	ulState = ( ulState * 1664525UL ) + 1013904223UL;
+	return ulState >> 8;
+}
+/*-----------------------------------------------------------*/
+
+static void prvMeasure( const BenchAllocator_t *pxAllocator )
+{
+uint64_t ullStart, ullLIFO, ullScattered;
+uint32_t ul, ulSlot, ulPairs = 0;
+
+	/* Each block is freed before the next is allocated. */
+	ullStart = ullHostGetNanoseconds();
+
+	for( ul = 0; ul < benchPAIRS; ul++ )
+	{
+		pvBlocks[ 0 ] = pxAllocator->pvAlloc();
+		configASSERT( pvBlocks[ 0 ] );
+		pxAllocator->vFree( pvBlocks[ 0 ] );
+	}
+
+	ullLIFO = ullHostGetNanoseconds() - ullStart;
+
+	/* benchLIVE_BLOCKS blocks are held.  On each pass up to half of them,
+	chosen at random, are freed, then every free slot is refilled. */
+	for( ul = 0; ul < benchLIVE_BLOCKS; ul++ )
+	{
+		pvBlocks[ ul ] = pxAllocator->pvAlloc();
+		configASSERT( pvBlocks[ ul ] );
+	}
+
+	ullStart = ullHostGetNanoseconds();
+
+	while( ulPairs < benchPAIRS )
+	{
+		for( ul = 0; ul < ( benchLIVE_BLOCKS / 2UL ); ul++ )
+		{
+			ulSlot = prvNextRandom() % benchLIVE_BLOCKS;
+
+			if( pvBlocks[ ulSlot ] != NULL )
+			{
+				pxAllocator->vFree( pvBlocks[ ulSlot ] );
+				pvBlocks[ ulSlot ] = NULL;
+			}
+		}
+
+		for( ul = 0; ul < benchLIVE_BLOCKS; ul++ )
+		{
+			if( pvBlocks[ ul ] == NULL )
+			{
+				pvBlocks[ ul ] = pxAllocator->pvAlloc();
+				configASSERT( pvBlocks[ ul ] );
+				ulPairs++;
+			}
+		}
+	}
+
+	ullScattered = ullHostGetNanoseconds() - ullStart;
+
+	for( ul = 0; ul < benchLIVE_BLOCKS; ul++ )
+	{
+		pxAllocator->vFree( pvBlocks[ ul ] );
+	}
+
+	printf( "  %-32s %6.1f ns  %6.1f ns\n", pxAllocator->pcName, ( double ) ullLIFO / ( double ) benchPAIRS, ( double ) ullScattered / ( double ) ulPairs );
+}
+/*-----------------------------------------------------------*/
+
+static void prvPoolInterrupt( void )
+{
+uint32_t ul;
+void *pvBlock;
+
+	for( ul = 0; ul < benchISR_PAIRS; ul++ )
+	{
+		pvBlock = osMemoryPoolAlloc( xPool, 0U );
+
+		if( ( pvBlock == NULL ) || ( osMemoryPoolFree( xPool, pvBlock ) != osOK ) )
+		{
+			ulISRFailures++;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchmark( void )
+{
+static const BenchAllocator_t xPoolAllocator = { "osMemoryPoolAlloc/Free", prvPoolAlloc, prvPoolFree };
+static const BenchAllocator_t xHeapAllocator = { "pvPortMalloc/vPortFree (heap_4)", prvHeapAlloc, prvHeapFree };
+size_t xHeapBefore, xHeapUsed;
+size_t xPoolBefore, xPoolUsed;
+uint64_t ullStart, ullTime;
+uint32_t ul;
+
+	/* The pool and its control block are allocated from the FreeRTOS heap. */
+	xPoolBefore = xPortGetFreeHeapSize();
+	xPool = osMemoryPoolNew( benchLIVE_BLOCKS, benchBLOCK_SIZE, NULL );
+	configASSERT( xPool );
+	xPoolUsed = xPoolBefore - xPortGetFreeHeapSize();
+
+	printf( "Allocate and free, %lu byte blocks:   freed at once  %lu live, freed at random\n", benchBLOCK_SIZE, benchLIVE_BLOCKS );
+	prvMeasure( &xPoolAllocator );
+
+	xHeapBefore = xPortGetFreeHeapSize();
+	prvMeasure( &xHeapAllocator );
+	hostCHECK( xPortGetFreeHeapSize() == xHeapBefore );
+	hostCHECK( osMemoryPoolGetCount( xPool ) == 0U );
+
+	/* The pool from an interrupt.  Includes the cost of entering the simulated
+	interrupt once. */
+	ullStart = ullHostGetNanoseconds();
+	vPortSimulateInterrupt( prvPoolInterrupt );
+	ullTime = ullHostGetNanoseconds() - ullStart;
+	printf( "  %-32s %6.1f ns  (heap_4 cannot be called from an interrupt)\n", "osMemoryPoolAlloc/Free from ISR", ( double ) ullTime / ( double ) benchISR_PAIRS );
+	hostCHECK( ulISRFailures == 0 );
+
+	/* RAM used to hold benchLIVE_BLOCKS blocks. */
+	for( ul = 0; ul < benchLIVE_BLOCKS; ul++ )
+	{
+		pvBlocks[ ul ] = pvPortMalloc( benchBLOCK_SIZE );
+		configASSERT( pvBlocks[ ul ] );
+	}
+
+	xHeapUsed = xHeapBefore - xPortGetFreeHeapSize();
+
+	for( ul = 0; ul < benchLIVE_BLOCKS; ul++ )
+	{
+		vPortFree( pvBlocks[ ul ] );
+	}
+
+	printf( "RAM for %lu blocks of %lu bytes:\n", benchLIVE_BLOCKS, benchBLOCK_SIZE );
+	printf( "  %-32s %6lu bytes (%lu control block, %lu blocks)\n", "memory pool", ( unsigned long ) xPoolUsed, ( unsigned long ) MEMPOOL_CB_SIZE, ( unsigned long ) MEMPOOL_ARR_SIZE( benchLIVE_BLOCKS, benchBLOCK_SIZE ) );
+	printf( "  %-32s %6lu bytes\n", "heap_4", ( unsigned long ) xHeapUsed );
+
+	configASSERT( osMemoryPoolDelete( xPool ) == osOK );
+	hostCHECK( xPortGetFreeHeapSize() == xPoolBefore );
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+	return iHostRunTest( prvBenchmark, tskIDLE_PRIORITY + 1 );
+}
@@ -0,0 +1,249 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * Tests the parallel loops in parallel_for.c on the host simulator.  The
+ * worker tasks have the same priority as the test task, and the loop bodies
+ * yield, so the workers steal ranges from the test task and from each other.
+ *
+ * + Every iteration of a loop is executed exactly once, for grains from 1 to
+ *   more than the number of iterations, and for a range that does not start
+ *   at 0.
+ *
+ * + A reduction gives the same result, to the bit, as a serial sum of the
+ *   same chunks in chunk order, whichever tasks executed the chunks.
+ *
+ * + A loop started from a loop body is executed serially.
+ *
+ * Build the kernel objects and the test with -DconfigPARALLEL_FOR_WORKERS=0,
+ * 1 or 3 (the default) to test each number of workers.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <string.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "parallel_for.h"
+
+#include "host_support.h"
+
+#define testITERATIONS		( 1000UL )
+#define testFIRST			( 24UL )
+#define testMAX_TASKS		( 8U )
+
+/*-----------------------------------------------------------*/
+
+/* Iterations per grain size tested. */
+static const uint32_t ulGrains[] = { 0UL, 1UL, 3UL, 7UL, 64UL, 333UL, testITERATIONS, testITERATIONS + 5UL };
+
+static uint8_t ucHits[ testITERATIONS ];
+static float fData[ testITERATIONS ];
+static float fPartials[ testITERATIONS ];
+
+/* The tasks that executed a loop body. */
+static TaskHandle_t xTasks[ testMAX_TASKS ];
+static UBaseType_t uxTasks = 0;
+
+/*-----------------------------------------------------------*/
+
+static void prvRecordTask( void )
+{
+TaskHandle_t xTask = xTaskGetCurrentTaskHandle();
+UBaseType_t ux;
+
+	for( ux = 0; ux < uxTasks; ux++ )
+	{
+		if( xTasks[ ux ] == xTask )
+		{
+			return;
+		}
+	}
+
+	configASSERT( uxTasks < testMAX_TASKS );
+	xTasks[ uxTasks ] = xTask;
+	uxTasks++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCount( void *pvContext, uint32_t ulBegin, uint32_t ulEnd )
+{
+uint32_t ul;
+
+	( void ) pvContext;
+	prvRecordTask();
+
+	for( ul = ulBegin; ul < ulEnd; ul++ )
+	{
+		ucHits[ ul ]++;
+	}
+
+	/* Let the other participants run. */
+	taskYIELD();
+}
+/*-----------------------------------------------------------*/
+
+static void prvSum( void *pvContext, uint32_t ulBegin, uint32_t ulEnd, void *pvAccumulator )
+{
+float *pfSum = ( float * ) pvAccumulator;
+uint32_t ul;
+
+	prvRecordTask();
+
+	for( ul = ulBegin; ul < ulEnd; ul++ )
+	{
+		*pfSum += fData[ ul ];
+	}
+
+	if( pvContext != NULL )
+	{
+		taskYIELD();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvCombine( void *pvContext, void *pvResult, const void *pvPartial )
+{
+	( void ) pvContext;
+	*( float * ) pvResult += *( const float * ) pvPartial;
+}
+/*-----------------------------------------------------------*/
+
+static void prvNested( void *pvContext, uint32_t ulBegin, uint32_t ulEnd )
+{
+	( void ) pvContext;
+	vParallelFor( ulBegin, ulEnd, 1UL, prvCount, NULL );
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvEachHitOnce( uint32_t ulBegin, uint32_t ulEnd )
+{
+uint32_t ul;
+BaseType_t xReturn = pdTRUE;
+
+	for( ul = 0; ul < testITERATIONS; ul++ )
+	{
+		if( ucHits[ ul ] != ( ( ( ul >= ulBegin ) && ( ul < ulEnd ) ) ? 1U : 0U ) )
+		{
+			xReturn = pdFALSE;
+		}
+	}
+
+	memset( ucHits, 0, sizeof( ucHits ) );
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestParallelFor( void )
+{
+size_t x;
+
+	for( x = 0; x < ( sizeof( ulGrains ) / sizeof( ulGrains[ 0 ] ) ); x++ )
+	{
+		uxTasks = 0;
+		vParallelFor( 0UL, testITERATIONS, ulGrains[ x ], prvCount, NULL );
+		hostCHECK( prvEachHitOnce( 0UL, testITERATIONS ) );
+
+		/* The workers took part if the range was split. */
+		if( ( configPARALLEL_FOR_WORKERS > 0 ) && ( ulGrains[ x ] > 0UL ) && ( ulGrains[ x ] < 100UL ) )
+		{
+			hostCHECK( uxTasks == ( UBaseType_t ) configPARALLEL_FOR_WORKERS + 1U );
+		}
+
+		vParallelFor( testFIRST, testITERATIONS - 1UL, ulGrains[ x ], prvCount, NULL );
+		hostCHECK( prvEachHitOnce( testFIRST, testITERATIONS - 1UL ) );
+	}
+
+	/* An empty range. */
+	vParallelFor( testFIRST, testFIRST, 1UL, prvCount, NULL );
+	hostCHECK( prvEachHitOnce( 0UL, 0UL ) );
+
+	/* Only the task that executes the outer body executes the inner loop. */
+	vParallelFor( 0UL, testITERATIONS, 100UL, prvNested, NULL );
+	hostCHECK( prvEachHitOnce( 0UL, testITERATIONS ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestParallelReduce( void )
+{
+size_t x;
+uint32_t ul, ulGrain;
+float fExpected, fChunk, fResult;
+BaseType_t xYield = pdTRUE;
+
+	/* Values of very different magnitudes, so the sum depends on the order in
+	which they are added. */
+	for( ul = 0; ul < testITERATIONS; ul++ )
+	{
+		fData[ ul ] = ( ( ul % 3UL ) == 0UL ) ? ( 1.0e7f / ( float ) ( ul + 1UL ) ) : ( 0.1f * ( float ) ul );
+	}
+
+	for( x = 0; x < ( sizeof( ulGrains ) / sizeof( ulGrains[ 0 ] ) ); x++ )
+	{
+		ulGrain = parallelforGRAIN( ulGrains[ x ] );
+		configASSERT( parallelforREDUCE_PARTIALS_SIZE( sizeof( float ), testITERATIONS - testFIRST, ulGrain ) <= sizeof( fPartials ) );
+
+		/* The partial result of each chunk, added up in chunk order. */
+		fExpected = 0.0f;
+
+		for( ul = testFIRST; ul < testITERATIONS; ul += ulGrain )
+		{
+			fChunk = 0.0f;
+			prvSum( NULL, ul, ( ( testITERATIONS - ul ) < ulGrain ) ? testITERATIONS : ( ul + ulGrain ), &fChunk );
+			fExpected += fChunk;
+		}
+
+		/* With and without yields in the body, which changes which tasks
+		execute which chunks. */
+		for( xYield = pdFALSE; xYield <= pdTRUE; xYield++ )
+		{
+			fResult = 0.0f;
+			vParallelReduce( testFIRST, testITERATIONS, ulGrains[ x ], prvSum, prvCombine, ( xYield != pdFALSE ) ? ( void * ) &xYield : NULL, &fResult, fPartials, sizeof( float ) );
+			hostCHECK( memcmp( &fResult, &fExpected, sizeof( float ) ) == 0 );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvTest( void )
+{
+	configASSERT( xParallelForInit() == pdPASS );
+
+	prvTestParallelFor();
+	prvTestParallelReduce();
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+int iReturn = iHostRunTest( prvTest, configPARALLEL_FOR_WORKER_PRIORITY );
+
+	printf( "parallel_for_test: %s\n", ( iReturn == 0 ) ? "PASS" : "FAIL" );
+	return iReturn;
+}
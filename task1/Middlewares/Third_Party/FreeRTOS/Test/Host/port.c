@@ -0,0 +1,325 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*-----------------------------------------------------------
+ * Implementation of functions defined in portable.h for the host simulator.
+ *----------------------------------------------------------*/
+
+#include <stdlib.h>
+#include <ucontext.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* The size of the host stack each task executes on.  The FreeRTOS stack of a
+task only holds its simulator context, so configMINIMAL_STACK_SIZE only has to
+be large enough for that. */
+#ifndef configSIMULATOR_HOST_STACK_SIZE
+	#define configSIMULATOR_HOST_STACK_SIZE	( ( size_t ) 256U * 1024U )
+#endif
+
+/* The state of a task that is not running. */
+typedef struct SimulatorContext
+{
+	ucontext_t xContext;
+	void *pvHostStack;
+	TaskFunction_t pxCode;
+	void *pvParameters;
+} SimulatorContext_t;
+
+/* The first member of a TCB is pxTopOfStack, which pxPortInitialiseStack()
+sets to the task's context. */
+extern void * volatile pxCurrentTCB;
+#define portCURRENT_CONTEXT()	( *( ( SimulatorContext_t ** ) pxCurrentTCB ) )
+
+/*
+ * The entry point of every task.  Calls the task function.
+ */
+static void prvTaskEntry( void );
+
+/*
+ * Runs a simulated interrupt handler.
+ */
+static void prvRunInterrupt( void ( *pxHandler )( void ) );
+
+/*
+ * Runs the pending interrupt, then performs the pending context switch, if
+ * interrupts are not masked.
+ */
+static void prvServicePending( void );
+
+/*
+ * Selects the task to run and switches to its context.
+ */
+static void prvSwitchContext( void );
+
+/*
+ * The simulated tick interrupt handler.
+ */
+static void prvTickInterrupt( void );
+
+/*-----------------------------------------------------------*/
+
+void ( *pxPortSpinWaitHook )( void ) = NULL;
+
+/* The context xPortStartScheduler() returns to when the scheduler ends. */
+static ucontext_t xSchedulerContext;
+
+/* Each critical section nesting level, as for the Cortex-M ports. */
+static UBaseType_t uxCriticalNesting = 0;
+
+/* Non zero when interrupts are masked, which is the BASEPRI register of the
+Cortex-M ports. */
+static UBaseType_t uxInterruptMask = 0;
+
+static BaseType_t xInInterrupt = pdFALSE;
+static BaseType_t xSchedulerStarted = pdFALSE;
+
+/* The context switch or interrupt that is waiting for interrupts to be
+unmasked, as a pending PendSV or IRQ would. */
+static BaseType_t xYieldPending = pdFALSE;
+static void ( *pxPendingInterrupt )( void ) = NULL;
+
+static uint32_t ulContextSwitches = 0;
+
+/*-----------------------------------------------------------*/
+
+StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters )
+{
+SimulatorContext_t *pxContext;
+
+	/* The context is kept at the top of the FreeRTOS stack.  The stack depth
+	must be at least sizeof( SimulatorContext_t ) bytes. */
+	pxContext = ( SimulatorContext_t * ) ( ( ( portPOINTER_SIZE_TYPE ) ( pxTopOfStack + 1 ) - sizeof( SimulatorContext_t ) ) & ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) );
+
+	pxContext->pvHostStack = malloc( configSIMULATOR_HOST_STACK_SIZE );
+	configASSERT( pxContext->pvHostStack );
+	pxContext->pxCode = pxCode;
+	pxContext->pvParameters = pvParameters;
+
+	( void ) getcontext( &( pxContext->xContext ) );
+	pxContext->xContext.uc_stack.ss_sp = pxContext->pvHostStack;
+	pxContext->xContext.uc_stack.ss_size = configSIMULATOR_HOST_STACK_SIZE;
+	pxContext->xContext.uc_link = NULL;
+	makecontext( &( pxContext->xContext ), prvTaskEntry, 0 );
+
+	return ( StackType_t * ) pxContext;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTaskEntry( void )
+{
+SimulatorContext_t * const pxContext = portCURRENT_CONTEXT();
+
+	pxContext->pxCode( pxContext->pvParameters );
+
+	/* A task must not return from its implementing function. */
+	configASSERT( pdFALSE );
+	vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortCleanUpTCB( void *pvTCB )
+{
+SimulatorContext_t * const pxContext = *( ( SimulatorContext_t ** ) pvTCB );
+
+	/* A task that deletes itself is cleaned up by the idle task, so this never
+	frees the stack it is executing on. */
+	free( pxContext->pvHostStack );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortStartScheduler( void )
+{
+	/* The first task starts with interrupts unmasked. */
+	uxCriticalNesting = 0;
+	uxInterruptMask = 0;
+	xYieldPending = pdFALSE;
+	xSchedulerStarted = pdTRUE;
+
+	( void ) swapcontext( &xSchedulerContext, &( portCURRENT_CONTEXT()->xContext ) );
+
+	/* vPortEndScheduler() was called. */
+	xSchedulerStarted = pdFALSE;
+	return 0;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+	/* The tasks' host stacks are not freed, as the scheduler cannot be
+	restarted. */
+	( void ) setcontext( &xSchedulerContext );
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+	xYieldPending = pdTRUE;
+	prvServicePending();
+}
+/*-----------------------------------------------------------*/
+
+void vPortYieldFromISR( void )
+{
+	/* Performed when the interrupt handler returns. */
+	xYieldPending = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+	( void ) uxPortSetInterruptMask();
+	uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+	configASSERT( uxCriticalNesting );
+	uxCriticalNesting--;
+
+	if( uxCriticalNesting == 0 )
+	{
+		vPortClearInterruptMask( 0 );
+	}
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxPortSetInterruptMask( void )
+{
+UBaseType_t uxReturn = uxInterruptMask;
+
+	uxInterruptMask = 1;
+	return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortClearInterruptMask( UBaseType_t uxNewMaskValue )
+{
+	uxInterruptMask = uxNewMaskValue;
+	prvServicePending();
+}
+/*-----------------------------------------------------------*/
+
+void vPortSimulateInterrupt( void ( *pxHandler )( void ) )
+{
+	configASSERT( pxHandler );
+
+	if( ( uxInterruptMask != 0 ) || ( xInInterrupt != pdFALSE ) )
+	{
+		/* Taken when interrupts are unmasked.  Simulated interrupts do not
+		nest. */
+		configASSERT( ( pxPendingInterrupt == NULL ) || ( pxPendingInterrupt == pxHandler ) );
+		pxPendingInterrupt = pxHandler;
+	}
+	else
+	{
+		prvRunInterrupt( pxHandler );
+		prvServicePending();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortSimulateTick( void )
+{
+	vPortSimulateInterrupt( prvTickInterrupt );
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulPortGetContextSwitchCount( void )
+{
+	return ulContextSwitches;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortIsInsideInterrupt( void )
+{
+	return xInInterrupt;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRunInterrupt( void ( *pxHandler )( void ) )
+{
+	xInInterrupt = pdTRUE;
+	pxHandler();
+	xInInterrupt = pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvServicePending( void )
+{
+void ( *pxHandler )( void );
+
+	if( ( uxInterruptMask == 0 ) && ( xInInterrupt == pdFALSE ) )
+	{
+		while( pxPendingInterrupt != NULL )
+		{
+			pxHandler = pxPendingInterrupt;
+			pxPendingInterrupt = NULL;
+			prvRunInterrupt( pxHandler );
+		}
+
+		if( ( xYieldPending != pdFALSE ) && ( xSchedulerStarted != pdFALSE ) )
+		{
+			prvSwitchContext();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchContext( void )
+{
+SimulatorContext_t * const pxFrom = portCURRENT_CONTEXT();
+SimulatorContext_t *pxTo;
+
+	xYieldPending = pdFALSE;
+	vTaskSwitchContext();
+	pxTo = portCURRENT_CONTEXT();
+
+	if( pxTo != pxFrom )
+	{
+		ulContextSwitches++;
+		( void ) swapcontext( &( pxFrom->xContext ), &( pxTo->xContext ) );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvTickInterrupt( void )
+{
+UBaseType_t uxSavedInterruptStatus;
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		if( xTaskIncrementTick() != pdFALSE )
+		{
+			vPortYieldFromISR();
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
@@ -0,0 +1,157 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*-----------------------------------------------------------
+ * Port specific definitions for the host simulator.
+ *
+ * The simulator runs the kernel in a single thread of a host process, so
+ * kernel code can be tested and benchmarked without the target hardware.
+ * Each task runs on its own ucontext, and a context switch is a
+ * swapcontext() call.  There are no asynchronous interrupts.  The idle hook
+ * simulates the tick interrupt by calling vPortSimulateTick(), so time only
+ * passes when every other task is blocked, and other interrupts are simulated
+ * by calling vPortSimulateInterrupt() from a task.  The order in which tasks
+ * execute does not depend on the speed or load of the host.
+ *-----------------------------------------------------------
+ */
+
+#include <stdint.h>
+
+/* Type definitions. */
+#define portCHAR		char
+#define portFLOAT		float
+#define portDOUBLE		double
+#define portLONG		long
+#define portSHORT		short
+#define portSTACK_TYPE	uintptr_t
+#define portBASE_TYPE	long
+
+typedef portSTACK_TYPE StackType_t;
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+
+#if( configUSE_16_BIT_TICKS == 1 )
+	typedef uint16_t TickType_t;
+	#define portMAX_DELAY ( TickType_t ) 0xffff
+#else
+	typedef uint32_t TickType_t;
+	#define portMAX_DELAY ( TickType_t ) 0xffffffffUL
+	#define portTICK_TYPE_IS_ATOMIC 1
+#endif
+
+#define portPOINTER_SIZE_TYPE	uintptr_t
+/*-----------------------------------------------------------*/
+
+/* Architecture specifics. */
+#define portSTACK_GROWTH			( -1 )
+#define portTICK_PERIOD_MS			( ( TickType_t ) 1000 / configTICK_RATE_HZ )
+#define portBYTE_ALIGNMENT			16
+#define portNOP()
+#define portINLINE					__inline
+#define portFORCE_INLINE			inline __attribute__( ( always_inline ) )
+/*-----------------------------------------------------------*/
+
+/* Scheduler utilities.  A yield requested while interrupts are masked, or from
+an interrupt, is held pending until interrupts are unmasked, as a PendSV
+would be. */
+extern void vPortYield( void );
+extern void vPortYieldFromISR( void );
+
+#define portYIELD()									vPortYield()
+#define portEND_SWITCHING_ISR( xSwitchRequired )	if( xSwitchRequired != pdFALSE ) vPortYieldFromISR()
+#define portYIELD_FROM_ISR( x )						portEND_SWITCHING_ISR( x )
+/*-----------------------------------------------------------*/
+
+/* Critical section management.  Masking interrupts only defers simulated
+interrupts, as nothing else can interrupt a task. */
+extern void vPortEnterCritical( void );
+extern void vPortExitCritical( void );
+extern UBaseType_t uxPortSetInterruptMask( void );
+extern void vPortClearInterruptMask( UBaseType_t uxNewMaskValue );
+
+#define portDISABLE_INTERRUPTS()				( void ) uxPortSetInterruptMask()
+#define portENABLE_INTERRUPTS()					vPortClearInterruptMask( 0 )
+#define portENTER_CRITICAL()					vPortEnterCritical()
+#define portEXIT_CRITICAL()						vPortExitCritical()
+#define portSET_INTERRUPT_MASK_FROM_ISR()		uxPortSetInterruptMask()
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR( x )	vPortClearInterruptMask( x )
+/*-----------------------------------------------------------*/
+
+/* Task function macros as described on the FreeRTOS.org WEB site. */
+#define portTASK_FUNCTION_PROTO( vFunction, pvParameters ) void vFunction( void *pvParameters )
+#define portTASK_FUNCTION( vFunction, pvParameters ) void vFunction( void *pvParameters )
+/*-----------------------------------------------------------*/
+
+/* Each task executes on a host stack that is allocated when the task is
+created, and freed here when the task is deleted. */
+extern void vPortCleanUpTCB( void *pvTCB );
+#define portCLEAN_UP_TCB( pxTCB )	vPortCleanUpTCB( pxTCB )
+/*-----------------------------------------------------------*/
+
+/* Called on each pass of a spin wait loop.  The hook lets a test simulate the
+interrupt or the other core that ends the wait. */
+extern void ( *pxPortSpinWaitHook )( void );
+#define portSPIN_WAIT_HINT()	if( pxPortSpinWaitHook != NULL ) pxPortSpinWaitHook()
+/*-----------------------------------------------------------*/
+
+#define portATOMIC_COMPARE_AND_SWAP_U32( pulDestination, ulExchange, ulComparand ) ( __sync_bool_compare_and_swap( ( pulDestination ), ( ulComparand ), ( ulExchange ) ) ? 1UL : 0UL )
+#define portMEMORY_BARRIER() __sync_synchronize()
+/*-----------------------------------------------------------*/
+
+/* Simulator services. */
+
+/*
+ * Executes pxHandler as an interrupt handler, which can call the FromISR API
+ * functions and portYIELD_FROM_ISR().  If interrupts are masked the handler
+ * executes when they are unmasked.  Only one masked interrupt can be pending.
+ */
+extern void vPortSimulateInterrupt( void ( *pxHandler )( void ) );
+
+/*
+ * Executes the tick interrupt.
+ */
+extern void vPortSimulateTick( void );
+
+/* The number of context switches performed since the scheduler started. */
+extern uint32_t ulPortGetContextSwitchCount( void );
+
+/* pdTRUE while a simulated interrupt handler is executing. */
+extern BaseType_t xPortIsInsideInterrupt( void );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PORTMACRO_H */
@@ -0,0 +1,136 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * Tests xQueueReset() on plain queues and on queue sets on the host simulator.
+ * Resetting a queue set clears the bitmap that follows its member pointers,
+ * which must not happen for any other queue, as a plain queue's storage area
+ * can be smaller than that bitmap would be.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <string.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+#include "host_support.h"
+
+#define testQUEUE_LENGTH	( 8U )
+#define testGUARD_BYTES		( 64U )
+#define testGUARD_VALUE		( 0xA5U )
+
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvGuardIntact( const uint8_t *pucGuard )
+{
+size_t x;
+
+	for( x = 0; x < testGUARD_BYTES; x++ )
+	{
+		if( pucGuard[ x ] != ( uint8_t ) testGUARD_VALUE )
+		{
+			return pdFALSE;
+		}
+	}
+
+	return pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+/* A queue of single bytes has a storage area smaller than the bitmap of a
+queue set of the same length. */
+static void prvTestPlainQueue( void )
+{
+static StaticQueue_t xQueueBuffer;
+static uint8_t ucMemory[ testQUEUE_LENGTH + testGUARD_BYTES ];
+QueueHandle_t xQueue;
+uint8_t ucItem;
+
+	memset( ucMemory, testGUARD_VALUE, sizeof( ucMemory ) );
+	xQueue = xQueueCreateStatic( testQUEUE_LENGTH, sizeof( uint8_t ), ucMemory, &xQueueBuffer );
+	configASSERT( xQueue );
+
+	for( ucItem = 0; ucItem < 3U; ucItem++ )
+	{
+		configASSERT( xQueueSend( xQueue, &ucItem, 0 ) == pdPASS );
+	}
+
+	( void ) xQueueReset( xQueue );
+	hostCHECK( uxQueueMessagesWaiting( xQueue ) == 0U );
+	hostCHECK( prvGuardIntact( &( ucMemory[ testQUEUE_LENGTH ] ) ) != pdFALSE );
+
+	/* The queue still works after the reset. */
+	ucItem = 7U;
+	configASSERT( xQueueSend( xQueue, &ucItem, 0 ) == pdPASS );
+	ucItem = 0U;
+	hostCHECK( ( xQueueReceive( xQueue, &ucItem, 0 ) == pdPASS ) && ( ucItem == 7U ) );
+	hostCHECK( prvGuardIntact( &( ucMemory[ testQUEUE_LENGTH ] ) ) != pdFALSE );
+
+	vQueueDelete( xQueue );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestQueueSet( void )
+{
+QueueSetHandle_t xSet;
+QueueHandle_t xMember;
+uint32_t ulItem = 1UL;
+
+	xSet = xQueueCreateSet( 2 );
+	xMember = xQueueCreate( 2, sizeof( uint32_t ) );
+	configASSERT( xSet && xMember );
+	configASSERT( xQueueAddToSet( xMember, xSet ) == pdPASS );
+
+	configASSERT( xQueueSend( xMember, &ulItem, 0 ) == pdPASS );
+	( void ) xQueueReset( xSet );
+
+	/* The reset discards the pending event, but the member stays in the set
+	and becomes ready again when data is next sent to it. */
+	hostCHECK( xQueueSelectFromSet( xSet, 0 ) == NULL );
+	configASSERT( xQueueSend( xMember, &ulItem, 0 ) == pdPASS );
+	hostCHECK( xQueueSelectFromSet( xSet, 0 ) == xMember );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTest( void )
+{
+	prvTestPlainQueue();
+	prvTestQueueSet();
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+int iReturn = iHostRunTest( prvTest, tskIDLE_PRIORITY + 1 );
+
+	printf( "queue_reset_test: %s\n", ( iReturn == 0 ) ? "PASS" : "FAIL" );
+	return iReturn;
+}
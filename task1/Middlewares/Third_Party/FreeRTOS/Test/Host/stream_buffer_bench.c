@@ -0,0 +1,262 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * Compares the throughput of the copy based stream buffer API
+ * (xStreamBufferSend() and xStreamBufferReceive()) with the gather and scatter
+ * API (xStreamBufferSendV() and xStreamBufferReceiveV()) and the zero copy API
+ * (xStreamBufferWriteReserve(), xStreamBufferReadReserve() and the commit
+ * functions), for chunks of 16 to 4096 bytes, on the host simulator.
+ *
+ * Each chunk is an 8 byte header followed by a payload that the writer
+ * generates, and the reader adds up every byte of the chunk.
+ *
+ * + Copy: the writer generates the payload into a staging buffer after the
+ *   header and sends the staging buffer.  The reader receives into a local
+ *   buffer.
+ * + Gather and scatter: the writer generates the payload into its own buffer
+ *   and sends the header and the payload as two segments.  The reader receives
+ *   into a header buffer and a payload buffer.
+ * + Zero copy: the writer generates the header and payload straight into the
+ *   stream buffer, and the reader adds up the bytes where they are.
+ *
+ * The writer and reader are the same task, so no context switches are
+ * included, and the stream buffer is larger than the largest chunk so its
+ * storage area wraps regularly.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <string.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "stream_buffer.h"
+
+#include "host_support.h"
+
+#define benchBUFFER_SIZE		( 6000UL )
+#define benchHEADER_SIZE		( 8UL )
+#define benchMAX_CHUNK_SIZE		( 4096UL )
+#define benchBYTES_PER_RUN		( 4UL * 1024UL * 1024UL )
+#define benchRUNS				( 15UL )
+#define benchMETHODS			( 3U )
+
+/*-----------------------------------------------------------*/
+
+static StreamBufferHandle_t xStreamBuffer = NULL;
+
+/* The header of the chunk being written. */
+static uint8_t ucHeader[ benchHEADER_SIZE ];
+
+/* Writer and reader buffers for the copy and the gather and scatter tests. */
+static uint8_t ucStaging[ benchMAX_CHUNK_SIZE ];
+static uint8_t ucPayload[ benchMAX_CHUNK_SIZE ];
+static uint8_t ucReceived[ benchMAX_CHUNK_SIZE ];
+
+/*-----------------------------------------------------------*/
+
+static void prvGenerate( uint8_t *pucDestination, size_t xLength, uint32_t ulSeed )
+{
+size_t x;
+
+	for( x = 0; x < xLength; x++ )
+	{
+		pucDestination[ x ] = ( uint8_t ) ( ulSeed + ( uint32_t ) x );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvSum( const uint8_t *pucSource, size_t xLength )
+{
+uint32_t ulSum = 0;
+size_t x;
+
+	for( x = 0; x < xLength; x++ )
+	{
+		ulSum += pucSource[ x ];
+	}
+
+	return ulSum;
+}
+/*-----------------------------------------------------------*/
+
+/* Writes one chunk and reads it back.  Returns the sum of its bytes. */
+static uint32_t prvCopy( size_t xChunkSize, uint32_t ulSeed )
+{
+const size_t xPayloadSize = xChunkSize - benchHEADER_SIZE;
+
+	memcpy( ucStaging, ucHeader, benchHEADER_SIZE );
+	prvGenerate( &( ucStaging[ benchHEADER_SIZE ] ), xPayloadSize, ulSeed );
+	configASSERT( xStreamBufferSend( xStreamBuffer, ucStaging, xChunkSize, 0 ) == xChunkSize );
+
+	configASSERT( xStreamBufferReceive( xStreamBuffer, ucReceived, xChunkSize, 0 ) == xChunkSize );
+	return prvSum( ucReceived, xChunkSize );
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvGatherScatter( size_t xChunkSize, uint32_t ulSeed )
+{
+const size_t xPayloadSize = xChunkSize - benchHEADER_SIZE;
+StreamBufferSegment_t xSegments[ 2 ];
+
+	prvGenerate( ucPayload, xPayloadSize, ulSeed );
+	xSegments[ 0 ].pvData = ucHeader;
+	xSegments[ 0 ].xLength = benchHEADER_SIZE;
+	xSegments[ 1 ].pvData = ucPayload;
+	xSegments[ 1 ].xLength = xPayloadSize;
+	configASSERT( xStreamBufferSendV( xStreamBuffer, xSegments, 2, 0 ) == xChunkSize );
+
+	xSegments[ 0 ].pvData = ucStaging;
+	xSegments[ 1 ].pvData = ucReceived;
+	configASSERT( xStreamBufferReceiveV( xStreamBuffer, xSegments, 2, 0 ) == xChunkSize );
+	return prvSum( ucStaging, benchHEADER_SIZE ) + prvSum( ucReceived, xPayloadSize );
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvZeroCopy( size_t xChunkSize, uint32_t ulSeed )
+{
+StreamBufferSegment_t xSegments[ 2 ];
+uint8_t *pucFirst;
+size_t xFirst, xHeaderFirst;
+uint32_t ulSum;
+
+	/* The header and payload may be split across the end of the storage
+	area. */
+	configASSERT( xStreamBufferWriteReserve( xStreamBuffer, xSegments ) >= xChunkSize );
+	pucFirst = ( uint8_t * ) xSegments[ 0 ].pvData;
+	xFirst = ( xSegments[ 0 ].xLength < xChunkSize ) ? xSegments[ 0 ].xLength : xChunkSize;
+	xHeaderFirst = ( xFirst < benchHEADER_SIZE ) ? xFirst : benchHEADER_SIZE;
+
+	memcpy( pucFirst, ucHeader, xHeaderFirst );
+	memcpy( xSegments[ 1 ].pvData, &( ucHeader[ xHeaderFirst ] ), benchHEADER_SIZE - xHeaderFirst );
+
+	if( xFirst > benchHEADER_SIZE )
+	{
+		prvGenerate( &( pucFirst[ benchHEADER_SIZE ] ), xFirst - benchHEADER_SIZE, ulSeed );
+		prvGenerate( ( uint8_t * ) xSegments[ 1 ].pvData, xChunkSize - xFirst, ulSeed + ( uint32_t ) ( xFirst - benchHEADER_SIZE ) );
+	}
+	else
+	{
+		prvGenerate( &( ( ( uint8_t * ) xSegments[ 1 ].pvData )[ benchHEADER_SIZE - xHeaderFirst ] ), xChunkSize - benchHEADER_SIZE, ulSeed );
+	}
+
+	vStreamBufferWriteCommit( xStreamBuffer, xChunkSize );
+
+	configASSERT( xStreamBufferReadReserve( xStreamBuffer, xSegments ) == xChunkSize );
+	ulSum = prvSum( ( uint8_t * ) xSegments[ 0 ].pvData, xSegments[ 0 ].xLength );
+	ulSum += prvSum( ( uint8_t * ) xSegments[ 1 ].pvData, xSegments[ 1 ].xLength );
+	vStreamBufferReadCommit( xStreamBuffer, xChunkSize );
+
+	return ulSum;
+}
+/*-----------------------------------------------------------*/
+
+/* Times ulChunks round trips of xChunkSize bytes, and checks every chunk
+arrived intact. */
+static uint64_t prvTime( uint32_t ( *pxRoundTrip )( size_t, uint32_t ), size_t xChunkSize, uint32_t ulChunks, uint32_t ulExpected )
+{
+uint64_t ullStart;
+uint32_t ul, ulFailures = 0;
+
+	ullStart = ullHostGetNanoseconds();
+
+	for( ul = 0; ul < ulChunks; ul++ )
+	{
+		if( pxRoundTrip( xChunkSize, 0 ) != ulExpected )
+		{
+			ulFailures++;
+		}
+	}
+
+	hostCHECK( ( ulFailures == 0 ) && ( xStreamBufferIsEmpty( xStreamBuffer ) != pdFALSE ) );
+
+	return ullHostGetNanoseconds() - ullStart;
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchmark( void )
+{
+static const size_t xChunkSizes[] = { 16, 64, 256, 1024, 4096 };
+static uint32_t ( * const pxRoundTrips[ benchMETHODS ] )( size_t, uint32_t ) = { prvCopy, prvGatherScatter, prvZeroCopy };
+uint64_t ullBest[ benchMETHODS ], ullTime;
+uint32_t ulChunks, ulExpected, ulRun;
+size_t x, xMethod;
+
+	xStreamBuffer = xStreamBufferCreate( benchBUFFER_SIZE, 1 );
+	configASSERT( xStreamBuffer );
+	prvGenerate( ucHeader, benchHEADER_SIZE, 0xA5UL );
+
+	printf( "Write and read throughput, MB/s:\n" );
+	printf( "  %-6s %10s %16s %10s\n", "chunk", "copy", "gather/scatter", "zero copy" );
+
+	for( x = 0; x < ( sizeof( xChunkSizes ) / sizeof( xChunkSizes[ 0 ] ) ); x++ )
+	{
+		ulChunks = ( uint32_t ) ( benchBYTES_PER_RUN / xChunkSizes[ x ] );
+		ulExpected = prvSum( ucHeader, benchHEADER_SIZE );
+		prvGenerate( ucPayload, xChunkSizes[ x ] - benchHEADER_SIZE, 0 );
+		ulExpected += prvSum( ucPayload, xChunkSizes[ x ] - benchHEADER_SIZE );
+
+		/* The methods take turns, so a slow period on the host affects them
+		all, and the fastest run of each is reported. */
+		for( xMethod = 0; xMethod < benchMETHODS; xMethod++ )
+		{
+			ullBest[ xMethod ] = UINT64_MAX;
+		}
+
+		for( ulRun = 0; ulRun < benchRUNS; ulRun++ )
+		{
+			for( xMethod = 0; xMethod < benchMETHODS; xMethod++ )
+			{
+				ullTime = prvTime( pxRoundTrips[ xMethod ], xChunkSizes[ x ], ulChunks, ulExpected );
+
+				if( ullTime < ullBest[ xMethod ] )
+				{
+					ullBest[ xMethod ] = ullTime;
+				}
+			}
+		}
+
+		printf( "  %-6lu", ( unsigned long ) xChunkSizes[ x ] );
+
+		for( xMethod = 0; xMethod < benchMETHODS; xMethod++ )
+		{
+			printf( " %*.0f", ( xMethod == 1 ) ? 16 : 10, ( ( double ) ulChunks * ( double ) xChunkSizes[ x ] * 1000.0 ) / ( ( double ) ullBest[ xMethod ] * 1.048576 ) );
+		}
+
+		printf( "\n" );
+	}
+
+	vStreamBufferDelete( xStreamBuffer );
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+	return iHostRunTest( prvBenchmark, tskIDLE_PRIORITY + 1 );
+}
@@ -145,6 +145,11 @@ standard names. */
 
 /* USER CODE BEGIN Defines */
 /* Section where parameter definitions can be added (for instance, to override default ones in FreeRTOS.h) */
+/* Index 0 is used by stream buffers and application notifications, index 1
+   by the CMSIS-RTOS2 thread flags. */
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES    2
+/* The LED controller runs as an active object. */
+#define configUSE_ACTIVE_OBJECTS                 1
 /* USER CODE END Defines */
 
 #endif /* FREERTOS_CONFIG_H */
@@ -2,8 +2,8 @@
  * task2, main.c
  * Purpose: create project to demonstrate dynamic memory allocation.
  *
- * There are two tasks in the program. In the first task the data received from the UART is put into the queue.
- * In the second task the data read from the queue is used to control the LED states. As the commands the
+ * In the task the data received from the UART is converted into events that are published to the
+ * LED controller active object, which uses them to control the LED states. As the commands the
  * characters from 'A' to 'H' are used to switch on one of eight LEDs on the board, and the characters
  * from 'a' to 'h' are used to switch off one of eight LEDs. USART2 is used in the program, so
  * it is necessary to use USB-RS232 converter (PA2 = TX, PA3 = RX; 9600 baud, 1 stop bit, 8 data bits, no parity).
@@ -16,6 +16,7 @@
 #include "FreeRTOS.h"
 #include "task.h"
 #include "queue.h"
+#include "active_object.h"
 #include "uart_driver.h"
 
 /*
@@ -37,29 +38,55 @@
 #define TASK_STACK_SIZE 32U
 
 /*
- * The length of the queue used in the program.
+ * The length of the event queue of the LED controller.
  */
 #define QUEUE_LENGTH 4U
 
+/*
+ * The number of events in the event pool and the size of each event in bytes.
+ */
+#define EVENT_POOL_SIZE 4U
+#define EVENT_BLOCK_SIZE 16U
+
+/*
+ * The identifier of the LED controller active object.
+ */
+#define LED_CONTROLLER_ID 0U
+
+/*
+ * The signals of the events published by the receive data task.
+ */
+#define LED_ON_SIG	(aoSIG_USER)
+#define LED_OFF_SIG	(aoSIG_USER + 1U)
+
 /*
  * The number of LEDs on the board.
  */
 #define LEDS_NUM 8
 
+/*
+ * The event that switches a LED on or off. The LED is the index of the element in the led_pins array.
+ */
+typedef struct {
+	AOEvent_t super;
+	uint8_t led;
+} led_event_t;
+
 /*
  * Declaration of the function prototypes.
  */
 void GPIO_Init(void);
 void receive_data_task(void *param);
-void led_controller_task(void *param);
+void publish_led_event(AOSignal_t signal, uint8_t led);
+BaseType_t led_controller_initial(ActiveObject_t *ao, const AOEvent_t *event);
+BaseType_t led_controller_active(ActiveObject_t *ao, const AOEvent_t *event);
 void error_handler(void);
-void change_led_state(int cmd);
+void change_led_state(uint8_t led, GPIO_PinState state);
 
 /*
- * The variables are used to store task handles.
+ * The variable is used to store task handle.
  */
 TaskHandle_t task1_handle;
-TaskHandle_t task2_handle;
 
 /*
  * The array contais pin numbers the LEDs connected to.
@@ -68,14 +95,19 @@ uint16_t led_pins[LEDS_NUM] = {BLUE_LED_1, RED_LED_1, ORANGE_LED_1, GREEN_LED_1,
 															 BLUE_LED_2, RED_LED_2, ORANGE_LED_2, GREEN_LED_2};
 
 /*
- * The variable is used to store queue handle.
+ * The LED controller active object. Its event queue is allocated from the FreeRTOS heap.
+ */
+ActiveObject_t led_controller;
+
+/*
+ * The storage of the event pool the events are allocated from.
  */
-QueueHandle_t queue_handle;
+uint64_t event_pool[EVENT_POOL_SIZE * EVENT_BLOCK_SIZE / sizeof(uint64_t)];
 
 /*
  * The main function of the program (the entry point).
- * Two tasks are created. In the first task the data received from the UART is put into the queue.
- * In the second task the data read from the queue is used to control the LED states. As the commands the
+ * The task is created in which the data received from the UART is converted into the events.
+ * The events are published to the LED controller active object that controls the LED states. As the commands the
  * characters from 'A' to 'H' are used to switch on one of eight LEDs on the board, and the characters
  * from 'a' to 'h' are used to switch off one of eight LEDs.
  */
@@ -92,13 +124,18 @@ int main()
 		error_handler();
 	}
 	
-	result = xTaskCreate(led_controller_task, "LED controller task",  TASK_STACK_SIZE, NULL, 1, &task2_handle);
+	result = xActiveObjectInit();
 	if(result != pdPASS){
 		error_handler();
 	}
 	
-	queue_handle = xQueueCreate(QUEUE_LENGTH, sizeof(int));
-	if(queue_handle == NULL){
+	result = xActiveObjectPoolInit(event_pool, EVENT_BLOCK_SIZE, EVENT_POOL_SIZE);
+	if(result != pdPASS){
+		error_handler();
+	}
+	
+	result = xActiveObjectStart(&led_controller, LED_CONTROLLER_ID, 0U, NULL, QUEUE_LENGTH, led_controller_initial);
+	if(result != pdPASS){
 		error_handler();
 	}
 	
@@ -129,8 +166,9 @@ void GPIO_Init()
 }
 
 /*
- * This is a task function (thread) that reads data received from UART and puts it into the queue.
+ * This is a task function (thread) that reads data received from UART and publishes it as the events.
  * The data is the command: 'a' - 'h' to switch off a LED; 'A' - 'H' to switch on a LED.
+ * Other characters are ignored.
  *
  * @param a value that is passed as the parameter to the created task.
  */
@@ -138,24 +176,72 @@ void receive_data_task(void * param)
 {
 	int cmd;
 	while(1) {
-			cmd=uart_read();
-		  xQueueSend(queue_handle, &cmd,  portMAX_DELAY);
+		cmd = uart_read();
+		if(cmd >= 'a' && cmd <= 'h'){
+			publish_led_event(LED_OFF_SIG, (uint8_t)(cmd - 'a'));
+		} else if(cmd >= 'A' && cmd <= 'H'){
+			publish_led_event(LED_ON_SIG, (uint8_t)(cmd - 'A'));
 		}
+	}
 }
 
 /*
- * This is a task function that gets the data from the queue and changes the LEDs state
- * depending on the data.
+ * The function publishes a LED event to the LED controller. Publishing never blocks, so if the
+ * event pool is empty or the event queue of the LED controller is full, the function waits one
+ * tick and tries again. Like the queue the commands were sent through before, the receive data
+ * task waits while the LED controller is busy, and no command is lost.
  *
- * @param a value that is passed as the parameter to the created task.
+ * @param signal LED_ON_SIG or LED_OFF_SIG.
+ * @param led the number of a LED (0 - 7).
  */
-void led_controller_task(void * param)
+void publish_led_event(AOSignal_t signal, uint8_t led)
 {
-	int cmd;
+	led_event_t *event;
 	while(1) {
-		xQueueReceive(queue_handle, &cmd, portMAX_DELAY);
-		change_led_state(cmd);
+		event = (led_event_t *)pxActiveObjectNewEvent(sizeof(led_event_t), signal);
+		if(event != NULL){
+			event->led = led;
+			/* An event that is not delivered is returned to the pool. */
+			if(uxActiveObjectPublish(&event->super) != 0U){
+				return;
+			}
+		}
+		vTaskDelay(1);
+	}
+}
+
+/*
+ * This is the initial transition of the LED controller. The LED controller subscribes
+ * to the LED events and starts in the active state.
+ *
+ * @param ao the LED controller active object.
+ * @param event the initial event (not used).
+ */
+BaseType_t led_controller_initial(ActiveObject_t *ao, const AOEvent_t *event)
+{
+	vActiveObjectSubscribe(ao, LED_ON_SIG);
+	vActiveObjectSubscribe(ao, LED_OFF_SIG);
+	return aoTRAN(ao, led_controller_active);
+}
+
+/*
+ * This is the state of the LED controller in which the LED events change the LEDs state.
+ * Each event is processed to completion before the next one is taken from the event queue.
+ *
+ * @param ao the LED controller active object.
+ * @param event the event to be processed.
+ */
+BaseType_t led_controller_active(ActiveObject_t *ao, const AOEvent_t *event)
+{
+	switch(event->xSignal){
+		case LED_ON_SIG:
+			change_led_state(((const led_event_t *)event)->led, GPIO_PIN_SET);
+			return aoHANDLED();
+		case LED_OFF_SIG:
+			change_led_state(((const led_event_t *)event)->led, GPIO_PIN_RESET);
+			return aoHANDLED();
 	}
+	return aoSUPER(ao, xActiveObjectTop);
 }
 
 /*
@@ -169,18 +255,15 @@ void error_handler(void)
 }
 
 /*
- * The function changes the LED state (on or off) depending on the command passed into
- * the function as a parameter. The command is the ASCII-code of one of the chars: 'a' - 'h'
- * to switch off a LED; 'A' - 'H' to switch on a LED. The pins the LEDs connected to are in the array,
- * and ASCII-code of a char is used as the index of the element in the array.
+ * The function changes the LED state (on or off). The pins the LEDs connected to are in the array,
+ * and the number of a LED is used as the index of the element in the array.
  * 
- * @param cmd an ASCII-code of a character that is used as a command to control the LED state.
+ * @param led the number of a LED (0 - 7).
+ * @param state GPIO_PIN_SET to switch on the LED; GPIO_PIN_RESET to switch off the LED.
  */
-void change_led_state(int cmd)
+void change_led_state(uint8_t led, GPIO_PinState state)
 {
-	if(cmd >= 'a' && cmd <= 'h'){
-		HAL_GPIO_WritePin(GPIOE, led_pins[cmd-'a'], GPIO_PIN_RESET);
-	} else if(cmd >= 'A' && cmd <= 'H'){
-			HAL_GPIO_WritePin(GPIOE, led_pins[cmd-'A'], GPIO_PIN_SET);
+	if(led < LEDS_NUM){
+		HAL_GPIO_WritePin(GPIOE, led_pins[led], state);
 	}
 }
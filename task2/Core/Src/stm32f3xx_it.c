@@ -49,6 +49,9 @@
 
 /* Private function prototypes -----------------------------------------------*/
 /* USER CODE BEGIN PFP */
+#if (configUSE_MPU_STACK_GUARD == 1)
+extern void vApplicationStackOverflowHook(TaskHandle_t xTask, signed char *pcTaskName);
+#endif
 
 /* USER CODE END PFP */
 
@@ -102,7 +105,23 @@ void HardFault_Handler(void)
 void MemManage_Handler(void)
 {
   /* USER CODE BEGIN MemoryManagement_IRQn 0 */
-
+#if (configUSE_MPU_STACK_GUARD == 1)
+  uint32_t guard;
+  TaskHandle_t task;
+
+  /* The kernel keeps the MPU stack guard region at the end of the running
+     task's stack. A fault while stacking the exception frame, or a data access
+     inside the guard, means that task has overflowed its stack. */
+  MPU->RNR = configMPU_STACK_GUARD_REGION;
+  guard = MPU->RBAR & MPU_RBAR_ADDR_Msk;
+
+  if (((SCB->CFSR & SCB_CFSR_MSTKERR_Msk) != 0U) ||
+      (((SCB->CFSR & SCB_CFSR_MMARVALID_Msk) != 0U) && ((SCB->MMFAR - guard) < portSTACK_GUARD_SIZE)))
+  {
+    task = xTaskGetCurrentTaskHandle();
+    vApplicationStackOverflowHook(task, (signed char *)pcTaskGetName(task));
+  }
+#endif
   /* USER CODE END MemoryManagement_IRQn 0 */
   while (1)
   {
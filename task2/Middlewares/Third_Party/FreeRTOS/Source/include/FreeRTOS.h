@@ -202,6 +202,10 @@ extern "C" {
 	#define configUSE_MUTEXES 0
 #endif
 
+#ifndef configUSE_PRIORITY_CEILING_MUTEXES
+	#define configUSE_PRIORITY_CEILING_MUTEXES 0
+#endif
+
 #ifndef configUSE_TIMERS
 	#define configUSE_TIMERS 0
 #endif
@@ -754,6 +758,40 @@ extern "C" {
 	#define configUSE_QUEUE_SETS 0
 #endif
 
+#ifndef configUSE_ADAPTIVE_SEMAPHORE_SPIN
+	#define configUSE_ADAPTIVE_SEMAPHORE_SPIN 0
+#endif
+
+#ifndef configSEMAPHORE_SPIN_MIN_ITERATIONS
+	#define configSEMAPHORE_SPIN_MIN_ITERATIONS 8
+#endif
+
+#ifndef configSEMAPHORE_SPIN_MAX_ITERATIONS
+	#define configSEMAPHORE_SPIN_MAX_ITERATIONS 512
+#endif
+
+#ifndef portSPIN_WAIT_HINT
+	#define portSPIN_WAIT_HINT()
+#endif
+
+#ifndef configUSE_MPU_STACK_GUARD
+	#define configUSE_MPU_STACK_GUARD 0
+#endif
+
+#ifndef portSETUP_STACK_GUARD
+	#define portSETUP_STACK_GUARD( pxStack )
+#endif
+
+#ifndef portSTACK_GUARD_END
+	#define portSTACK_GUARD_END( pxStack ) ( ( uint8_t * ) ( pxStack ) )
+#endif
+
+#if( ( configUSE_MPU_STACK_GUARD == 1 ) && ( configCHECK_FOR_STACK_OVERFLOW > 1 ) )
+	/* Method 2 reads the first bytes of the outgoing task's stack, which are
+	covered by the guard when the check runs. */
+	#error configCHECK_FOR_STACK_OVERFLOW must be 0 or 1 when configUSE_MPU_STACK_GUARD is 1
+#endif
+
 #ifndef portTASK_USES_FLOATING_POINT
 	#define portTASK_USES_FLOATING_POINT()
 #endif
@@ -806,6 +844,14 @@ extern "C" {
 	#define configUSE_TASK_NOTIFICATIONS 1
 #endif
 
+#ifndef configTASK_NOTIFICATION_ARRAY_ENTRIES
+	#define configTASK_NOTIFICATION_ARRAY_ENTRIES 1
+#endif
+
+#if configTASK_NOTIFICATION_ARRAY_ENTRIES < 1
+	#error configTASK_NOTIFICATION_ARRAY_ENTRIES must be at least 1
+#endif
+
 #ifndef portTICK_TYPE_IS_ATOMIC
 	#define portTICK_TYPE_IS_ATOMIC 0
 #endif
@@ -841,6 +887,283 @@ extern "C" {
 	#error configUSE_MUTEXES must be set to 1 to use recursive mutexes
 #endif
 
+#if( ( configUSE_PRIORITY_CEILING_MUTEXES == 1 ) && ( configUSE_MUTEXES != 1 ) )
+	#error configUSE_MUTEXES must be set to 1 to use priority ceiling mutexes
+#endif
+
+#if( ( configUSE_ADAPTIVE_SEMAPHORE_SPIN == 1 ) && ( configSEMAPHORE_SPIN_MIN_ITERATIONS > configSEMAPHORE_SPIN_MAX_ITERATIONS ) )
+	#error configSEMAPHORE_SPIN_MIN_ITERATIONS must not be greater than configSEMAPHORE_SPIN_MAX_ITERATIONS
+#endif
+
+#ifndef configUSE_DEFERRED_WORK
+	#define configUSE_DEFERRED_WORK 0
+#endif
+
+/* The number of deferred work priority levels, each of which has its own
+ring and worker task. */
+#ifndef configDEFERRED_WORK_LEVELS
+	#define configDEFERRED_WORK_LEVELS 2
+#endif
+
+/* The number of items each ring can hold.  Must be a power of two. */
+#ifndef configDEFERRED_WORK_QUEUE_LENGTH
+	#define configDEFERRED_WORK_QUEUE_LENGTH 32
+#endif
+
+/* The maximum number of items a worker processes before yielding to other
+tasks of equal priority. */
+#ifndef configDEFERRED_WORK_BATCH_SIZE
+	#define configDEFERRED_WORK_BATCH_SIZE 8
+#endif
+
+/* The worker for level n runs at configDEFERRED_WORK_TASK_PRIORITY + n. */
+#ifndef configDEFERRED_WORK_TASK_PRIORITY
+	#define configDEFERRED_WORK_TASK_PRIORITY ( configMAX_PRIORITIES - configDEFERRED_WORK_LEVELS )
+#endif
+
+#ifndef configDEFERRED_WORK_TASK_STACK_DEPTH
+	#define configDEFERRED_WORK_TASK_STACK_DEPTH configMINIMAL_STACK_SIZE
+#endif
+
+/* Latency histogram bucket n counts items that waited less than 2^n
+timestamp units, the last bucket counting all longer waits. */
+#ifndef configDEFERRED_WORK_HISTOGRAM_BUCKETS
+	#define configDEFERRED_WORK_HISTOGRAM_BUCKETS 8
+#endif
+
+/* Latencies are measured in ticks unless a finer timestamp, such as a free
+running cycle counter, is provided. */
+#ifndef configDEFERRED_WORK_GET_TIMESTAMP
+	#define configDEFERRED_WORK_GET_TIMESTAMP() ( ( uint32_t ) xTaskGetTickCountFromISR() )
+#endif
+
+#if ( configUSE_DEFERRED_WORK == 1 )
+
+	#if( ( configDEFERRED_WORK_QUEUE_LENGTH & ( configDEFERRED_WORK_QUEUE_LENGTH - 1 ) ) != 0 )
+		#error configDEFERRED_WORK_QUEUE_LENGTH must be a power of two
+	#endif
+
+	#if( ( configDEFERRED_WORK_TASK_PRIORITY + configDEFERRED_WORK_LEVELS ) > configMAX_PRIORITIES )
+		#error configDEFERRED_WORK_TASK_PRIORITY + configDEFERRED_WORK_LEVELS must not exceed configMAX_PRIORITIES
+	#endif
+
+#endif /* configUSE_DEFERRED_WORK */
+
+#ifndef configUSE_CRITICAL_SECTION_PROFILER
+	#define configUSE_CRITICAL_SECTION_PROFILER 0
+#endif
+
+/* The number of call sites the critical section profiler records separately.
+Must be a power of two.  Sites that do not fit are recorded together. */
+#ifndef configCRITICAL_PROFILER_MAX_SITES
+	#define configCRITICAL_PROFILER_MAX_SITES 32
+#endif
+
+/* The number of interrupts, in addition to the tick, whose latency can be
+watched using xCriticalProfilerWatchIRQ(). */
+#ifndef configCRITICAL_PROFILER_WATCHED_IRQS
+	#define configCRITICAL_PROFILER_WATCHED_IRQS 1
+#endif
+
+/* Histogram bucket n counts samples shorter than
+2^( n + configCRITICAL_PROFILER_HISTOGRAM_SHIFT ) cycles, the last bucket
+counting all longer samples. */
+#ifndef configCRITICAL_PROFILER_HISTOGRAM_BUCKETS
+	#define configCRITICAL_PROFILER_HISTOGRAM_BUCKETS 8
+#endif
+
+#ifndef configCRITICAL_PROFILER_HISTOGRAM_SHIFT
+	#define configCRITICAL_PROFILER_HISTOGRAM_SHIFT 6
+#endif
+
+#if ( configUSE_CRITICAL_SECTION_PROFILER == 1 )
+
+	#if( ( configCRITICAL_PROFILER_MAX_SITES & ( configCRITICAL_PROFILER_MAX_SITES - 1 ) ) != 0 )
+		#error configCRITICAL_PROFILER_MAX_SITES must be a power of two
+	#endif
+
+	#ifndef portCRITICAL_PROFILER_GET_CYCLES
+		#error The port does not support the critical section profiler - portCRITICAL_PROFILER_GET_CYCLES() is not defined
+	#endif
+
+	#ifndef portCRITICAL_PROFILER_IRQ_PENDING
+		#error The port does not support the critical section profiler - portCRITICAL_PROFILER_IRQ_PENDING() is not defined
+	#endif
+
+#endif /* configUSE_CRITICAL_SECTION_PROFILER */
+
+#ifndef configUSE_ACTIVE_OBJECTS
+	#define configUSE_ACTIVE_OBJECTS 0
+#endif
+
+/* The number of active objects.  Each has a unique identifier below this
+value.  Must not exceed 32. */
+#ifndef configAO_MAX_ACTIVE_OBJECTS
+	#define configAO_MAX_ACTIVE_OBJECTS 8
+#endif
+
+/* Signals below this value can be published and subscribed to.  Any signal
+can be posted. */
+#ifndef configAO_MAX_PUBLISH_SIGNALS
+	#define configAO_MAX_PUBLISH_SIGNALS 16
+#endif
+
+#ifndef configAO_MAX_EVENT_POOLS
+	#define configAO_MAX_EVENT_POOLS 3
+#endif
+
+/* The deepest nesting of any state, counting the top state. */
+#ifndef configAO_MAX_NEST_DEPTH
+	#define configAO_MAX_NEST_DEPTH 6
+#endif
+
+/* The number of runner tasks.  Active objects assigned to the same runner
+share its stack. */
+#ifndef configAO_RUNNERS
+	#define configAO_RUNNERS 1
+#endif
+
+/* Runner n runs at configAO_RUNNER_PRIORITY + n. */
+#ifndef configAO_RUNNER_PRIORITY
+	#define configAO_RUNNER_PRIORITY 1
+#endif
+
+#ifndef configAO_RUNNER_STACK_DEPTH
+	#define configAO_RUNNER_STACK_DEPTH configMINIMAL_STACK_SIZE
+#endif
+
+#if ( configUSE_ACTIVE_OBJECTS == 1 )
+
+	#if( configAO_MAX_ACTIVE_OBJECTS > 32 )
+		#error configAO_MAX_ACTIVE_OBJECTS must not exceed 32
+	#endif
+
+	#if( configAO_MAX_EVENT_POOLS > 255 )
+		#error configAO_MAX_EVENT_POOLS must not exceed 255
+	#endif
+
+	#if( ( configAO_RUNNER_PRIORITY + configAO_RUNNERS ) > configMAX_PRIORITIES )
+		#error configAO_RUNNER_PRIORITY + configAO_RUNNERS must not exceed configMAX_PRIORITIES
+	#endif
+
+#endif /* configUSE_ACTIVE_OBJECTS */
+
+#ifndef configUSE_PARALLEL_FOR
+	#define configUSE_PARALLEL_FOR 0
+#endif
+
+/* The number of worker tasks that execute parallel loops together with the
+calling task.  0 executes every loop serially in the calling task, which is
+the right setting for a single core. */
+#ifndef configPARALLEL_FOR_WORKERS
+	#define configPARALLEL_FOR_WORKERS 0
+#endif
+
+/* The number of ranges each participant's deque can hold.  Must be a power of
+two.  Recursive halving needs about log2( iterations / grain ) entries. */
+#ifndef configPARALLEL_FOR_DEQUE_LENGTH
+	#define configPARALLEL_FOR_DEQUE_LENGTH 32
+#endif
+
+#ifndef configPARALLEL_FOR_WORKER_PRIORITY
+	#define configPARALLEL_FOR_WORKER_PRIORITY 1
+#endif
+
+#ifndef configPARALLEL_FOR_WORKER_STACK_DEPTH
+	#define configPARALLEL_FOR_WORKER_STACK_DEPTH configMINIMAL_STACK_SIZE
+#endif
+
+/* The number of times in succession a participant looks for work, and
+yields when it finds none, before it stops taking part in a loop. */
+#ifndef configPARALLEL_FOR_IDLE_SPINS
+	#define configPARALLEL_FOR_IDLE_SPINS 32
+#endif
+
+#if ( configUSE_PARALLEL_FOR == 1 )
+
+	#if( ( configPARALLEL_FOR_DEQUE_LENGTH & ( configPARALLEL_FOR_DEQUE_LENGTH - 1 ) ) != 0 )
+		#error configPARALLEL_FOR_DEQUE_LENGTH must be a power of two
+	#endif
+
+	#if( configPARALLEL_FOR_WORKER_PRIORITY >= configMAX_PRIORITIES )
+		#error configPARALLEL_FOR_WORKER_PRIORITY must be less than configMAX_PRIORITIES
+	#endif
+
+#endif /* configUSE_PARALLEL_FOR */
+
+/* Set to 1 to include ullTaskGetTimestamp() and ullTaskGetTimestampUs(), which
+extend the tick count with the counts of the timer that generates the tick
+interrupt. */
+#ifndef configUSE_TIMESTAMP
+	#define configUSE_TIMESTAMP 0
+#endif
+
+#if ( configUSE_TIMESTAMP == 1 )
+
+	#ifndef portGET_TICK_ELAPSED_COUNTS
+		#error The port does not support the timestamp service - portGET_TICK_ELAPSED_COUNTS() is not defined
+	#endif
+
+	#ifndef portTIMESTAMP_CLOCK_HZ
+		#error The port does not support the timestamp service - portTIMESTAMP_CLOCK_HZ is not defined
+	#endif
+
+#endif /* configUSE_TIMESTAMP */
+
+/* Set to 1 to reserve, at build time, fixed capacity pools from which kernel
+objects are taken when configSUPPORT_DYNAMIC_ALLOCATION is 0.  See
+static_pools.h. */
+#ifndef configUSE_STATIC_POOLS
+	#define configUSE_STATIC_POOLS 0
+#endif
+
+/* The number of task control blocks in the task pool. */
+#ifndef configSTATIC_POOL_TASKS
+	#define configSTATIC_POOL_TASKS 0
+#endif
+
+/* The number of words of stack shared by the tasks taken from the pool.  Each
+task takes as many words as it asks for. */
+#ifndef configSTATIC_POOL_TASK_STACK_WORDS
+	#define configSTATIC_POOL_TASK_STACK_WORDS ( configSTATIC_POOL_TASKS * configMINIMAL_STACK_SIZE )
+#endif
+
+/* The number of queue control blocks in the queue pool. */
+#ifndef configSTATIC_POOL_QUEUES
+	#define configSTATIC_POOL_QUEUES 0
+#endif
+
+/* The number of bytes of item storage shared by the queues taken from the
+pool.  Each queue takes its length times its item size, rounded up to
+portBYTE_ALIGNMENT. */
+#ifndef configSTATIC_POOL_QUEUE_STORAGE_SIZE
+	#define configSTATIC_POOL_QUEUE_STORAGE_SIZE 0
+#endif
+
+#ifndef configSTATIC_POOL_SEMAPHORES
+	#define configSTATIC_POOL_SEMAPHORES 0
+#endif
+
+#ifndef configSTATIC_POOL_EVENT_GROUPS
+	#define configSTATIC_POOL_EVENT_GROUPS 0
+#endif
+
+#ifndef configSTATIC_POOL_TIMERS
+	#define configSTATIC_POOL_TIMERS 0
+#endif
+
+#if ( configUSE_STATIC_POOLS == 1 )
+
+	#if( configSUPPORT_STATIC_ALLOCATION != 1 )
+		#error configSUPPORT_STATIC_ALLOCATION must be set to 1 to use static pools
+	#endif
+
+	#if( ( configSTATIC_POOL_TIMERS > 0 ) && ( configUSE_TIMERS != 1 ) )
+		#error configUSE_TIMERS must be set to 1 to use the timer pool
+	#endif
+
+#endif /* configUSE_STATIC_POOLS */
+
 #ifndef configINITIAL_TICK_COUNT
 	#define configINITIAL_TICK_COUNT 0
 #endif
@@ -1016,8 +1339,8 @@ typedef struct xSTATIC_TCB
 		struct	_reent	xDummy17;
 	#endif
 	#if ( configUSE_TASK_NOTIFICATIONS == 1 )
-		uint32_t 		ulDummy18;
-		uint8_t 		ucDummy19;
+		uint32_t 		ulDummy18[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
+		uint8_t 		ucDummy19[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
 	#endif
 	#if( ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) || ( portUSING_MPU_WRAPPERS == 1 ) )
 		uint8_t			uxDummy20;
@@ -1063,13 +1386,25 @@ typedef struct xSTATIC_QUEUE
 
 	#if ( configUSE_QUEUE_SETS == 1 )
 		void *pvDummy7;
+		UBaseType_t uxDummy7;
 	#endif
 
 	#if ( configUSE_TRACE_FACILITY == 1 )
 		UBaseType_t uxDummy8;
+	#endif
+
+	#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_QUEUE_SETS == 1 ) )
 		uint8_t ucDummy9;
 	#endif
 
+	#if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+		UBaseType_t uxDummy10;
+	#endif
+
+	#if ( configUSE_ADAPTIVE_SEMAPHORE_SPIN == 1 )
+		UBaseType_t uxDummy11;
+	#endif
+
 } StaticQueue_t;
 typedef StaticQueue_t StaticSemaphore_t;
 
@@ -1160,6 +1495,20 @@ typedef struct xSTATIC_STREAM_BUFFER
 /* Message buffers are built on stream buffers. */
 typedef StaticStreamBuffer_t StaticMessageBuffer_t;
 
+/*
+ * In line with software engineering best practice, FreeRTOS implements a strict
+ * data hiding policy, so the real multi-producer message buffer structure is
+ * not accessible to the application.  StaticMPMessageBuffer_t is provided so
+ * the application can statically allocate one, see
+ * xMPMessageBufferCreateStatic().
+ */
+typedef struct xSTATIC_MP_MESSAGE_BUFFER
+{
+	uint32_t ulDummy1[ 4 ];
+	void * pvDummy2[ 2 ];
+	uint8_t ucDummy3;
+} StaticMPMessageBuffer_t;
+
 #ifdef __cplusplus
 }
 #endif
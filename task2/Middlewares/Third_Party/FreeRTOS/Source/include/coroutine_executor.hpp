@@ -0,0 +1,792 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * A C++20 coroutine executor that runs any number of cooperative state
+ * machines inside a single FreeRTOS task.
+ *
+ * Each logical task is a C++20 coroutine returning freertos::coro::Task.
+ * Coroutines are stackless - they all run on the stack of the task that calls
+ * Executor::run(), and the state each one keeps across suspension points is
+ * held in a coroutine frame allocated from the executor's fixed block
+ * FrameArena rather than the FreeRTOS heap.  A logical task therefore costs
+ * its frame, typically a few tens of bytes, in place of a TCB and a stack.
+ * This is the same trade off made by the co-routines in croutine.h, but local
+ * variables survive suspension and waiting is written as a normal co_await
+ * expression.  The first parameter of a coroutine (after the object, for a
+ * member function) is the Executor it runs on, which allocates its frame:
+ *
+ *	freertos::coro::Task vBlinkLED( freertos::coro::Executor &xExecutor )
+ *	{
+ *		for( ;; )
+ *		{
+ *			HAL_GPIO_TogglePin( LD3_GPIO_Port, LD3_Pin );
+ *			co_await freertos::coro::delay( pdMS_TO_TICKS( 500 ) );
+ *		}
+ *	}
+ *
+ *	static freertos::coro::StaticFrameArena< 64, 16 > xArena;
+ *	static freertos::coro::Executor xExecutor( xArena );
+ *
+ *	void vExecutorTask( void *pvParameters )
+ *	{
+ *		xExecutor.spawn( vBlinkLED( xExecutor ) );
+ *		xExecutor.run();
+ *	}
+ *
+ * The awaitables provided are delay(), yield(), notifyWait() (bits sent to the
+ * executor task with xTaskNotify() or xTaskNotifyFromISR() using eSetBits),
+ * queueReceive() and streamReceive().  The executor task blocks on its task
+ * notification, so notifications and timeouts resume coroutines without
+ * latency.  Queues and stream buffers cannot notify the executor themselves,
+ * so after writing to one that a coroutine receives from, the writer must
+ * call Executor::wake() or Executor::wakeFromISR().  The executor then checks
+ * every waiting coroutine once.  Without a wake, a coroutine waiting on a
+ * queue or stream buffer is only resumed the next time the executor wakes for
+ * another reason.
+ *
+ * Alternatively, set configCORO_POLL_TICKS above 0 to make the executor check
+ * them at least every configCORO_POLL_TICKS ticks while any coroutine waits on
+ * a queue or stream buffer.  Each check costs two context switches plus one
+ * non-blocking receive attempt per waiting coroutine, so a period of 1 tick
+ * costs configTICK_RATE_HZ executor wake ups a second even when no data
+ * arrives, and still adds up to configCORO_POLL_TICKS ticks of latency.
+ *
+ * Coroutines are resumed in FIFO order and run until they next co_await, so
+ * a coroutine must never call a blocking FreeRTOS API function.
+ *
+ * Requires a C++20 compiler, such as Arm Compiler 6 or GCC 10 or later, built
+ * without exceptions.
+ */
+
+#ifndef COROUTINE_EXECUTOR_HPP
+#define COROUTINE_EXECUTOR_HPP
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "stream_buffer.h"
+
+#if( configUSE_TASK_NOTIFICATIONS != 1 )
+	#error configUSE_TASK_NOTIFICATIONS must be set to 1 to use the coroutine executor
+#endif
+
+/* The longest a coroutine waiting on a queue or stream buffer can go without
+the object being checked, or 0 to only check when the executor is woken.  See
+above. */
+#ifndef configCORO_POLL_TICKS
+	#define configCORO_POLL_TICKS 0
+#endif
+
+namespace freertos
+{
+namespace coro
+{
+
+class Executor;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Fixed block allocator for coroutine frames.  Allocation and release are
+ * O(1).  A frame larger than the block size cannot be allocated, in which case
+ * the coroutine function returns an empty Task that spawn() rejects.  The
+ * frame size of each coroutine is fixed at compile time, so the block size can
+ * be chosen by logging the sizes passed to allocate() during development.
+ * Each frame is preceded by a header of alignof( std::max_align_t ) bytes that
+ * records the arena it belongs to, which is included in the size passed to
+ * allocate().
+ */
+class FrameArena
+{
+public:
+	FrameArena( void *pvStorage, size_t xStorageBytes, size_t xBlockBytes ) noexcept
+	{
+		uint8_t *pucBlock = static_cast< uint8_t * >( pvStorage );
+
+		/* Blocks are kept aligned for any frame. */
+		xBlockSize = ( xBlockBytes + ( alignof( std::max_align_t ) - 1U ) ) & ~( alignof( std::max_align_t ) - 1U );
+		xBlocks = xStorageBytes / xBlockSize;
+		xBlocksFree = xBlocks;
+		xMinimumEverBlocksFree = xBlocks;
+		pxFree = nullptr;
+
+		for( size_t x = 0; x < xBlocks; x++ )
+		{
+			FreeBlock *pxBlock = reinterpret_cast< FreeBlock * >( pucBlock + ( x * xBlockSize ) );
+			pxBlock->pxNext = pxFree;
+			pxFree = pxBlock;
+		}
+	}
+
+	FrameArena( const FrameArena & ) = delete;
+	FrameArena &operator=( const FrameArena & ) = delete;
+
+	void *allocate( size_t xBytes ) noexcept
+	{
+	FreeBlock *pxBlock = nullptr;
+
+		if( xBytes <= xBlockSize )
+		{
+			taskENTER_CRITICAL();
+			{
+				pxBlock = pxFree;
+
+				if( pxBlock != nullptr )
+				{
+					pxFree = pxBlock->pxNext;
+					xBlocksFree--;
+
+					if( xBlocksFree < xMinimumEverBlocksFree )
+					{
+						xMinimumEverBlocksFree = xBlocksFree;
+					}
+				}
+			}
+			taskEXIT_CRITICAL();
+		}
+
+		return pxBlock;
+	}
+
+	void deallocate( void *pv ) noexcept
+	{
+	FreeBlock *pxBlock = static_cast< FreeBlock * >( pv );
+
+		taskENTER_CRITICAL();
+		{
+			pxBlock->pxNext = pxFree;
+			pxFree = pxBlock;
+			xBlocksFree++;
+		}
+		taskEXIT_CRITICAL();
+	}
+
+	size_t blockSize( void ) const noexcept { return xBlockSize; }
+	size_t blocksFree( void ) const noexcept { return xBlocksFree; }
+	size_t minimumEverBlocksFree( void ) const noexcept { return xMinimumEverBlocksFree; }
+
+private:
+	struct FreeBlock
+	{
+		FreeBlock *pxNext;
+	};
+
+	FreeBlock *pxFree;
+	size_t xBlockSize;
+	size_t xBlocks;
+	size_t xBlocksFree;
+	size_t xMinimumEverBlocksFree;
+};
+
+/*
+ * A FrameArena that holds its own storage, for static allocation.
+ */
+template< size_t xBlockBytes, size_t xBlockCount >
+class StaticFrameArena : public FrameArena
+{
+public:
+	StaticFrameArena( void ) noexcept : FrameArena( ucStorage, sizeof( ucStorage ), xBlockBytes ) {}
+
+private:
+	static constexpr size_t xAlignedBlockBytes = ( xBlockBytes + ( alignof( std::max_align_t ) - 1U ) ) & ~( alignof( std::max_align_t ) - 1U );
+	alignas( std::max_align_t ) uint8_t ucStorage[ xAlignedBlockBytes * xBlockCount ];
+};
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The return type of a coroutine that can be spawned on an Executor.  A Task
+ * owns its coroutine until it is passed to Executor::spawn(), after which the
+ * executor destroys the coroutine when it completes.
+ */
+class Task
+{
+public:
+	struct promise_type
+	{
+		/* A coroutine's first parameter, or its second if it is a member
+		function, is the executor that runs it and allocates its frame. */
+		template< typename... Args >
+		explicit promise_type( Executor &xExecutor, Args &... ) noexcept : pxExecutor( &xExecutor ) {}
+
+		template< typename Object, typename... Args >
+		promise_type( Object &, Executor &xExecutor, Args &... ) noexcept : pxExecutor( &xExecutor ) {}
+
+		Executor *pxExecutor;
+		promise_type *pxNextReady = nullptr;
+
+		Task get_return_object( void ) noexcept { return Task( std::coroutine_handle< promise_type >::from_promise( *this ) ); }
+		static Task get_return_object_on_allocation_failure( void ) noexcept { return Task(); }
+
+		/* Coroutines do not start running until the executor resumes them, and
+		remain suspended when complete so the executor can destroy them. */
+		std::suspend_always initial_suspend( void ) noexcept { return {}; }
+		std::suspend_always final_suspend( void ) noexcept { return {}; }
+		void return_void( void ) noexcept {}
+		void unhandled_exception( void ) noexcept { configASSERT( pdFALSE ); }
+
+		template< typename... Args >
+		static void *operator new( size_t xBytes, Executor &xExecutor, Args &... ) noexcept
+		{
+			return prvAllocate( xBytes, xExecutor );
+		}
+
+		template< typename Object, typename... Args >
+		static void *operator new( size_t xBytes, Object &, Executor &xExecutor, Args &... ) noexcept
+		{
+			return prvAllocate( xBytes, xExecutor );
+		}
+
+		static void operator delete( void *pv ) noexcept
+		{
+		uint8_t *pucBlock = static_cast< uint8_t * >( pv ) - xFrameHeaderBytes;
+
+			( *reinterpret_cast< FrameArena ** >( pucBlock ) )->deallocate( pucBlock );
+		}
+
+	private:
+		/* Frames are returned to the arena they came from, which the header in
+		front of each frame records. */
+		static constexpr size_t xFrameHeaderBytes = alignof( std::max_align_t );
+
+		static void *prvAllocate( size_t xBytes, Executor &xExecutor ) noexcept;
+	};
+
+	using Handle = std::coroutine_handle< promise_type >;
+
+	Task( void ) noexcept = default;
+	explicit Task( Handle xHandle ) noexcept : xCoroutine( xHandle ) {}
+	Task( Task &&xOther ) noexcept : xCoroutine( xOther.release() ) {}
+	Task( const Task & ) = delete;
+	Task &operator=( const Task & ) = delete;
+
+	~Task( void )
+	{
+		if( xCoroutine )
+		{
+			xCoroutine.destroy();
+		}
+	}
+
+	explicit operator bool( void ) const noexcept { return static_cast< bool >( xCoroutine ); }
+
+	Handle release( void ) noexcept
+	{
+	Handle xReturn = xCoroutine;
+
+		xCoroutine = nullptr;
+		return xReturn;
+	}
+
+private:
+	Handle xCoroutine = nullptr;
+};
+
+/*-----------------------------------------------------------*/
+
+/*
+ * A suspended coroutine that is waiting for a condition, a timeout, or both.
+ * Waiters live in the awaiting coroutine's frame, so waiting never allocates.
+ */
+struct Waiter
+{
+	/* Returns true, having completed the operation, if the condition the
+	coroutine is waiting for is met.  nullptr if only waiting for a timeout. */
+	bool ( *pxTryComplete )( Waiter *pxWaiter ) = nullptr;
+
+	Waiter *pxNext = nullptr;
+	Task::Handle xCoroutine = nullptr;
+	TickType_t xTimeOutStart = 0;
+	TickType_t xTicksToWait = portMAX_DELAY;
+
+	/* True if the condition can only be detected by polling. */
+	bool xPolled = false;
+
+	/* True if the condition was met, false if the wait timed out. */
+	bool xCompleted = false;
+};
+
+/*-----------------------------------------------------------*/
+
+class Executor
+{
+public:
+	/* Coroutines spawned on the executor have their frames allocated from
+	xArena.  Executors can share an arena. */
+	explicit Executor( FrameArena &xArena ) noexcept : xArena( xArena ) {}
+
+	Executor( const Executor & ) = delete;
+	Executor &operator=( const Executor & ) = delete;
+
+	/*
+	 * Hands a coroutine to the executor, which starts it when run() next
+	 * resumes coroutines.  Returns pdFAIL if the coroutine's frame could not be
+	 * allocated.  Can be called before run() is called, or from a coroutine
+	 * running on this executor.
+	 */
+	BaseType_t spawn( Task &&xTask ) noexcept
+	{
+	BaseType_t xReturn = pdFAIL;
+	Task xOwned( static_cast< Task && >( xTask ) );
+
+		if( xOwned )
+		{
+			Task::Handle xCoroutine = xOwned.release();
+
+			/* The coroutine must have been created for this executor. */
+			configASSERT( xCoroutine.promise().pxExecutor == this );
+			uxLiveCoroutines++;
+			makeReady( xCoroutine );
+			xReturn = pdPASS;
+		}
+
+		return xReturn;
+	}
+
+	/*
+	 * Runs the coroutines.  Must be called from the FreeRTOS task that hosts
+	 * the executor, and never returns.
+	 */
+	[[noreturn]] void run( void ) noexcept
+	{
+	uint32_t ulNotifiedValue;
+
+		xExecutorTask = xTaskGetCurrentTaskHandle();
+
+		for( ;; )
+		{
+			runReady();
+
+			ulNotifiedValue = 0;
+			( void ) xTaskNotifyWait( 0, ~( uint32_t ) 0, &ulNotifiedValue, nextTimeout() );
+			ulPendingNotifications |= ulNotifiedValue;
+
+			checkWaiters();
+		}
+	}
+
+	/*
+	 * Makes the executor check its waiting coroutines.  Call after sending to
+	 * a queue or stream buffer that a coroutine might be waiting on.  Does not
+	 * set any notification bits.
+	 */
+	void wake( void ) const noexcept
+	{
+		if( xExecutorTask != nullptr )
+		{
+			( void ) xTaskNotify( xExecutorTask, 0, eNoAction );
+		}
+	}
+
+	void wakeFromISR( BaseType_t *pxHigherPriorityTaskWoken ) const noexcept
+	{
+		if( xExecutorTask != nullptr )
+		{
+			( void ) xTaskNotifyFromISR( xExecutorTask, 0, eNoAction, pxHigherPriorityTaskWoken );
+		}
+	}
+
+	/* The handle of the task that runs the executor, to which notifications
+	awaited with notifyWait() are sent.  NULL until run() is called. */
+	TaskHandle_t taskHandle( void ) const noexcept { return xExecutorTask; }
+
+	FrameArena &arena( void ) const noexcept { return xArena; }
+
+	UBaseType_t liveCoroutines( void ) const noexcept { return uxLiveCoroutines; }
+
+	/* Used by the awaitables below. */
+	void makeReady( Task::Handle xCoroutine ) noexcept
+	{
+	Task::promise_type &xPromise = xCoroutine.promise();
+
+		xPromise.pxNextReady = nullptr;
+
+		if( pxReadyTail == nullptr )
+		{
+			pxReadyHead = &xPromise;
+		}
+		else
+		{
+			pxReadyTail->pxNextReady = &xPromise;
+		}
+
+		pxReadyTail = &xPromise;
+	}
+
+	void addWaiter( Waiter *pxWaiter ) noexcept
+	{
+		pxWaiter->xTimeOutStart = xTaskGetTickCount();
+		pxWaiter->pxNext = pxWaiters;
+		pxWaiters = pxWaiter;
+	}
+
+	/* Takes any of the notification bits in ulBitsToWaitFor that have been
+	received, returning the bits taken. */
+	uint32_t takeNotifications( uint32_t ulBitsToWaitFor ) noexcept
+	{
+	uint32_t ulReturn = ulPendingNotifications & ulBitsToWaitFor;
+
+		ulPendingNotifications &= ~ulReturn;
+		return ulReturn;
+	}
+
+private:
+	void runReady( void ) noexcept
+	{
+		while( pxReadyHead != nullptr )
+		{
+			Task::promise_type *pxPromise = pxReadyHead;
+			pxReadyHead = pxPromise->pxNextReady;
+
+			if( pxReadyHead == nullptr )
+			{
+				pxReadyTail = nullptr;
+			}
+
+			Task::Handle xCoroutine = Task::Handle::from_promise( *pxPromise );
+			xCoroutine.resume();
+
+			if( xCoroutine.done() )
+			{
+				xCoroutine.destroy();
+				uxLiveCoroutines--;
+			}
+		}
+	}
+
+	TickType_t nextTimeout( void ) noexcept
+	{
+	TickType_t xTimeout = portMAX_DELAY, xElapsed;
+	const TickType_t xNow = xTaskGetTickCount();
+
+		for( Waiter *pxWaiter = pxWaiters; pxWaiter != nullptr; pxWaiter = pxWaiter->pxNext )
+		{
+			if( pxWaiter->xTicksToWait != portMAX_DELAY )
+			{
+				xElapsed = xNow - pxWaiter->xTimeOutStart;
+
+				if( xElapsed >= pxWaiter->xTicksToWait )
+				{
+					xTimeout = 0;
+				}
+				else if( ( pxWaiter->xTicksToWait - xElapsed ) < xTimeout )
+				{
+					xTimeout = pxWaiter->xTicksToWait - xElapsed;
+				}
+			}
+
+			#if( configCORO_POLL_TICKS > 0 )
+			{
+				if( ( pxWaiter->xPolled != false ) && ( xTimeout > ( TickType_t ) configCORO_POLL_TICKS ) )
+				{
+					xTimeout = ( TickType_t ) configCORO_POLL_TICKS;
+				}
+			}
+			#endif
+		}
+
+		return xTimeout;
+	}
+
+	void checkWaiters( void ) noexcept
+	{
+	Waiter **ppxLink = &pxWaiters;
+	const TickType_t xNow = xTaskGetTickCount();
+
+		while( *ppxLink != nullptr )
+		{
+			Waiter *pxWaiter = *ppxLink;
+			bool xResume = false;
+
+			if( ( pxWaiter->pxTryComplete != nullptr ) && ( pxWaiter->pxTryComplete( pxWaiter ) != false ) )
+			{
+				pxWaiter->xCompleted = true;
+				xResume = true;
+			}
+			else if( ( pxWaiter->xTicksToWait != portMAX_DELAY ) && ( ( TickType_t ) ( xNow - pxWaiter->xTimeOutStart ) >= pxWaiter->xTicksToWait ) )
+			{
+				pxWaiter->xCompleted = false;
+				xResume = true;
+			}
+
+			if( xResume != false )
+			{
+				*ppxLink = pxWaiter->pxNext;
+				makeReady( pxWaiter->xCoroutine );
+			}
+			else
+			{
+				ppxLink = &( pxWaiter->pxNext );
+			}
+		}
+	}
+
+	FrameArena &xArena;
+	Task::promise_type *pxReadyHead = nullptr;
+	Task::promise_type *pxReadyTail = nullptr;
+	Waiter *pxWaiters = nullptr;
+	TaskHandle_t xExecutorTask = nullptr;
+	uint32_t ulPendingNotifications = 0;
+	UBaseType_t uxLiveCoroutines = 0;
+};
+
+/*-----------------------------------------------------------*/
+
+inline void *Task::promise_type::prvAllocate( size_t xBytes, Executor &xExecutor ) noexcept
+{
+FrameArena &xArena = xExecutor.arena();
+uint8_t *pucBlock = static_cast< uint8_t * >( xArena.allocate( xBytes + xFrameHeaderBytes ) );
+void *pvReturn = nullptr;
+
+	if( pucBlock != nullptr )
+	{
+		*reinterpret_cast< FrameArena ** >( pucBlock ) = &xArena;
+		pvReturn = pucBlock + xFrameHeaderBytes;
+	}
+
+	return pvReturn;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Common part of the awaitables that wait for a condition. */
+template< typename Derived >
+class WaitAwaitable
+{
+public:
+	/* Try the operation before suspending, so a coroutine only suspends if it
+	has to wait. */
+	bool await_ready( void ) noexcept
+	{
+		return static_cast< Derived * >( this )->tryComplete();
+	}
+
+	bool await_suspend( Task::Handle xCoroutine ) noexcept
+	{
+	bool xSuspend = true;
+
+		if( xWaiter.xTicksToWait == 0 )
+		{
+			/* Already tried and failed, and not allowed to wait. */
+			xWaiter.xCompleted = false;
+			xSuspend = false;
+		}
+		else
+		{
+			pxExecutor = xCoroutine.promise().pxExecutor;
+			xWaiter.xCoroutine = xCoroutine;
+			pxExecutor->addWaiter( &xWaiter );
+		}
+
+		return xSuspend;
+	}
+
+protected:
+	WaitAwaitable( TickType_t xTicksToWait, bool xPolled ) noexcept
+	{
+		xWaiter.xTicksToWait = xTicksToWait;
+		xWaiter.xPolled = xPolled;
+		xWaiter.pxTryComplete = &WaitAwaitable::prvTryComplete;
+	}
+
+	static bool prvTryComplete( Waiter *pxWaiter ) noexcept
+	{
+		/* xWaiter is the first member, so the waiter's address is the
+		awaitable's address. */
+		return static_cast< Derived * >( reinterpret_cast< WaitAwaitable * >( pxWaiter ) )->tryComplete();
+	}
+
+	Waiter xWaiter;
+	Executor *pxExecutor = nullptr;
+};
+
+/*
+ * co_await delay( xTicksToDelay ) suspends the calling coroutine for
+ * xTicksToDelay ticks.
+ */
+class delay
+{
+public:
+	explicit delay( TickType_t xTicksToDelay ) noexcept
+	{
+		xWaiter.xTicksToWait = xTicksToDelay;
+	}
+
+	bool await_ready( void ) const noexcept { return xWaiter.xTicksToWait == 0; }
+
+	void await_suspend( Task::Handle xCoroutine ) noexcept
+	{
+		xWaiter.xCoroutine = xCoroutine;
+		xCoroutine.promise().pxExecutor->addWaiter( &xWaiter );
+	}
+
+	void await_resume( void ) const noexcept {}
+
+private:
+	Waiter xWaiter;
+};
+
+/*
+ * co_await yield() lets the other ready coroutines run before the calling
+ * coroutine continues.
+ */
+class yield
+{
+public:
+	bool await_ready( void ) const noexcept { return false; }
+
+	void await_suspend( Task::Handle xCoroutine ) noexcept
+	{
+		xCoroutine.promise().pxExecutor->makeReady( xCoroutine );
+	}
+
+	void await_resume( void ) const noexcept {}
+};
+
+/*
+ * co_await notifyWait( ulBitsToWaitFor, xTicksToWait ) waits for any of the
+ * bits in ulBitsToWaitFor to be set in the executor task's notification value
+ * (see xTaskNotify() with eSetBits), then clears and returns those bits.  0 is
+ * returned if the wait timed out.
+ */
+class notifyWait : public WaitAwaitable< notifyWait >
+{
+public:
+	notifyWait( uint32_t ulBitsToWaitFor, TickType_t xTicksToWait = portMAX_DELAY ) noexcept :
+		WaitAwaitable( xTicksToWait, false ),
+		ulBitsToWaitFor( ulBitsToWaitFor )
+	{
+	}
+
+	bool await_ready( void ) noexcept
+	{
+		/* The executor is not known until the coroutine suspends. */
+		return false;
+	}
+
+	bool await_suspend( Task::Handle xCoroutine ) noexcept
+	{
+	bool xSuspend;
+
+		pxExecutor = xCoroutine.promise().pxExecutor;
+
+		if( tryComplete() != false )
+		{
+			xWaiter.xCompleted = true;
+			xSuspend = false;
+		}
+		else
+		{
+			xSuspend = WaitAwaitable::await_suspend( xCoroutine );
+		}
+
+		return xSuspend;
+	}
+
+	uint32_t await_resume( void ) const noexcept { return ( xWaiter.xCompleted != false ) ? ulBitsReceived : 0; }
+
+	bool tryComplete( void ) noexcept
+	{
+		ulBitsReceived = pxExecutor->takeNotifications( ulBitsToWaitFor );
+		return ulBitsReceived != 0;
+	}
+
+private:
+	uint32_t ulBitsToWaitFor;
+	uint32_t ulBitsReceived = 0;
+};
+
+/*
+ * co_await queueReceive( xQueue, pvBuffer, xTicksToWait ) receives an item
+ * from xQueue into pvBuffer, returning pdPASS, or pdFAIL if the wait timed
+ * out.
+ */
+class queueReceive : public WaitAwaitable< queueReceive >
+{
+public:
+	queueReceive( QueueHandle_t xQueue, void *pvBuffer, TickType_t xTicksToWait = portMAX_DELAY ) noexcept :
+		WaitAwaitable( xTicksToWait, true ),
+		xQueue( xQueue ),
+		pvBuffer( pvBuffer )
+	{
+	}
+
+	BaseType_t await_resume( void ) const noexcept { return ( xWaiter.xCompleted != false ) ? pdPASS : pdFAIL; }
+
+	bool tryComplete( void ) noexcept
+	{
+		xWaiter.xCompleted = ( xQueueReceive( xQueue, pvBuffer, 0 ) == pdPASS );
+		return xWaiter.xCompleted;
+	}
+
+private:
+	QueueHandle_t xQueue;
+	void *pvBuffer;
+};
+
+/*
+ * co_await streamReceive( xStreamBuffer, pvBuffer, xBufferLengthBytes,
+ * xTicksToWait ) receives up to xBufferLengthBytes bytes from xStreamBuffer
+ * (which may be a message buffer), returning the number of bytes received, or
+ * 0 if the wait timed out.
+ */
+class streamReceive : public WaitAwaitable< streamReceive >
+{
+public:
+	streamReceive( StreamBufferHandle_t xStreamBuffer, void *pvBuffer, size_t xBufferLengthBytes, TickType_t xTicksToWait = portMAX_DELAY ) noexcept :
+		WaitAwaitable( xTicksToWait, true ),
+		xStreamBuffer( xStreamBuffer ),
+		pvBuffer( pvBuffer ),
+		xBufferLengthBytes( xBufferLengthBytes )
+	{
+	}
+
+	size_t await_resume( void ) const noexcept { return ( xWaiter.xCompleted != false ) ? xReceivedBytes : 0; }
+
+	bool tryComplete( void ) noexcept
+	{
+		xReceivedBytes = xStreamBufferReceive( xStreamBuffer, pvBuffer, xBufferLengthBytes, 0 );
+		xWaiter.xCompleted = ( xReceivedBytes != 0 );
+		return xWaiter.xCompleted;
+	}
+
+private:
+	StreamBufferHandle_t xStreamBuffer;
+	void *pvBuffer;
+	size_t xBufferLengthBytes;
+	size_t xReceivedBytes = 0;
+};
+
+} /* namespace coro */
+} /* namespace freertos */
+
+#endif /* COROUTINE_EXECUTOR_HPP */
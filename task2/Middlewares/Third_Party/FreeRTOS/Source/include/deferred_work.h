@@ -0,0 +1,184 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * Deferred work moves processing out of interrupt service routines and into
+ * worker tasks.  It provides the same service as
+ * xTimerPendFunctionCallFromISR(), but is intended for interrupts that fire in
+ * bursts:
+ *
+ * + Each priority level has its own lock-free ring of work items, so posting
+ *   an item from an interrupt never enters a critical section, and a burst of
+ *   low priority items cannot delay high priority items.
+ *
+ * + Each level is drained by its own worker task, in batches of up to
+ *   configDEFERRED_WORK_BATCH_SIZE items.  The worker is only notified when it
+ *   is not already draining its ring, so an interrupt storm costs one
+ *   notification rather than one queue send per item.
+ *
+ * + Items that cannot be posted because a ring is full are counted, and the
+ *   time each item waited before being processed is recorded in a histogram,
+ *   so rings and worker priorities can be sized from measurements.
+ *
+ * Set configUSE_DEFERRED_WORK to 1 in FreeRTOSConfig.h to use deferred work,
+ * and call xDeferredWorkStart() before posting any items.
+ */
+
+#ifndef DEFERRED_WORK_H
+#define DEFERRED_WORK_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h must appear in source files before include deferred_work.h"
+#endif
+
+/*lint -save -e537 This headers are only multiply included if the application code
+happens to also be including task.h. */
+#include "task.h"
+#include "timers.h"
+/*lint -restore */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Used with xDeferredWorkGetStats() to obtain the statistics gathered for one
+ * deferred work level.
+ */
+typedef struct xDEFERRED_WORK_STATS
+{
+	uint32_t ulPosted;			/* The number of items posted to the level. */
+	uint32_t ulProcessed;		/* The number of items the level's worker has processed. */
+	uint32_t ulOverflows;		/* The number of items that could not be posted because the ring was full. */
+	uint32_t ulMaxLatency;		/* The longest time, in configDEFERRED_WORK_GET_TIMESTAMP() units, an item waited before being processed. */
+	uint32_t ulLatencyHistogram[ configDEFERRED_WORK_HISTOGRAM_BUCKETS ]; /* Bucket n counts items that waited less than 2^n units.  The last bucket also counts all longer waits. */
+} DeferredWorkStats_t;
+
+/**
+ * deferred_work.h
+ * <pre>
+ * BaseType_t xDeferredWorkStart( void );
+ * </pre>
+ *
+ * Creates the deferred work worker tasks, one per level.  The worker for level
+ * n runs at priority configDEFERRED_WORK_TASK_PRIORITY + n, so higher levels
+ * are processed first.  Must be called once, before any items are posted.
+ *
+ * @return pdPASS if the worker tasks were created, otherwise pdFAIL.
+ *
+ * \defgroup xDeferredWorkStart xDeferredWorkStart
+ * \ingroup DeferredWork
+ */
+BaseType_t xDeferredWorkStart( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * deferred_work.h
+ * <pre>
+ * BaseType_t xDeferredWorkPostFromISR( UBaseType_t uxLevel,
+ *                                      PendedFunction_t xFunctionToPend,
+ *                                      void *pvParameter1,
+ *                                      uint32_t ulParameter2,
+ *                                      BaseType_t *pxHigherPriorityTaskWoken );
+ * </pre>
+ *
+ * Used from an interrupt service routine to defer the execution of a function
+ * to the worker task of a deferred work level.  Items posted to the same
+ * level are executed in the order in which they were posted.
+ *
+ * Any number of interrupts, including nested interrupts, can post to the same
+ * level at the same time.  Posting never enters a critical section.
+ *
+ * @param uxLevel The level to post to, from 0 (lowest priority) to
+ * configDEFERRED_WORK_LEVELS - 1.
+ *
+ * @param xFunctionToPend The function to execute from the worker task.  The
+ * function must conform to the PendedFunction_t prototype, as used by
+ * xTimerPendFunctionCallFromISR().
+ *
+ * @param pvParameter1 The value of the callback function's first parameter.
+ *
+ * @param ulParameter2 The value of the callback function's second parameter.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if posting the item unblocked
+ * a worker task that has a priority above that of the interrupted task, in
+ * which case a context switch should be requested before the interrupt exits.
+ *
+ * @return pdPASS if the item was posted.  pdFAIL if the level's ring was full,
+ * in which case the level's overflow count is incremented.
+ *
+ * \defgroup xDeferredWorkPostFromISR xDeferredWorkPostFromISR
+ * \ingroup DeferredWork
+ */
+BaseType_t xDeferredWorkPostFromISR( UBaseType_t uxLevel, PendedFunction_t xFunctionToPend, void *pvParameter1, uint32_t ulParameter2, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * deferred_work.h
+ * <pre>
+ * BaseType_t xDeferredWorkPost( UBaseType_t uxLevel,
+ *                               PendedFunction_t xFunctionToPend,
+ *                               void *pvParameter1,
+ *                               uint32_t ulParameter2 );
+ * </pre>
+ *
+ * Version of xDeferredWorkPostFromISR() that can be called from a task.  The
+ * function never blocks - pdFAIL is returned if the level's ring is full.
+ *
+ * \defgroup xDeferredWorkPost xDeferredWorkPost
+ * \ingroup DeferredWork
+ */
+BaseType_t xDeferredWorkPost( UBaseType_t uxLevel, PendedFunction_t xFunctionToPend, void *pvParameter1, uint32_t ulParameter2 ) PRIVILEGED_FUNCTION;
+
+/**
+ * deferred_work.h
+ * <pre>
+ * void vDeferredWorkGetStats( UBaseType_t uxLevel, DeferredWorkStats_t *pxStats );
+ * </pre>
+ *
+ * Copies the statistics gathered for a deferred work level into *pxStats.
+ *
+ * \defgroup vDeferredWorkGetStats vDeferredWorkGetStats
+ * \ingroup DeferredWork
+ */
+void vDeferredWorkGetStats( UBaseType_t uxLevel, DeferredWorkStats_t *pxStats ) PRIVILEGED_FUNCTION;
+
+/**
+ * deferred_work.h
+ * <pre>
+ * void vDeferredWorkResetStats( UBaseType_t uxLevel );
+ * </pre>
+ *
+ * Clears the statistics gathered for a deferred work level.
+ *
+ * \defgroup vDeferredWorkResetStats vDeferredWorkResetStats
+ * \ingroup DeferredWork
+ */
+void vDeferredWorkResetStats( UBaseType_t uxLevel ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* DEFERRED_WORK_H */
@@ -595,6 +595,33 @@ BaseType_t xHigherPriorityTaskWoken = pdFALSE;  // Initialised to pdFALSE.
  */
 #define xMessageBufferReceiveFromISR( xMessageBuffer, pvRxData, xBufferLengthBytes, pxHigherPriorityTaskWoken ) xStreamBufferReceiveFromISR( ( StreamBufferHandle_t ) xMessageBuffer, pvRxData, xBufferLengthBytes, pxHigherPriorityTaskWoken )
 
+/**
+ * message_buffer.h
+ *
+<pre>
+size_t xMessageBufferSendV( MessageBufferHandle_t xMessageBuffer,
+							const StreamBufferSegment_t * const pxSegments,
+							size_t xSegmentCount,
+							TickType_t xTicksToWait );
+size_t xMessageBufferReceiveV( MessageBufferHandle_t xMessageBuffer,
+							   const StreamBufferSegment_t * const pxSegments,
+							   size_t xSegmentCount,
+							   TickType_t xTicksToWait );
+</pre>
+ *
+ * Gather and scatter versions of xMessageBufferSend() and
+ * xMessageBufferReceive().  xMessageBufferSendV() writes the segments as a
+ * single message.  xMessageBufferReceiveV() reads a single message into the
+ * segments, or leaves the message in the message buffer if it is longer than
+ * the total length of the segments.  See xStreamBufferSendV() and
+ * xStreamBufferReceiveV().
+ *
+ * \defgroup xMessageBufferSendV xMessageBufferSendV
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferSendV( xMessageBuffer, pxSegments, xSegmentCount, xTicksToWait ) xStreamBufferSendV( ( StreamBufferHandle_t ) xMessageBuffer, pxSegments, xSegmentCount, xTicksToWait )
+#define xMessageBufferReceiveV( xMessageBuffer, pxSegments, xSegmentCount, xTicksToWait ) xStreamBufferReceiveV( ( StreamBufferHandle_t ) xMessageBuffer, pxSegments, xSegmentCount, xTicksToWait )
+
 /**
  * message_buffer.h
  *
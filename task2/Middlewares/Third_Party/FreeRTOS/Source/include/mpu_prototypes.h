@@ -57,6 +57,9 @@ void MPU_vTaskStartScheduler( void );
 void MPU_vTaskSuspendAll( void );
 BaseType_t MPU_xTaskResumeAll( void );
 TickType_t MPU_xTaskGetTickCount( void );
+uint64_t MPU_ullTaskGetTickCount64( void );
+uint64_t MPU_ullTaskGetTimestamp( void );
+uint64_t MPU_ullTaskGetTimestampUs( void );
 UBaseType_t MPU_uxTaskGetNumberOfTasks( void );
 char * MPU_pcTaskGetName( TaskHandle_t xTaskToQuery );
 TaskHandle_t MPU_xTaskGetHandle( const char *pcNameToQuery );
@@ -70,10 +73,10 @@ TaskHandle_t MPU_xTaskGetIdleTaskHandle( void );
 UBaseType_t MPU_uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, uint32_t * const pulTotalRunTime );
 void MPU_vTaskList( char * pcWriteBuffer );
 void MPU_vTaskGetRunTimeStats( char *pcWriteBuffer );
-BaseType_t MPU_xTaskGenericNotify( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue );
-BaseType_t MPU_xTaskNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait );
-uint32_t MPU_ulTaskNotifyTake( BaseType_t xClearCountOnExit, TickType_t xTicksToWait );
-BaseType_t MPU_xTaskNotifyStateClear( TaskHandle_t xTask );
+BaseType_t MPU_xTaskGenericNotify( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue );
+BaseType_t MPU_xTaskGenericNotifyWait( UBaseType_t uxIndexToWaitOn, uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait );
+uint32_t MPU_ulTaskGenericNotifyTake( UBaseType_t uxIndexToWaitOn, BaseType_t xClearCountOnExit, TickType_t xTicksToWait );
+BaseType_t MPU_xTaskGenericNotifyStateClear( TaskHandle_t xTask, UBaseType_t uxIndexToClear );
 BaseType_t MPU_xTaskIncrementTick( void );
 TaskHandle_t MPU_xTaskGetCurrentTaskHandle( void );
 void MPU_vTaskSetTimeOutState( TimeOut_t * const pxTimeOut );
@@ -101,7 +104,7 @@ void MPU_vQueueUnregisterQueue( QueueHandle_t xQueue );
 const char * MPU_pcQueueGetName( QueueHandle_t xQueue );
 QueueHandle_t MPU_xQueueGenericCreate( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, const uint8_t ucQueueType );
 QueueHandle_t MPU_xQueueGenericCreateStatic( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, uint8_t *pucQueueStorage, StaticQueue_t *pxStaticQueue, const uint8_t ucQueueType );
-QueueSetHandle_t MPU_xQueueCreateSet( const UBaseType_t uxEventQueueLength );
+QueueSetHandle_t MPU_xQueueCreateSet( const UBaseType_t uxMaxMembers );
 BaseType_t MPU_xQueueAddToSet( QueueSetMemberHandle_t xQueueOrSemaphore, QueueSetHandle_t xQueueSet );
 BaseType_t MPU_xQueueRemoveFromSet( QueueSetMemberHandle_t xQueueOrSemaphore, QueueSetHandle_t xQueueSet );
 QueueSetMemberHandle_t MPU_xQueueSelectFromSet( QueueSetHandle_t xQueueSet, const TickType_t xTicksToWait );
@@ -148,6 +151,12 @@ size_t MPU_xStreamBufferBytesAvailable( StreamBufferHandle_t xStreamBuffer );
 BaseType_t MPU_xStreamBufferSetTriggerLevel( StreamBufferHandle_t xStreamBuffer, size_t xTriggerLevel );
 StreamBufferHandle_t MPU_xStreamBufferGenericCreate( size_t xBufferSizeBytes, size_t xTriggerLevelBytes, BaseType_t xIsMessageBuffer );
 StreamBufferHandle_t MPU_xStreamBufferGenericCreateStatic( size_t xBufferSizeBytes, size_t xTriggerLevelBytes, BaseType_t xIsMessageBuffer, uint8_t * const pucStreamBufferStorageArea, StaticStreamBuffer_t * const pxStaticStreamBuffer );
+size_t MPU_xStreamBufferSendV( StreamBufferHandle_t xStreamBuffer, const StreamBufferSegment_t * const pxSegments, size_t xSegmentCount, TickType_t xTicksToWait );
+size_t MPU_xStreamBufferReceiveV( StreamBufferHandle_t xStreamBuffer, const StreamBufferSegment_t * const pxSegments, size_t xSegmentCount, TickType_t xTicksToWait );
+size_t MPU_xStreamBufferWriteReserve( StreamBufferHandle_t xStreamBuffer, StreamBufferSegment_t pxSegments[ 2 ] );
+void MPU_vStreamBufferWriteCommit( StreamBufferHandle_t xStreamBuffer, size_t xBytesWritten );
+size_t MPU_xStreamBufferReadReserve( StreamBufferHandle_t xStreamBuffer, StreamBufferSegment_t pxSegments[ 2 ] );
+void MPU_vStreamBufferReadCommit( StreamBufferHandle_t xStreamBuffer, size_t xBytesRead );
 
 
 
@@ -0,0 +1,728 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "atomic.h"
+#include "parallel_for.h"
+
+#if ( configUSE_PARALLEL_FOR == 1 ) && ( configPARALLEL_FOR_WORKERS > 0 )
+
+	#if( configUSE_TASK_NOTIFICATIONS != 1 )
+		#error configUSE_TASK_NOTIFICATIONS must be set to 1 to use parallel loops with worker tasks.
+	#endif
+
+	#if( configUSE_MUTEXES != 1 )
+		#error configUSE_MUTEXES must be set to 1 to use parallel loops with worker tasks.
+	#endif
+
+#endif
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+
+/* This entire source file will be skipped if the application is not configured
+to include parallel loop functionality.  This #if is closed at the very bottom
+of this file.  If you want to include parallel loops then ensure
+configUSE_PARALLEL_FOR is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_PARALLEL_FOR == 1 )
+
+#if( configPARALLEL_FOR_WORKERS > 0 )
+
+/* The calling task is participant 0, worker n is participant n + 1. */
+#define pfPARTICIPANTS		( ( UBaseType_t ) configPARALLEL_FOR_WORKERS + ( UBaseType_t ) 1 )
+#define pfINDEX_MASK		( ( uint32_t ) configPARALLEL_FOR_DEQUE_LENGTH - 1UL )
+
+#ifndef configPARALLEL_FOR_WORKER_NAME
+	#define configPARALLEL_FOR_WORKER_NAME "PFor"
+#endif
+
+/* A range of iterations that has not been started. */
+typedef struct xPARALLEL_RANGE
+{
+	uint32_t ulBegin;
+	uint32_t ulEnd;
+} ParallelRange_t;
+
+/* A Chase-Lev deque.  Its participant pushes and pops ranges at the bottom,
+other participants steal ranges from the top.  ulTop and ulBottom are free
+running, the deque holding the ranges from ulTop to ulBottom - 1. */
+typedef struct xPARALLEL_DEQUE
+{
+	volatile uint32_t ulTop;		/* Only updated by compare and swap. */
+	volatile uint32_t ulBottom;		/* Only updated by the deque's participant. */
+	ParallelRange_t xRanges[ configPARALLEL_FOR_DEQUE_LENGTH ];
+} ParallelDeque_t;
+
+/* The loop currently being executed.  Lives on the calling task's stack. */
+typedef struct xPARALLEL_JOB
+{
+	ParallelForFunction_t pxFunction;	/* NULL for a reduction. */
+	ParallelReduceFunction_t pxBody;	/* NULL for a loop. */
+	void *pvContext;
+	uint8_t *pucPartials;				/* The partial result of each chunk of a reduction. */
+	size_t xPartialSize;
+	uint32_t ulFirst;					/* The first iteration of the loop, where chunk 0 starts. */
+	uint32_t ulGrain;
+	volatile uint32_t ulRemaining;		/* The number of iterations not yet executed. */
+	volatile uint32_t ulWorkersDone;	/* The number of workers that have stopped taking part. */
+} ParallelJob_t;
+
+/*lint -save -e956 A manual analysis and inspection has been used to determine
+which static variables must be declared volatile. */
+
+PRIVILEGED_DATA static ParallelDeque_t xDeques[ pfPARTICIPANTS ];
+PRIVILEGED_DATA static TaskHandle_t xWorkers[ configPARALLEL_FOR_WORKERS ];
+PRIVILEGED_DATA static ParallelJob_t * volatile pxCurrentJob = NULL;
+PRIVILEGED_DATA static TaskHandle_t volatile xCurrentJobOwner = NULL;
+
+/* Serialises loops started by different tasks. */
+PRIVILEGED_DATA static SemaphoreHandle_t xJobMutex = NULL;
+
+/* Given by the last worker to stop taking part in a loop. */
+PRIVILEGED_DATA static SemaphoreHandle_t xJobDone = NULL;
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+	PRIVILEGED_DATA static StaticSemaphore_t xJobMutexBuffer;
+	PRIVILEGED_DATA static StaticSemaphore_t xJobDoneBuffer;
+	PRIVILEGED_DATA static StaticTask_t xWorkerTCBs[ configPARALLEL_FOR_WORKERS ];
+	PRIVILEGED_DATA static StackType_t xWorkerStacks[ configPARALLEL_FOR_WORKERS ][ configPARALLEL_FOR_WORKER_STACK_DEPTH ];
+#endif
+
+/*lint -restore */
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The worker task.  pvParameters points to the worker's deque.
+ */
+static void prvWorkerTask( void *pvParameters ) PRIVILEGED_FUNCTION;
+
+/*
+ * Executes a loop, either spread over the calling task and the workers or, if
+ * the calling task is already taking part in a loop, serially.
+ */
+static void prvRunJob( ParallelJob_t * const pxJob, uint32_t ulBegin, uint32_t ulEnd ) PRIVILEGED_FUNCTION;
+
+/*
+ * Takes and steals ranges of a loop until every iteration has been executed,
+ * or until no work has been found configPARALLEL_FOR_IDLE_SPINS times in
+ * succession.
+ */
+static void prvParticipate( ParallelJob_t * const pxJob, UBaseType_t uxParticipant ) PRIVILEGED_FUNCTION;
+
+/*
+ * Splits a range in halves, at a multiple of the grain from the first
+ * iteration of the loop, pushing the upper halves onto the participant's
+ * deque, until it is no larger than the grain, then executes it.
+ */
+static void prvExecuteRange( ParallelJob_t * const pxJob, UBaseType_t uxParticipant, ParallelRange_t xRange ) PRIVILEGED_FUNCTION;
+
+/*
+ * Calls the body of a loop or reduction for one range.
+ */
+static void prvCallBody( ParallelJob_t * const pxJob, uint32_t ulBegin, uint32_t ulEnd ) PRIVILEGED_FUNCTION;
+
+/*
+ * The Chase-Lev deque operations.  prvPush() and prvPop() are only called by
+ * the deque's participant, prvSteal() by any other participant.
+ */
+static BaseType_t prvPush( ParallelDeque_t * const pxDeque, uint32_t ulBegin, uint32_t ulEnd ) PRIVILEGED_FUNCTION;
+static BaseType_t prvPop( ParallelDeque_t * const pxDeque, ParallelRange_t * const pxRange ) PRIVILEGED_FUNCTION;
+static BaseType_t prvSteal( ParallelDeque_t * const pxDeque, ParallelRange_t * const pxRange ) PRIVILEGED_FUNCTION;
+
+#endif /* configPARALLEL_FOR_WORKERS */
+
+/*
+ * Executes the chunks of a reduction from ulBegin to ulEnd - 1, one call of
+ * the body per chunk, each accumulating into the chunk's own partial result.
+ * Chunk n starts at iteration ulFirst + ( n * ulGrain ), and ulBegin must be
+ * the start of a chunk.
+ */
+static void prvReduceChunks( ParallelReduceFunction_t pxBody, void *pvContext, uint32_t ulFirst, uint32_t ulGrain, uint32_t ulBegin, uint32_t ulEnd, uint8_t *pucPartials, size_t xPartialSize ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+BaseType_t xParallelForInit( void )
+{
+BaseType_t xReturn = pdPASS;
+
+	#if( configPARALLEL_FOR_WORKERS > 0 )
+	{
+	UBaseType_t uxWorker;
+
+		/* Must not be initialised twice. */
+		configASSERT( xJobMutex == NULL );
+
+		#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+		{
+			xJobMutex = xSemaphoreCreateMutex();
+			xJobDone = xSemaphoreCreateBinary();
+		}
+		#else
+		{
+			xJobMutex = xSemaphoreCreateMutexStatic( &xJobMutexBuffer );
+			xJobDone = xSemaphoreCreateBinaryStatic( &xJobDoneBuffer );
+		}
+		#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+		if( ( xJobMutex == NULL ) || ( xJobDone == NULL ) )
+		{
+			xReturn = pdFAIL;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		for( uxWorker = 0; ( uxWorker < ( UBaseType_t ) configPARALLEL_FOR_WORKERS ) && ( xReturn == pdPASS ); uxWorker++ )
+		{
+			#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+			{
+				if( xTaskCreate( prvWorkerTask,
+								 configPARALLEL_FOR_WORKER_NAME,
+								 configPARALLEL_FOR_WORKER_STACK_DEPTH,
+								 ( void * ) &( xDeques[ uxWorker + 1 ] ),
+								 ( UBaseType_t ) configPARALLEL_FOR_WORKER_PRIORITY | portPRIVILEGE_BIT,
+								 &( xWorkers[ uxWorker ] ) ) != pdPASS )
+				{
+					xReturn = pdFAIL;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#else
+			{
+				xWorkers[ uxWorker ] = xTaskCreateStatic( prvWorkerTask,
+														  configPARALLEL_FOR_WORKER_NAME,
+														  configPARALLEL_FOR_WORKER_STACK_DEPTH,
+														  ( void * ) &( xDeques[ uxWorker + 1 ] ),
+														  ( UBaseType_t ) configPARALLEL_FOR_WORKER_PRIORITY | portPRIVILEGE_BIT,
+														  xWorkerStacks[ uxWorker ],
+														  &( xWorkerTCBs[ uxWorker ] ) );
+
+				if( xWorkers[ uxWorker ] == NULL )
+				{
+					xReturn = pdFAIL;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+		}
+	}
+	#endif /* configPARALLEL_FOR_WORKERS */
+
+	configASSERT( xReturn );
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vParallelFor( uint32_t ulBegin, uint32_t ulEnd, uint32_t ulGrain, ParallelForFunction_t pxFunction, void *pvContext )
+{
+	configASSERT( pxFunction );
+
+	#if( configPARALLEL_FOR_WORKERS > 0 )
+	{
+	ParallelJob_t xJob;
+
+		xJob.pxFunction = pxFunction;
+		xJob.pxBody = NULL;
+		xJob.pvContext = pvContext;
+		xJob.pucPartials = NULL;
+		xJob.xPartialSize = 0;
+		xJob.ulFirst = ulBegin;
+		xJob.ulGrain = ulGrain;
+
+		prvRunJob( &xJob, ulBegin, ulEnd );
+	}
+	#else
+	{
+		( void ) ulGrain;
+
+		if( ulEnd > ulBegin )
+		{
+			pxFunction( pvContext, ulBegin, ulEnd );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configPARALLEL_FOR_WORKERS */
+}
+/*-----------------------------------------------------------*/
+
+void vParallelReduce( uint32_t ulBegin, uint32_t ulEnd, uint32_t ulGrain, ParallelReduceFunction_t pxBody, ParallelCombineFunction_t pxCombine, void *pvContext, void *pvResult, void *pvPartials, size_t xPartialSize )
+{
+uint8_t * const pucPartials = ( uint8_t * ) pvPartials;
+uint32_t ulChunk, ulChunks;
+
+	configASSERT( pxBody );
+	configASSERT( pxCombine );
+	configASSERT( pvResult );
+
+	if( ulGrain == 0UL )
+	{
+		ulGrain = 1UL;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	#if( configPARALLEL_FOR_WORKERS > 0 )
+	{
+		configASSERT( pucPartials );
+	}
+	#endif /* configPARALLEL_FOR_WORKERS */
+
+	if( ulEnd <= ulBegin )
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+	else if( pucPartials == NULL )
+	{
+		/* Only possible without worker tasks.  The whole range is a single
+		chunk. */
+		pxBody( pvContext, ulBegin, ulEnd, pvResult );
+	}
+	else
+	{
+		configASSERT( xPartialSize > ( size_t ) 0 );
+
+		ulChunks = parallelforREDUCE_CHUNKS( ulEnd - ulBegin, ulGrain );
+
+		/* Each chunk's partial result starts as the identity. */
+		for( ulChunk = 0; ulChunk < ulChunks; ulChunk++ )
+		{
+			memcpy( ( void * ) &( pucPartials[ ulChunk * xPartialSize ] ), pvResult, xPartialSize );
+		}
+
+		#if( configPARALLEL_FOR_WORKERS > 0 )
+		{
+		ParallelJob_t xJob;
+
+			xJob.pxFunction = NULL;
+			xJob.pxBody = pxBody;
+			xJob.pvContext = pvContext;
+			xJob.pucPartials = pucPartials;
+			xJob.xPartialSize = xPartialSize;
+			xJob.ulFirst = ulBegin;
+			xJob.ulGrain = ulGrain;
+
+			prvRunJob( &xJob, ulBegin, ulEnd );
+		}
+		#else
+		{
+			prvReduceChunks( pxBody, pvContext, ulBegin, ulGrain, ulBegin, ulEnd, pucPartials, xPartialSize );
+		}
+		#endif /* configPARALLEL_FOR_WORKERS */
+
+		/* Which participant executed a chunk, and when, has no effect on its
+		partial result, and the partial results are always combined in chunk
+		order, so the result is the same on every run. */
+		for( ulChunk = 0; ulChunk < ulChunks; ulChunk++ )
+		{
+			pxCombine( pvContext, pvResult, ( const void * ) &( pucPartials[ ulChunk * xPartialSize ] ) );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+#if( configPARALLEL_FOR_WORKERS > 0 )
+
+	static void prvRunJob( ParallelJob_t * const pxJob, uint32_t ulBegin, uint32_t ulEnd )
+	{
+	TaskHandle_t xCurrentTask;
+	UBaseType_t uxWorker;
+	BaseType_t xNested = pdFALSE;
+
+		/* xParallelForInit() must be called first. */
+		configASSERT( xJobMutex );
+
+		if( pxJob->ulGrain == 0UL )
+		{
+			pxJob->ulGrain = 1UL;
+		}
+
+		/* A loop started from the body of another loop is executed serially,
+		as the participants of the outer loop are all busy. */
+		xCurrentTask = xTaskGetCurrentTaskHandle();
+
+		if( xCurrentTask == xCurrentJobOwner )
+		{
+			xNested = pdTRUE;
+		}
+
+		for( uxWorker = 0; uxWorker < ( UBaseType_t ) configPARALLEL_FOR_WORKERS; uxWorker++ )
+		{
+			if( xCurrentTask == xWorkers[ uxWorker ] )
+			{
+				xNested = pdTRUE;
+			}
+		}
+
+		if( ulEnd <= ulBegin )
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+		else if( xNested != pdFALSE )
+		{
+			prvCallBody( pxJob, ulBegin, ulEnd );
+		}
+		else
+		{
+			( void ) xSemaphoreTake( xJobMutex, portMAX_DELAY );
+			{
+				pxJob->ulRemaining = ulEnd - ulBegin;
+				pxJob->ulWorkersDone = 0UL;
+
+				/* Every deque is empty between loops. */
+				configASSERT( xDeques[ 0 ].ulTop == xDeques[ 0 ].ulBottom );
+				( void ) prvPush( &( xDeques[ 0 ] ), ulBegin, ulEnd );
+
+				xCurrentJobOwner = xCurrentTask;
+				pxCurrentJob = pxJob;
+				portMEMORY_BARRIER();
+
+				for( uxWorker = 0; uxWorker < ( UBaseType_t ) configPARALLEL_FOR_WORKERS; uxWorker++ )
+				{
+					( void ) xTaskNotifyGive( xWorkers[ uxWorker ] );
+				}
+
+				prvParticipate( pxJob, ( UBaseType_t ) 0 );
+
+				/* A worker only stops taking part once its own deque is
+				empty, and nothing else pushes onto it, so when every worker
+				has stopped all the work has been done. */
+				( void ) xSemaphoreTake( xJobDone, portMAX_DELAY );
+				configASSERT( pxJob->ulRemaining == 0UL );
+
+				pxCurrentJob = NULL;
+				xCurrentJobOwner = NULL;
+			}
+			( void ) xSemaphoreGive( xJobMutex );
+		}
+	}
+
+#endif /* configPARALLEL_FOR_WORKERS */
+/*-----------------------------------------------------------*/
+
+#if( configPARALLEL_FOR_WORKERS > 0 )
+
+	static void prvWorkerTask( void *pvParameters )
+	{
+	ParallelDeque_t * const pxDeque = ( ParallelDeque_t * ) pvParameters;
+	const UBaseType_t uxParticipant = ( UBaseType_t ) ( pxDeque - xDeques );
+	ParallelJob_t *pxJob;
+
+		for( ;; )
+		{
+			( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+			pxJob = pxCurrentJob;
+			configASSERT( pxJob );
+
+			prvParticipate( pxJob, uxParticipant );
+
+			/* The calling task's stack, where the job lives, can be reused as
+			soon as the last worker has stopped, so the job must not be
+			accessed after this. */
+			if( ulAtomicAdd( &( pxJob->ulWorkersDone ), 1UL ) == ( ( uint32_t ) configPARALLEL_FOR_WORKERS - 1UL ) )
+			{
+				( void ) xSemaphoreGive( xJobDone );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+
+#endif /* configPARALLEL_FOR_WORKERS */
+/*-----------------------------------------------------------*/
+
+#if( configPARALLEL_FOR_WORKERS > 0 )
+
+	static void prvParticipate( ParallelJob_t * const pxJob, UBaseType_t uxParticipant )
+	{
+	ParallelRange_t xRange;
+	UBaseType_t uxOffset, uxVictim, uxIdleSpins = 0;
+
+		while( ( pxJob->ulRemaining != 0UL ) && ( uxIdleSpins < ( UBaseType_t ) configPARALLEL_FOR_IDLE_SPINS ) )
+		{
+			if( prvPop( &( xDeques[ uxParticipant ] ), &xRange ) == pdPASS )
+			{
+				prvExecuteRange( pxJob, uxParticipant, xRange );
+				uxIdleSpins = 0;
+			}
+			else
+			{
+				/* The participant's own deque is empty, so try to steal from
+				the others, starting with the next one. */
+				for( uxOffset = 1; uxOffset < pfPARTICIPANTS; uxOffset++ )
+				{
+					uxVictim = ( uxParticipant + uxOffset ) % pfPARTICIPANTS;
+
+					if( prvSteal( &( xDeques[ uxVictim ] ), &xRange ) == pdPASS )
+					{
+						break;
+					}
+				}
+
+				if( uxOffset < pfPARTICIPANTS )
+				{
+					prvExecuteRange( pxJob, uxParticipant, xRange );
+					uxIdleSpins = 0;
+				}
+				else
+				{
+					/* The remaining iterations are being executed, or split,
+					by other participants.  Look again, but not forever, as a
+					participant that spins on a single core can stop the
+					participants that have the work from running. */
+					uxIdleSpins++;
+					taskYIELD();
+				}
+			}
+		}
+	}
+
+#endif /* configPARALLEL_FOR_WORKERS */
+/*-----------------------------------------------------------*/
+
+#if( configPARALLEL_FOR_WORKERS > 0 )
+
+	static void prvExecuteRange( ParallelJob_t * const pxJob, UBaseType_t uxParticipant, ParallelRange_t xRange )
+	{
+	uint32_t ulMiddle;
+
+		while( ( xRange.ulEnd - xRange.ulBegin ) > pxJob->ulGrain )
+		{
+			/* Split at a chunk boundary, so every range is made of whole
+			chunks wherever it is executed. */
+			ulMiddle = xRange.ulBegin + ( ( parallelforREDUCE_CHUNKS( xRange.ulEnd - xRange.ulBegin, pxJob->ulGrain ) / 2UL ) * pxJob->ulGrain );
+
+			if( prvPush( &( xDeques[ uxParticipant ] ), ulMiddle, xRange.ulEnd ) != pdPASS )
+			{
+				/* The deque is full, so execute the rest of the range here. */
+				break;
+			}
+
+			xRange.ulEnd = ulMiddle;
+		}
+
+		prvCallBody( pxJob, xRange.ulBegin, xRange.ulEnd );
+
+		/* Adding the two's complement subtracts the number of iterations
+		executed. */
+		( void ) ulAtomicAdd( &( pxJob->ulRemaining ), ( uint32_t ) ( ~( xRange.ulEnd - xRange.ulBegin ) + 1UL ) );
+	}
+
+#endif /* configPARALLEL_FOR_WORKERS */
+/*-----------------------------------------------------------*/
+
+#if( configPARALLEL_FOR_WORKERS > 0 )
+
+	static void prvCallBody( ParallelJob_t * const pxJob, uint32_t ulBegin, uint32_t ulEnd )
+	{
+		if( pxJob->pxBody != NULL )
+		{
+			prvReduceChunks( pxJob->pxBody, pxJob->pvContext, pxJob->ulFirst, pxJob->ulGrain, ulBegin, ulEnd, pxJob->pucPartials, pxJob->xPartialSize );
+		}
+		else
+		{
+			pxJob->pxFunction( pxJob->pvContext, ulBegin, ulEnd );
+		}
+	}
+
+#endif /* configPARALLEL_FOR_WORKERS */
+/*-----------------------------------------------------------*/
+
+#if( configPARALLEL_FOR_WORKERS > 0 )
+
+	static BaseType_t prvPush( ParallelDeque_t * const pxDeque, uint32_t ulBegin, uint32_t ulEnd )
+	{
+	uint32_t ulBottom, ulTop;
+	BaseType_t xReturn;
+
+		ulBottom = pxDeque->ulBottom;
+		ulTop = pxDeque->ulTop;
+
+		if( ( ulBottom - ulTop ) < ( uint32_t ) configPARALLEL_FOR_DEQUE_LENGTH )
+		{
+			pxDeque->xRanges[ ulBottom & pfINDEX_MASK ].ulBegin = ulBegin;
+			pxDeque->xRanges[ ulBottom & pfINDEX_MASK ].ulEnd = ulEnd;
+
+			/* Publish the range to thieves. */
+			portMEMORY_BARRIER();
+			pxDeque->ulBottom = ulBottom + 1UL;
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = pdFAIL;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configPARALLEL_FOR_WORKERS */
+/*-----------------------------------------------------------*/
+
+#if( configPARALLEL_FOR_WORKERS > 0 )
+
+	static BaseType_t prvPop( ParallelDeque_t * const pxDeque, ParallelRange_t * const pxRange )
+	{
+	uint32_t ulBottom, ulTop;
+	int32_t lSize;
+	BaseType_t xReturn;
+
+		/* Claim the bottom range before looking at ulTop, so a thief that
+		reads ulBottom after this cannot also take it. */
+		ulBottom = pxDeque->ulBottom - 1UL;
+		pxDeque->ulBottom = ulBottom;
+		portMEMORY_BARRIER();
+		ulTop = pxDeque->ulTop;
+
+		lSize = ( int32_t ) ( ulBottom - ulTop );
+
+		if( lSize < 0 )
+		{
+			/* The deque was empty. */
+			pxDeque->ulBottom = ulTop;
+			xReturn = pdFAIL;
+		}
+		else
+		{
+			*pxRange = pxDeque->xRanges[ ulBottom & pfINDEX_MASK ];
+			xReturn = pdPASS;
+
+			if( lSize == 0 )
+			{
+				/* This was the last range, which a thief may be taking at the
+				same time.  Whoever advances ulTop first has it. */
+				if( ulAtomicCompareAndSwap( &( pxDeque->ulTop ), ulTop + 1UL, ulTop ) != atomicCOMPARE_AND_SWAP_SUCCESS )
+				{
+					xReturn = pdFAIL;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				pxDeque->ulBottom = ulTop + 1UL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		return xReturn;
+	}
+
+#endif /* configPARALLEL_FOR_WORKERS */
+/*-----------------------------------------------------------*/
+
+#if( configPARALLEL_FOR_WORKERS > 0 )
+
+	static BaseType_t prvSteal( ParallelDeque_t * const pxDeque, ParallelRange_t * const pxRange )
+	{
+	uint32_t ulBottom, ulTop;
+	ParallelRange_t xRange;
+	BaseType_t xReturn = pdFAIL;
+
+		ulTop = pxDeque->ulTop;
+		portMEMORY_BARRIER();
+		ulBottom = pxDeque->ulBottom;
+
+		if( ( int32_t ) ( ulBottom - ulTop ) > 0 )
+		{
+			/* If the range is taken by the owner or another thief before the
+			swap, the copy may be stale, but the swap then fails. */
+			xRange = pxDeque->xRanges[ ulTop & pfINDEX_MASK ];
+			portMEMORY_BARRIER();
+
+			if( ulAtomicCompareAndSwap( &( pxDeque->ulTop ), ulTop + 1UL, ulTop ) == atomicCOMPARE_AND_SWAP_SUCCESS )
+			{
+				*pxRange = xRange;
+				xReturn = pdPASS;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configPARALLEL_FOR_WORKERS */
+/*-----------------------------------------------------------*/
+
+static void prvReduceChunks( ParallelReduceFunction_t pxBody, void *pvContext, uint32_t ulFirst, uint32_t ulGrain, uint32_t ulBegin, uint32_t ulEnd, uint8_t *pucPartials, size_t xPartialSize )
+{
+uint32_t ulChunkEnd;
+
+	configASSERT( ( ( ulBegin - ulFirst ) % ulGrain ) == 0UL );
+
+	while( ulBegin < ulEnd )
+	{
+		ulChunkEnd = ulBegin + configMIN( ulGrain, ulEnd - ulBegin );
+		pxBody( pvContext, ulBegin, ulChunkEnd, ( void * ) &( pucPartials[ ( ( ulBegin - ulFirst ) / ulGrain ) * xPartialSize ] ) );
+		ulBegin = ulChunkEnd;
+	}
+}
+
+/* This entire source file will be skipped if the application is not configured
+to include parallel loop functionality.  This #if is closed at the very bottom
+of this file.  If you want to include parallel loops then ensure
+configUSE_PARALLEL_FOR is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_PARALLEL_FOR == 1 */
@@ -202,6 +202,63 @@ static size_t prvReadBytesFromBuffer( StreamBuffer_t *pxStreamBuffer,
 									  size_t xMaxCount,
 									  size_t xBytesAvailable ); PRIVILEGED_FUNCTION
 
+/*
+ * Copies xCount bytes from pucData into the buffer's storage area, starting at
+ * index xHead and wrapping back to the start of the storage area if necessary.
+ * Returns the index of the byte that follows the last byte written.  The
+ * buffer's head is not updated, so the caller can make several copies before
+ * making all the data visible to the reader at once.
+ */
+static size_t prvCopyBytesToBuffer( const StreamBuffer_t * const pxStreamBuffer,
+									const uint8_t *pucData,
+									size_t xCount,
+									size_t xHead ) PRIVILEGED_FUNCTION;
+
+/*
+ * Copies xCount bytes out of the buffer's storage area, starting at index
+ * xTail, into pucData.  Returns the index of the byte that follows the last
+ * byte read.  The buffer's tail is not updated.
+ */
+static size_t prvCopyBytesFromBuffer( const StreamBuffer_t * const pxStreamBuffer,
+									  uint8_t *pucData,
+									  size_t xCount,
+									  size_t xTail ) PRIVILEGED_FUNCTION;
+
+/*
+ * Blocks the calling task for up to xTicksToWait ticks until at least
+ * xRequiredSpace bytes are free in the buffer.  Returns the free space.
+ */
+static size_t prvWaitForSpace( StreamBuffer_t * const pxStreamBuffer,
+							   size_t xRequiredSpace,
+							   TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Blocks the calling task for up to xTicksToWait ticks until more than
+ * xBytesToStoreMessageLength bytes are in the buffer.  Returns the number of
+ * bytes in the buffer.
+ */
+static size_t prvWaitForData( StreamBuffer_t * const pxStreamBuffer,
+							  size_t xBytesToStoreMessageLength,
+							  TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Describes the xCount bytes of the buffer's storage area that start at index
+ * xStart as two segments.  The second segment has a length of zero unless the
+ * bytes wrap around the end of the storage area.
+ */
+static void prvGetSegments( const StreamBuffer_t * const pxStreamBuffer,
+							size_t xStart,
+							size_t xCount,
+							StreamBufferSegment_t * const pxSegments ) PRIVILEGED_FUNCTION;
+
+/*
+ * Moves the head (write) or tail (read) of the buffer on by the number of bytes
+ * the application has written to, or read from, the segments returned by
+ * xStreamBufferWriteReserve() or xStreamBufferReadReserve().
+ */
+static void prvCommitWrite( StreamBuffer_t * const pxStreamBuffer, size_t xBytesWritten ) PRIVILEGED_FUNCTION;
+static void prvCommitRead( StreamBuffer_t * const pxStreamBuffer, size_t xBytesRead ) PRIVILEGED_FUNCTION;
+
 /*
  * Called by both pxStreamBufferCreate() and pxStreamBufferCreateStatic() to
  * initialise the members of the newly created stream buffer structure.
@@ -490,9 +547,8 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
 						  TickType_t xTicksToWait )
 {
 StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
-size_t xReturn, xSpace = 0;
+size_t xReturn, xSpace;
 size_t xRequiredSpace = xDataLengthBytes;
-TimeOut_t xTimeOut;
 
 	configASSERT( pvTxData );
 	configASSERT( pxStreamBuffer );
@@ -510,55 +566,7 @@ TimeOut_t xTimeOut;
 		mtCOVERAGE_TEST_MARKER();
 	}
 
-	if( xTicksToWait != ( TickType_t ) 0 )
-	{
-		vTaskSetTimeOutState( &xTimeOut );
-
-		do
-		{
-			/* Wait until the required number of bytes are free in the message
-			buffer. */
-			taskENTER_CRITICAL();
-			{
-				xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
-
-				if( xSpace < xRequiredSpace )
-				{
-					/* Clear notification state as going to wait for space. */
-					( void ) xTaskNotifyStateClear( NULL );
-
-					/* Should only be one writer. */
-					configASSERT( pxStreamBuffer->xTaskWaitingToSend == NULL );
-					pxStreamBuffer->xTaskWaitingToSend = xTaskGetCurrentTaskHandle();
-				}
-				else
-				{
-					taskEXIT_CRITICAL();
-					break;
-				}
-			}
-			taskEXIT_CRITICAL();
-
-			traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer );
-			( void ) xTaskNotifyWait( ( uint32_t ) 0, UINT32_MAX, NULL, xTicksToWait );
-			pxStreamBuffer->xTaskWaitingToSend = NULL;
-
-		} while( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE );
-	}
-	else
-	{
-		mtCOVERAGE_TEST_MARKER();
-	}
-
-	if( xSpace == ( size_t ) 0 )
-	{
-		xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
-	}
-	else
-	{
-		mtCOVERAGE_TEST_MARKER();
-	}
-
+	xSpace = prvWaitForSpace( pxStreamBuffer, xRequiredSpace, xTicksToWait );
 	xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pvTxData, xDataLengthBytes, xSpace, xRequiredSpace );
 
 	if( xReturn > ( size_t ) 0 )
@@ -713,54 +721,7 @@ size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
 		xBytesToStoreMessageLength = 0;
 	}
 
-	if( xTicksToWait != ( TickType_t ) 0 )
-	{
-		/* Checking if there is data and clearing the notification state must be
-		performed atomically. */
-		taskENTER_CRITICAL();
-		{
-			xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
-
-			/* If this function was invoked by a message buffer read then
-			xBytesToStoreMessageLength holds the number of bytes used to hold
-			the length of the next discrete message.  If this function was
-			invoked by a stream buffer read then xBytesToStoreMessageLength will
-			be 0. */
-			if( xBytesAvailable <= xBytesToStoreMessageLength )
-			{
-				/* Clear notification state as going to wait for data. */
-				( void ) xTaskNotifyStateClear( NULL );
-
-				/* Should only be one reader. */
-				configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
-				pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
-			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
-		}
-		taskEXIT_CRITICAL();
-
-		if( xBytesAvailable <= xBytesToStoreMessageLength )
-		{
-			/* Wait for data to be available. */
-			traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer );
-			( void ) xTaskNotifyWait( ( uint32_t ) 0, UINT32_MAX, NULL, xTicksToWait );
-			pxStreamBuffer->xTaskWaitingToReceive = NULL;
-
-			/* Recheck the data available after blocking. */
-			xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
-		}
-		else
-		{
-			mtCOVERAGE_TEST_MARKER();
-		}
-	}
-	else
-	{
-		xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
-	}
+	xBytesAvailable = prvWaitForData( pxStreamBuffer, xBytesToStoreMessageLength, xTicksToWait );
 
 	/* Whether receiving a discrete message (where xBytesToStoreMessageLength
 	holds the number of bytes used to store the message length) or a stream of
@@ -1017,22 +978,18 @@ UBaseType_t uxSavedInterruptStatus;
 }
 /*-----------------------------------------------------------*/
 
-static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer, const uint8_t *pucData, size_t xCount )
+static size_t prvCopyBytesToBuffer( const StreamBuffer_t * const pxStreamBuffer, const uint8_t *pucData, size_t xCount, size_t xHead )
 {
-size_t xNextHead, xFirstLength;
-
-	configASSERT( xCount > ( size_t ) 0 );
-
-	xNextHead = pxStreamBuffer->xHead;
+size_t xFirstLength;
 
 	/* Calculate the number of bytes that can be added in the first write -
 	which may be less than the total number of bytes that need to be added if
 	the buffer will wrap back to the beginning. */
-	xFirstLength = configMIN( pxStreamBuffer->xLength - xNextHead, xCount );
+	xFirstLength = configMIN( pxStreamBuffer->xLength - xHead, xCount );
 
 	/* Write as many bytes as can be written in the first write. */
-	configASSERT( ( xNextHead + xFirstLength ) <= pxStreamBuffer->xLength );
-	memcpy( ( void* ) ( &( pxStreamBuffer->pucBuffer[ xNextHead ] ) ), ( const void * ) pucData, xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+	configASSERT( ( xHead + xFirstLength ) <= pxStreamBuffer->xLength );
+	memcpy( ( void* ) ( &( pxStreamBuffer->pucBuffer[ xHead ] ) ), ( const void * ) pucData, xFirstLength ); /*lint !e9087 memcpy() requires void *. */
 
 	/* If the number of bytes written was less than the number that could be
 	written in the first write... */
@@ -1047,67 +1004,83 @@ size_t xNextHead, xFirstLength;
 		mtCOVERAGE_TEST_MARKER();
 	}
 
-	xNextHead += xCount;
-	if( xNextHead >= pxStreamBuffer->xLength )
+	xHead += xCount;
+	if( xHead >= pxStreamBuffer->xLength )
 	{
-		xNextHead -= pxStreamBuffer->xLength;
+		xHead -= pxStreamBuffer->xLength;
 	}
 	else
 	{
 		mtCOVERAGE_TEST_MARKER();
 	}
 
-	pxStreamBuffer->xHead = xNextHead;
+	return xHead;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer, const uint8_t *pucData, size_t xCount )
+{
+	configASSERT( xCount > ( size_t ) 0 );
+
+	pxStreamBuffer->xHead = prvCopyBytesToBuffer( pxStreamBuffer, pucData, xCount, pxStreamBuffer->xHead );
 
 	return xCount;
 }
 /*-----------------------------------------------------------*/
 
-static size_t prvReadBytesFromBuffer( StreamBuffer_t *pxStreamBuffer, uint8_t *pucData, size_t xMaxCount, size_t xBytesAvailable )
+static size_t prvCopyBytesFromBuffer( const StreamBuffer_t * const pxStreamBuffer, uint8_t *pucData, size_t xCount, size_t xTail )
 {
-size_t xCount, xFirstLength, xNextTail;
+size_t xFirstLength;
 
-	/* Use the minimum of the wanted bytes and the available bytes. */
-	xCount = configMIN( xBytesAvailable, xMaxCount );
+	/* Calculate the number of bytes that can be read - which may be
+	less than the number wanted if the data wraps around to the start of
+	the buffer. */
+	xFirstLength = configMIN( pxStreamBuffer->xLength - xTail, xCount );
 
-	if( xCount > ( size_t ) 0 )
+	/* Obtain the number of bytes it is possible to obtain in the first
+	read.  Asserts check bounds of read and write. */
+	configASSERT( ( xTail + xFirstLength ) <= pxStreamBuffer->xLength );
+	memcpy( ( void * ) pucData, ( const void * ) &( pxStreamBuffer->pucBuffer[ xTail ] ), xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+
+	/* If the total number of wanted bytes is greater than the number
+	that could be read in the first read... */
+	if( xCount > xFirstLength )
 	{
-		xNextTail = pxStreamBuffer->xTail;
+		/*...then read the remaining bytes from the start of the buffer. */
+		memcpy( ( void * ) &( pucData[ xFirstLength ] ), ( void * ) ( pxStreamBuffer->pucBuffer ), xCount - xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
 
-		/* Calculate the number of bytes that can be read - which may be
-		less than the number wanted if the data wraps around to the start of
-		the buffer. */
-		xFirstLength = configMIN( pxStreamBuffer->xLength - xNextTail, xCount );
+	xTail += xCount;
 
-		/* Obtain the number of bytes it is possible to obtain in the first
-		read.  Asserts check bounds of read and write. */
-		configASSERT( xFirstLength <= xMaxCount );
-		configASSERT( ( xNextTail + xFirstLength ) <= pxStreamBuffer->xLength );
-		memcpy( ( void * ) pucData, ( const void * ) &( pxStreamBuffer->pucBuffer[ xNextTail ] ), xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+	if( xTail >= pxStreamBuffer->xLength )
+	{
+		xTail -= pxStreamBuffer->xLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
 
-		/* If the total number of wanted bytes is greater than the number
-		that could be read in the first read... */
-		if( xCount > xFirstLength )
-		{
-			/*...then read the remaining bytes from the start of the buffer. */
-			configASSERT( xCount <= xMaxCount );
-			memcpy( ( void * ) &( pucData[ xFirstLength ] ), ( void * ) ( pxStreamBuffer->pucBuffer ), xCount - xFirstLength ); /*lint !e9087 memcpy() requires void *. */
-		}
-		else
-		{
-			mtCOVERAGE_TEST_MARKER();
-		}
+	return xTail;
+}
+/*-----------------------------------------------------------*/
 
-		/* Move the tail pointer to effectively remove the data read from
-		the buffer. */
-		xNextTail += xCount;
+static size_t prvReadBytesFromBuffer( StreamBuffer_t *pxStreamBuffer, uint8_t *pucData, size_t xMaxCount, size_t xBytesAvailable )
+{
+size_t xCount;
 
-		if( xNextTail >= pxStreamBuffer->xLength )
-		{
-			xNextTail -= pxStreamBuffer->xLength;
-		}
+	/* Use the minimum of the wanted bytes and the available bytes. */
+	xCount = configMIN( xBytesAvailable, xMaxCount );
 
-		pxStreamBuffer->xTail = xNextTail;
+	if( xCount > ( size_t ) 0 )
+	{
+		/* Move the tail pointer to effectively remove the data read from
+		the buffer. */
+		pxStreamBuffer->xTail = prvCopyBytesFromBuffer( pxStreamBuffer, pucData, xCount, pxStreamBuffer->xTail );
 	}
 	else
 	{
@@ -1197,3 +1170,506 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
 
 #endif /* configUSE_TRACE_FACILITY */
 /*-----------------------------------------------------------*/
+
+size_t xStreamBufferSendV( StreamBufferHandle_t xStreamBuffer,
+						   const StreamBufferSegment_t * const pxSegments,
+						   size_t xSegmentCount,
+						   TickType_t xTicksToWait )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+size_t xReturn = 0, xSpace, xSegment, xCount, xHead;
+size_t xDataLengthBytes = 0, xRequiredSpace, xBytesToWrite;
+
+	configASSERT( pxSegments );
+	configASSERT( pxStreamBuffer );
+
+	for( xSegment = 0; xSegment < xSegmentCount; xSegment++ )
+	{
+		xDataLengthBytes += pxSegments[ xSegment ].xLength;
+	}
+
+	xRequiredSpace = xDataLengthBytes;
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		xRequiredSpace += sbBYTES_TO_STORE_MESSAGE_LENGTH;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	xSpace = prvWaitForSpace( pxStreamBuffer, xRequiredSpace, xTicksToWait );
+	xHead = pxStreamBuffer->xHead;
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 )
+	{
+		/* Stream buffer - write as many bytes as possible. */
+		xBytesToWrite = configMIN( xDataLengthBytes, xSpace );
+	}
+	else if( ( xSpace >= xRequiredSpace ) && ( xDataLengthBytes > ( size_t ) 0 ) )
+	{
+		/* Message buffer - the segments are gathered into a single message,
+		which is preceded by its length. */
+		xBytesToWrite = xDataLengthBytes;
+		xHead = prvCopyBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) &xDataLengthBytes, sbBYTES_TO_STORE_MESSAGE_LENGTH, xHead );
+	}
+	else
+	{
+		xBytesToWrite = 0;
+	}
+
+	if( xBytesToWrite > ( size_t ) 0 )
+	{
+		for( xSegment = 0; ( xSegment < xSegmentCount ) && ( xReturn < xBytesToWrite ); xSegment++ )
+		{
+			xCount = configMIN( pxSegments[ xSegment ].xLength, xBytesToWrite - xReturn );
+
+			if( xCount > ( size_t ) 0 )
+			{
+				xHead = prvCopyBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) pxSegments[ xSegment ].pvData, xCount, xHead );
+				xReturn += xCount;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		/* Only now make the data, including the length of a message, visible
+		to the reader. */
+		pxStreamBuffer->xHead = xHead;
+
+		traceSTREAM_BUFFER_SEND( xStreamBuffer, xReturn );
+
+		/* Was a task waiting for the data? */
+		if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+		{
+			sbSEND_COMPLETED( pxStreamBuffer );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		traceSTREAM_BUFFER_SEND_FAILED( xStreamBuffer );
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceiveV( StreamBufferHandle_t xStreamBuffer,
+							  const StreamBufferSegment_t * const pxSegments,
+							  size_t xSegmentCount,
+							  TickType_t xTicksToWait )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
+size_t xSegment, xCount, xTail, xCapacity = 0, xBytesToRead, xNextMessageLength;
+
+	configASSERT( pxSegments );
+	configASSERT( pxStreamBuffer );
+
+	for( xSegment = 0; xSegment < xSegmentCount; xSegment++ )
+	{
+		xCapacity += pxSegments[ xSegment ].xLength;
+	}
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
+	}
+	else
+	{
+		xBytesToStoreMessageLength = 0;
+	}
+
+	xBytesAvailable = prvWaitForData( pxStreamBuffer, xBytesToStoreMessageLength, xTicksToWait );
+
+	if( xBytesAvailable > xBytesToStoreMessageLength )
+	{
+		xTail = pxStreamBuffer->xTail;
+
+		if( xBytesToStoreMessageLength != ( size_t ) 0 )
+		{
+			/* Read the length of the next message.  The tail is only updated
+			once the message itself has been read, so the message is left in
+			the buffer if it will not fit in the segments provided. */
+			xTail = prvCopyBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xNextMessageLength, xBytesToStoreMessageLength, xTail );
+
+			if( xNextMessageLength <= xCapacity )
+			{
+				xBytesToRead = xNextMessageLength;
+			}
+			else
+			{
+				xBytesToRead = 0;
+			}
+		}
+		else
+		{
+			xBytesToRead = configMIN( xBytesAvailable, xCapacity );
+		}
+
+		for( xSegment = 0; ( xSegment < xSegmentCount ) && ( xReceivedLength < xBytesToRead ); xSegment++ )
+		{
+			xCount = configMIN( pxSegments[ xSegment ].xLength, xBytesToRead - xReceivedLength );
+
+			if( xCount > ( size_t ) 0 )
+			{
+				xTail = prvCopyBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) pxSegments[ xSegment ].pvData, xCount, xTail );
+				xReceivedLength += xCount;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		/* Was a task waiting for space in the buffer? */
+		if( xReceivedLength != ( size_t ) 0 )
+		{
+			pxStreamBuffer->xTail = xTail;
+			traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReceivedLength );
+			sbRECEIVE_COMPLETED( pxStreamBuffer );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		traceSTREAM_BUFFER_RECEIVE_FAILED( xStreamBuffer );
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReceivedLength;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferWriteReserve( StreamBufferHandle_t xStreamBuffer,
+								  StreamBufferSegment_t pxSegments[ 2 ] )
+{
+const StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+size_t xSpace;
+
+	configASSERT( pxSegments );
+	configASSERT( pxStreamBuffer );
+
+	/* Message buffers must write the length of each message, so cannot be
+	written in place. */
+	configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+	/* Only the writer moves the head, so the free space can only grow (as the
+	reader moves the tail) until vStreamBufferWriteCommit() is called. */
+	xSpace = xStreamBufferSpacesAvailable( xStreamBuffer );
+	prvGetSegments( pxStreamBuffer, pxStreamBuffer->xHead, xSpace, pxSegments );
+
+	return xSpace;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCommitWrite( StreamBuffer_t * const pxStreamBuffer, size_t xBytesWritten )
+{
+size_t xNextHead;
+
+	configASSERT( xBytesWritten <= xStreamBufferSpacesAvailable( pxStreamBuffer ) );
+
+	xNextHead = pxStreamBuffer->xHead + xBytesWritten;
+
+	if( xNextHead >= pxStreamBuffer->xLength )
+	{
+		xNextHead -= pxStreamBuffer->xLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	pxStreamBuffer->xHead = xNextHead;
+}
+/*-----------------------------------------------------------*/
+
+void vStreamBufferWriteCommit( StreamBufferHandle_t xStreamBuffer, size_t xBytesWritten )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+
+	configASSERT( pxStreamBuffer );
+
+	if( xBytesWritten > ( size_t ) 0 )
+	{
+		prvCommitWrite( pxStreamBuffer, xBytesWritten );
+		traceSTREAM_BUFFER_SEND( xStreamBuffer, xBytesWritten );
+
+		/* Was a task waiting for the data? */
+		if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+		{
+			sbSEND_COMPLETED( pxStreamBuffer );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vStreamBufferWriteCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+									  size_t xBytesWritten,
+									  BaseType_t * const pxHigherPriorityTaskWoken )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+
+	configASSERT( pxStreamBuffer );
+
+	if( xBytesWritten > ( size_t ) 0 )
+	{
+		prvCommitWrite( pxStreamBuffer, xBytesWritten );
+
+		/* Was a task waiting for the data? */
+		if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+		{
+			sbSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xBytesWritten );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReadReserve( StreamBufferHandle_t xStreamBuffer,
+								 StreamBufferSegment_t pxSegments[ 2 ] )
+{
+const StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+size_t xBytesAvailable;
+
+	configASSERT( pxSegments );
+	configASSERT( pxStreamBuffer );
+	configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+	/* Only the reader moves the tail, so the data available can only grow
+	(as the writer moves the head) until vStreamBufferReadCommit() is
+	called. */
+	xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+	prvGetSegments( pxStreamBuffer, pxStreamBuffer->xTail, xBytesAvailable, pxSegments );
+
+	return xBytesAvailable;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCommitRead( StreamBuffer_t * const pxStreamBuffer, size_t xBytesRead )
+{
+size_t xNextTail;
+
+	configASSERT( xBytesRead <= prvBytesInBuffer( pxStreamBuffer ) );
+
+	xNextTail = pxStreamBuffer->xTail + xBytesRead;
+
+	if( xNextTail >= pxStreamBuffer->xLength )
+	{
+		xNextTail -= pxStreamBuffer->xLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	pxStreamBuffer->xTail = xNextTail;
+}
+/*-----------------------------------------------------------*/
+
+void vStreamBufferReadCommit( StreamBufferHandle_t xStreamBuffer, size_t xBytesRead )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+
+	configASSERT( pxStreamBuffer );
+
+	if( xBytesRead > ( size_t ) 0 )
+	{
+		prvCommitRead( pxStreamBuffer, xBytesRead );
+		traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xBytesRead );
+
+		/* Was a task waiting for space in the buffer? */
+		sbRECEIVE_COMPLETED( pxStreamBuffer );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vStreamBufferReadCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+									 size_t xBytesRead,
+									 BaseType_t * const pxHigherPriorityTaskWoken )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+
+	configASSERT( pxStreamBuffer );
+
+	if( xBytesRead > ( size_t ) 0 )
+	{
+		prvCommitRead( pxStreamBuffer, xBytesRead );
+
+		/* Was a task waiting for space in the buffer? */
+		sbRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xBytesRead );
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWaitForSpace( StreamBuffer_t * const pxStreamBuffer,
+							   size_t xRequiredSpace,
+							   TickType_t xTicksToWait )
+{
+size_t xSpace = 0;
+TimeOut_t xTimeOut;
+
+	if( xTicksToWait != ( TickType_t ) 0 )
+	{
+		vTaskSetTimeOutState( &xTimeOut );
+
+		do
+		{
+			/* Wait until the required number of bytes are free in the message
+			buffer. */
+			taskENTER_CRITICAL();
+			{
+				xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+
+				if( xSpace < xRequiredSpace )
+				{
+					/* Clear notification state as going to wait for space. */
+					( void ) xTaskNotifyStateClear( NULL );
+
+					/* Should only be one writer. */
+					configASSERT( pxStreamBuffer->xTaskWaitingToSend == NULL );
+					pxStreamBuffer->xTaskWaitingToSend = xTaskGetCurrentTaskHandle();
+				}
+				else
+				{
+					taskEXIT_CRITICAL();
+					break;
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			traceBLOCKING_ON_STREAM_BUFFER_SEND( pxStreamBuffer );
+			( void ) xTaskNotifyWait( ( uint32_t ) 0, UINT32_MAX, NULL, xTicksToWait );
+			pxStreamBuffer->xTaskWaitingToSend = NULL;
+
+		} while( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( xSpace == ( size_t ) 0 )
+	{
+		xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xSpace;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWaitForData( StreamBuffer_t * const pxStreamBuffer,
+							  size_t xBytesToStoreMessageLength,
+							  TickType_t xTicksToWait )
+{
+size_t xBytesAvailable;
+
+	if( xTicksToWait != ( TickType_t ) 0 )
+	{
+		/* Checking if there is data and clearing the notification state must be
+		performed atomically. */
+		taskENTER_CRITICAL();
+		{
+			xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+
+			/* If this function was invoked by a message buffer read then
+			xBytesToStoreMessageLength holds the number of bytes used to hold
+			the length of the next discrete message.  If this function was
+			invoked by a stream buffer read then xBytesToStoreMessageLength will
+			be 0. */
+			if( xBytesAvailable <= xBytesToStoreMessageLength )
+			{
+				/* Clear notification state as going to wait for data. */
+				( void ) xTaskNotifyStateClear( NULL );
+
+				/* Should only be one reader. */
+				configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
+				pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		if( xBytesAvailable <= xBytesToStoreMessageLength )
+		{
+			/* Wait for data to be available. */
+			traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( pxStreamBuffer );
+			( void ) xTaskNotifyWait( ( uint32_t ) 0, UINT32_MAX, NULL, xTicksToWait );
+			pxStreamBuffer->xTaskWaitingToReceive = NULL;
+
+			/* Recheck the data available after blocking. */
+			xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+	}
+
+	return xBytesAvailable;
+}
+/*-----------------------------------------------------------*/
+
+static void prvGetSegments( const StreamBuffer_t * const pxStreamBuffer, size_t xStart, size_t xCount, StreamBufferSegment_t * const pxSegments )
+{
+size_t xFirstLength;
+
+	xFirstLength = configMIN( pxStreamBuffer->xLength - xStart, xCount );
+
+	pxSegments[ 0 ].pvData = ( void * ) &( pxStreamBuffer->pucBuffer[ xStart ] );
+	pxSegments[ 0 ].xLength = xFirstLength;
+
+	/* Any bytes that did not fit before the end of the storage area wrap
+	around to its start. */
+	pxSegments[ 1 ].pvData = ( void * ) pxStreamBuffer->pucBuffer;
+	pxSegments[ 1 ].xLength = xCount - xFirstLength;
+}
+/*-----------------------------------------------------------*/
@@ -145,6 +145,12 @@ standard names. */
 
 /* USER CODE BEGIN Defines */
 /* Section where parameter definitions can be added (for instance, to override default ones in FreeRTOS.h) */
+/* Index 0 is used by stream buffers and application notifications, index 1
+   by the CMSIS-RTOS2 thread flags. */
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES    2
+/* configUSE_MPU_STACK_GUARD is left at 0: check_static_stack_overflow() in
+   main.c scans task1's stack from its first word, which the guard region
+   makes unreadable while task1 runs. */
 /* USER CODE END Defines */
 
 #endif /* FREERTOS_CONFIG_H */
@@ -39,6 +39,90 @@
     } while (0)
 
 
+/**
+ *  Compare the floating-point outputs from the function under test and the
+ *  reference function by their distance in ULP. The bit patterns are mapped to
+ *  integers that are ordered like the values they represent.
+ */
+#define FAST_MATH_ULP_COMPARE_INTERFACE(block_size,     \
+                                        max_ulp)        \
+    do                                                  \
+    {                                                   \
+        uint32_t j;                                     \
+        int32_t  ord_ref;                               \
+        int32_t  ord_fut;                               \
+        int64_t  ulp;                                   \
+                                                        \
+        for(j=0;j<(block_size);j++)                     \
+        {                                               \
+            memcpy(&ord_ref, &fast_math_output_ref[j], 4); \
+            memcpy(&ord_fut, &fast_math_output_fut[j], 4); \
+            if (ord_ref < 0)                            \
+            {                                           \
+                ord_ref = (int32_t)(0x80000000U - (uint32_t)ord_ref); \
+            }                                           \
+            if (ord_fut < 0)                            \
+            {                                           \
+                ord_fut = (int32_t)(0x80000000U - (uint32_t)ord_fut); \
+            }                                           \
+            ulp = (int64_t)ord_fut - ord_ref;           \
+            if ((ulp > (max_ulp)) || (ulp < -(max_ulp))) \
+            {                                           \
+                JTEST_DUMP_STRF("ULP: %d at %d\n",      \
+                                (int)ulp, (int)j);      \
+                return JTEST_TEST_FAILED;               \
+            }                                           \
+        }                                               \
+    } while (0)
+
+/**
+ *  Compare the fixed-point angles from the function under test and the
+ *  reference function by their distance in LSB, modulo 2*pi.
+ */
+#define FAST_MATH_ANGLE_COMPARE_INTERFACE(block_size,   \
+                                          output_type,  \
+                                          max_lsb)      \
+    do                                                  \
+    {                                                   \
+        uint32_t j;                                     \
+        output_type diff;                               \
+                                                        \
+        for(j=0;j<(block_size);j++)                     \
+        {                                               \
+            diff = (output_type)(                       \
+                (uint32_t)((output_type *) fast_math_output_fut)[j] - \
+                (uint32_t)((output_type *) fast_math_output_ref)[j]); \
+            if ((diff > (max_lsb)) || (diff < -(max_lsb))) \
+            {                                           \
+                JTEST_DUMP_STRF("LSB: %d at %d\n",      \
+                                (int)diff, (int)j);     \
+                return JTEST_TEST_FAILED;               \
+            }                                           \
+        }                                               \
+    } while (0)
+
+/**
+ *  Inputs of the vector functions, derived from fast_math_f32_inputs. The
+ *  exponential covers most of its finite range and the logarithm covers
+ *  magnitudes from 2^-32 to 2^38.
+ */
+#define FAST_MATH_VEXP_INPUT(idx)  (fast_math_f32_inputs[idx] * 14.0f)
+#define FAST_MATH_VLOG_INPUT(idx)  ldexpf(fabsf(fast_math_f32_inputs[idx]), \
+                                          (int)((idx) & 63U) - 32)
+#define FAST_MATH_VTANH_INPUT(idx) (fast_math_f32_inputs[idx])
+
+/**
+ *  Maximum errors of the vector functions against the rounded reference.
+ */
+#define FAST_MATH_MAX_ULP_vexp  1
+#define FAST_MATH_MAX_ULP_vlog  1
+#define FAST_MATH_MAX_ULP_vtanh 2
+#define FAST_MATH_MAX_ULP_atan2 3
+
+#define FAST_MATH_MAX_LSB_q31_t 2
+#define FAST_MATH_MAX_LSB_q15_t 1
+
+
 /*--------------------------------------------------------------------------------*/
 /* TEST Templates */
 /*--------------------------------------------------------------------------------*/
@@ -99,4 +183,84 @@
             return JTEST_TEST_PASSED;                                   \
         }
 
+#define VECTOR_TEST_TEMPLATE_ELT1(func, input)                          \
+                                                                        \
+        JTEST_DEFINE_TEST(arm_##func##_f32_test, arm_##func##_f32)      \
+        {                                                               \
+            uint32_t i;                                                 \
+                                                                        \
+            for(i=0;i<FAST_MATH_MAX_LEN;i++)                            \
+            {                                                           \
+                fast_math_output_f32_fut[i] = input(i);                 \
+            }                                                           \
+                                                                        \
+            JTEST_COUNT_CYCLES(                                         \
+                arm_##func##_f32(                                       \
+                    fast_math_output_f32_fut,                           \
+                    fast_math_output_fut,                               \
+                    FAST_MATH_MAX_LEN));                                \
+                                                                        \
+            JTEST_COUNT_CYCLES(                                         \
+                ref_##func##_f32(                                       \
+                    fast_math_output_f32_fut,                           \
+                    fast_math_output_ref,                               \
+                    FAST_MATH_MAX_LEN));                                \
+                                                                        \
+            FAST_MATH_ULP_COMPARE_INTERFACE(                            \
+                FAST_MATH_MAX_LEN,                                      \
+                FAST_MATH_MAX_ULP_##func);                              \
+                                                                        \
+            /* In-place computation gives the same results */           \
+            arm_##func##_f32(                                           \
+                fast_math_output_f32_fut,                               \
+                fast_math_output_f32_fut,                               \
+                FAST_MATH_MAX_LEN);                                     \
+                                                                        \
+            TEST_ASSERT_BUFFERS_EQUAL(                                  \
+                fast_math_output_f32_fut,                               \
+                fast_math_output_fut,                                   \
+                FAST_MATH_MAX_LEN * sizeof(float32_t));                 \
+                                                                        \
+            return JTEST_TEST_PASSED;                                   \
+        }
+
+/**
+ *  The ordinates and abscissas are the inputs read forwards and backwards,
+ *  with their signs alternated so that all four quadrants are covered.
+ */
+#define ATAN2_TEST_TEMPLATE_ELT1(suffix, type, compare)                 \
+                                                                        \
+        JTEST_DEFINE_TEST(arm_atan2_##suffix##_test, arm_atan2_##suffix) \
+        {                                                               \
+            uint32_t i;                                                 \
+            type * pY = (type *) fast_math_output_f32_fut;              \
+            type * pX = (type *) fast_math_output_f32_ref;              \
+                                                                        \
+            for(i=0;i<FAST_MATH_MAX_LEN;i++)                            \
+            {                                                           \
+                pY[i] = fast_math_##suffix##_inputs[i];                 \
+                pX[i] = fast_math_##suffix##_inputs[FAST_MATH_MAX_LEN - 1 - i]; \
+                pY[i] = (i & 1U) ? -pY[i] : pY[i];                      \
+                pX[i] = (i & 2U) ? -pX[i] : pX[i];                      \
+            }                                                           \
+                                                                        \
+            JTEST_COUNT_CYCLES(                                         \
+                arm_atan2_##suffix(                                     \
+                    pY,                                                 \
+                    pX,                                                 \
+                    (type *) fast_math_output_fut,                      \
+                    FAST_MATH_MAX_LEN));                                \
+                                                                        \
+            JTEST_COUNT_CYCLES(                                         \
+                ref_atan2_##suffix(                                     \
+                    pY,                                                 \
+                    pX,                                                 \
+                    (type *) fast_math_output_ref,                      \
+                    FAST_MATH_MAX_LEN));                                \
+                                                                        \
+            compare;                                                    \
+                                                                        \
+            return JTEST_TEST_PASSED;                                   \
+        }
+
 #endif /* _FAST_MATH_TEMPLATES_H_ */
@@ -49,4 +49,18 @@ void arm_apply_guard_bits (float32_t * pIn, uint32_t numSamples, uint32_t guard_
 uint32_t arm_compare_fixed_q15(q15_t *pIn, q15_t * pOut, uint32_t numSamples);
 uint32_t arm_compare_fixed_q31(q31_t *pIn, q31_t *pOut, uint32_t numSamples);
 uint32_t arm_calc_2pow(uint32_t guard_bits);
+uint32_t arm_rand_lcg(uint32_t *pSeed);
+void arm_fill_rand_q31(q31_t *pDst, uint32_t numSamples, uint32_t seed, uint32_t mask);
+void arm_fill_rand_f32(float32_t *pDst, uint32_t numSamples, uint32_t seed, float32_t scale);
+
+/* Masks for arm_fill_rand_q31(): all bits for distinct values, the top three
+   bits only for a few repeated values. */
+#define ARM_RAND_MASK_COUNT 2
+extern const uint32_t arm_rand_masks[ARM_RAND_MASK_COUNT];
+
+/* Convert the output of arm_fill_rand_q31() to the type of a test suffix. */
+#define ARM_RAND_CONVERT_f32(pSrc, pDst, len) arm_q31_to_float(pSrc, (float32_t *) (pDst), len)
+#define ARM_RAND_CONVERT_q31(pSrc, pDst, len) arm_copy_q31(pSrc, (q31_t *) (pDst), len)
+#define ARM_RAND_CONVERT_q15(pSrc, pDst, len) arm_q31_to_q15(pSrc, (q15_t *) (pDst), len)
+#define ARM_RAND_CONVERT_q7(pSrc, pDst, len)  arm_q31_to_q7(pSrc, (q7_t *) (pDst), len)
 #endif
@@ -5,11 +5,13 @@
 /* Test/Group Declarations */
 /*--------------------------------------------------------------------------------*/
 JTEST_DECLARE_GROUP(mat_add_tests);
+JTEST_DECLARE_GROUP(mat_cholesky_tests);
 JTEST_DECLARE_GROUP(mat_cmplx_mult_tests);
 JTEST_DECLARE_GROUP(mat_init_tests);
 JTEST_DECLARE_GROUP(mat_inverse_tests);
 JTEST_DECLARE_GROUP(mat_mult_tests);
 JTEST_DECLARE_GROUP(mat_mult_fast_tests);
+JTEST_DECLARE_GROUP(mat_mult_tiled_tests);
 JTEST_DECLARE_GROUP(mat_sub_tests);
 JTEST_DECLARE_GROUP(mat_trans_tests);
 JTEST_DECLARE_GROUP(mat_scale_tests);
@@ -6,6 +6,14 @@
 /*--------------------------------------------------------------------------------*/
 
 #include "arr_desc.h"
+#include "arm_math.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Macros and Defines */
+/*--------------------------------------------------------------------------------*/
+
+/* Length of the pseudo-random inputs of the sort tests. */
+#define SUPPORT_RANDOM_MAX_LEN 1024
 
 /*--------------------------------------------------------------------------------*/
 /* Declare Variables */
@@ -15,6 +23,10 @@
 ARR_DESC_DECLARE(support_output_fut);
 ARR_DESC_DECLARE(support_output_ref);
 
+/* Pseudo-random Q31 input, and its conversion to the type under test */
+extern q31_t support_random_input[SUPPORT_RANDOM_MAX_LEN];
+extern q31_t support_random_src[SUPPORT_RANDOM_MAX_LEN];
+
 /* Block Sizes*/
 ARR_DESC_DECLARE(support_block_sizes);
 
@@ -0,0 +1,532 @@
+#include "jtest.h"
+#include "filtering_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "filtering_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Multichannel Data */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  The multichannel filters take interleaved frames of up to MC_MAX_CHANS
+  channels, more than the filtering_test_data buffers hold, so the input is
+  generated at run time. The buffers are float32_t and are cast to the type
+  under test.
+*/
+#define MC_MAX_CHANS        16
+#define MC_NUM_FRAMES       256
+#define MC_MAX_SAMPLES      (MC_MAX_CHANS * MC_NUM_FRAMES)
+#define MC_FIR_NUMTAPS      32
+#define MC_BIQUAD_STAGES    4
+#define MC_STATE_LEN        (MC_MAX_CHANS * (MC_FIR_NUMTAPS - 1 + MC_NUM_FRAMES))
+
+/* Frames per call: the maximum block size of the instances, used by the benchmark. */
+#define MC_BLOCKSIZE        64
+
+/* Frames per call of the correctness tests, not a divisor of MC_NUM_FRAMES. */
+#define MC_CALL_LEN         48
+
+static float32_t mc_source[MC_MAX_SAMPLES];
+static float32_t mc_input[MC_MAX_SAMPLES];
+static float32_t mc_output_fut[MC_MAX_SAMPLES];
+static float32_t mc_output_ref[MC_MAX_SAMPLES];
+static float32_t mc_chan_in[MC_NUM_FRAMES];
+static float32_t mc_chan_out[MC_NUM_FRAMES];
+static float32_t mc_state[MC_STATE_LEN];
+static float32_t mc_coeffs[MC_FIR_NUMTAPS];
+
+/* Stable 8th order filter, {b0, b1, b2, a1, a2} per stage. The q31 and q15
+   versions are scaled by 1/2 and use a postShift of 1. */
+static const float32_t mc_biquad_coeffs_f32[5 * MC_BIQUAD_STAGES] =
+{
+    0.20f,  0.40f,  0.20f,  0.60f, -0.40f,
+    0.30f, -0.10f,  0.20f, -0.50f, -0.30f,
+    0.10f,  0.10f,  0.10f,  1.20f, -0.50f,
+    0.25f,  0.00f, -0.25f,  0.00f,  0.50f
+};
+
+/* Channel counts of the correctness tests and of the benchmark. */
+static const uint16_t mc_numchans[]       = { 1, 2, 3, 4, 5, 8, 16 };
+static const uint16_t mc_bench_numchans[] = { 2, 4, 8, 16 };
+
+/**
+ *  Conversion of the generated data to the type under test.
+ */
+static void mc_from_float_f32(float32_t * pSrc, float32_t * pDst, uint32_t len)
+{
+    arm_copy_f32(pSrc, pDst, len);
+}
+
+static void mc_from_float_q31(float32_t * pSrc, q31_t * pDst, uint32_t len)
+{
+    arm_float_to_q31(pSrc, pDst, len);
+}
+
+static void mc_from_float_q15(float32_t * pSrc, q15_t * pDst, uint32_t len)
+{
+    arm_float_to_q15(pSrc, pDst, len);
+}
+
+/**
+ *  Copy one channel of interleaved frames to a contiguous buffer.
+ */
+static void mc_deinterleave(
+    const void * pSrc,
+    void * pDst,
+    uint32_t size,
+    uint32_t numChans,
+    uint32_t ch,
+    uint32_t numFrames)
+{
+    uint32_t n;
+
+    for (n = 0; n < numFrames; n++)
+    {
+        memcpy((uint8_t *) pDst + n * size,
+               (const uint8_t *) pSrc + (n * numChans + ch) * size, size);
+    }
+}
+
+/**
+ *  Copy a contiguous buffer to one channel of interleaved frames.
+ */
+static void mc_interleave(
+    const void * pSrc,
+    void * pDst,
+    uint32_t size,
+    uint32_t numChans,
+    uint32_t ch,
+    uint32_t numFrames)
+{
+    uint32_t n;
+
+    for (n = 0; n < numFrames; n++)
+    {
+        memcpy((uint8_t *) pDst + (n * numChans + ch) * size,
+               (const uint8_t *) pSrc + n * size, size);
+    }
+}
+
+/**
+ *  Biquad coefficients in the layout of each type.
+ */
+static void mc_biquad_setup_f32(void)
+{
+    arm_copy_f32((float32_t *) mc_biquad_coeffs_f32, mc_coeffs,
+                 5 * MC_BIQUAD_STAGES);
+}
+
+static void mc_biquad_setup_q31(void)
+{
+    arm_scale_f32((float32_t *) mc_biquad_coeffs_f32, 0.5f, mc_chan_out,
+                  5 * MC_BIQUAD_STAGES);
+    arm_float_to_q31(mc_chan_out, (q31_t *) mc_coeffs, 5 * MC_BIQUAD_STAGES);
+}
+
+static void mc_biquad_setup_q15(void)
+{
+    q15_t * pCoeffs = (q15_t *) mc_coeffs;
+    uint32_t stage;
+
+    arm_scale_f32((float32_t *) mc_biquad_coeffs_f32, 0.5f, mc_chan_out,
+                  5 * MC_BIQUAD_STAGES);
+
+    /* {b0, 0, b1, b2, a1, a2} per stage */
+    for (stage = 0; stage < MC_BIQUAD_STAGES; stage++)
+    {
+        arm_float_to_q15(mc_chan_out + 5 * stage, pCoeffs + 6 * stage + 1, 5);
+        pCoeffs[6 * stage] = pCoeffs[6 * stage + 1];
+        pCoeffs[6 * stage + 1] = 0;
+    }
+}
+
+/**
+ *  Biquad initialization for each type. The fixed-point filters use a
+ *  postShift of 1.
+ */
+static void mc_biquad_init_f32(
+    arm_biquad_cascade_mc_df2T_instance_f32 * S,
+    uint16_t numChans)
+{
+    arm_biquad_cascade_mc_df2T_init_f32(S, numChans, MC_BIQUAD_STAGES,
+                                        mc_coeffs, mc_state);
+}
+
+static void mc_biquad_init_q31(
+    arm_biquad_cascade_mc_df1_instance_q31 * S,
+    uint16_t numChans)
+{
+    arm_biquad_cascade_mc_df1_init_q31(S, numChans, MC_BIQUAD_STAGES,
+                                       (q31_t *) mc_coeffs,
+                                       (q31_t *) mc_state, 1);
+}
+
+static void mc_biquad_init_q15(
+    arm_biquad_cascade_mc_df1_instance_q15 * S,
+    uint16_t numChans)
+{
+    arm_biquad_cascade_mc_df1_init_q15(S, numChans, MC_BIQUAD_STAGES,
+                                       (q15_t *) mc_coeffs,
+                                       (q15_t *) mc_state, 1);
+}
+
+static void mc_biquad_single_init_f32(
+    arm_biquad_cascade_df2T_instance_f32 * S,
+    float32_t * pState)
+{
+    arm_biquad_cascade_df2T_init_f32(S, MC_BIQUAD_STAGES, mc_coeffs, pState);
+}
+
+static void mc_biquad_single_init_q31(
+    arm_biquad_casd_df1_inst_q31 * S,
+    q31_t * pState)
+{
+    arm_biquad_cascade_df1_init_q31(S, MC_BIQUAD_STAGES, (q31_t *) mc_coeffs,
+                                    pState, 1);
+}
+
+static void mc_biquad_single_init_q15(
+    arm_biquad_casd_df1_inst_q15 * S,
+    q15_t * pState)
+{
+    arm_biquad_cascade_df1_init_q15(S, MC_BIQUAD_STAGES, (q15_t *) mc_coeffs,
+                                    pState, 1);
+}
+
+/*
+  Floating-point results are compared by SNR, fixed-point results must be bit
+  exact.
+*/
+#define MC_COMPARE_f32(len)                                     \
+    TEST_ASSERT_SNR(mc_output_ref, mc_output_fut, len,          \
+                    FILTERING_SNR_THRESHOLD_float32_t)
+
+#define MC_COMPARE_q31(len)                                     \
+    TEST_ASSERT_BUFFERS_EQUAL(mc_output_ref, mc_output_fut,     \
+                              (len) * sizeof(q31_t))
+
+#define MC_COMPARE_q15(len)                                     \
+    TEST_ASSERT_BUFFERS_EQUAL(mc_output_ref, mc_output_fut,     \
+                              (len) * sizeof(q15_t))
+
+/*--------------------------------------------------------------------------------*/
+/* Tests */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  The multichannel filter processes the interleaved stream in calls of
+  MC_CALL_LEN frames. Each channel is then de-interleaved and filtered on its
+  own by the reference function.
+*/
+#define MC_FIR_DEFINE_TEST(suffix, type)                                        \
+    JTEST_DEFINE_TEST(arm_fir_mc_##suffix##_test,                               \
+                      arm_fir_mc_##suffix)                                      \
+    {                                                                           \
+        arm_fir_mc_instance_##suffix fir_inst_fut;                              \
+        arm_fir_instance_##suffix fir_inst_ref;                                 \
+        uint32_t cfg, ch, numChans, pos, len;                                   \
+                                                                                \
+        arm_fill_rand_f32(mc_source, MC_MAX_SAMPLES, 1U, 0.5f);                 \
+        mc_from_float_##suffix(mc_source, (type *) mc_input, MC_MAX_SAMPLES);   \
+        arm_fill_rand_f32(mc_source, MC_FIR_NUMTAPS, 2U, 0.5f);                 \
+        arm_scale_f32(mc_source, 0.25f, mc_source, MC_FIR_NUMTAPS);             \
+        mc_from_float_##suffix(mc_source, (type *) mc_coeffs, MC_FIR_NUMTAPS);  \
+                                                                                \
+        for (cfg = 0; cfg < sizeof(mc_numchans) / sizeof(uint16_t); cfg++)      \
+        {                                                                       \
+            numChans = mc_numchans[cfg];                                        \
+                                                                                \
+            /* Display test parameter values */                                 \
+            JTEST_DUMP_STRF("Channels: %d\n"                                    \
+                            "Number of Taps: %d\n",                             \
+                            (int)numChans,                                      \
+                            (int)MC_FIR_NUMTAPS);                               \
+                                                                                \
+            arm_fir_mc_init_##suffix(&fir_inst_fut, numChans, MC_FIR_NUMTAPS,   \
+                                     (type *) mc_coeffs, (type *) mc_state,     \
+                                     MC_BLOCKSIZE);                             \
+                                                                                \
+            for (pos = 0; pos < MC_NUM_FRAMES; pos += len)                      \
+            {                                                                   \
+                len = MC_NUM_FRAMES - pos;                                      \
+                len = (len < MC_CALL_LEN) ? len : MC_CALL_LEN;                  \
+                arm_fir_mc_##suffix(&fir_inst_fut,                              \
+                                    (type *) mc_input + pos * numChans,         \
+                                    (type *) mc_output_fut + pos * numChans,    \
+                                    len);                                       \
+            }                                                                   \
+                                                                                \
+            for (ch = 0; ch < numChans; ch++)                                   \
+            {                                                                   \
+                mc_deinterleave(mc_input, mc_chan_in, sizeof(type),             \
+                                numChans, ch, MC_NUM_FRAMES);                   \
+                arm_fir_init_##suffix(&fir_inst_ref, MC_FIR_NUMTAPS,            \
+                                      (type *) mc_coeffs, (type *) mc_state,    \
+                                      MC_NUM_FRAMES);                           \
+                ref_fir_##suffix(&fir_inst_ref, (type *) mc_chan_in,            \
+                                 (type *) mc_chan_out, MC_NUM_FRAMES);          \
+                mc_interleave(mc_chan_out, mc_output_ref, sizeof(type),         \
+                              numChans, ch, MC_NUM_FRAMES);                     \
+            }                                                                   \
+                                                                                \
+            MC_COMPARE_##suffix(MC_NUM_FRAMES * numChans);                      \
+        }                                                                       \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+#define MC_BIQUAD_DEFINE_TEST(suffix, type, form, inst_type, single_inst_type)  \
+    JTEST_DEFINE_TEST(arm_biquad_cascade_mc_##form##_##suffix##_test,           \
+                      arm_biquad_cascade_mc_##form##_##suffix)                  \
+    {                                                                           \
+        inst_type biquad_inst_fut;                                              \
+        single_inst_type biquad_inst_ref;                                       \
+        uint32_t cfg, ch, numChans, pos, len;                                   \
+                                                                                \
+        arm_fill_rand_f32(mc_source, MC_MAX_SAMPLES, 3U, 0.5f);                 \
+        mc_from_float_##suffix(mc_source, (type *) mc_input, MC_MAX_SAMPLES);   \
+        mc_biquad_setup_##suffix();                                             \
+                                                                                \
+        for (cfg = 0; cfg < sizeof(mc_numchans) / sizeof(uint16_t); cfg++)      \
+        {                                                                       \
+            numChans = mc_numchans[cfg];                                        \
+                                                                                \
+            /* Display test parameter values */                                 \
+            JTEST_DUMP_STRF("Channels: %d\n"                                    \
+                            "Number of Stages: %d\n",                           \
+                            (int)numChans,                                      \
+                            (int)MC_BIQUAD_STAGES);                             \
+                                                                                \
+            mc_biquad_init_##suffix(&biquad_inst_fut, numChans);                \
+                                                                                \
+            for (pos = 0; pos < MC_NUM_FRAMES; pos += len)                      \
+            {                                                                   \
+                len = MC_NUM_FRAMES - pos;                                      \
+                len = (len < MC_CALL_LEN) ? len : MC_CALL_LEN;                  \
+                arm_biquad_cascade_mc_##form##_##suffix(                        \
+                    &biquad_inst_fut,                                           \
+                    (type *) mc_input + pos * numChans,                         \
+                    (type *) mc_output_fut + pos * numChans,                    \
+                    len);                                                       \
+            }                                                                   \
+                                                                                \
+            for (ch = 0; ch < numChans; ch++)                                   \
+            {                                                                   \
+                mc_deinterleave(mc_input, mc_chan_in, sizeof(type),             \
+                                numChans, ch, MC_NUM_FRAMES);                   \
+                mc_biquad_single_init_##suffix(&biquad_inst_ref,                \
+                                               (type *) mc_state);              \
+                ref_biquad_cascade_##form##_##suffix(&biquad_inst_ref,          \
+                                                     (type *) mc_chan_in,       \
+                                                     (type *) mc_chan_out,      \
+                                                     MC_NUM_FRAMES);            \
+                mc_interleave(mc_chan_out, mc_output_ref, sizeof(type),         \
+                              numChans, ch, MC_NUM_FRAMES);                     \
+            }                                                                   \
+                                                                                \
+            MC_COMPARE_##suffix(MC_NUM_FRAMES * numChans);                      \
+        }                                                                       \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+MC_FIR_DEFINE_TEST(f32, float32_t);
+MC_FIR_DEFINE_TEST(q31, q31_t);
+MC_FIR_DEFINE_TEST(q15, q15_t);
+
+MC_BIQUAD_DEFINE_TEST(f32, float32_t, df2T,
+                      arm_biquad_cascade_mc_df2T_instance_f32,
+                      arm_biquad_cascade_df2T_instance_f32);
+MC_BIQUAD_DEFINE_TEST(q31, q31_t, df1,
+                      arm_biquad_cascade_mc_df1_instance_q31,
+                      arm_biquad_casd_df1_inst_q31);
+MC_BIQUAD_DEFINE_TEST(q15, q15_t, df1,
+                      arm_biquad_cascade_mc_df1_instance_q15,
+                      arm_biquad_casd_df1_inst_q15);
+
+/*--------------------------------------------------------------------------------*/
+/* Benchmarks */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Throughput benchmark: MC_NUM_FRAMES interleaved frames are filtered in blocks
+  of MC_BLOCKSIZE frames. The first cycle count is the single channel filter
+  called once per channel, with each block de-interleaved into and out of
+  scratch buffers; the second is the multichannel filter.
+*/
+#define MC_FIR_DEFINE_BENCH(suffix, type)                                       \
+    JTEST_DEFINE_TEST(arm_fir_mc_##suffix##_bench,                              \
+                      arm_fir_mc_##suffix)                                      \
+    {                                                                           \
+        arm_fir_mc_instance_##suffix fir_inst_fut;                              \
+        arm_fir_instance_##suffix fir_inst_chan[MC_MAX_CHANS];                  \
+        uint32_t cfg, ch, numChans, pos;                                        \
+                                                                                \
+        arm_fill_rand_f32(mc_source, MC_MAX_SAMPLES, 1U, 0.5f);                 \
+        mc_from_float_##suffix(mc_source, (type *) mc_input, MC_MAX_SAMPLES);   \
+        arm_fill_rand_f32(mc_source, MC_FIR_NUMTAPS, 2U, 0.5f);                 \
+        arm_scale_f32(mc_source, 0.25f, mc_source, MC_FIR_NUMTAPS);             \
+        mc_from_float_##suffix(mc_source, (type *) mc_coeffs, MC_FIR_NUMTAPS);  \
+                                                                                \
+        for (cfg = 0; cfg < sizeof(mc_bench_numchans) / sizeof(uint16_t); cfg++) \
+        {                                                                       \
+            numChans = mc_bench_numchans[cfg];                                  \
+                                                                                \
+            JTEST_DUMP_STRF("Channels: %d\n"                                    \
+                            "Number of Taps: %d\n"                              \
+                            "Block Size: %d\n"                                  \
+                            "Frames: %d\n",                                     \
+                            (int)numChans,                                      \
+                            (int)MC_FIR_NUMTAPS,                                \
+                            (int)MC_BLOCKSIZE,                                  \
+                            (int)MC_NUM_FRAMES);                                \
+                                                                                \
+            for (ch = 0; ch < numChans; ch++)                                   \
+            {                                                                   \
+                arm_fir_init_##suffix(&fir_inst_chan[ch], MC_FIR_NUMTAPS,       \
+                    (type *) mc_coeffs,                                         \
+                    (type *) mc_state + ch * (MC_FIR_NUMTAPS - 1 + MC_BLOCKSIZE), \
+                    MC_BLOCKSIZE);                                              \
+            }                                                                   \
+                                                                                \
+            JTEST_COUNT_CYCLES(                                                 \
+                for (pos = 0; pos < MC_NUM_FRAMES; pos += MC_BLOCKSIZE)         \
+                {                                                               \
+                    for (ch = 0; ch < numChans; ch++)                           \
+                    {                                                           \
+                        mc_deinterleave((type *) mc_input + pos * numChans,     \
+                                        mc_chan_in, sizeof(type),               \
+                                        numChans, ch, MC_BLOCKSIZE);            \
+                        arm_fir_##suffix(&fir_inst_chan[ch],                    \
+                                         (type *) mc_chan_in,                   \
+                                         (type *) mc_chan_out, MC_BLOCKSIZE);   \
+                        mc_interleave(mc_chan_out,                              \
+                                      (type *) mc_output_ref + pos * numChans,  \
+                                      sizeof(type), numChans, ch,               \
+                                      MC_BLOCKSIZE);                            \
+                    }                                                           \
+                });                                                             \
+                                                                                \
+            arm_fir_mc_init_##suffix(&fir_inst_fut, numChans, MC_FIR_NUMTAPS,   \
+                                     (type *) mc_coeffs, (type *) mc_state,     \
+                                     MC_BLOCKSIZE);                             \
+                                                                                \
+            JTEST_COUNT_CYCLES(                                                 \
+                for (pos = 0; pos < MC_NUM_FRAMES; pos += MC_BLOCKSIZE)         \
+                {                                                               \
+                    arm_fir_mc_##suffix(&fir_inst_fut,                          \
+                                        (type *) mc_input + pos * numChans,     \
+                                        (type *) mc_output_fut + pos * numChans, \
+                                        MC_BLOCKSIZE);                          \
+                });                                                             \
+                                                                                \
+            MC_COMPARE_##suffix(MC_NUM_FRAMES * numChans);                      \
+        }                                                                       \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+#define MC_BIQUAD_DEFINE_BENCH(suffix, type, form, inst_type, single_inst_type) \
+    JTEST_DEFINE_TEST(arm_biquad_cascade_mc_##form##_##suffix##_bench,          \
+                      arm_biquad_cascade_mc_##form##_##suffix)                  \
+    {                                                                           \
+        inst_type biquad_inst_fut;                                              \
+        single_inst_type biquad_inst_chan[MC_MAX_CHANS];                        \
+        uint32_t cfg, ch, numChans, pos;                                        \
+                                                                                \
+        arm_fill_rand_f32(mc_source, MC_MAX_SAMPLES, 3U, 0.5f);                 \
+        mc_from_float_##suffix(mc_source, (type *) mc_input, MC_MAX_SAMPLES);   \
+        mc_biquad_setup_##suffix();                                             \
+                                                                                \
+        for (cfg = 0; cfg < sizeof(mc_bench_numchans) / sizeof(uint16_t); cfg++) \
+        {                                                                       \
+            numChans = mc_bench_numchans[cfg];                                  \
+                                                                                \
+            JTEST_DUMP_STRF("Channels: %d\n"                                    \
+                            "Number of Stages: %d\n"                            \
+                            "Block Size: %d\n"                                  \
+                            "Frames: %d\n",                                     \
+                            (int)numChans,                                      \
+                            (int)MC_BIQUAD_STAGES,                              \
+                            (int)MC_BLOCKSIZE,                                  \
+                            (int)MC_NUM_FRAMES);                                \
+                                                                                \
+            for (ch = 0; ch < numChans; ch++)                                   \
+            {                                                                   \
+                mc_biquad_single_init_##suffix(&biquad_inst_chan[ch],           \
+                    (type *) mc_state + ch * 4 * MC_BIQUAD_STAGES);             \
+            }                                                                   \
+                                                                                \
+            JTEST_COUNT_CYCLES(                                                 \
+                for (pos = 0; pos < MC_NUM_FRAMES; pos += MC_BLOCKSIZE)         \
+                {                                                               \
+                    for (ch = 0; ch < numChans; ch++)                           \
+                    {                                                           \
+                        mc_deinterleave((type *) mc_input + pos * numChans,     \
+                                        mc_chan_in, sizeof(type),               \
+                                        numChans, ch, MC_BLOCKSIZE);            \
+                        arm_biquad_cascade_##form##_##suffix(                   \
+                            &biquad_inst_chan[ch], (type *) mc_chan_in,         \
+                            (type *) mc_chan_out, MC_BLOCKSIZE);                \
+                        mc_interleave(mc_chan_out,                              \
+                                      (type *) mc_output_ref + pos * numChans,  \
+                                      sizeof(type), numChans, ch,               \
+                                      MC_BLOCKSIZE);                            \
+                    }                                                           \
+                });                                                             \
+                                                                                \
+            mc_biquad_init_##suffix(&biquad_inst_fut, numChans);                \
+                                                                                \
+            JTEST_COUNT_CYCLES(                                                 \
+                for (pos = 0; pos < MC_NUM_FRAMES; pos += MC_BLOCKSIZE)         \
+                {                                                               \
+                    arm_biquad_cascade_mc_##form##_##suffix(                    \
+                        &biquad_inst_fut,                                       \
+                        (type *) mc_input + pos * numChans,                     \
+                        (type *) mc_output_fut + pos * numChans,                \
+                        MC_BLOCKSIZE);                                          \
+                });                                                             \
+                                                                                \
+            MC_COMPARE_##suffix(MC_NUM_FRAMES * numChans);                      \
+        }                                                                       \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+MC_FIR_DEFINE_BENCH(f32, float32_t);
+MC_FIR_DEFINE_BENCH(q31, q31_t);
+MC_FIR_DEFINE_BENCH(q15, q15_t);
+
+MC_BIQUAD_DEFINE_BENCH(f32, float32_t, df2T,
+                       arm_biquad_cascade_mc_df2T_instance_f32,
+                       arm_biquad_cascade_df2T_instance_f32);
+MC_BIQUAD_DEFINE_BENCH(q31, q31_t, df1,
+                       arm_biquad_cascade_mc_df1_instance_q31,
+                       arm_biquad_casd_df1_inst_q31);
+MC_BIQUAD_DEFINE_BENCH(q15, q15_t, df1,
+                       arm_biquad_cascade_mc_df1_instance_q15,
+                       arm_biquad_casd_df1_inst_q15);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(multichannel_tests)
+{
+    JTEST_TEST_CALL(arm_fir_mc_f32_test);
+    JTEST_TEST_CALL(arm_fir_mc_q31_test);
+    JTEST_TEST_CALL(arm_fir_mc_q15_test);
+    JTEST_TEST_CALL(arm_biquad_cascade_mc_df2T_f32_test);
+    JTEST_TEST_CALL(arm_biquad_cascade_mc_df1_q31_test);
+    JTEST_TEST_CALL(arm_biquad_cascade_mc_df1_q15_test);
+    JTEST_TEST_CALL(arm_fir_mc_f32_bench);
+    JTEST_TEST_CALL(arm_fir_mc_q31_bench);
+    JTEST_TEST_CALL(arm_fir_mc_q15_bench);
+    JTEST_TEST_CALL(arm_biquad_cascade_mc_df2T_f32_bench);
+    JTEST_TEST_CALL(arm_biquad_cascade_mc_df1_q31_bench);
+    JTEST_TEST_CALL(arm_biquad_cascade_mc_df1_q15_bench);
+}
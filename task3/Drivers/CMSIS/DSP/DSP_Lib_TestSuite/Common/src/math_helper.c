@@ -489,3 +489,59 @@ void arm_clip_f32 (float *pIn, uint32_t numSamples)
 
     }
 }
+
+/**
+ * @brief  Masks for arm_fill_rand_q31(): all bits are kept for distinct
+ *         values, the top three bits only for a few repeated values.
+ */
+const uint32_t arm_rand_masks[ARM_RAND_MASK_COUNT] = { 0xFFFFFFFFU, 0xE0000000U };
+
+/**
+ * @brief  Advances a linear congruential generator
+ * @param  pSeed        points to the state of the generator
+ * @return the new state, a pseudo-random 32-bit value
+ * The tests use this generator so that their inputs are the same on every
+ * target and every run.
+ */
+uint32_t arm_rand_lcg(uint32_t *pSeed)
+{
+  *pSeed = *pSeed * 1664525U + 1013904223U;
+
+  return(*pSeed);
+}
+
+/**
+ * @brief  Fills a buffer with pseudo-random Q31 values
+ * @param  pDst         points to the output buffer
+ * @param  numSamples   number of samples in the buffer
+ * @param  seed         initial state of the generator
+ * @param  mask         bits of each value that are kept
+ * @return none
+ */
+void arm_fill_rand_q31(q31_t *pDst, uint32_t numSamples, uint32_t seed, uint32_t mask)
+{
+  uint32_t i;
+
+  for (i = 0; i < numSamples; i++)
+    {
+      pDst[i] = (q31_t) (arm_rand_lcg(&seed) & mask);
+    }
+}
+
+/**
+ * @brief  Fills a buffer with uniform pseudo-random values in [-scale, scale)
+ * @param  pDst         points to the output buffer
+ * @param  numSamples   number of samples in the buffer
+ * @param  seed         initial state of the generator
+ * @param  scale        half the width of the range
+ * @return none
+ */
+void arm_fill_rand_f32(float32_t *pDst, uint32_t numSamples, uint32_t seed, float32_t scale)
+{
+  uint32_t i;
+
+  for (i = 0; i < numSamples; i++)
+    {
+      pDst[i] = (float32_t) (int32_t) arm_rand_lcg(&seed) / 2147483648.0f * scale;
+    }
+}
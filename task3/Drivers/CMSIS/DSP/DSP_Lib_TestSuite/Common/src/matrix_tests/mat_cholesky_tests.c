@@ -0,0 +1,436 @@
+#include "jtest.h"
+#include "matrix_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "matrix_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Symmetric Positive Definite Inputs */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  The decompositions need symmetric positive definite inputs. They are built
+  from the square invertible inputs M as M * M^T + n * I, in double precision,
+  and then converted to the type under test.
+*/
+
+static float64_t mat_cholesky_spd_f64[MATRIX_TEST_MAX_ELTS];
+static MATRIX_TEST_BIGGEST_INPUT_TYPE mat_cholesky_spd_data[MATRIX_TEST_MAX_ELTS];
+static MATRIX_TEST_BIGGEST_INPUT_TYPE mat_cholesky_fac_data[MATRIX_TEST_MAX_ELTS];
+static MATRIX_TEST_BIGGEST_INPUT_TYPE mat_cholesky_d_fut[MATRIX_TEST_MAX_ROWS];
+static MATRIX_TEST_BIGGEST_INPUT_TYPE mat_cholesky_d_ref[MATRIX_TEST_MAX_ROWS];
+
+static void mat_cholesky_make_spd(const arm_matrix_instance_f32 * mat_ptr)
+{
+    uint32_t n = mat_ptr->numRows;
+    uint32_t r, c, k;
+    float64_t sum;
+
+    for (r = 0; r < n; r++)
+    {
+        for (c = 0; c < n; c++)
+        {
+            sum = (r == c) ? (float64_t) n : 0.0;
+
+            for (k = 0; k < n; k++)
+            {
+                sum += (float64_t) mat_ptr->pData[r * n + k] *
+                    (float64_t) mat_ptr->pData[c * n + k];
+            }
+
+            mat_cholesky_spd_f64[r * n + c] = sum;
+        }
+    }
+}
+
+/**
+ *  Build the symmetric positive definite input of the given type in
+ *  mat_cholesky_spd_data and describe it with the instance spd.
+ */
+#define MAT_CHOLESKY_CONFIG_SPD_INPUT(suffix, mat_ptr, spd)             \
+    do                                                                  \
+    {                                                                   \
+        uint32_t spd_idx;                                               \
+                                                                        \
+        mat_cholesky_make_spd(mat_ptr);                                 \
+        for (spd_idx = 0;                                               \
+             spd_idx < (uint32_t) (mat_ptr)->numRows * (mat_ptr)->numCols; \
+             spd_idx++)                                                 \
+        {                                                               \
+            ((TYPE_FROM_ABBREV(suffix) *) mat_cholesky_spd_data)[spd_idx] = \
+                (TYPE_FROM_ABBREV(suffix)) mat_cholesky_spd_f64[spd_idx]; \
+        }                                                               \
+        (spd).numRows = (mat_ptr)->numRows;                             \
+        (spd).numCols = (mat_ptr)->numCols;                             \
+        (spd).pData = (TYPE_FROM_ABBREV(suffix) *) mat_cholesky_spd_data; \
+    } while (0)
+
+/**
+ *  Compare an output of the function under test with the reference output
+ *  using SNR.
+ */
+#define MAT_CHOLESKY_SNR_COMPARE_f32(ref_ptr, tst_ptr, block_size)      \
+    TEST_ASSERT_SNR((float32_t *) (ref_ptr), (float32_t *) (tst_ptr),   \
+                    block_size, MATRIX_SNR_THRESHOLD)
+
+#define MAT_CHOLESKY_SNR_COMPARE_f64(ref_ptr, tst_ptr, block_size)      \
+    TEST_ASSERT_DBL_SNR((float64_t *) (ref_ptr), (float64_t *) (tst_ptr), \
+                        block_size, MATRIX_SNR_THRESHOLD)
+
+/* Output instances of matching type for each suffix. */
+#define MAT_CHOLESKY_OUTPUT_FUT_f32 matrix_output_fut
+#define MAT_CHOLESKY_OUTPUT_REF_f32 matrix_output_ref
+#define MAT_CHOLESKY_OUTPUT_FUT_f64 matrix_output_fut64
+#define MAT_CHOLESKY_OUTPUT_REF_f64 matrix_output_ref64
+
+/**
+ *  Give the output instances the size of the input.
+ */
+#define MAT_CHOLESKY_CONFIG_OUTPUT(suffix, spd)                         \
+    do                                                                  \
+    {                                                                   \
+        MAT_CHOLESKY_OUTPUT_FUT_##suffix.numRows = (spd).numRows;       \
+        MAT_CHOLESKY_OUTPUT_FUT_##suffix.numCols = (spd).numCols;       \
+        MAT_CHOLESKY_OUTPUT_REF_##suffix.numRows = (spd).numRows;       \
+        MAT_CHOLESKY_OUTPUT_REF_##suffix.numCols = (spd).numCols;       \
+    } while (0)
+
+/**
+ *  Run the function under test in place on a copy of its input and check
+ *  that the result is identical to the out of place result.
+ */
+#define MAT_CHOLESKY_ASSERT_IN_PLACE(suffix, inplace_call, size)        \
+    do                                                                  \
+    {                                                                   \
+        inplace_call;                                                   \
+        TEST_ASSERT_BUFFERS_EQUAL(                                      \
+            MAT_CHOLESKY_OUTPUT_FUT_##suffix.pData,                     \
+            mat_cholesky_fac_data,                                      \
+            (size) * sizeof(TYPE_FROM_ABBREV(suffix)));                 \
+    } while (0)
+
+/*--------------------------------------------------------------------------------*/
+/* Decomposition Tests */
+/*--------------------------------------------------------------------------------*/
+
+#define JTEST_ARM_MAT_CHOLESKY_TEST(suffix)                                 \
+    JTEST_DEFINE_TEST(arm_mat_cholesky_##suffix##_test,                     \
+                      arm_mat_cholesky_##suffix)                            \
+    {                                                                       \
+        arm_matrix_instance_##suffix spd;                                   \
+        arm_matrix_instance_##suffix fac;                                   \
+                                                                            \
+        TEMPLATE_DO_ARR_DESC(                                               \
+            mat_idx, arm_matrix_instance_f32 *, mat_ptr,                    \
+            matrix_f32_invertible_inputs                                    \
+            ,                                                               \
+            JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n",                   \
+                            (int)mat_ptr->numRows,                          \
+                            (int)mat_ptr->numCols);                         \
+                                                                            \
+            MAT_CHOLESKY_CONFIG_SPD_INPUT(suffix, mat_ptr, spd);            \
+            MAT_CHOLESKY_CONFIG_OUTPUT(suffix, spd);                        \
+                                                                            \
+            JTEST_COUNT_CYCLES(                                             \
+                arm_mat_cholesky_##suffix(                                  \
+                    &spd, &MAT_CHOLESKY_OUTPUT_FUT_##suffix));              \
+            ref_mat_cholesky_##suffix(                                      \
+                &spd, &MAT_CHOLESKY_OUTPUT_REF_##suffix);                   \
+                                                                            \
+            MAT_CHOLESKY_SNR_COMPARE_##suffix(                              \
+                MAT_CHOLESKY_OUTPUT_REF_##suffix.pData,                     \
+                MAT_CHOLESKY_OUTPUT_FUT_##suffix.pData,                     \
+                spd.numRows * spd.numCols);                                 \
+                                                                            \
+            fac = spd;                                                      \
+            fac.pData = (TYPE_FROM_ABBREV(suffix) *) mat_cholesky_fac_data; \
+            memcpy(mat_cholesky_fac_data, spd.pData,                        \
+                   spd.numRows * spd.numCols *                              \
+                   sizeof(TYPE_FROM_ABBREV(suffix)));                       \
+            MAT_CHOLESKY_ASSERT_IN_PLACE(                                   \
+                suffix,                                                     \
+                arm_mat_cholesky_##suffix(&fac, &fac),                      \
+                spd.numRows * spd.numCols));                                \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+#define JTEST_ARM_MAT_LDLT_TEST(suffix)                                     \
+    JTEST_DEFINE_TEST(arm_mat_ldlt_##suffix##_test,                         \
+                      arm_mat_ldlt_##suffix)                                \
+    {                                                                       \
+        arm_matrix_instance_##suffix spd;                                   \
+        arm_matrix_instance_##suffix fac;                                   \
+                                                                            \
+        TEMPLATE_DO_ARR_DESC(                                               \
+            mat_idx, arm_matrix_instance_f32 *, mat_ptr,                    \
+            matrix_f32_invertible_inputs                                    \
+            ,                                                               \
+            JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n",                   \
+                            (int)mat_ptr->numRows,                          \
+                            (int)mat_ptr->numCols);                         \
+                                                                            \
+            MAT_CHOLESKY_CONFIG_SPD_INPUT(suffix, mat_ptr, spd);            \
+            MAT_CHOLESKY_CONFIG_OUTPUT(suffix, spd);                        \
+                                                                            \
+            JTEST_COUNT_CYCLES(                                             \
+                arm_mat_ldlt_##suffix(                                      \
+                    &spd, &MAT_CHOLESKY_OUTPUT_FUT_##suffix,                \
+                    (TYPE_FROM_ABBREV(suffix) *) mat_cholesky_d_fut));      \
+            ref_mat_ldlt_##suffix(                                          \
+                &spd, &MAT_CHOLESKY_OUTPUT_REF_##suffix,                    \
+                (TYPE_FROM_ABBREV(suffix) *) mat_cholesky_d_ref);           \
+                                                                            \
+            MAT_CHOLESKY_SNR_COMPARE_##suffix(                              \
+                MAT_CHOLESKY_OUTPUT_REF_##suffix.pData,                     \
+                MAT_CHOLESKY_OUTPUT_FUT_##suffix.pData,                     \
+                spd.numRows * spd.numCols);                                 \
+            MAT_CHOLESKY_SNR_COMPARE_##suffix(                              \
+                mat_cholesky_d_ref, mat_cholesky_d_fut, spd.numRows);       \
+                                                                            \
+            fac = spd;                                                      \
+            fac.pData = (TYPE_FROM_ABBREV(suffix) *) mat_cholesky_fac_data; \
+            memcpy(mat_cholesky_fac_data, spd.pData,                        \
+                   spd.numRows * spd.numCols *                              \
+                   sizeof(TYPE_FROM_ABBREV(suffix)));                       \
+            MAT_CHOLESKY_ASSERT_IN_PLACE(                                   \
+                suffix,                                                     \
+                arm_mat_ldlt_##suffix(                                      \
+                    &fac, &fac,                                             \
+                    (TYPE_FROM_ABBREV(suffix) *) mat_cholesky_d_ref),       \
+                spd.numRows * spd.numCols));                                \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+JTEST_ARM_MAT_CHOLESKY_TEST(f32);
+JTEST_ARM_MAT_CHOLESKY_TEST(f64);
+JTEST_ARM_MAT_LDLT_TEST(f32);
+JTEST_ARM_MAT_LDLT_TEST(f64);
+
+/*--------------------------------------------------------------------------------*/
+/* Triangular Solve Tests */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  The triangular matrix is the reference Cholesky factor L of the symmetric
+  positive definite input, or its transpose for the upper triangular solve.
+  The right-hand side is the symmetric positive definite input itself.
+*/
+
+static MATRIX_TEST_BIGGEST_INPUT_TYPE mat_cholesky_tri_data[MATRIX_TEST_MAX_ELTS];
+
+#define JTEST_ARM_MAT_SOLVE_TRIANGULAR_TEST(side, suffix, tri_from_chol)    \
+    JTEST_DEFINE_TEST(arm_mat_solve_##side##_triangular_##suffix##_test,    \
+                      arm_mat_solve_##side##_triangular_##suffix)           \
+    {                                                                       \
+        arm_matrix_instance_##suffix spd;                                   \
+        arm_matrix_instance_##suffix tri;                                   \
+        arm_matrix_instance_##suffix rhs;                                   \
+                                                                            \
+        TEMPLATE_DO_ARR_DESC(                                               \
+            mat_idx, arm_matrix_instance_f32 *, mat_ptr,                    \
+            matrix_f32_invertible_inputs                                    \
+            ,                                                               \
+            JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n",                   \
+                            (int)mat_ptr->numRows,                          \
+                            (int)mat_ptr->numCols);                         \
+                                                                            \
+            MAT_CHOLESKY_CONFIG_SPD_INPUT(suffix, mat_ptr, spd);            \
+            MAT_CHOLESKY_CONFIG_OUTPUT(suffix, spd);                        \
+                                                                            \
+            tri = spd;                                                      \
+            tri.pData = (TYPE_FROM_ABBREV(suffix) *) mat_cholesky_tri_data; \
+            tri_from_chol(suffix, spd, tri);                                \
+                                                                            \
+            JTEST_COUNT_CYCLES(                                             \
+                arm_mat_solve_##side##_triangular_##suffix(                 \
+                    &tri, &spd, &MAT_CHOLESKY_OUTPUT_FUT_##suffix));        \
+            ref_mat_solve_##side##_triangular_##suffix(                     \
+                &tri, &spd, &MAT_CHOLESKY_OUTPUT_REF_##suffix);             \
+                                                                            \
+            MAT_CHOLESKY_SNR_COMPARE_##suffix(                              \
+                MAT_CHOLESKY_OUTPUT_REF_##suffix.pData,                     \
+                MAT_CHOLESKY_OUTPUT_FUT_##suffix.pData,                     \
+                spd.numRows * spd.numCols);                                 \
+                                                                            \
+            rhs = spd;                                                      \
+            rhs.pData = (TYPE_FROM_ABBREV(suffix) *) mat_cholesky_fac_data; \
+            memcpy(mat_cholesky_fac_data, spd.pData,                        \
+                   spd.numRows * spd.numCols *                              \
+                   sizeof(TYPE_FROM_ABBREV(suffix)));                       \
+            MAT_CHOLESKY_ASSERT_IN_PLACE(                                   \
+                suffix,                                                     \
+                arm_mat_solve_##side##_triangular_##suffix(                 \
+                    &tri, &rhs, &rhs),                                      \
+                spd.numRows * spd.numCols));                                \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+#define MAT_CHOLESKY_LOWER_FACTOR(suffix, spd, tri)     \
+    ref_mat_cholesky_##suffix(&(spd), &(tri))
+
+#define MAT_CHOLESKY_UPPER_FACTOR(suffix, spd, tri)     \
+    do                                                  \
+    {                                                   \
+        arm_matrix_instance_##suffix chol = (spd);      \
+                                                        \
+        chol.pData = MAT_CHOLESKY_OUTPUT_REF_##suffix.pData; \
+        ref_mat_cholesky_##suffix(&(spd), &chol);       \
+        ref_mat_trans_##suffix(&chol, &(tri));          \
+    } while (0)
+
+JTEST_ARM_MAT_SOLVE_TRIANGULAR_TEST(lower, f32, MAT_CHOLESKY_LOWER_FACTOR);
+JTEST_ARM_MAT_SOLVE_TRIANGULAR_TEST(lower, f64, MAT_CHOLESKY_LOWER_FACTOR);
+JTEST_ARM_MAT_SOLVE_TRIANGULAR_TEST(upper, f32, MAT_CHOLESKY_UPPER_FACTOR);
+JTEST_ARM_MAT_SOLVE_TRIANGULAR_TEST(upper, f64, MAT_CHOLESKY_UPPER_FACTOR);
+
+/*--------------------------------------------------------------------------------*/
+/* Benchmark Against Inverse-Then-Multiply */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Solves A * X = B for symmetric positive definite matrices of growing size,
+  once with arm_mat_inverse_f32() followed by arm_mat_mult_f32() and once with
+  arm_mat_cholesky_f32(), arm_mat_trans_f32() and the two triangular solves.
+  Both cycle counts are displayed and the two solutions are compared.
+*/
+
+#define MAT_CHOLESKY_BENCH_MAX_DIM 16
+#define MAT_CHOLESKY_BENCH_RHS_COLS 4
+#define MAT_CHOLESKY_BENCH_SNR_THRESHOLD 80
+
+static const uint16_t mat_cholesky_bench_dims[] = {4, 8, 16};
+
+static float32_t mat_cholesky_bench_a[MAT_CHOLESKY_BENCH_MAX_DIM * MAT_CHOLESKY_BENCH_MAX_DIM];
+static float32_t mat_cholesky_bench_work[MAT_CHOLESKY_BENCH_MAX_DIM * MAT_CHOLESKY_BENCH_MAX_DIM];
+static float32_t mat_cholesky_bench_fac[MAT_CHOLESKY_BENCH_MAX_DIM * MAT_CHOLESKY_BENCH_MAX_DIM];
+static float32_t mat_cholesky_bench_b[MAT_CHOLESKY_BENCH_MAX_DIM * MAT_CHOLESKY_BENCH_RHS_COLS];
+static float32_t mat_cholesky_bench_x_inv[MAT_CHOLESKY_BENCH_MAX_DIM * MAT_CHOLESKY_BENCH_RHS_COLS];
+static float32_t mat_cholesky_bench_x_chol[MAT_CHOLESKY_BENCH_MAX_DIM * MAT_CHOLESKY_BENCH_RHS_COLS];
+
+/*
+  Fill A with M * M^T + n * I and B with pseudo-random values in [-1, 1).
+*/
+static void mat_cholesky_bench_fill(uint16_t dim)
+{
+    uint32_t seed = dim;
+    uint32_t r, c, k;
+    float32_t sum;
+
+    for (r = 0; r < (uint32_t) dim * dim; r++)
+    {
+        mat_cholesky_bench_work[r] = (float32_t) ((int32_t) arm_rand_lcg(&seed) >> 8) / 8388608.0f;
+    }
+
+    for (r = 0; r < (uint32_t) dim * MAT_CHOLESKY_BENCH_RHS_COLS; r++)
+    {
+        mat_cholesky_bench_b[r] = (float32_t) ((int32_t) arm_rand_lcg(&seed) >> 8) / 8388608.0f;
+    }
+
+    for (r = 0; r < dim; r++)
+    {
+        for (c = 0; c < dim; c++)
+        {
+            sum = (r == c) ? (float32_t) dim : 0.0f;
+
+            for (k = 0; k < dim; k++)
+            {
+                sum += mat_cholesky_bench_work[r * dim + k] *
+                    mat_cholesky_bench_work[c * dim + k];
+            }
+
+            mat_cholesky_bench_a[r * dim + c] = sum;
+        }
+    }
+}
+
+/* Solve with the inverse, which overwrites the copy of A in the work buffer. */
+static void mat_cholesky_bench_solve_inverse(
+    arm_matrix_instance_f32 * work,
+    arm_matrix_instance_f32 * fac,
+    arm_matrix_instance_f32 * b,
+    arm_matrix_instance_f32 * x)
+{
+    arm_mat_inverse_f32(work, fac);
+    arm_mat_mult_f32(fac, b, x);
+}
+
+/* Solve with the Cholesky factor L: L * Y = B, then L^T * X = Y in place. */
+static void mat_cholesky_bench_solve_cholesky(
+    arm_matrix_instance_f32 * a,
+    arm_matrix_instance_f32 * fac,
+    arm_matrix_instance_f32 * work,
+    arm_matrix_instance_f32 * b,
+    arm_matrix_instance_f32 * x)
+{
+    arm_mat_cholesky_f32(a, fac);
+    arm_mat_trans_f32(fac, work);
+    arm_mat_solve_lower_triangular_f32(fac, b, x);
+    arm_mat_solve_upper_triangular_f32(work, x, x);
+}
+
+JTEST_DEFINE_TEST(arm_mat_cholesky_solve_f32_benchmark, arm_mat_cholesky_f32)
+{
+    arm_matrix_instance_f32 a, work, fac, b, x_inv, x_chol;
+    uint32_t dim_idx;
+    uint16_t dim;
+
+    for (dim_idx = 0;
+         dim_idx < (sizeof(mat_cholesky_bench_dims) /
+                    sizeof(mat_cholesky_bench_dims[0]));
+         dim_idx++)
+    {
+        dim = mat_cholesky_bench_dims[dim_idx];
+
+        mat_cholesky_bench_fill(dim);
+
+        arm_mat_init_f32(&a, dim, dim, mat_cholesky_bench_a);
+        arm_mat_init_f32(&work, dim, dim, mat_cholesky_bench_work);
+        arm_mat_init_f32(&fac, dim, dim, mat_cholesky_bench_fac);
+        arm_mat_init_f32(&b, dim, MAT_CHOLESKY_BENCH_RHS_COLS, mat_cholesky_bench_b);
+        arm_mat_init_f32(&x_inv, dim, MAT_CHOLESKY_BENCH_RHS_COLS, mat_cholesky_bench_x_inv);
+        arm_mat_init_f32(&x_chol, dim, MAT_CHOLESKY_BENCH_RHS_COLS, mat_cholesky_bench_x_chol);
+
+        JTEST_DUMP_STRF("Dimension: %d\n", (int) dim);
+
+        memcpy(mat_cholesky_bench_work, mat_cholesky_bench_a,
+               dim * dim * sizeof(float32_t));
+        JTEST_COUNT_CYCLES(
+            mat_cholesky_bench_solve_inverse(&work, &fac, &b, &x_inv));
+
+        JTEST_COUNT_CYCLES(
+            mat_cholesky_bench_solve_cholesky(&a, &fac, &work, &b, &x_chol));
+
+        TEST_ASSERT_SNR(mat_cholesky_bench_x_inv,
+                        mat_cholesky_bench_x_chol,
+                        dim * MAT_CHOLESKY_BENCH_RHS_COLS,
+                        MAT_CHOLESKY_BENCH_SNR_THRESHOLD);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(mat_cholesky_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_mat_cholesky_f32_test);
+    JTEST_TEST_CALL(arm_mat_cholesky_f64_test);
+    JTEST_TEST_CALL(arm_mat_ldlt_f32_test);
+    JTEST_TEST_CALL(arm_mat_ldlt_f64_test);
+    JTEST_TEST_CALL(arm_mat_solve_lower_triangular_f32_test);
+    JTEST_TEST_CALL(arm_mat_solve_lower_triangular_f64_test);
+    JTEST_TEST_CALL(arm_mat_solve_upper_triangular_f32_test);
+    JTEST_TEST_CALL(arm_mat_solve_upper_triangular_f64_test);
+    JTEST_TEST_CALL(arm_mat_cholesky_solve_f32_benchmark);
+}
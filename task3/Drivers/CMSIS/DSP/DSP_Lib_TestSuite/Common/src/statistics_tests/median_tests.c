@@ -0,0 +1,208 @@
+#include "jtest.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "type_abbrev.h"
+#include "statistics_test_data.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Buffers */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  The input is a pseudo-random Q31 signal generated at run time, in
+  statistics_random_input, and converted to the type under test in
+  statistics_random_src. The buffers are shared by all types, so they are
+  declared with the biggest one.
+*/
+#define MEDIAN_MAX_WINDOW 255
+#define MEDIAN_INPUT_LEN  1024
+
+/* Size of the blocks pushed into the filter, not a divisor of the input length. */
+#define MEDIAN_PUSH_LEN   100U
+
+static q31_t median_output_fut[MEDIAN_INPUT_LEN];
+static q31_t median_output_ref[MEDIAN_INPUT_LEN];
+static q31_t median_state[MEDIAN_MAX_WINDOW];
+static q31_t median_window[MEDIAN_MAX_WINDOW];
+static uint16_t median_heap[2 * MEDIAN_MAX_WINDOW];
+
+/* Window lengths of the correctness tests, odd and even. */
+static const uint16_t median_window_lens[] =
+{
+    1, 2, 3, 4, 5, 8, 31, 64, 255
+};
+
+/* Window lengths of the benchmark. */
+static const uint16_t median_bench_window_lens[] =
+{
+    3, 5, 9, 15, 31, 63, 127, 255
+};
+
+/*--------------------------------------------------------------------------------*/
+/* Test Templates */
+/*--------------------------------------------------------------------------------*/
+
+#define MEDIAN_TEST_BODY(suffix)                                                \
+    do                                                                          \
+    {                                                                           \
+        arm_median_filter_instance_##suffix median_inst;                        \
+        TYPE_FROM_ABBREV(suffix) * pSrc = (void *) statistics_random_src;       \
+        TYPE_FROM_ABBREV(suffix) * pFut = (void *) median_output_fut;           \
+        TYPE_FROM_ABBREV(suffix) * pRef = (void *) median_output_ref;           \
+        uint32_t cfg, m, pos, len;                                              \
+        uint16_t windowLen;                                                     \
+                                                                                \
+        for (m = 0; m < ARM_RAND_MASK_COUNT; m++)                               \
+        {                                                                       \
+            arm_fill_rand_q31(statistics_random_input, MEDIAN_INPUT_LEN,        \
+                              m + 1U, arm_rand_masks[m]);                       \
+            ARM_RAND_CONVERT_##suffix(statistics_random_input, pSrc,            \
+                                      MEDIAN_INPUT_LEN);                        \
+                                                                                \
+            for (cfg = 0;                                                       \
+                 cfg < sizeof(median_window_lens) / sizeof(uint16_t);           \
+                 cfg++)                                                         \
+            {                                                                   \
+                windowLen = median_window_lens[cfg];                            \
+                                                                                \
+                /* Display test parameter values */                             \
+                JTEST_DUMP_STRF("Window Length: %d\n"                           \
+                                "Mask: 0x%08x\n",                               \
+                                (int)windowLen,                                 \
+                                (unsigned int)arm_rand_masks[m]);               \
+                                                                                \
+                TEST_ASSERT_EQUAL(                                              \
+                    arm_median_filter_init_##suffix(                            \
+                        &median_inst, windowLen, (void *) median_state,         \
+                        median_heap),                                           \
+                    ARM_MATH_SUCCESS);                                          \
+                                                                                \
+                /* Stream the input in blocks, the last one shorter */          \
+                for (pos = 0; pos < MEDIAN_INPUT_LEN; pos += len)               \
+                {                                                               \
+                    len = MEDIAN_INPUT_LEN - pos;                               \
+                    len = (len < MEDIAN_PUSH_LEN) ? len : MEDIAN_PUSH_LEN;      \
+                    arm_median_filter_##suffix(&median_inst, pSrc + pos,        \
+                                               pFut + pos, len);                \
+                }                                                               \
+                                                                                \
+                ref_median_filter_##suffix(pSrc, pRef, (void *) median_window,  \
+                                           MEDIAN_INPUT_LEN, windowLen);        \
+                                                                                \
+                TEST_ASSERT_BUFFERS_EQUAL(                                      \
+                    pRef, pFut,                                                 \
+                    MEDIAN_INPUT_LEN * sizeof(TYPE_FROM_ABBREV(suffix)));       \
+            }                                                                   \
+        }                                                                       \
+                                                                                \
+        /* An empty window is rejected */                                       \
+        TEST_ASSERT_EQUAL(                                                      \
+            arm_median_filter_init_##suffix(&median_inst, 0,                    \
+                                            (void *) median_state,              \
+                                            median_heap),                       \
+            ARM_MATH_ARGUMENT_ERROR);                                           \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    } while (0)
+
+/*
+  Benchmark against the reference, which sorts the window with an insertion
+  sort for each sample: the first cycle count is the reference, the second the
+  function under test, for MEDIAN_INPUT_LEN samples.
+*/
+#define MEDIAN_BENCH_BODY(suffix)                                               \
+    do                                                                          \
+    {                                                                           \
+        arm_median_filter_instance_##suffix median_inst;                        \
+        TYPE_FROM_ABBREV(suffix) * pSrc = (void *) statistics_random_src;       \
+        TYPE_FROM_ABBREV(suffix) * pFut = (void *) median_output_fut;           \
+        TYPE_FROM_ABBREV(suffix) * pRef = (void *) median_output_ref;           \
+        uint32_t cfg;                                                           \
+        uint16_t windowLen;                                                     \
+                                                                                \
+        arm_fill_rand_q31(statistics_random_input, MEDIAN_INPUT_LEN, 1U,        \
+                          arm_rand_masks[0]);                                   \
+        ARM_RAND_CONVERT_##suffix(statistics_random_input, pSrc,                \
+                                  MEDIAN_INPUT_LEN);                            \
+                                                                                \
+        for (cfg = 0;                                                           \
+             cfg < sizeof(median_bench_window_lens) / sizeof(uint16_t);         \
+             cfg++)                                                             \
+        {                                                                       \
+            windowLen = median_bench_window_lens[cfg];                          \
+                                                                                \
+            JTEST_DUMP_STRF("Window Length: %d\n"                               \
+                            "Samples: %d\n",                                    \
+                            (int)windowLen,                                     \
+                            (int)MEDIAN_INPUT_LEN);                             \
+                                                                                \
+            JTEST_COUNT_CYCLES(                                                 \
+                ref_median_filter_##suffix(pSrc, pRef, (void *) median_window,  \
+                                           MEDIAN_INPUT_LEN, windowLen));       \
+                                                                                \
+            arm_median_filter_init_##suffix(&median_inst, windowLen,            \
+                                            (void *) median_state,              \
+                                            median_heap);                       \
+                                                                                \
+            JTEST_COUNT_CYCLES(                                                 \
+                arm_median_filter_##suffix(&median_inst, pSrc, pFut,            \
+                                           MEDIAN_INPUT_LEN));                  \
+                                                                                \
+            TEST_ASSERT_BUFFERS_EQUAL(                                          \
+                pRef, pFut,                                                     \
+                MEDIAN_INPUT_LEN * sizeof(TYPE_FROM_ABBREV(suffix)));           \
+        }                                                                       \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    } while (0)
+
+/*--------------------------------------------------------------------------------*/
+/* Tests */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_TEST(arm_median_filter_f32_test, arm_median_filter_f32)
+{
+    MEDIAN_TEST_BODY(f32);
+}
+
+JTEST_DEFINE_TEST(arm_median_filter_q31_test, arm_median_filter_q31)
+{
+    MEDIAN_TEST_BODY(q31);
+}
+
+JTEST_DEFINE_TEST(arm_median_filter_q15_test, arm_median_filter_q15)
+{
+    MEDIAN_TEST_BODY(q15);
+}
+
+JTEST_DEFINE_TEST(arm_median_filter_f32_bench, arm_median_filter_f32)
+{
+    MEDIAN_BENCH_BODY(f32);
+}
+
+JTEST_DEFINE_TEST(arm_median_filter_q31_bench, arm_median_filter_q31)
+{
+    MEDIAN_BENCH_BODY(q31);
+}
+
+JTEST_DEFINE_TEST(arm_median_filter_q15_bench, arm_median_filter_q15)
+{
+    MEDIAN_BENCH_BODY(q15);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(median_tests)
+{
+    JTEST_TEST_CALL(arm_median_filter_f32_test);
+    JTEST_TEST_CALL(arm_median_filter_q31_test);
+    JTEST_TEST_CALL(arm_median_filter_q15_test);
+
+    JTEST_TEST_CALL(arm_median_filter_f32_bench);
+    JTEST_TEST_CALL(arm_median_filter_q31_bench);
+    JTEST_TEST_CALL(arm_median_filter_q15_bench);
+}
@@ -0,0 +1,220 @@
+#include "jtest.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "type_abbrev.h"
+#include "statistics_test_data.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Buffers */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  The inputs are pseudo-random Q31 values generated at run time, in
+  statistics_random_input, and converted to the type under test in
+  statistics_random_src. The buffers are shared by all types, so they are
+  declared with the biggest one.
+*/
+#define PERCENTILE_MAX_BLOCKSIZE STATISTICS_RANDOM_MAX_LEN
+
+static q31_t percentile_scratch_fut[PERCENTILE_MAX_BLOCKSIZE];
+static q31_t percentile_scratch_ref[PERCENTILE_MAX_BLOCKSIZE];
+
+/* Lengths of the correctness tests. */
+static const uint16_t percentile_block_sizes[] =
+{
+    1, 2, 5, 9, 10, 16, 100, 1000
+};
+
+/* Lengths of the benchmark. */
+static const uint16_t percentile_bench_block_sizes[] =
+{
+    16, 64, 256, 1024, 4096
+};
+
+/* Minimum, 10%, quartile, median, 90% and maximum in each format. */
+static const float32_t percentile_fractions_f32[] =
+{
+    0.0f, 0.1f, 0.25f, 0.5f, 0.9f, 1.0f
+};
+
+static const q31_t percentile_fractions_q31[] =
+{
+    0, 0x0CCCCCCD, 0x20000000, 0x40000000, 0x73333333, 0x7FFFFFFF
+};
+
+static const q15_t percentile_fractions_q15[] =
+{
+    0, 0x0CCD, 0x2000, 0x4000, 0x7333, 0x7FFF
+};
+
+static const q7_t percentile_fractions_q7[] =
+{
+    0, 0x0D, 0x20, 0x40, 0x73, 0x7F
+};
+
+/*--------------------------------------------------------------------------------*/
+/* Test Templates */
+/*--------------------------------------------------------------------------------*/
+
+#define PERCENTILE_TEST_BODY(suffix)                                            \
+    do                                                                          \
+    {                                                                           \
+        TYPE_FROM_ABBREV(suffix) * pSrc = (void *) statistics_random_src;       \
+        TYPE_FROM_ABBREV(suffix) * pFut = (void *) percentile_scratch_fut;      \
+        TYPE_FROM_ABBREV(suffix) * pRef = (void *) percentile_scratch_ref;      \
+        TYPE_FROM_ABBREV(suffix) result_fut, result_ref;                        \
+        uint32_t cfg, m, p, blockSize;                                          \
+                                                                                \
+        for (m = 0; m < ARM_RAND_MASK_COUNT; m++)                               \
+        {                                                                       \
+            for (cfg = 0;                                                       \
+                 cfg < sizeof(percentile_block_sizes) / sizeof(uint16_t);       \
+                 cfg++)                                                         \
+            {                                                                   \
+                blockSize = percentile_block_sizes[cfg];                        \
+                                                                                \
+                /* Display test parameter values */                             \
+                JTEST_DUMP_STRF("Block Size: %d\n"                              \
+                                "Mask: 0x%08x\n",                               \
+                                (int)blockSize,                                 \
+                                (unsigned int)arm_rand_masks[m]);               \
+                                                                                \
+                arm_fill_rand_q31(statistics_random_input, blockSize, cfg + 1U, \
+                                  arm_rand_masks[m]);                           \
+                ARM_RAND_CONVERT_##suffix(statistics_random_input, pSrc,        \
+                                          blockSize);                           \
+                                                                                \
+                for (p = 0;                                                     \
+                     p < sizeof(percentile_fractions_##suffix) /                \
+                         sizeof(TYPE_FROM_ABBREV(suffix));                      \
+                     p++)                                                       \
+                {                                                               \
+                    ref_percentile_##suffix(pSrc, pRef, blockSize,              \
+                                            percentile_fractions_##suffix[p],   \
+                                            &result_ref);                       \
+                    arm_percentile_##suffix(pSrc, pFut, blockSize,              \
+                                            percentile_fractions_##suffix[p],   \
+                                            &result_fut);                       \
+                                                                                \
+                    TEST_ASSERT_EQUAL(result_fut, result_ref);                  \
+                }                                                               \
+                                                                                \
+                /* The input may be used as the scratch buffer */               \
+                arm_percentile_##suffix(pSrc, pSrc, blockSize,                  \
+                                        percentile_fractions_##suffix[3],       \
+                                        &result_fut);                           \
+                ref_percentile_##suffix(pRef, pRef, blockSize,                  \
+                                        percentile_fractions_##suffix[3],       \
+                                        &result_ref);                           \
+                                                                                \
+                TEST_ASSERT_EQUAL(result_fut, result_ref);                      \
+            }                                                                   \
+        }                                                                       \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    } while (0)
+
+/*
+  Benchmark of the median against the insertion sort of the reference
+  library: the first cycle count is the insertion sort, the second the
+  function under test.
+*/
+#define PERCENTILE_BENCH_BODY(suffix)                                           \
+    do                                                                          \
+    {                                                                           \
+        TYPE_FROM_ABBREV(suffix) * pSrc = (void *) statistics_random_src;       \
+        TYPE_FROM_ABBREV(suffix) * pFut = (void *) percentile_scratch_fut;      \
+        TYPE_FROM_ABBREV(suffix) * pRef = (void *) percentile_scratch_ref;      \
+        TYPE_FROM_ABBREV(suffix) result_fut, result_ref;                        \
+        uint32_t cfg, blockSize;                                                \
+                                                                                \
+        for (cfg = 0;                                                           \
+             cfg < sizeof(percentile_bench_block_sizes) / sizeof(uint16_t);     \
+             cfg++)                                                             \
+        {                                                                       \
+            blockSize = percentile_bench_block_sizes[cfg];                      \
+                                                                                \
+            JTEST_DUMP_STRF("Block Size: %d\n", (int)blockSize);                \
+                                                                                \
+            arm_fill_rand_q31(statistics_random_input, blockSize, cfg + 1U,     \
+                              arm_rand_masks[0]);                               \
+            ARM_RAND_CONVERT_##suffix(statistics_random_input, pSrc,            \
+                                      blockSize);                               \
+                                                                                \
+            JTEST_COUNT_CYCLES(                                                 \
+                ref_percentile_##suffix(pSrc, pRef, blockSize,                  \
+                                        percentile_fractions_##suffix[3],       \
+                                        &result_ref));                          \
+            JTEST_COUNT_CYCLES(                                                 \
+                arm_percentile_##suffix(pSrc, pFut, blockSize,                  \
+                                        percentile_fractions_##suffix[3],       \
+                                        &result_fut));                          \
+                                                                                \
+            TEST_ASSERT_EQUAL(result_fut, result_ref);                          \
+        }                                                                       \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    } while (0)
+
+/*--------------------------------------------------------------------------------*/
+/* Tests */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_TEST(arm_percentile_f32_test, arm_percentile_f32)
+{
+    PERCENTILE_TEST_BODY(f32);
+}
+
+JTEST_DEFINE_TEST(arm_percentile_q31_test, arm_percentile_q31)
+{
+    PERCENTILE_TEST_BODY(q31);
+}
+
+JTEST_DEFINE_TEST(arm_percentile_q15_test, arm_percentile_q15)
+{
+    PERCENTILE_TEST_BODY(q15);
+}
+
+JTEST_DEFINE_TEST(arm_percentile_q7_test, arm_percentile_q7)
+{
+    PERCENTILE_TEST_BODY(q7);
+}
+
+JTEST_DEFINE_TEST(arm_percentile_f32_bench, arm_percentile_f32)
+{
+    PERCENTILE_BENCH_BODY(f32);
+}
+
+JTEST_DEFINE_TEST(arm_percentile_q31_bench, arm_percentile_q31)
+{
+    PERCENTILE_BENCH_BODY(q31);
+}
+
+JTEST_DEFINE_TEST(arm_percentile_q15_bench, arm_percentile_q15)
+{
+    PERCENTILE_BENCH_BODY(q15);
+}
+
+JTEST_DEFINE_TEST(arm_percentile_q7_bench, arm_percentile_q7)
+{
+    PERCENTILE_BENCH_BODY(q7);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(percentile_tests)
+{
+    JTEST_TEST_CALL(arm_percentile_f32_test);
+    JTEST_TEST_CALL(arm_percentile_q31_test);
+    JTEST_TEST_CALL(arm_percentile_q15_test);
+    JTEST_TEST_CALL(arm_percentile_q7_test);
+
+    JTEST_TEST_CALL(arm_percentile_f32_bench);
+    JTEST_TEST_CALL(arm_percentile_q31_bench);
+    JTEST_TEST_CALL(arm_percentile_q15_bench);
+    JTEST_TEST_CALL(arm_percentile_q7_bench);
+}
@@ -24,6 +24,9 @@ statistics_output_f32_ref[STATISTICS_MAX_INPUT_ELEMENTS];
 STATISTICS_BIGGEST_INPUT_TYPE
 statistics_output_f32_fut[STATISTICS_MAX_INPUT_ELEMENTS];
 
+q31_t statistics_random_input[STATISTICS_RANDOM_MAX_LEN];
+q31_t statistics_random_src[STATISTICS_RANDOM_MAX_LEN];
+
 /*--------------------------------------------------------------------------------*/
 /* Block Sizes */
 /*--------------------------------------------------------------------------------*/
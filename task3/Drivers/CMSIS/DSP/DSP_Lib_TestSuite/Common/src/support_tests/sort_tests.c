@@ -0,0 +1,197 @@
+#include "jtest.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "type_abbrev.h"
+#include "support_test_data.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Buffers */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  The inputs are pseudo-random Q31 values generated at run time, in
+  support_random_input, and converted to the type under test in
+  support_random_src. The buffers are shared by all types, so they are
+  declared with the biggest one.
+*/
+#define SORT_MAX_BLOCKSIZE SUPPORT_RANDOM_MAX_LEN
+
+static q31_t sort_output_fut[SORT_MAX_BLOCKSIZE];
+static q31_t sort_output_ref[SORT_MAX_BLOCKSIZE];
+static q31_t sort_scratch[SORT_MAX_BLOCKSIZE];
+
+/* Lengths of the correctness tests, on both sides of the algorithm switches. */
+static const uint16_t sort_block_sizes[] =
+{
+    1, 2, 7, 16, 31, 32, 33, 64, 65, 100, 256, 1000
+};
+
+/* Lengths of the benchmark. */
+static const uint16_t sort_bench_block_sizes[] =
+{
+    8, 16, 32, 64, 128, 256, 512, 1024
+};
+
+/*--------------------------------------------------------------------------------*/
+/* Type Specific Interfaces */
+/*--------------------------------------------------------------------------------*/
+
+#define ARM_SORT_f32(pSrc, pDst, len)                                   \
+    arm_sort_f32(pSrc, pDst, (float32_t *) sort_scratch, len)
+
+#define ARM_SORT_q31(pSrc, pDst, len)                                   \
+    arm_sort_q31(pSrc, pDst, sort_scratch, len)
+
+#define ARM_SORT_q15(pSrc, pDst, len)                                   \
+    arm_sort_q15(pSrc, pDst, (q15_t *) sort_scratch, len)
+
+#define ARM_SORT_q7(pSrc, pDst, len)                                    \
+    arm_sort_q7(pSrc, pDst, len)
+
+/*--------------------------------------------------------------------------------*/
+/* Test Templates */
+/*--------------------------------------------------------------------------------*/
+
+#define SORT_TEST_BODY(suffix)                                                  \
+    do                                                                          \
+    {                                                                           \
+        TYPE_FROM_ABBREV(suffix) * pSrc = (void *) support_random_src;          \
+        TYPE_FROM_ABBREV(suffix) * pFut = (void *) sort_output_fut;             \
+        TYPE_FROM_ABBREV(suffix) * pRef = (void *) sort_output_ref;             \
+        uint32_t cfg, m, blockSize;                                             \
+                                                                                \
+        for (m = 0; m < ARM_RAND_MASK_COUNT; m++)                               \
+        {                                                                       \
+            for (cfg = 0;                                                       \
+                 cfg < sizeof(sort_block_sizes) / sizeof(uint16_t);             \
+                 cfg++)                                                         \
+            {                                                                   \
+                blockSize = sort_block_sizes[cfg];                              \
+                                                                                \
+                /* Display test parameter values */                             \
+                JTEST_DUMP_STRF("Block Size: %d\n"                              \
+                                "Mask: 0x%08x\n",                               \
+                                (int)blockSize,                                 \
+                                (unsigned int)arm_rand_masks[m]);               \
+                                                                                \
+                arm_fill_rand_q31(support_random_input, blockSize, cfg + 1U,    \
+                                  arm_rand_masks[m]);                           \
+                ARM_RAND_CONVERT_##suffix(support_random_input, pSrc,           \
+                                          blockSize);                           \
+                                                                                \
+                ref_sort_##suffix(pSrc, pRef, blockSize);                       \
+                ARM_SORT_##suffix(pSrc, pFut, blockSize);                       \
+                                                                                \
+                TEST_ASSERT_BUFFERS_EQUAL(                                      \
+                    pRef, pFut,                                                 \
+                    blockSize * sizeof(TYPE_FROM_ABBREV(suffix)));              \
+                                                                                \
+                /* In-place sorting gives the same output */                    \
+                ARM_SORT_##suffix(pSrc, pSrc, blockSize);                       \
+                                                                                \
+                TEST_ASSERT_BUFFERS_EQUAL(                                      \
+                    pRef, pSrc,                                                 \
+                    blockSize * sizeof(TYPE_FROM_ABBREV(suffix)));              \
+            }                                                                   \
+        }                                                                       \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    } while (0)
+
+/*
+  Benchmark against the insertion sort of the reference library: the first
+  cycle count is the insertion sort, the second the function under test.
+*/
+#define SORT_BENCH_BODY(suffix)                                                 \
+    do                                                                          \
+    {                                                                           \
+        TYPE_FROM_ABBREV(suffix) * pSrc = (void *) support_random_src;          \
+        TYPE_FROM_ABBREV(suffix) * pFut = (void *) sort_output_fut;             \
+        TYPE_FROM_ABBREV(suffix) * pRef = (void *) sort_output_ref;             \
+        uint32_t cfg, blockSize;                                                \
+                                                                                \
+        for (cfg = 0;                                                           \
+             cfg < sizeof(sort_bench_block_sizes) / sizeof(uint16_t);           \
+             cfg++)                                                             \
+        {                                                                       \
+            blockSize = sort_bench_block_sizes[cfg];                            \
+                                                                                \
+            JTEST_DUMP_STRF("Block Size: %d\n", (int)blockSize);                \
+                                                                                \
+            arm_fill_rand_q31(support_random_input, blockSize, cfg + 1U,        \
+                              arm_rand_masks[0]);                               \
+            ARM_RAND_CONVERT_##suffix(support_random_input, pSrc, blockSize);   \
+                                                                                \
+            JTEST_COUNT_CYCLES(ref_sort_##suffix(pSrc, pRef, blockSize));       \
+            JTEST_COUNT_CYCLES(ARM_SORT_##suffix(pSrc, pFut, blockSize));       \
+                                                                                \
+            TEST_ASSERT_BUFFERS_EQUAL(                                          \
+                pRef, pFut,                                                     \
+                blockSize * sizeof(TYPE_FROM_ABBREV(suffix)));                  \
+        }                                                                       \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    } while (0)
+
+/*--------------------------------------------------------------------------------*/
+/* Tests */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_TEST(arm_sort_f32_test, arm_sort_f32)
+{
+    SORT_TEST_BODY(f32);
+}
+
+JTEST_DEFINE_TEST(arm_sort_q31_test, arm_sort_q31)
+{
+    SORT_TEST_BODY(q31);
+}
+
+JTEST_DEFINE_TEST(arm_sort_q15_test, arm_sort_q15)
+{
+    SORT_TEST_BODY(q15);
+}
+
+JTEST_DEFINE_TEST(arm_sort_q7_test, arm_sort_q7)
+{
+    SORT_TEST_BODY(q7);
+}
+
+JTEST_DEFINE_TEST(arm_sort_f32_bench, arm_sort_f32)
+{
+    SORT_BENCH_BODY(f32);
+}
+
+JTEST_DEFINE_TEST(arm_sort_q31_bench, arm_sort_q31)
+{
+    SORT_BENCH_BODY(q31);
+}
+
+JTEST_DEFINE_TEST(arm_sort_q15_bench, arm_sort_q15)
+{
+    SORT_BENCH_BODY(q15);
+}
+
+JTEST_DEFINE_TEST(arm_sort_q7_bench, arm_sort_q7)
+{
+    SORT_BENCH_BODY(q7);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(sort_tests)
+{
+    JTEST_TEST_CALL(arm_sort_f32_test);
+    JTEST_TEST_CALL(arm_sort_q31_test);
+    JTEST_TEST_CALL(arm_sort_q15_test);
+    JTEST_TEST_CALL(arm_sort_q7_test);
+
+    JTEST_TEST_CALL(arm_sort_f32_bench);
+    JTEST_TEST_CALL(arm_sort_q31_bench);
+    JTEST_TEST_CALL(arm_sort_q15_bench);
+    JTEST_TEST_CALL(arm_sort_q7_bench);
+}
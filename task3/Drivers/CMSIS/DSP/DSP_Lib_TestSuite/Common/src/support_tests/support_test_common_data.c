@@ -18,6 +18,9 @@ ARR_DESC_DEFINE(BIGGEST_INPUT_TYPE,
                 MAX_INPUT_ELEMENTS,
                 CURLY(0));
 
+q31_t support_random_input[SUPPORT_RANDOM_MAX_LEN];
+q31_t support_random_src[SUPPORT_RANDOM_MAX_LEN];
+
 /*--------------------------------------------------------------------------------*/
 /* Block Sizes */
 /*--------------------------------------------------------------------------------*/
@@ -96,6 +96,112 @@
     } while (0)
 
 
+/* The fixed-point tables reorder the output when bit reversal is disabled. */
+extern void arm_bitreversal_32(
+    uint32_t * pSrc,
+    const uint16_t bitRevLen,
+    const uint16_t * pBitRevTable);
+
+extern void arm_bitreversal_16(
+    uint16_t * pSrc,
+    const uint16_t bitRevLen,
+    const uint16_t * pBitRevTable);
+
+/*
+  CFFT without bit reversal test template. The output of the function under test
+  with bitReverseFlag cleared, reordered with the bit reversal table of the
+  instance, must match its output with bitReverseFlag set. Arguments are:
+  inverse-transform flag, function suffix (q15/q31), the output type (q15_t,
+  q31_t) and the width of the bit reversal (16/32).
+*/
+#define CFFT_NO_BITREVERSE_TEST_BODY(ifft_flag, suffix, output_type, width)             \
+    do                                                                                  \
+    {                                                                                   \
+        /* Go through all arm_cfft_instances */                                         \
+        TEMPLATE_DO_ARR_DESC(                                                           \
+            cfft_inst_idx, const arm_cfft_instance_##suffix *, cfft_inst_ptr,           \
+            transform_cfft_##suffix##_structs                                           \
+            ,                                                                           \
+                                                                                        \
+            TRANSFORM_PREPARE_INPLACE_INPUTS(                                           \
+                transform_fft_##suffix##_inputs,                                        \
+                cfft_inst_ptr->fftLen *                                                 \
+                sizeof(output_type) *                                                   \
+                2 /*complex_inputs*/);                                                  \
+                                                                                        \
+            /* Display parameter values */                                              \
+            JTEST_DUMP_STRF("Block Size: %d\n"                                          \
+                            "Inverse-transform flag: %d\n",                             \
+                            (int)cfft_inst_ptr->fftLen,                                 \
+                            (int)ifft_flag);                                            \
+                                                                                        \
+            arm_cfft_##suffix(cfft_inst_ptr,                                            \
+                         (void *) transform_fft_inplace_input_fut,                      \
+                         ifft_flag,              /* IFFT Flag */                        \
+                         0);             /* Bitreverse flag */                          \
+            arm_bitreversal_##width((void *) transform_fft_inplace_input_fut,           \
+                                    cfft_inst_ptr->bitRevLength,                        \
+                                    cfft_inst_ptr->pBitRevTable);                       \
+            arm_cfft_##suffix(cfft_inst_ptr,                                            \
+                         (void *) transform_fft_inplace_input_ref,                      \
+                         ifft_flag,              /* IFFT Flag */                        \
+                         1);             /* Bitreverse flag */                          \
+                                                                                        \
+            /* Test correctness */                                                      \
+            TEST_ASSERT_BUFFERS_EQUAL(                                                  \
+                transform_fft_inplace_input_ref,                                        \
+                transform_fft_inplace_input_fut,                                        \
+                cfft_inst_ptr->fftLen * sizeof(output_type) * 2));                      \
+                                                                                        \
+        return JTEST_TEST_PASSED;                                                       \
+    } while (0)
+
+/*
+  Fixed-point CFFT benchmark template. Every length of the arm_cfft_instances is
+  timed, followed by the deprecated radix-4 function for the lengths it supports.
+  Arguments are: function suffix (q15/q31) and the output type (q15_t, q31_t).
+*/
+#define CFFT_BENCH_BODY(suffix, output_type)                                            \
+    do                                                                                  \
+    {                                                                                   \
+        arm_cfft_radix4_instance_##suffix radix4_inst;                                  \
+                                                                                        \
+        /* Go through all arm_cfft_instances */                                         \
+        TEMPLATE_DO_ARR_DESC(                                                           \
+            cfft_inst_idx, const arm_cfft_instance_##suffix *, cfft_inst_ptr,           \
+            transform_cfft_##suffix##_structs                                           \
+            ,                                                                           \
+                                                                                        \
+            TRANSFORM_PREPARE_INPLACE_INPUTS(                                           \
+                transform_fft_##suffix##_inputs,                                        \
+                cfft_inst_ptr->fftLen *                                                 \
+                sizeof(output_type) *                                                   \
+                2 /*complex_inputs*/);                                                  \
+                                                                                        \
+            /* Display parameter values */                                              \
+            JTEST_DUMP_STRF("Block Size: %d\n",                                         \
+                            (int)cfft_inst_ptr->fftLen);                                \
+                                                                                        \
+            JTEST_COUNT_CYCLES(                                                         \
+                arm_cfft_##suffix(cfft_inst_ptr,                                        \
+                             (void *) transform_fft_inplace_input_fut,                  \
+                             0,                      /* IFFT Flag */                    \
+                             1));            /* Bitreverse flag */                      \
+                                                                                        \
+            if (arm_cfft_radix4_init_##suffix(&radix4_inst,                             \
+                                              cfft_inst_ptr->fftLen,                    \
+                                              0, 1) == ARM_MATH_SUCCESS)                \
+            {                                                                           \
+                JTEST_COUNT_CYCLES(                                                     \
+                    arm_cfft_radix4_##suffix(                                           \
+                        &radix4_inst,                                                   \
+                        (void *) transform_fft_inplace_input_ref));                     \
+            });                                                                         \
+                                                                                        \
+        return JTEST_TEST_PASSED;                                                       \
+    } while (0)
+
+
 /* Test declarations */
 JTEST_DEFINE_TEST(cfft_f32_test, cfft_f32)
 {
@@ -127,6 +233,36 @@ JTEST_DEFINE_TEST(cfft_q15_ifft_test, cfft_q15)
     CFFT_TEST_BODY((uint8_t) 1, q15, q15_t);
 }
 
+JTEST_DEFINE_TEST(cfft_q31_no_bitreverse_test, cfft_q31)
+{
+    CFFT_NO_BITREVERSE_TEST_BODY((uint8_t) 0, q31, q31_t, 32);
+}
+
+JTEST_DEFINE_TEST(cfft_q31_ifft_no_bitreverse_test, cfft_q31)
+{
+    CFFT_NO_BITREVERSE_TEST_BODY((uint8_t) 1, q31, q31_t, 32);
+}
+
+JTEST_DEFINE_TEST(cfft_q15_no_bitreverse_test, cfft_q15)
+{
+    CFFT_NO_BITREVERSE_TEST_BODY((uint8_t) 0, q15, q15_t, 16);
+}
+
+JTEST_DEFINE_TEST(cfft_q15_ifft_no_bitreverse_test, cfft_q15)
+{
+    CFFT_NO_BITREVERSE_TEST_BODY((uint8_t) 1, q15, q15_t, 16);
+}
+
+JTEST_DEFINE_TEST(cfft_q31_bench, cfft_q31)
+{
+    CFFT_BENCH_BODY(q31, q31_t);
+}
+
+JTEST_DEFINE_TEST(cfft_q15_bench, cfft_q15)
+{
+    CFFT_BENCH_BODY(q15, q15_t);
+}
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group */
 /*--------------------------------------------------------------------------------*/
@@ -141,4 +277,12 @@ JTEST_DEFINE_GROUP(cfft_tests)
 
     JTEST_TEST_CALL(cfft_q15_test);
     JTEST_TEST_CALL(cfft_q15_ifft_test);
+
+    JTEST_TEST_CALL(cfft_q31_no_bitreverse_test);
+    JTEST_TEST_CALL(cfft_q31_ifft_no_bitreverse_test);
+    JTEST_TEST_CALL(cfft_q15_no_bitreverse_test);
+    JTEST_TEST_CALL(cfft_q15_ifft_no_bitreverse_test);
+
+    JTEST_TEST_CALL(cfft_q31_bench);
+    JTEST_TEST_CALL(cfft_q15_bench);
 }
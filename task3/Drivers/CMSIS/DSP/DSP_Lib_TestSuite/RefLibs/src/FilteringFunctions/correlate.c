@@ -73,7 +73,7 @@ void ref_correlate_f32(
       if ((i - j < srcBLen) && (j < srcALen))
       {
         /* z[i] += x[i-j] * y[j] */
-        sum += pIn1[j] * pIn2[-((int32_t)i - j)];
+        sum += pIn1[j] * pIn2[-((int32_t) (i - j))];
       }
     }
     /* Store the output in the destination buffer */
@@ -144,7 +144,7 @@ void ref_correlate_q31(
       if ((((i - j) < srcBLen) && (j < srcALen)))
       {
         /* z[i] += x[i-j] * y[j] */
-        sum += ((q63_t) pIn1[j] * pIn2[-((int32_t) i - j)]);
+        sum += ((q63_t) pIn1[j] * pIn2[-((int32_t) (i - j))]);
       }
     }
     /* Store the output in the destination buffer */
@@ -216,7 +216,7 @@ void ref_correlate_fast_q31(
       {
         /* z[i] += x[i-j] * y[j] */
         sum = (q31_t) ((((q63_t) sum << 32) +
-												((q63_t) pIn1[j] * pIn2[-((int32_t) i - j)])) >> 32);
+												((q63_t) pIn1[j] * pIn2[-((int32_t) (i - j))])) >> 32);
       }
     }
     /* Store the output in the destination buffer */
@@ -287,7 +287,7 @@ void ref_correlate_q15(
       if ((((i - j) < srcBLen) && (j < srcALen)))
       {
         /* z[i] += x[i-j] * y[j] */
-        sum += ((q31_t) pIn1[j] * pIn2[-((int32_t) i - j)]);
+        sum += ((q31_t) pIn1[j] * pIn2[-((int32_t) (i - j))]);
       }
     }
     /* Store the output in the destination buffer */
@@ -358,7 +358,7 @@ void ref_correlate_fast_q15(
       if ((((i - j) < srcBLen) && (j < srcALen)))
       {
         /* z[i] += x[i-j] * y[j] */
-        sum += ((q31_t) pIn1[j] * pIn2[-((int32_t) i - j)]);
+        sum += ((q31_t) pIn1[j] * pIn2[-((int32_t) (i - j))]);
       }
     }
     /* Store the output in the destination buffer */
@@ -430,7 +430,7 @@ void ref_correlate_fast_opt_q15(
       if ((((i - j) < srcBLen) && (j < srcALen)))
       {
         /* z[i] += x[i-j] * y[j] */
-        sum += ((q31_t) pIn1[j] * pIn2[-((int32_t) i - j)]);
+        sum += ((q31_t) pIn1[j] * pIn2[-((int32_t) (i - j))]);
       }
     }
     /* Store the output in the destination buffer */
@@ -501,7 +501,7 @@ void ref_correlate_q7(
       if ((((i - j) < srcBLen) && (j < srcALen)))
       {
         /* z[i] += x[i-j] * y[j] */
-        sum += ((q15_t) pIn1[j] * pIn2[-((int32_t) i - j)]);
+        sum += ((q15_t) pIn1[j] * pIn2[-((int32_t) (i - j))]);
       }
     }
     /* Store the output in the destination buffer */
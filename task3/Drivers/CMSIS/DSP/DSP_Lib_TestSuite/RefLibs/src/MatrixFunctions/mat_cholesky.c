@@ -0,0 +1,167 @@
+#include "ref.h"
+
+arm_status ref_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+	uint32_t r,c,k;
+	uint32_t n = pSrc->numRows;
+	float32_t sum;
+	
+	for(r=0;r<n;r++)
+	{
+		for(c=0;c<=r;c++)
+		{
+			sum = pSrc->pData[r*n + c];
+			for(k=0;k<c;k++)
+			{
+				sum -= pDst->pData[r*n + k] * pDst->pData[c*n + k];
+			}
+			
+			if(r == c)
+			{
+				if(sum <= 0)
+				{
+					return ARM_MATH_DECOMPOSITION_FAILURE;
+				}
+				pDst->pData[r*n + c] = sqrtf(sum);
+			}
+			else
+			{
+				pDst->pData[r*n + c] = sum / pDst->pData[c*n + c];
+			}
+		}
+		
+		for(c=r+1;c<n;c++)
+		{
+			pDst->pData[r*n + c] = 0;
+		}
+	}
+	
+	return ARM_MATH_SUCCESS;
+}
+
+arm_status ref_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst,
+  float32_t * pD)
+{
+	uint32_t r,c,k;
+	uint32_t n = pSrc->numRows;
+	float32_t sum;
+	
+	for(r=0;r<n;r++)
+	{
+		for(c=0;c<r;c++)
+		{
+			sum = pSrc->pData[r*n + c];
+			for(k=0;k<c;k++)
+			{
+				sum -= pDst->pData[r*n + k] * pDst->pData[c*n + k] * pD[k];
+			}
+			pDst->pData[r*n + c] = sum / pD[c];
+		}
+		
+		sum = pSrc->pData[r*n + r];
+		for(k=0;k<r;k++)
+		{
+			sum -= pDst->pData[r*n + k] * pDst->pData[r*n + k] * pD[k];
+		}
+		if(sum == 0)
+		{
+			return ARM_MATH_DECOMPOSITION_FAILURE;
+		}
+		pD[r] = sum;
+		pDst->pData[r*n + r] = 1;
+		
+		for(c=r+1;c<n;c++)
+		{
+			pDst->pData[r*n + c] = 0;
+		}
+	}
+	
+	return ARM_MATH_SUCCESS;
+}
+
+arm_status ref_mat_cholesky_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst)
+{
+	uint64_t r,c,k;
+	uint64_t n = pSrc->numRows;
+	float64_t sum;
+	
+	for(r=0;r<n;r++)
+	{
+		for(c=0;c<=r;c++)
+		{
+			sum = pSrc->pData[r*n + c];
+			for(k=0;k<c;k++)
+			{
+				sum -= pDst->pData[r*n + k] * pDst->pData[c*n + k];
+			}
+			
+			if(r == c)
+			{
+				if(sum <= 0)
+				{
+					return ARM_MATH_DECOMPOSITION_FAILURE;
+				}
+				pDst->pData[r*n + c] = sqrt(sum);
+			}
+			else
+			{
+				pDst->pData[r*n + c] = sum / pDst->pData[c*n + c];
+			}
+		}
+		
+		for(c=r+1;c<n;c++)
+		{
+			pDst->pData[r*n + c] = 0;
+		}
+	}
+	
+	return ARM_MATH_SUCCESS;
+}
+
+arm_status ref_mat_ldlt_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst,
+  float64_t * pD)
+{
+	uint64_t r,c,k;
+	uint64_t n = pSrc->numRows;
+	float64_t sum;
+	
+	for(r=0;r<n;r++)
+	{
+		for(c=0;c<r;c++)
+		{
+			sum = pSrc->pData[r*n + c];
+			for(k=0;k<c;k++)
+			{
+				sum -= pDst->pData[r*n + k] * pDst->pData[c*n + k] * pD[k];
+			}
+			pDst->pData[r*n + c] = sum / pD[c];
+		}
+		
+		sum = pSrc->pData[r*n + r];
+		for(k=0;k<r;k++)
+		{
+			sum -= pDst->pData[r*n + k] * pDst->pData[r*n + k] * pD[k];
+		}
+		if(sum == 0)
+		{
+			return ARM_MATH_DECOMPOSITION_FAILURE;
+		}
+		pD[r] = sum;
+		pDst->pData[r*n + r] = 1;
+		
+		for(c=r+1;c<n;c++)
+		{
+			pDst->pData[r*n + c] = 0;
+		}
+	}
+	
+	return ARM_MATH_SUCCESS;
+}
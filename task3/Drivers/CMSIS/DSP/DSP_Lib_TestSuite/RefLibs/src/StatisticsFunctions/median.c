@@ -0,0 +1,75 @@
+#include "ref.h"
+
+/*
+ * The reference median filters sort a copy of the window for every output
+ * sample. Samples before the start of the input are zeros.
+ */
+
+void ref_median_filter_f32(
+	float32_t * pSrc,
+	float32_t * pDst,
+	float32_t * pWindow,
+	uint32_t blockSize,
+	uint16_t windowLen)
+{
+	uint32_t n, k;
+
+	for (n = 0; n < blockSize; n++)
+	{
+		for (k = 0; k < windowLen; k++)
+		{
+			pWindow[k] = (n + k + 1 >= windowLen) ? pSrc[n + k + 1 - windowLen] : 0;
+		}
+
+		ref_sort_f32(pWindow, pWindow, windowLen);
+
+		pDst[n] = (windowLen & 1) ? pWindow[windowLen / 2] :
+			0.5f * (pWindow[windowLen / 2 - 1] + pWindow[windowLen / 2]);
+	}
+}
+
+void ref_median_filter_q31(
+	q31_t * pSrc,
+	q31_t * pDst,
+	q31_t * pWindow,
+	uint32_t blockSize,
+	uint16_t windowLen)
+{
+	uint32_t n, k;
+
+	for (n = 0; n < blockSize; n++)
+	{
+		for (k = 0; k < windowLen; k++)
+		{
+			pWindow[k] = (n + k + 1 >= windowLen) ? pSrc[n + k + 1 - windowLen] : 0;
+		}
+
+		ref_sort_q31(pWindow, pWindow, windowLen);
+
+		pDst[n] = (windowLen & 1) ? pWindow[windowLen / 2] :
+			(q31_t)(((q63_t)pWindow[windowLen / 2 - 1] + pWindow[windowLen / 2]) >> 1);
+	}
+}
+
+void ref_median_filter_q15(
+	q15_t * pSrc,
+	q15_t * pDst,
+	q15_t * pWindow,
+	uint32_t blockSize,
+	uint16_t windowLen)
+{
+	uint32_t n, k;
+
+	for (n = 0; n < blockSize; n++)
+	{
+		for (k = 0; k < windowLen; k++)
+		{
+			pWindow[k] = (n + k + 1 >= windowLen) ? pSrc[n + k + 1 - windowLen] : 0;
+		}
+
+		ref_sort_q15(pWindow, pWindow, windowLen);
+
+		pDst[n] = (windowLen & 1) ? pWindow[windowLen / 2] :
+			(q15_t)(((q31_t)pWindow[windowLen / 2 - 1] + pWindow[windowLen / 2]) >> 1);
+	}
+}
@@ -0,0 +1,78 @@
+#include "ref.h"
+
+/*
+ * The percentile is read from a sorted copy of the input, at index
+ * floor(percentile * blockSize).
+ */
+
+void ref_percentile_f32(
+	float32_t * pSrc,
+	float32_t * pScratch,
+	uint32_t blockSize,
+	float32_t percentile,
+	float32_t * pResult)
+{
+	uint32_t k;
+
+	ref_sort_f32(pSrc, pScratch, blockSize);
+
+	if (percentile <= 0.0f)
+	{
+		k = 0;
+	}
+	else
+	{
+		k = (percentile < 1.0f) ? (uint32_t)(percentile * blockSize) : blockSize;
+		k = (k < blockSize) ? k : blockSize - 1;
+	}
+
+	*pResult = pScratch[k];
+}
+
+void ref_percentile_q31(
+	q31_t * pSrc,
+	q31_t * pScratch,
+	uint32_t blockSize,
+	q31_t percentile,
+	q31_t * pResult)
+{
+	uint32_t k;
+
+	ref_sort_q31(pSrc, pScratch, blockSize);
+
+	k = (percentile > 0) ? (uint32_t)(((uint64_t)percentile * blockSize) >> 31) : 0;
+
+	*pResult = pScratch[k];
+}
+
+void ref_percentile_q15(
+	q15_t * pSrc,
+	q15_t * pScratch,
+	uint32_t blockSize,
+	q15_t percentile,
+	q15_t * pResult)
+{
+	uint32_t k;
+
+	ref_sort_q15(pSrc, pScratch, blockSize);
+
+	k = (percentile > 0) ? (uint32_t)(((uint64_t)percentile * blockSize) >> 15) : 0;
+
+	*pResult = pScratch[k];
+}
+
+void ref_percentile_q7(
+	q7_t * pSrc,
+	q7_t * pScratch,
+	uint32_t blockSize,
+	q7_t percentile,
+	q7_t * pResult)
+{
+	uint32_t k;
+
+	ref_sort_q7(pSrc, pScratch, blockSize);
+
+	k = (percentile > 0) ? (uint32_t)(((uint64_t)percentile * blockSize) >> 7) : 0;
+
+	*pResult = pScratch[k];
+}
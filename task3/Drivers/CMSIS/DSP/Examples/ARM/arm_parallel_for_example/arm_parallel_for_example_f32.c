@@ -0,0 +1,237 @@
+/* ----------------------------------------------------------------------
+*
+* Project:       CMSIS DSP Library
+* Title:         arm_parallel_for_example_f32.c
+*
+* Description:   Benchmark of FIR filtering and matrix multiplication
+*                split over FreeRTOS parallel loop workers
+*
+* Target Processor: Cortex-M4/Cortex-M7
+*
+ * -------------------------------------------------------------------- */
+
+/**
+ * @ingroup groupExamples
+ */
+
+/**
+ * @defgroup ParallelForExample Parallel Loop Example
+ *
+ * \par Description:
+ * \par
+ * Demonstrates how to split CMSIS DSP kernels over several FreeRTOS tasks with
+ * vParallelFor(), and measures the speed up over executing them serially.
+ *
+ * \par Algorithm:
+ * \par
+ * The FIR filter output is split into blocks of \c FIR_BLOCK_SIZE samples.  Each
+ * block is filtered independently: its state buffer is loaded with the
+ * <code>NUM_TAPS - 1</code> input samples that precede the block, so every block
+ * produces exactly the samples a single pass over the whole signal would.
+ * \par
+ * The matrix product <code>C = A * B</code> is split into bands of rows.  The band
+ * of \c C from row \c i to row \c j is the product of the same band of \c A with
+ * \c B, computed by arm_mat_mult_f32() on sub-matrix instances.
+ * \par
+ * Each kernel is executed serially and then with vParallelFor(), and the cycle
+ * counts read from the DWT cycle counter are stored in \c cycles.  The parallel
+ * outputs are compared with the serial outputs.
+ *
+ * \par Variables Description:
+ * \par
+ * \li \c firInput padded input signal, with <code>NUM_TAPS - 1</code> leading zeros
+ * \li \c firSerial and \c firParallel serial and parallel filter outputs
+ * \li \c matA, \c matB input matrices
+ * \li \c matSerial and \c matParallel serial and parallel products
+ * \li \c cycles cycle counts, indexed by the \c BENCH_ values
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_fir_init_f32()
+ * - arm_fir_f32()
+ * - arm_mat_init_f32()
+ * - arm_mat_mult_f32()
+ *
+ * <b> Refer  </b>
+ * \link arm_parallel_for_example_f32.c \endlink
+ *
+ */
+
+
+/** \example arm_parallel_for_example_f32.c
+ */
+
+/* ----------------------------------------------------------------------
+** Include Files
+** ------------------------------------------------------------------- */
+
+#include <string.h>
+#include "arm_math.h"
+#include "math_helper.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "parallel_for.h"
+
+/* ----------------------------------------------------------------------
+** Macro Defines
+** ------------------------------------------------------------------- */
+
+#define FIR_LENGTH_SAMPLES   4096
+#define FIR_BLOCK_SIZE       64
+#define NUM_TAPS             32
+#define MAT_DIM              32
+#define MAT_ROWS_GRAIN       4
+#define SNR_THRESHOLD_F32    140.0f
+
+#define BENCH_FIR_SERIAL     0
+#define BENCH_FIR_PARALLEL   1
+#define BENCH_MAT_SERIAL     2
+#define BENCH_MAT_PARALLEL   3
+#define BENCH_COUNT          4
+
+#define BENCH_TASK_STACK     512
+
+/* arm_math.h only includes the generic part of the core header, so the DWT
+   cycle counter registers are defined here. */
+#define DEMCR                (*(volatile uint32_t *) 0xE000EDFCUL)
+#define DEMCR_TRCENA         (1UL << 24)
+#define DWT_CTRL             (*(volatile uint32_t *) 0xE0001000UL)
+#define DWT_CTRL_CYCCNTENA   (1UL << 0)
+#define DWT_CYCCNT           (*(volatile uint32_t *) 0xE0001004UL)
+#define BENCH_TASK_PRIORITY  ( configPARALLEL_FOR_WORKER_PRIORITY )
+
+/* ----------------------------------------------------------------------
+** Data
+** ------------------------------------------------------------------- */
+
+float32_t firInput[NUM_TAPS - 1 + FIR_LENGTH_SAMPLES];
+float32_t firSerial[FIR_LENGTH_SAMPLES];
+float32_t firParallel[FIR_LENGTH_SAMPLES];
+float32_t firCoeffs[NUM_TAPS];
+
+float32_t matA[MAT_DIM * MAT_DIM];
+float32_t matB[MAT_DIM * MAT_DIM];
+float32_t matSerial[MAT_DIM * MAT_DIM];
+float32_t matParallel[MAT_DIM * MAT_DIM];
+
+uint32_t cycles[BENCH_COUNT];
+float32_t snr[2];
+arm_status benchStatus = ARM_MATH_TEST_FAILURE;
+
+/* ----------------------------------------------------------------------
+** Cycle counter
+** ------------------------------------------------------------------- */
+
+static void cycleCounterStart(void)
+{
+  DEMCR |= DEMCR_TRCENA;
+  DWT_CYCCNT = 0;
+  DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+}
+
+/* ----------------------------------------------------------------------
+** Loop bodies.  Iterations are FIR blocks and matrix rows.
+** ------------------------------------------------------------------- */
+
+static void firBlocks(void *pvContext, uint32_t ulBegin, uint32_t ulEnd)
+{
+  arm_fir_instance_f32 S;
+  float32_t state[NUM_TAPS - 1 + FIR_BLOCK_SIZE];
+  float32_t *pOut = (float32_t *) pvContext;
+  uint32_t block;
+
+  for (block = ulBegin; block < ulEnd; block++)
+  {
+    /* firInput is padded, so sample n of the signal is firInput[n + NUM_TAPS - 1]
+       and the samples preceding block start at firInput[block * FIR_BLOCK_SIZE]. */
+    arm_fir_init_f32(&S, NUM_TAPS, firCoeffs, state, FIR_BLOCK_SIZE);
+    memcpy(state, &firInput[block * FIR_BLOCK_SIZE], (NUM_TAPS - 1) * sizeof(float32_t));
+    arm_fir_f32(&S, &firInput[block * FIR_BLOCK_SIZE + NUM_TAPS - 1], &pOut[block * FIR_BLOCK_SIZE], FIR_BLOCK_SIZE);
+  }
+}
+
+static void matRows(void *pvContext, uint32_t ulBegin, uint32_t ulEnd)
+{
+  arm_matrix_instance_f32 A, B, C;
+  float32_t *pOut = (float32_t *) pvContext;
+
+  arm_mat_init_f32(&A, (uint16_t) (ulEnd - ulBegin), MAT_DIM, &matA[ulBegin * MAT_DIM]);
+  arm_mat_init_f32(&B, MAT_DIM, MAT_DIM, matB);
+  arm_mat_init_f32(&C, (uint16_t) (ulEnd - ulBegin), MAT_DIM, &pOut[ulBegin * MAT_DIM]);
+  (void) arm_mat_mult_f32(&A, &B, &C);
+}
+
+/* ----------------------------------------------------------------------
+** Benchmark task
+** ------------------------------------------------------------------- */
+
+static void benchTask(void *pvParameters)
+{
+  uint32_t i, start;
+
+  (void) pvParameters;
+
+  for (i = 0; i < NUM_TAPS; i++)
+  {
+    firCoeffs[i] = 1.0f / (float32_t) (NUM_TAPS);
+  }
+
+  for (i = 0; i < FIR_LENGTH_SAMPLES; i++)
+  {
+    firInput[NUM_TAPS - 1 + i] = arm_sin_f32((float32_t) i * 0.05f) + 0.25f * arm_sin_f32((float32_t) i * 1.3f);
+  }
+
+  for (i = 0; i < MAT_DIM * MAT_DIM; i++)
+  {
+    matA[i] = (float32_t) (i % 17) * 0.125f;
+    matB[i] = (float32_t) (i % 11) * 0.25f;
+  }
+
+  cycleCounterStart();
+
+  start = DWT_CYCCNT;
+  firBlocks(firSerial, 0, FIR_LENGTH_SAMPLES / FIR_BLOCK_SIZE);
+  cycles[BENCH_FIR_SERIAL] = DWT_CYCCNT - start;
+
+  start = DWT_CYCCNT;
+  vParallelFor(0, FIR_LENGTH_SAMPLES / FIR_BLOCK_SIZE, 1, firBlocks, firParallel);
+  cycles[BENCH_FIR_PARALLEL] = DWT_CYCCNT - start;
+
+  start = DWT_CYCCNT;
+  matRows(matSerial, 0, MAT_DIM);
+  cycles[BENCH_MAT_SERIAL] = DWT_CYCCNT - start;
+
+  start = DWT_CYCCNT;
+  vParallelFor(0, MAT_DIM, MAT_ROWS_GRAIN, matRows, matParallel);
+  cycles[BENCH_MAT_PARALLEL] = DWT_CYCCNT - start;
+
+  /* The parallel outputs must match the serial outputs. */
+  snr[0] = arm_snr_f32(firSerial, firParallel, FIR_LENGTH_SAMPLES);
+  snr[1] = arm_snr_f32(matSerial, matParallel, MAT_DIM * MAT_DIM);
+
+  if ((snr[0] > SNR_THRESHOLD_F32) && (snr[1] > SNR_THRESHOLD_F32))
+  {
+    benchStatus = ARM_MATH_SUCCESS;
+  }
+
+  vTaskDelete(NULL);
+}
+
+int32_t main(void)
+{
+  if (xParallelForInit() != pdPASS)
+  {
+    while (1);
+  }
+
+  if (xTaskCreate(benchTask, "Bench", BENCH_TASK_STACK, NULL, BENCH_TASK_PRIORITY, NULL) != pdPASS)
+  {
+    while (1);
+  }
+
+  vTaskStartScheduler();
+
+  while (1);                             /* main function does not return */
+}
+
+ /** \endlink */
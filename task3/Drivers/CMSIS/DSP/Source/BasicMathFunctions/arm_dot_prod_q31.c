@@ -65,7 +65,47 @@ void arm_dot_prod_q31(
   uint32_t blkCnt;                               /* loop counter */
 
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_HOST) && defined (__AVX2__)
+
+  /* Run the below code for x86 hosts */
+  /* The 64-bit products of the even and the odd lanes are shifted right by 14 as
+   * on the Cortex-M. AVX2 only shifts 64-bit lanes logically, so the sign bits are
+   * put back from a comparison with zero. The sum of the lanes wraps as the sum
+   * of the Cortex-M code does, so the result is the same. */
+  __m256i acc = _mm256_setzero_si256();
+  __m256i zero = _mm256_setzero_si256();
+  __m256i inA, inB, prodEven, prodOdd;
+  q63_t lanes[4];
+
+  blkCnt = blockSize >> 3U;
+
+  while (blkCnt > 0U)
+  {
+    inA = _mm256_loadu_si256((const __m256i *) pSrcA);
+    inB = _mm256_loadu_si256((const __m256i *) pSrcB);
+
+    prodEven = _mm256_mul_epi32(inA, inB);
+    prodOdd = _mm256_mul_epi32(_mm256_srli_epi64(inA, 32), _mm256_srli_epi64(inB, 32));
+
+    prodEven = _mm256_or_si256(_mm256_srli_epi64(prodEven, 14),
+                               _mm256_slli_epi64(_mm256_cmpgt_epi64(zero, prodEven), 50));
+    prodOdd = _mm256_or_si256(_mm256_srli_epi64(prodOdd, 14),
+                              _mm256_slli_epi64(_mm256_cmpgt_epi64(zero, prodOdd), 50));
+
+    acc = _mm256_add_epi64(acc, _mm256_add_epi64(prodEven, prodOdd));
+    pSrcA += 8U;
+    pSrcB += 8U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  _mm256_storeu_si256((__m256i *) lanes, acc);
+  sum = (q63_t) ((uint64_t) lanes[0] + (uint64_t) lanes[1] + (uint64_t) lanes[2] + (uint64_t) lanes[3]);
+
+  blkCnt = blockSize % 0x8U;
+
+#elif defined (ARM_MATH_DSP)
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
   q31_t inA1, inA2, inA3, inA4;
@@ -109,7 +149,7 @@ void arm_dot_prod_q31(
   /* Initialize blkCnt with number of samples */
   blkCnt = blockSize;
 
-#endif /* #if defined (ARM_MATH_DSP) */
+#endif /* #if defined (ARM_MATH_HOST) && defined (__AVX2__) */
 
 
   while (blkCnt > 0U)
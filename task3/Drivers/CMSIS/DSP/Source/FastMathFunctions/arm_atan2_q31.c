@@ -0,0 +1,202 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_atan2_q31.c
+ * Description:  Vector four-quadrant arc tangent for Q31 values
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup atan2
+ * @{
+ */
+
+/**
+ * @brief  Four-quadrant arc tangent of a single Q31 point.
+ * @param[in] y ordinate.
+ * @param[in] x abscissa.
+ * @return  atan2(y, x) / pi in 1.31 format.
+ */
+CMSIS_INLINE __STATIC_INLINE q31_t arm_atan2_core_q31(
+  q31_t y,
+  q31_t x)
+{
+  uint32_t ax, ay;                               /* absolute values of x and y */
+  uint32_t num, den;                             /* smaller and larger absolute values */
+  uint32_t t, s;                                 /* ratio in 1.31 format and its square */
+  uint32_t a, base = 0U;                         /* angle and octant offset, scaled by 1/pi */
+  q31_t acc;                                     /* polynomial accumulator */
+
+  /* The magnitude of 0x80000000 is representable as an unsigned value */
+  ax = (x < 0) ? 0U - (uint32_t) x : (uint32_t) x;
+  ay = (y < 0) ? 0U - (uint32_t) y : (uint32_t) y;
+
+  if (ay > ax)
+  {
+    num = ax;
+    den = ay;
+  }
+  else
+  {
+    num = ay;
+    den = ax;
+  }
+
+  if (den == 0U)
+  {
+    return (0);
+  }
+
+  /* t = num / den, rounded */
+  t = (uint32_t) ((((uint64_t) num << 31) + (den >> 1)) / den);
+
+  /* atan(t) = pi/4 - atan((1 - t) / (1 + t)) above tan(pi/8) */
+  if (t > 0x3504F334U)
+  {
+    t = (uint32_t) ((((uint64_t) (den - num) << 31) + (((uint64_t) den + num) >> 1)) /
+                    ((uint64_t) den + num));
+    base = 0x20000000U;
+  }
+
+  /* atan(t) / pi = t * P(t^2) */
+  s = (uint32_t) (((uint64_t) t * t + 0x40000000U) >> 31);
+
+  acc = -41193731;
+  acc = 72251680 + (q31_t) (((q63_t) acc * (q31_t) s + 0x40000000) >> 31);
+  acc = -97336501 + (q31_t) (((q63_t) acc * (q31_t) s + 0x40000000) >> 31);
+  acc = 136700635 + (q31_t) (((q63_t) acc * (q31_t) s + 0x40000000) >> 31);
+  acc = -227854911 + (q31_t) (((q63_t) acc * (q31_t) s + 0x40000000) >> 31);
+  acc = 683565275 + (q31_t) (((q63_t) acc * (q31_t) s + 0x40000000) >> 31);
+  a = (uint32_t) (((q63_t) acc * (q31_t) t + 0x40000000) >> 31);
+
+  /* Restore the octant. The arithmetic wraps modulo 2, so +pi becomes -pi */
+  if (base != 0U)
+  {
+    a = base - a;
+  }
+
+  if (ay > ax)
+  {
+    a = 0x40000000U - a;
+  }
+
+  if (x < 0)
+  {
+    a = 0x80000000U - a;
+  }
+
+  if (y < 0)
+  {
+    a = 0U - a;
+  }
+
+  return ((q31_t) a);
+}
+
+/**
+ * @brief  Q31 vector four-quadrant arc tangent.
+ * @param[in]       *pSrcY points to the input vector of ordinates
+ * @param[in]       *pSrcX points to the input vector of abscissas
+ * @param[out]      *pDst points to the output vector of angles divided by pi
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using an internal 64-bit accumulator and cannot overflow.
+ * The output is in 1.31 format and represents the range [-pi, +pi).
+ */
+
+void arm_atan2_q31(
+  q31_t * pSrcY,
+  q31_t * pSrcX,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t out1, out2, out3, out4;                  /* temporary variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = atan2(A, B) / pi */
+    out1 = arm_atan2_core_q31(pSrcY[0], pSrcX[0]);
+    out2 = arm_atan2_core_q31(pSrcY[1], pSrcX[1]);
+    out3 = arm_atan2_core_q31(pSrcY[2], pSrcX[2]);
+    out4 = arm_atan2_core_q31(pSrcY[3], pSrcX[3]);
+
+    /* store the results in the destination buffer */
+    pDst[0] = out1;
+    pDst[1] = out2;
+    pDst[2] = out3;
+    pDst[3] = out4;
+
+    /* update pointers to process next samples */
+    pSrcY += 4U;
+    pSrcX += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = atan2(A, B) / pi */
+    *pDst++ = arm_atan2_core_q31(*pSrcY++, *pSrcX++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of atan2 group
+ */
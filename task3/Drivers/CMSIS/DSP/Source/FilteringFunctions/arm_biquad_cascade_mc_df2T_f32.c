@@ -0,0 +1,311 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_mc_df2T_f32.c
+ * Description:  Processing function for floating-point transposed direct form II Biquad cascade filter. Interleaved channels
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+* @ingroup groupFilters
+*/
+
+/**
+* @addtogroup BiquadCascadeDF2T
+* @{
+*/
+
+/**
+* @brief Processing function for the floating-point transposed direct form II Biquad cascade filter. Interleaved channels
+* @param[in]  *S        points to an instance of the filter data structure.
+* @param[in]  *pSrc     points to the block of interleaved input frames.
+* @param[out] *pDst     points to the block of interleaved output frames.
+* @param[in]  blockSize number of frames to process.
+* @return none.
+*
+* \par
+* The same filter is applied to <code>numChans</code> channels of interleaved data, so
+* <code>pSrc</code> and <code>pDst</code> hold <code>blockSize * numChans</code> values.
+* The stages are run one after the other: the 5 coefficients of a stage are loaded once and
+* used for every channel, and the samples of each channel are read in place with a stride of
+* <code>numChans</code>. The result is the same as running <code>arm_biquad_cascade_df2T_f32()</code>
+* on each de-interleaved channel.
+*/
+
+void arm_biquad_cascade_mc_df2T_f32(
+const arm_biquad_cascade_mc_df2T_instance_f32 * S,
+float32_t * pSrc,
+float32_t * pDst,
+uint32_t blockSize)
+{
+
+    float32_t *pIn = pSrc;                         /*  source pointer            */
+    float32_t *pIO, *pOut;                         /*  channel input and output pointers */
+    float32_t *pStateCh;                           /*  channel state pointer     */
+    float32_t *pState = S->pState;                 /*  State pointer             */
+    float32_t *pCoeffs = S->pCoeffs;               /*  coefficient pointer       */
+    float32_t acc1a;                               /*  accumulator               */
+    float32_t b0, b1, b2, a1, a2;                  /*  Filter coefficients       */
+    float32_t Xn1a;                                /*  temporary input           */
+    float32_t d1a, d2a;                            /*  state variables           */
+    uint32_t numChans = S->numChans;               /*  number of interleaved channels */
+    uint32_t stateStride = 2U * S->numStages;      /*  state values of one channel */
+    uint32_t sample, ch, chCnt, stage = S->numStages;    /*  loop counters             */
+
+#if defined (ARM_MATH_HOST) && defined (__SSE2__)
+
+    /* Run the below code for x86 hosts */
+
+    __m128 vb0, vb1, vb2, va1, va2;                /*  Filter coefficients       */
+    __m128 vx, vacc, vd1, vd2;                     /*  4 channels per vector     */
+    float32_t lanes[4];                            /*  lanes of a state vector   */
+
+#elif defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    float32_t acc1b, acc1c, acc1d;                 /*  accumulators              */
+    float32_t Xn1b, Xn1c, Xn1d;                    /*  temporary inputs          */
+    float32_t d1b, d2b, d1c, d2c, d1d, d2d;        /*  state variables           */
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__SSE2__) */
+
+    do
+    {
+        /* Reading the coefficients */
+        b0 = pCoeffs[0];
+        b1 = pCoeffs[1];
+        b2 = pCoeffs[2];
+        a1 = pCoeffs[3];
+        a2 = pCoeffs[4];
+
+        ch = 0U;
+
+#if defined (ARM_MATH_DSP)
+
+        /* Filter 4 channels at a time; their samples are adjacent in each frame */
+        chCnt = numChans >> 2U;
+
+        while (chCnt > 0U)
+        {
+#if defined (ARM_MATH_HOST) && defined (__SSE2__)
+
+            /* Each vector lane holds one channel and performs the same operations
+            ** in the same order as the scalar code below */
+            vb0 = _mm_set1_ps(b0);
+            vb1 = _mm_set1_ps(b1);
+            vb2 = _mm_set1_ps(b2);
+            va1 = _mm_set1_ps(a1);
+            va2 = _mm_set1_ps(a2);
+
+            pStateCh = pState + (ch * stateStride);
+            vd1 = _mm_setr_ps(pStateCh[0], pStateCh[stateStride],
+                              pStateCh[2U * stateStride], pStateCh[3U * stateStride]);
+            vd2 = _mm_setr_ps(pStateCh[1], pStateCh[stateStride + 1U],
+                              pStateCh[(2U * stateStride) + 1U], pStateCh[(3U * stateStride) + 1U]);
+
+            pIO = pIn + ch;
+            pOut = pDst + ch;
+
+            sample = blockSize;
+
+            while (sample > 0U)
+            {
+                vx = _mm_loadu_ps(pIO);
+
+                vacc = _mm_add_ps(_mm_mul_ps(vb0, vx), vd1);
+                vd1 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vb1, vx), _mm_mul_ps(va1, vacc)), vd2);
+                vd2 = _mm_add_ps(_mm_mul_ps(vb2, vx), _mm_mul_ps(va2, vacc));
+
+                _mm_storeu_ps(pOut, vacc);
+
+                pIO += numChans;
+                pOut += numChans;
+
+                /* decrement the loop counter */
+                sample--;
+            }
+
+            /* Store the updated state variables back into the state array */
+            _mm_storeu_ps(lanes, vd1);
+            pStateCh[0] = lanes[0];
+            pStateCh[stateStride] = lanes[1];
+            pStateCh[2U * stateStride] = lanes[2];
+            pStateCh[3U * stateStride] = lanes[3];
+            _mm_storeu_ps(lanes, vd2);
+            pStateCh[1] = lanes[0];
+            pStateCh[stateStride + 1U] = lanes[1];
+            pStateCh[(2U * stateStride) + 1U] = lanes[2];
+            pStateCh[(3U * stateStride) + 1U] = lanes[3];
+
+#else
+
+            /* Reading the state values of the 4 channels */
+            pStateCh = pState + (ch * stateStride);
+            d1a = pStateCh[0];
+            d2a = pStateCh[1];
+            pStateCh += stateStride;
+            d1b = pStateCh[0];
+            d2b = pStateCh[1];
+            pStateCh += stateStride;
+            d1c = pStateCh[0];
+            d2c = pStateCh[1];
+            pStateCh += stateStride;
+            d1d = pStateCh[0];
+            d2d = pStateCh[1];
+
+            pIO = pIn + ch;
+            pOut = pDst + ch;
+
+            sample = blockSize;
+
+            while (sample > 0U)
+            {
+                /* Read the input of the 4 channels */
+                Xn1a = pIO[0];
+                Xn1b = pIO[1];
+                Xn1c = pIO[2];
+                Xn1d = pIO[3];
+
+                /* y[n] = b0 * x[n] + d1 */
+                acc1a = (b0 * Xn1a) + d1a;
+                acc1b = (b0 * Xn1b) + d1b;
+                acc1c = (b0 * Xn1c) + d1c;
+                acc1d = (b0 * Xn1d) + d1d;
+
+                /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+                d1a = ((b1 * Xn1a) + (a1 * acc1a)) + d2a;
+                d1b = ((b1 * Xn1b) + (a1 * acc1b)) + d2b;
+                d1c = ((b1 * Xn1c) + (a1 * acc1c)) + d2c;
+                d1d = ((b1 * Xn1d) + (a1 * acc1d)) + d2d;
+
+                /* d2 = b2 * x[n] + a2 * y[n] */
+                d2a = (b2 * Xn1a) + (a2 * acc1a);
+                d2b = (b2 * Xn1b) + (a2 * acc1b);
+                d2c = (b2 * Xn1c) + (a2 * acc1c);
+                d2d = (b2 * Xn1d) + (a2 * acc1d);
+
+                /* Store the results in the destination buffer */
+                pOut[0] = acc1a;
+                pOut[1] = acc1b;
+                pOut[2] = acc1c;
+                pOut[3] = acc1d;
+
+                pIO += numChans;
+                pOut += numChans;
+
+                /* decrement the loop counter */
+                sample--;
+            }
+
+            /* Store the updated state variables back into the state array */
+            pStateCh = pState + (ch * stateStride);
+            pStateCh[0] = d1a;
+            pStateCh[1] = d2a;
+            pStateCh += stateStride;
+            pStateCh[0] = d1b;
+            pStateCh[1] = d2b;
+            pStateCh += stateStride;
+            pStateCh[0] = d1c;
+            pStateCh[1] = d2c;
+            pStateCh += stateStride;
+            pStateCh[0] = d1d;
+            pStateCh[1] = d2d;
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__SSE2__) */
+
+            ch += 4U;
+
+            /* decrement the loop counter */
+            chCnt--;
+        }
+
+        /* Filter the remaining channels one at a time */
+        chCnt = numChans % 0x4U;
+
+#else
+
+        /* Run the below code for Cortex-M0 */
+
+        chCnt = numChans;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+        while (chCnt > 0U)
+        {
+            /* Reading the state values */
+            pStateCh = pState + (ch * stateStride);
+            d1a = pStateCh[0];
+            d2a = pStateCh[1];
+
+            pIO = pIn + ch;
+            pOut = pDst + ch;
+
+            sample = blockSize;
+
+            while (sample > 0U)
+            {
+                Xn1a = *pIO;
+
+                acc1a = (b0 * Xn1a) + d1a;
+                d1a = ((b1 * Xn1a) + (a1 * acc1a)) + d2a;
+                d2a = (b2 * Xn1a) + (a2 * acc1a);
+
+                *pOut = acc1a;
+
+                pIO += numChans;
+                pOut += numChans;
+
+                /* decrement the loop counter */
+                sample--;
+            }
+
+            /* Store the updated state variables back into the state array */
+            pStateCh[0] = d1a;
+            pStateCh[1] = d2a;
+
+            ch++;
+
+            /* decrement the loop counter */
+            chCnt--;
+        }
+
+        /* The next stage uses the next 5 coefficients and the next 2 state values of each channel */
+        pCoeffs += 5U;
+        pState += 2U;
+
+        /* The current stage input is given as the output to the next stage */
+        pIn = pDst;
+
+        /* decrement the loop counter */
+        stage--;
+
+    } while (stage > 0U);
+
+}
+
+/**
+   * @} end of BiquadCascadeDF2T group
+   */
@@ -0,0 +1,294 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_fft_f32.c
+ * Description:  Floating-point FFT-based FIR filter processing function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+* @ingroup groupFilters
+*/
+
+/**
+* @defgroup FIR_FFT FFT-Based FIR Filters
+*
+* This set of functions implements long Finite Impulse Response (FIR) filters for
+* floating-point data by uniformly partitioned overlap-save convolution.  The output is the
+* same as the output of arm_fir_f32() within floating-point rounding, but the cost per sample
+* grows with the logarithm of the partition length and linearly with the number of partitions,
+* instead of linearly with the number of taps.
+*
+* \par Algorithm:
+* The impulse response is split into <code>numParts = ceil(numTaps / blockSize)</code>
+* partitions of <code>blockSize</code> taps.  Each partition is zero padded to
+* <code>2*blockSize</code> samples and transformed once, at initialization.
+* \par
+* Each block of <code>blockSize</code> input samples is appended to the previous block, and the
+* <code>2*blockSize</code> samples are transformed with arm_rfft_fast_f32().  The spectrum is
+* stored in a frequency-domain delay line that holds the spectra of the last
+* <code>numParts</code> blocks.  Each stored spectrum is multiplied by the spectrum of the
+* partition of matching delay, and the products are accumulated:
+* <pre>
+*    Y = X[j] * H[0] + X[j-1] * H[1] + ... + X[j-numParts+1] * H[numParts-1]
+* </pre>
+* The inverse transform of Y holds the output block in its second half (overlap-save).  A block
+* costs one forward and one inverse real FFT of length <code>2*blockSize</code> and
+* <code>numParts</code> complex multiply-accumulates of <code>blockSize</code> bins, and adds no
+* latency.
+* \par
+* The partition length trades the FFT cost against the number of partitions.  A partition of
+* about a quarter to an eighth of the filter length is usually the fastest; shorter partitions
+* reduce the block size that the application has to use.
+*
+* \par Buffers
+* <code>pCoeffs</code> points to the time-domain coefficients of size <code>numTaps</code>, in
+* the same time reversed order as for arm_fir_f32():
+* <pre>
+*    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+* </pre>
+* <code>pCoeffsFreq</code> points to an array of size <code>2*numParts*blockSize</code> that
+* receives the partition spectra.  It may be shared among several instances of the same filter.
+* <code>pState</code> points to a state array of size <code>(2*numParts+1)*blockSize</code>,
+* which holds the previous input block and the delay line.
+* <code>pScratch</code> points to a scratch array of size <code>4*blockSize</code>, which may be
+* shared among instances that do not run concurrently.
+*
+* \par Initialization Functions
+* The initialization function arm_fir_fft_init_f32() sets the fields of the instance structure,
+* transforms the coefficients and zeros out the state buffer.  The instance cannot be
+* initialized statically because the partition spectra are computed at run time.
+*/
+
+/**
+* @addtogroup FIR_FFT
+* @{
+*/
+
+/**
+* @brief Multiplies two packed real FFT spectra and adds the product to an accumulator.
+* @param[in]     *pSrcA points to the first spectrum.
+* @param[in]     *pSrcB points to the second spectrum.
+* @param[in,out] *pAcc  points to the accumulator.
+* @param[in]     fftLen length of the real FFT.
+* @return        none.
+*
+* The first two values of a packed spectrum are the real DC and Nyquist bins; they are
+* multiplied as real numbers.  The other values are the complex bins 1 to fftLen/2-1.
+*/
+
+static void arm_fir_fft_cmplx_mac_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pAcc,
+  uint32_t fftLen)
+{
+  float32_t a, b, c, d;                          /* Temporary variables */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+  float32_t acc0, acc1, acc2, acc3;              /* accumulators */
+#endif
+
+  /* DC and Nyquist */
+  pAcc[0] += pSrcA[0] * pSrcB[0];
+  pAcc[1] += pSrcA[1] * pSrcB[1];
+
+  /* Complex bins */
+  pSrcA += 2U;
+  pSrcB += 2U;
+  pAcc += 2U;
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* loop Unrolling */
+  blkCnt = ((fftLen >> 1U) - 1U) >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C[2 * i] += A[2 * i] * B[2 * i] - A[2 * i + 1] * B[2 * i + 1].  */
+    /* C[2 * i + 1] += A[2 * i] * B[2 * i + 1] + A[2 * i + 1] * B[2 * i].  */
+    a = pSrcA[0];
+    b = pSrcA[1];
+    c = pSrcB[0];
+    d = pSrcB[1];
+    acc0 = pAcc[0] + (a * c) - (b * d);
+    acc1 = pAcc[1] + (a * d) + (b * c);
+
+    a = pSrcA[2];
+    b = pSrcA[3];
+    c = pSrcB[2];
+    d = pSrcB[3];
+    acc2 = pAcc[2] + (a * c) - (b * d);
+    acc3 = pAcc[3] + (a * d) + (b * c);
+
+    pAcc[0] = acc0;
+    pAcc[1] = acc1;
+    pAcc[2] = acc2;
+    pAcc[3] = acc3;
+
+    a = pSrcA[4];
+    b = pSrcA[5];
+    c = pSrcB[4];
+    d = pSrcB[5];
+    acc0 = pAcc[4] + (a * c) - (b * d);
+    acc1 = pAcc[5] + (a * d) + (b * c);
+
+    a = pSrcA[6];
+    b = pSrcA[7];
+    c = pSrcB[6];
+    d = pSrcB[7];
+    acc2 = pAcc[6] + (a * c) - (b * d);
+    acc3 = pAcc[7] + (a * d) + (b * c);
+
+    pAcc[4] = acc0;
+    pAcc[5] = acc1;
+    pAcc[6] = acc2;
+    pAcc[7] = acc3;
+
+    /* update pointers to process next samples */
+    pSrcA += 8U;
+    pSrcB += 8U;
+    pAcc += 8U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the number of bins is not a multiple of 4, compute any remaining bins here.
+   ** No loop unrolling is used. */
+  blkCnt = ((fftLen >> 1U) - 1U) % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = (fftLen >> 1U) - 1U;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C[2 * i] += A[2 * i] * B[2 * i] - A[2 * i + 1] * B[2 * i + 1].  */
+    /* C[2 * i + 1] += A[2 * i] * B[2 * i + 1] + A[2 * i + 1] * B[2 * i].  */
+    a = *pSrcA++;
+    b = *pSrcA++;
+    c = *pSrcB++;
+    d = *pSrcB++;
+    *pAcc++ += (a * c) - (b * d);
+    *pAcc++ += (a * d) + (b * c);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+*
+* @param[in,out] *S points to an instance of the floating-point FFT-based FIR filter structure.
+* @param[in]  *pSrc points to the block of input data.
+* @param[out] *pDst points to the block of output data.
+* @param[in]  blockSize number of samples to process per call.  It must be a multiple of the
+*             partition length given at initialization; the samples after the last whole
+*             partition are not processed.
+* @return     none.
+*
+* \par
+* The function supports in-place computation: <code>pDst</code> may be the same buffer as
+* <code>pSrc</code>.
+*/
+
+void arm_fir_fft_f32(
+  arm_fir_fft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t partLen = S->blockSize;               /* partition length */
+  uint32_t fftLen = 2U * partLen;                /* real FFT length */
+  uint32_t numParts = S->numParts;               /* number of partitions */
+  float32_t *pHistory = S->pState;               /* previous input block */
+  float32_t *pLine = S->pState + partLen;        /* frequency-domain delay line */
+  float32_t *pLineEnd = pLine + (numParts * fftLen); /* end of the delay line */
+  float32_t *pFrame = S->pScratch;               /* FFT input and output */
+  float32_t *pAcc = S->pScratch + fftLen;        /* accumulated spectrum */
+  float32_t *pX;                                 /* input spectrum of a partition */
+  const float32_t *pH;                           /* filter spectrum of a partition */
+  uint32_t blkCnt;                               /* number of blocks to process */
+  uint32_t i;                                    /* Loop counter */
+
+  blkCnt = blockSize / partLen;
+
+  while (blkCnt > 0U)
+  {
+    /* Form the frame from the previous and the current block, and keep the current block */
+    arm_copy_f32(pHistory, pFrame, partLen);
+    arm_copy_f32(pSrc, pFrame + partLen, partLen);
+    arm_copy_f32(pSrc, pHistory, partLen);
+
+    /* The newest spectrum replaces the oldest one in the delay line */
+    S->partIndex = (S->partIndex == 0U) ? (numParts - 1U) : (S->partIndex - 1U);
+    pX = pLine + (S->partIndex * fftLen);
+
+    arm_rfft_fast_f32(&S->rfft, pFrame, pX, 0U);
+
+    /* Y = X[j] * H[0] + X[j-1] * H[1] + ... */
+    arm_fill_f32(0.0f, pAcc, fftLen);
+    pH = S->pCoeffsFreq;
+
+    for (i = 0U; i < numParts; i++)
+    {
+      arm_fir_fft_cmplx_mac_f32(pX, pH, pAcc, fftLen);
+
+      pH += fftLen;
+      pX += fftLen;
+
+      /* Older spectra wrap around the delay line */
+      if (pX == pLineEnd)
+      {
+        pX = pLine;
+      }
+    }
+
+    /* The second half of the inverse transform is the output block */
+    arm_rfft_fast_f32(&S->rfft, pAcc, pFrame, 1U);
+    arm_copy_f32(pFrame + partLen, pDst, partLen);
+
+    /* update pointers to process next samples */
+    pSrc += partLen;
+    pDst += partLen;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+* @} end of FIR_FFT group
+*/
@@ -0,0 +1,522 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_mc_f32.c
+ * Description:  Processing function for the floating-point multichannel FIR filter
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @par Multichannel Filters
+ * The multichannel functions <code>arm_fir_mc_f32()</code>, <code>arm_fir_mc_q31()</code> and
+ * <code>arm_fir_mc_q15()</code> apply the same filter to <code>numChans</code> channels of interleaved data.
+ * <code>pSrc</code> and <code>pDst</code> hold <code>blockSize</code> frames of <code>numChans</code> samples each:
+ * <pre>
+ *    {x0[0], x1[0], ..., x(numChans-1)[0], x0[1], x1[1], ...}
+ * </pre>
+ * The input is consumed in place, so no de-interleaving buffers are needed, and each coefficient
+ * loaded in the inner loop is applied to several channels at once.
+ * Every channel has its own delay line of <code>numTaps + maxBlockSize - 1</code> samples, ordered as
+ * in the single channel filter, and the delay lines of channels 0, 1, ... follow one another in
+ * <code>pState</code>. The state array is <code>numChans * (numTaps + maxBlockSize - 1)</code> samples long.
+ * The results match those of the single channel filter run on each de-interleaved channel.
+ */
+
+/**
+ * @brief Processing function for the floating-point multichannel FIR filter.
+ * @param[in]  *S points to an instance of the floating-point multichannel FIR filter structure.
+ * @param[in]  *pSrc points to the block of interleaved input frames.
+ * @param[out] *pDst points to the block of interleaved output frames.
+ * @param[in]  blockSize number of frames to process per call. Must not exceed <code>maxBlockSize</code>.
+ * @return     none.
+ */
+
+#if defined (ARM_MATH_HOST) && defined (__SSE2__)
+
+/* Run the below code for x86 hosts */
+
+void arm_fir_mc_f32(
+  const arm_fir_mc_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pLine, *px, *pOut;                  /* Delay line, state and output pointers */
+  float32_t *px0, *px1, *px2, *px3;              /* State pointers of 4 channels */
+  float32_t acc;                                 /* Accumulator */
+  float32_t lanes[4];                            /* Outputs of a single channel vector */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t numChans = S->numChans;               /* Number of interleaved channels */
+  uint32_t stateLen = (numTaps - 1U) + S->maxBlockSize;  /* Length of the delay line of one channel */
+  uint32_t ch, n, i, k;                          /* Loop counters */
+
+  /* Copy the new frames into the end of the delay line of each channel */
+  for (ch = 0U; ch < numChans; ch++)
+  {
+    pLine = pState + (ch * stateLen) + (numTaps - 1U);
+
+    for (n = 0U; n < blockSize; n++)
+    {
+      pLine[n] = pSrc[(n * numChans) + ch];
+    }
+  }
+
+  /* Each vector lane computes one frame of a channel, multiplying each coefficient with
+  ** the state sample that lies as many samples further in the delay line as the lane is
+  ** to the right, as in arm_fir_f32(). Groups of 4 channels share the coefficient
+  ** broadcasts, and their 4 x 4 block of outputs is transposed so that each frame is
+  ** stored with one vector. */
+  for (ch = 0U; (ch + 4U) <= numChans; ch += 4U)
+  {
+    pLine = pState + (ch * stateLen);
+
+    for (n = 0U; (n + 4U) <= blockSize; n += 4U)
+    {
+      __m128 acc0 = _mm_setzero_ps();
+      __m128 acc1 = _mm_setzero_ps();
+      __m128 acc2 = _mm_setzero_ps();
+      __m128 acc3 = _mm_setzero_ps();
+      __m128 c0;
+
+      px0 = pLine + n;
+      px1 = px0 + stateLen;
+      px2 = px1 + stateLen;
+      px3 = px2 + stateLen;
+
+      for (i = 0U; i < numTaps; i++)
+      {
+        c0 = _mm_set1_ps(pCoeffs[i]);
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(px0++), c0));
+        acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(px1++), c0));
+        acc2 = _mm_add_ps(acc2, _mm_mul_ps(_mm_loadu_ps(px2++), c0));
+        acc3 = _mm_add_ps(acc3, _mm_mul_ps(_mm_loadu_ps(px3++), c0));
+      }
+
+      _MM_TRANSPOSE4_PS(acc0, acc1, acc2, acc3);
+
+      pOut = pDst + (n * numChans) + ch;
+      _mm_storeu_ps(pOut, acc0);
+      _mm_storeu_ps(pOut + numChans, acc1);
+      _mm_storeu_ps(pOut + (2U * numChans), acc2);
+      _mm_storeu_ps(pOut + (3U * numChans), acc3);
+    }
+  }
+
+  /* The remaining channels are filtered one at a time, 4 frames per vector */
+  for (; ch < numChans; ch++)
+  {
+    pLine = pState + (ch * stateLen);
+
+    for (n = 0U; (n + 4U) <= blockSize; n += 4U)
+    {
+      __m128 acc0 = _mm_setzero_ps();
+
+      px = pLine + n;
+
+      for (i = 0U; i < numTaps; i++)
+      {
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(px), _mm_set1_ps(pCoeffs[i])));
+        px++;
+      }
+
+      _mm_storeu_ps(lanes, acc0);
+
+      for (k = 0U; k < 4U; k++)
+      {
+        pDst[((n + k) * numChans) + ch] = lanes[k];
+      }
+    }
+  }
+
+  /* The frames left over by the vector loops */
+  for (n = blockSize & ~0x3U; n < blockSize; n++)
+  {
+    for (ch = 0U; ch < numChans; ch++)
+    {
+      /* Set the accumulator to zero */
+      acc = 0.0f;
+
+      px = pState + (ch * stateLen) + n;
+
+      /* Perform the multiply-accumulates */
+      for (i = 0U; i < numTaps; i++)
+      {
+        acc += *px++ * pCoeffs[i];
+      }
+
+      pDst[(n * numChans) + ch] = acc;
+    }
+  }
+
+  /* Processing is complete.
+  ** Now copy the last numTaps - 1 samples of each delay line to its start.
+  ** This prepares the state buffer for the next function call. */
+  for (ch = 0U; ch < numChans; ch++)
+  {
+    pLine = pState + (ch * stateLen);
+    memmove(pLine, pLine + blockSize, (numTaps - 1U) * sizeof(float32_t));
+  }
+}
+
+#else
+
+void arm_fir_mc_f32(
+  const arm_fir_mc_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *px, *pb, *pIn, *pOut;               /* Temporary pointers for state, coefficient, input and output buffers */
+  float32_t acc0;                                /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t numChans = S->numChans;               /* Number of interleaved channels */
+  uint32_t stateLen = (numTaps - 1U) + S->maxBlockSize;  /* Length of the delay line of one channel */
+  uint32_t ch, chCnt, tapCnt, blkCnt;            /* Loop counters */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  float32_t *py;                                 /* State pointer of the second channel */
+  float32_t acc1, acc2, acc3, acc4, acc5, acc6, acc7;  /* Accumulators */
+  float32_t x0, x1, x2, x3, y0, y1, y2, y3;      /* Temporary variables to hold state values */
+  float32_t c0;                                  /* Coefficient shared by 8 outputs */
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  /* Copy the new frames into the end of the delay line of each channel */
+  for (ch = 0U; ch < numChans; ch++)
+  {
+    pStateCurnt = pState + (ch * stateLen) + (numTaps - 1U);
+    pIn = pSrc + ch;
+
+    blkCnt = blockSize;
+
+    while (blkCnt > 0U)
+    {
+      *pStateCurnt++ = *pIn;
+      pIn += numChans;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+
+  ch = 0U;
+
+#if defined (ARM_MATH_DSP)
+
+  /* Filter 2 channels at a time, 4 frames per channel, so that each coefficient is loaded
+   ** once for 8 outputs. As in arm_fir_f32(), the state samples slide through registers,
+   ** so that only one new sample per channel is read for each coefficient.
+   ** The delay lines of the 2 channels are stateLen samples apart. */
+  chCnt = numChans >> 1U;
+
+  while (chCnt > 0U)
+  {
+    pStateCurnt = pState + (ch * stateLen);
+    pOut = pDst + ch;
+
+    blkCnt = blockSize >> 2U;
+
+    while (blkCnt > 0U)
+    {
+      /* Set the accumulators to zero */
+      acc0 = 0.0f;
+      acc1 = 0.0f;
+      acc2 = 0.0f;
+      acc3 = 0.0f;
+      acc4 = 0.0f;
+      acc5 = 0.0f;
+      acc6 = 0.0f;
+      acc7 = 0.0f;
+
+      /* Initialize state pointers */
+      px = pStateCurnt;
+      py = pStateCurnt + stateLen;
+
+      /* Initialize coefficient pointer */
+      pb = pCoeffs;
+
+      /* Read the first three samples of each channel */
+      x0 = *px++;
+      x1 = *px++;
+      x2 = *px++;
+      y0 = *py++;
+      y1 = *py++;
+      y2 = *py++;
+
+      /* Loop unrolling. Process 4 taps at a time. */
+      tapCnt = numTaps >> 2U;
+
+      while (tapCnt > 0U)
+      {
+        /* Read the b[numTaps-1] coefficient and the x[n+3], y[n+3] samples */
+        c0 = *(pb++);
+        x3 = *(px++);
+        y3 = *(py++);
+
+        acc0 += x0 * c0;
+        acc1 += x1 * c0;
+        acc2 += x2 * c0;
+        acc3 += x3 * c0;
+        acc4 += y0 * c0;
+        acc5 += y1 * c0;
+        acc6 += y2 * c0;
+        acc7 += y3 * c0;
+
+        /* Read the b[numTaps-2] coefficient and the x[n+4], y[n+4] samples */
+        c0 = *(pb++);
+        x0 = *(px++);
+        y0 = *(py++);
+
+        acc0 += x1 * c0;
+        acc1 += x2 * c0;
+        acc2 += x3 * c0;
+        acc3 += x0 * c0;
+        acc4 += y1 * c0;
+        acc5 += y2 * c0;
+        acc6 += y3 * c0;
+        acc7 += y0 * c0;
+
+        /* Read the b[numTaps-3] coefficient and the x[n+5], y[n+5] samples */
+        c0 = *(pb++);
+        x1 = *(px++);
+        y1 = *(py++);
+
+        acc0 += x2 * c0;
+        acc1 += x3 * c0;
+        acc2 += x0 * c0;
+        acc3 += x1 * c0;
+        acc4 += y2 * c0;
+        acc5 += y3 * c0;
+        acc6 += y0 * c0;
+        acc7 += y1 * c0;
+
+        /* Read the b[numTaps-4] coefficient and the x[n+6], y[n+6] samples */
+        c0 = *(pb++);
+        x2 = *(px++);
+        y2 = *(py++);
+
+        acc0 += x3 * c0;
+        acc1 += x0 * c0;
+        acc2 += x1 * c0;
+        acc3 += x2 * c0;
+        acc4 += y3 * c0;
+        acc5 += y0 * c0;
+        acc6 += y1 * c0;
+        acc7 += y2 * c0;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      /* If the filter length is not a multiple of 4, compute the remaining filter taps */
+      tapCnt = numTaps % 0x4U;
+
+      while (tapCnt > 0U)
+      {
+        c0 = *(pb++);
+        x3 = *(px++);
+        y3 = *(py++);
+
+        acc0 += x0 * c0;
+        acc1 += x1 * c0;
+        acc2 += x2 * c0;
+        acc3 += x3 * c0;
+        acc4 += y0 * c0;
+        acc5 += y1 * c0;
+        acc6 += y2 * c0;
+        acc7 += y3 * c0;
+
+        /* Reuse the present samples for the next tap */
+        x0 = x1;
+        x1 = x2;
+        x2 = x3;
+        y0 = y1;
+        y1 = y2;
+        y2 = y3;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      /* Store the results of the 4 frames, interleaved */
+      pOut[0] = acc0;
+      pOut[1] = acc4;
+      pOut += numChans;
+      pOut[0] = acc1;
+      pOut[1] = acc5;
+      pOut += numChans;
+      pOut[0] = acc2;
+      pOut[1] = acc6;
+      pOut += numChans;
+      pOut[0] = acc3;
+      pOut[1] = acc7;
+      pOut += numChans;
+
+      /* Advance state pointer by 4 for the next 4 frames */
+      pStateCurnt += 4U;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 4, compute the remaining frames */
+    blkCnt = blockSize % 0x4U;
+
+    while (blkCnt > 0U)
+    {
+      /* Set the accumulators to zero */
+      acc0 = 0.0f;
+      acc4 = 0.0f;
+
+      px = pStateCurnt;
+      py = pStateCurnt + stateLen;
+      pb = pCoeffs;
+
+      tapCnt = numTaps;
+
+      /* Perform the multiply-accumulates */
+      while (tapCnt > 0U)
+      {
+        c0 = *pb++;
+        acc0 += *px++ * c0;
+        acc4 += *py++ * c0;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      pOut[0] = acc0;
+      pOut[1] = acc4;
+      pOut += numChans;
+
+      /* Advance state pointer by 1 for the next frame */
+      pStateCurnt++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    ch += 2U;
+
+    /* Decrement the loop counter */
+    chCnt--;
+  }
+
+  /* If the number of channels is odd, filter the last channel on its own */
+  chCnt = numChans % 0x2U;
+
+#else
+
+
+  /* Run the below code for Cortex-M0 */
+
+  chCnt = numChans;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (chCnt > 0U)
+  {
+    pStateCurnt = pState + (ch * stateLen);
+    pOut = pDst + ch;
+
+    blkCnt = blockSize;
+
+    while (blkCnt > 0U)
+    {
+      /* Set the accumulator to zero */
+      acc0 = 0.0f;
+
+      px = pStateCurnt;
+      pb = pCoeffs;
+
+      tapCnt = numTaps;
+
+      /* Perform the multiply-accumulates */
+      while (tapCnt > 0U)
+      {
+        acc0 += *px++ * *pb++;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      *pOut = acc0;
+      pOut += numChans;
+
+      /* Advance state pointer by 1 for the next frame */
+      pStateCurnt++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    ch++;
+
+    /* Decrement the loop counter */
+    chCnt--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last numTaps - 1 samples of each delay line to its start.
+   ** This prepares the state buffer for the next function call. */
+  for (ch = 0U; ch < numChans; ch++)
+  {
+    pStateCurnt = pState + (ch * stateLen);
+    px = pStateCurnt + blockSize;
+
+    tapCnt = numTaps - 1U;
+
+    while (tapCnt > 0U)
+    {
+      *pStateCurnt++ = *px++;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__SSE2__) */
+
+/**
+ * @} end of FIR group
+ */
@@ -0,0 +1,235 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_mc_q15.c
+ * Description:  Processing function for the Q15 multichannel FIR filter
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 multichannel FIR filter.
+ * @param[in]  *S points to an instance of the Q15 multichannel FIR filter structure.
+ * @param[in]  *pSrc points to the block of interleaved input frames.
+ * @param[out] *pDst points to the block of interleaved output frames.
+ * @param[in]  blockSize number of frames to process per call. Must not exceed <code>maxBlockSize</code>.
+ * @return     none.
+ */
+
+void arm_fir_mc_q15(
+  const arm_fir_mc_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q15_t *px, *pb, *pIn, *pOut;                   /* Temporary pointers for state, coefficient, input and output buffers */
+  q63_t acc0;                                    /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t numChans = S->numChans;               /* Number of interleaved channels */
+  uint32_t stateLen = (numTaps - 1U) + S->maxBlockSize;  /* Length of the delay line of one channel */
+  uint32_t ch, chCnt, tapCnt, blkCnt;            /* Loop counters */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q63_t acc1, acc2, acc3;                        /* Accumulators */
+  q15_t c0;                                      /* Coefficient shared by 4 channels */
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  /* Copy the new frames into the end of the delay line of each channel */
+  for (ch = 0U; ch < numChans; ch++)
+  {
+    pStateCurnt = pState + (ch * stateLen) + (numTaps - 1U);
+    pIn = pSrc + ch;
+
+    blkCnt = blockSize;
+
+    while (blkCnt > 0U)
+    {
+      *pStateCurnt++ = *pIn;
+      pIn += numChans;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+
+  ch = 0U;
+
+#if defined (ARM_MATH_DSP)
+
+  /* Filter 4 channels at a time so that each coefficient is loaded once for all of them.
+   ** The delay lines of the 4 channels are stateLen samples apart. */
+  chCnt = numChans >> 2U;
+
+  while (chCnt > 0U)
+  {
+    pStateCurnt = pState + (ch * stateLen);
+    pOut = pDst + ch;
+
+    blkCnt = blockSize;
+
+    while (blkCnt > 0U)
+    {
+      /* Set the accumulators to zero */
+      acc0 = 0;
+      acc1 = 0;
+      acc2 = 0;
+      acc3 = 0;
+
+      /* Initialize state pointer */
+      px = pStateCurnt;
+
+      /* Initialize coefficient pointer */
+      pb = pCoeffs;
+
+      tapCnt = numTaps;
+
+      while (tapCnt > 0U)
+      {
+        /* Read the coefficient once and apply it to the 4 channels */
+        c0 = *pb++;
+
+        acc0 += (q63_t) px[0U] * c0;
+        acc1 += (q63_t) px[stateLen] * c0;
+        acc2 += (q63_t) px[2U * stateLen] * c0;
+        acc3 += (q63_t) px[3U * stateLen] * c0;
+
+        px++;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      /* The results are in 34.30 format.  Convert to 1.15 and store them */
+      pOut[0] = (q15_t) __SSAT((acc0 >> 15U), 16);
+      pOut[1] = (q15_t) __SSAT((acc1 >> 15U), 16);
+      pOut[2] = (q15_t) __SSAT((acc2 >> 15U), 16);
+      pOut[3] = (q15_t) __SSAT((acc3 >> 15U), 16);
+      pOut += numChans;
+
+      /* Advance state pointer by 1 for the next frame */
+      pStateCurnt++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    ch += 4U;
+
+    /* Decrement the loop counter */
+    chCnt--;
+  }
+
+  /* If the number of channels is not a multiple of 4, filter the remaining channels one at a time */
+  chCnt = numChans % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  chCnt = numChans;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (chCnt > 0U)
+  {
+    pStateCurnt = pState + (ch * stateLen);
+    pOut = pDst + ch;
+
+    blkCnt = blockSize;
+
+    while (blkCnt > 0U)
+    {
+      /* Set the accumulator to zero */
+      acc0 = 0;
+
+      px = pStateCurnt;
+      pb = pCoeffs;
+
+      tapCnt = numTaps;
+
+      /* Perform the multiply-accumulates */
+      while (tapCnt > 0U)
+      {
+        acc0 += (q63_t) *px++ * *pb++;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      /* The result is in 34.30 format.  Convert to 1.15 */
+      *pOut = (q15_t) __SSAT((acc0 >> 15U), 16);
+      pOut += numChans;
+
+      /* Advance state pointer by 1 for the next frame */
+      pStateCurnt++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    ch++;
+
+    /* Decrement the loop counter */
+    chCnt--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last numTaps - 1 samples of each delay line to its start.
+   ** This prepares the state buffer for the next function call. */
+  for (ch = 0U; ch < numChans; ch++)
+  {
+    pStateCurnt = pState + (ch * stateLen);
+    px = pStateCurnt + blockSize;
+
+    tapCnt = numTaps - 1U;
+
+    while (tapCnt > 0U)
+    {
+      *pStateCurnt++ = *px++;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+  }
+}
+
+/**
+ * @} end of FIR group
+ */
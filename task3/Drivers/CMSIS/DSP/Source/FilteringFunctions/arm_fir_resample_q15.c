@@ -0,0 +1,194 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_q15.c
+ * Description:  Q15 polyphase rational resampler
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 polyphase resampler.
+ * @param[in,out] *S        points to an instance of the Q15 resampler structure.
+ * @param[in]     *pSrc     points to the block of input data.
+ * @param[out]    *pDst     points to the block of output data.
+ * @param[in]     blockSize number of input samples to process.
+ * @return        number of output samples written to <code>pDst</code>.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using a 64-bit internal accumulator.
+ * Both coefficients and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
+ * The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+ * There is no risk of internal overflow with this approach and the full precision of intermediate multiplications is preserved.
+ * After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
+ * Lastly, the accumulator is saturated to yield a result in 1.15 format.
+ * \par
+ * As the filter has a passband gain of <code>L</code>, the coefficients must usually be scaled down
+ * to fit the 1.15 format, and the output scaled up by the same factor.
+ */
+
+uint32_t arm_fir_resample_q15(
+  arm_fir_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Per-phase coefficient pointer */
+  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q15_t *px, *pb;                                /* Temporary pointers for state and coefficient buffers */
+  q63_t acc0;                                    /* Accumulator */
+  uint32_t L = S->L;                             /* Upsample factor */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t n = S->inputOffset;                   /* Input position of the current output sample */
+  uint32_t p = S->phase;                         /* Polyphase component of the current output sample */
+  uint32_t stepInt, stepFrac;                    /* Input and phase increments between output samples */
+  uint32_t outCnt = 0U;                          /* Number of output samples */
+  uint32_t tapCnt, blkCnt;                       /* Loop counters */
+
+  /* Moving by M samples of the upsampled signal advances the input by M/L samples
+   * and the polyphase component by M%L */
+  stepInt = S->M / L;
+  stepFrac = S->M % L;
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (phaseLen - 1U);
+
+  /* Copy the new input samples into the state buffer */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    *pStateCurnt++ = *pSrc++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the output samples that fall within this block of input */
+  while (n < blockSize)
+  {
+    /* x[n-phaseLength+1] is at pState[n] */
+    px = pState + n;
+
+    /* Coefficients of polyphase component p */
+    pb = pCoeffs + (p * phaseLen);
+
+    /* Set the accumulator to zero */
+    acc0 = 0;
+
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling. Process 4 taps at a time.
+     ** The coefficients of a polyphase component are consecutive, so they are read in pairs
+     ** along with the state, and each pair is accumulated with one dual multiply-accumulate. */
+    tapCnt = phaseLen >> 2U;
+
+    while (tapCnt > 0U)
+    {
+      /* acc0 += x[n-k] * c[k] + x[n-k-1] * c[k+1] */
+      acc0 = __SMLALD(*__SIMD32(px)++, *__SIMD32(pb)++, acc0);
+      acc0 = __SMLALD(*__SIMD32(px)++, *__SIMD32(pb)++, acc0);
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* If the polyphase length is not a multiple of 4, compute the remaining filter taps */
+    tapCnt = phaseLen % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    tapCnt = phaseLen;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (tapCnt > 0U)
+    {
+      /* Perform the multiply-accumulate */
+      acc0 += (q31_t) *px++ * *pb++;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* The result is in 34.30 format. Convert it to 1.15 and store in the destination buffer. */
+    *pDst++ = (q15_t) (__SSAT((acc0 >> 15), 16));
+    outCnt++;
+
+    /* Advance to the next output sample */
+    n += stepInt;
+    p += stepFrac;
+
+    if (p >= L)
+    {
+      p -= L;
+      n++;
+    }
+  }
+
+  /* Positions carry over to the next block */
+  S->inputOffset = n - blockSize;
+  S->phase = (uint16_t) p;
+
+  /* Processing is complete.
+   ** Now copy the last phaseLen - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+  pState = S->pState + blockSize;
+
+  tapCnt = phaseLen - 1U;
+
+  /* copy data */
+  while (tapCnt > 0U)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    tapCnt--;
+  }
+
+  return (outCnt);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
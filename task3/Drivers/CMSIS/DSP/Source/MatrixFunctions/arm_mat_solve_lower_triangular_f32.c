@@ -0,0 +1,140 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_solve_lower_triangular_f32.c
+ * Description:  Floating-point lower triangular solve
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixSolve Triangular Solves
+ *
+ * Solves T * X = B for X, where T is a square lower or upper triangular matrix and B has
+ * any number of columns.
+ *
+ * The lower triangular solve uses forward substitution and reads only the lower triangle of T.
+ * The upper triangular solve uses back substitution and reads only the upper triangle of T.
+ * The functions check that T is square and that B and X have as many rows as T and the same
+ * number of columns. The destination matrix may be the same as B, in which case the solution
+ * overwrites B in place.
+ *
+ * After a Cholesky decomposition A = L * L<sup>T</sup> (see \ref MatrixChol), A * X = B is solved by
+ * a lower triangular solve with L followed by an upper triangular solve with L<sup>T</sup>, which
+ * <code>arm_mat_trans_f32()</code> provides.
+ *
+ * \par Algorithm
+ * Row i of X is computed from row i of B, minus the rows of X already known weighted by the
+ * elements of row i of T, divided by t(i, i). If a diagonal element of T is zero, then the
+ * system has no unique solution and the function returns <code>ARM_MATH_SINGULAR</code>.
+ */
+
+/**
+ * @addtogroup MatrixSolve
+ * @{
+ */
+
+/**
+ * @brief Floating-point lower triangular solve.
+ * @param[in]       *pSrcL points to the instance of the lower triangular matrix
+ * @param[in]       *pSrcB points to the instance of the right-hand side matrix
+ * @param[out]      *pDst points to the instance of the solution matrix, which may be pSrcB
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the sizes of the matrices do not match.
+ * If a diagonal element of the triangular matrix is zero, then the function returns
+ * <code>ARM_MATH_SINGULAR</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ */
+
+arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcL,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pInL = pSrcL->pData;                /* triangular matrix pointer */
+  float32_t *pInB = pSrcB->pData;                /* right-hand side matrix pointer */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float32_t *pRowL;                              /* pointer to the current row of the triangular matrix */
+  float32_t *pX;                                 /* pointer to the current column of the output matrix */
+  float32_t sum;                                 /* accumulator */
+  uint32_t n = pSrcL->numRows;                   /* size of the triangular matrix */
+  uint32_t numCols = pSrcB->numCols;             /* number of columns of the solution */
+  uint32_t i, j, k;                              /* loop counters */
+  arm_status status;                             /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcL->numRows != pSrcL->numCols) || (pSrcB->numRows != pSrcL->numRows)
+     || (pDst->numRows != pSrcB->numRows) || (pDst->numCols != pSrcB->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+
+    /* Forward substitution, from the first row to the last */
+    for (i = 0U; i < n; i++)
+    {
+      pRowL = pInL + (i * n);
+
+      if (pRowL[i] == 0.0f)
+      {
+        return ARM_MATH_SINGULAR;
+      }
+
+      for (j = 0U; j < numCols; j++)
+      {
+        pX = pOut + j;
+
+        /* x(i,j) = (b(i,j) - l(i,0)*x(0,j) - ... - l(i,i-1)*x(i-1,j)) / l(i,i) */
+        sum = pInB[(i * numCols) + j];
+
+        for (k = 0U; k < i; k++)
+        {
+          sum -= pRowL[k] * *pX;
+          pX += numCols;
+        }
+
+        /* b(i,j) is not read again, so that pSrcB and pDst may be the same matrix */
+        *pX = sum / pRowL[i];
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixSolve group
+ */
@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_median_filter_init_q31.c
+ * Description:  Q31 running median filter initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Median
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 running median filter.
+ * @param[in,out] *S            points to an instance of the Q31 median filter structure.
+ * @param[in]     windowLen     number of samples in the window.
+ * @param[in]     *pState       points to the state buffer.
+ * @param[in]     *pHeap        points to the heap buffer.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+ * <code>windowLen</code> is zero.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pState</code> points to an array of <code>windowLen</code> samples.
+ * <code>pHeap</code> points to an array of <code>2*windowLen</code> entries.
+ * \par
+ * The window is cleared, so the first outputs are medians of the input and of zeros.
+ */
+
+arm_status arm_median_filter_init_q31(
+  arm_median_filter_instance_q31 * S,
+  uint16_t windowLen,
+  q31_t * pState,
+  uint16_t * pHeap)
+{
+  uint32_t i;                                    /* Loop counter */
+  arm_status status;
+
+  if (windowLen == 0U)
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Clear state buffer */
+    memset(pState, 0, windowLen * sizeof(q31_t));
+
+    /* Equal samples form valid heaps in any order: sample i is at heap entry i */
+    for (i = 0U; i < windowLen; i++)
+    {
+      pHeap[i] = (uint16_t) i;
+      pHeap[windowLen + i] = (uint16_t) i;
+    }
+
+    /* Assign window length, state and heap pointers */
+    S->windowLen = windowLen;
+    S->stateIndex = 0U;
+    S->pState = pState;
+    S->pHeap = pHeap;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Median group
+ */
@@ -0,0 +1,238 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sort_f32.c
+ * Description:  Sorts the elements of a floating-point vector
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup Sort Sort
+ *
+ * Sorts the elements of a vector in ascending order.
+ *
+ * \par
+ * Short vectors are sorted by a bitonic network. It is a fixed sequence of compare-exchange
+ * operations on the output buffer, with a cycle count that does not depend on the data and
+ * no branches in the comparator. Lengths that are not a power of two skip the comparators past
+ * the end of the vector.
+ * Its O(N log<sup>2</sup> N) comparisons outgrow the linear passes of a radix sort beyond
+ * a few tens of samples, so longer vectors are sorted by an LSD radix sort with 8-bit digits.
+ * It makes one pass per byte of the data type and ping-pongs between <code>pScratch</code>
+ * and <code>pDst</code>, with a histogram of 256 words on the stack.
+ * Q7 vectors are sorted by counting in a single pass and need no scratch buffer.
+ *
+ * \par
+ * <code>pDst</code> may be equal to <code>pSrc</code> for in-place sorting.
+ * <code>pScratch</code> must not overlap either of them.
+ *
+ * \par
+ * The floating-point version orders the samples by their bit patterns when the radix sort is used,
+ * which puts -0 before +0. NaN inputs are not supported.
+ *
+ * There are separate functions for floating-point, Q31, Q15, and Q7 data types.
+ */
+
+/**
+ * @addtogroup Sort
+ * @{
+ */
+
+/* Vectors up to this length are sorted by the bitonic network, longer ones by the radix sort */
+#define SORT_F32_BITONIC_MAX_LEN 64U
+
+/**
+ * @brief  Orders two samples.
+ */
+CMSIS_INLINE __STATIC_INLINE void arm_sort_exchange_f32(
+  float32_t * pA,
+  float32_t * pB)
+{
+  float32_t a = *pA;
+  float32_t b = *pB;
+
+  /* Both samples are stored back, so that the selection compiles without branches */
+  *pA = (a < b) ? a : b;
+  *pB = (a < b) ? b : a;
+}
+
+/**
+ * @brief  In-place bitonic sorting network.
+ */
+static void arm_sort_bitonic_f32(
+  float32_t * pData,
+  uint32_t blockSize)
+{
+  float32_t *pA, *pB;                            /* Pointers to the two samples of a comparator */
+  uint32_t size, half, base, i, start, stop;     /* Loop counters and limits */
+
+  for (size = 2U; (size >> 1U) < blockSize; size <<= 1U)
+  {
+    half = size >> 1U;
+
+    /* Merge the sorted runs of half samples by pairs: each sample of the first
+     * run is compared with its mirror image in the second run. Comparators past
+     * the end of the vector are skipped, as if it was padded with +inf. */
+    for (base = 0U; (base + half) < blockSize; base += size)
+    {
+      start = ((base + size) > blockSize) ? ((base + size) - blockSize) : 0U;
+      pA = pData + base + start;
+      pB = pData + ((base + size) - 1U - start);
+
+      for (i = start; i < half; i++)
+      {
+        arm_sort_exchange_f32(pA++, pB--);
+      }
+    }
+
+    /* The half-cleaners sort each bitonic run */
+    for (half >>= 1U; half > 0U; half >>= 1U)
+    {
+      for (base = 0U; (base + half) < blockSize; base += 2U * half)
+      {
+        stop = blockSize - base - half;
+        stop = (stop < half) ? stop : half;
+        pA = pData + base;
+        pB = pA + half;
+
+        for (i = 0U; i < stop; i++)
+        {
+          arm_sort_exchange_f32(pA++, pB++);
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief  Maps the bit pattern of a sample to an unsigned key with the same order.
+ */
+CMSIS_INLINE __STATIC_INLINE uint32_t arm_sort_key_f32(
+  uint32_t in)
+{
+  /* Positive values get the sign bit set, negative values are complemented */
+  return in ^ ((uint32_t) ((int32_t) in >> 31) | 0x80000000U);
+}
+
+/**
+ * @brief  LSD radix sort with 8-bit digits of the keys.
+ */
+static void arm_sort_radix_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  float32_t * pScratch,
+  uint32_t blockSize)
+{
+  uint32_t count[256];                           /* Histogram, then start position of each digit */
+  uint32_t *pIn, *pOut;                          /* Source and destination of the current pass */
+  uint32_t in;                                   /* Temporary variable to hold the input sample */
+  uint32_t shift, digit, sum, i;                 /* Digit position and loop variables */
+
+  /* The samples are moved as their bit patterns */
+  pIn = (uint32_t *) pSrc;
+
+  for (shift = 0U; shift < 32U; shift += 8U)
+  {
+    memset(count, 0, sizeof(count));
+
+    for (i = 0U; i < blockSize; i++)
+    {
+      count[(arm_sort_key_f32(pIn[i]) >> shift) & 0xFFU]++;
+    }
+
+    /* A digit shared by all samples leaves their order unchanged */
+    if (count[(arm_sort_key_f32(pIn[0]) >> shift) & 0xFFU] == blockSize)
+    {
+      continue;
+    }
+
+    sum = 0U;
+    for (digit = 0U; digit < 256U; digit++)
+    {
+      i = count[digit];
+      count[digit] = sum;
+      sum += i;
+    }
+
+    /* Alternate between the scratch and the destination buffers */
+    pOut = (pIn == (uint32_t *) pScratch) ? (uint32_t *) pDst : (uint32_t *) pScratch;
+
+    for (i = 0U; i < blockSize; i++)
+    {
+      in = pIn[i];
+      pOut[count[(arm_sort_key_f32(in) >> shift) & 0xFFU]++] = in;
+    }
+
+    pIn = pOut;
+  }
+
+  if (pIn != (uint32_t *) pDst)
+  {
+    memcpy(pDst, pIn, blockSize * sizeof(float32_t));
+  }
+}
+
+/**
+ * @brief Sorts the elements of a floating-point vector in ascending order.
+ * @param[in]       *pSrc points to input vector
+ * @param[out]      *pDst points to output vector
+ * @param[in]       *pScratch points to a scratch buffer of blockSize samples
+ * @param[in]       blockSize length of the input vector
+ * @return none.
+ *
+ * \par
+ * Vectors of up to 64 samples are sorted by a bitonic network in <code>pDst</code> and <code>pScratch</code> is not used.
+ * Longer vectors are sorted by four radix passes over the bytes of an unsigned key with the order of the samples.
+ * Passes are skipped when all samples share the digit.
+ */
+
+void arm_sort_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  float32_t * pScratch,
+  uint32_t blockSize)
+{
+  if (blockSize <= SORT_F32_BITONIC_MAX_LEN)
+  {
+    if (pDst != pSrc)
+    {
+      memcpy(pDst, pSrc, blockSize * sizeof(float32_t));
+    }
+
+    arm_sort_bitonic_f32(pDst, blockSize);
+  }
+  else
+  {
+    arm_sort_radix_f32(pSrc, pDst, pScratch, blockSize);
+  }
+}
+
+/**
+ * @} end of Sort group
+ */
@@ -0,0 +1,160 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sort_q7.c
+ * Description:  Sorts the elements of a Q7 vector
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Sort
+ * @{
+ */
+
+/* Vectors up to this length are sorted by the bitonic network, longer ones by counting */
+#define SORT_Q7_BITONIC_MAX_LEN 32U
+
+/**
+ * @brief  Orders two samples.
+ */
+CMSIS_INLINE __STATIC_INLINE void arm_sort_exchange_q7(
+  q7_t * pA,
+  q7_t * pB)
+{
+  q7_t a = *pA;
+  q7_t b = *pB;
+
+  /* Both samples are stored back, so that the selection compiles without branches */
+  *pA = (a < b) ? a : b;
+  *pB = (a < b) ? b : a;
+}
+
+/**
+ * @brief  In-place bitonic sorting network.
+ */
+static void arm_sort_bitonic_q7(
+  q7_t * pData,
+  uint32_t blockSize)
+{
+  q7_t *pA, *pB;                                 /* Pointers to the two samples of a comparator */
+  uint32_t size, half, base, i, start, stop;     /* Loop counters and limits */
+
+  for (size = 2U; (size >> 1U) < blockSize; size <<= 1U)
+  {
+    half = size >> 1U;
+
+    /* Merge the sorted runs of half samples by pairs: each sample of the first
+     * run is compared with its mirror image in the second run. Comparators past
+     * the end of the vector are skipped, as if it was padded with +inf. */
+    for (base = 0U; (base + half) < blockSize; base += size)
+    {
+      start = ((base + size) > blockSize) ? ((base + size) - blockSize) : 0U;
+      pA = pData + base + start;
+      pB = pData + ((base + size) - 1U - start);
+
+      for (i = start; i < half; i++)
+      {
+        arm_sort_exchange_q7(pA++, pB--);
+      }
+    }
+
+    /* The half-cleaners sort each bitonic run */
+    for (half >>= 1U; half > 0U; half >>= 1U)
+    {
+      for (base = 0U; (base + half) < blockSize; base += 2U * half)
+      {
+        stop = blockSize - base - half;
+        stop = (stop < half) ? stop : half;
+        pA = pData + base;
+        pB = pA + half;
+
+        for (i = 0U; i < stop; i++)
+        {
+          arm_sort_exchange_q7(pA++, pB++);
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Sorts the elements of a Q7 vector in ascending order.
+ * @param[in]       *pSrc points to input vector
+ * @param[out]      *pDst points to output vector
+ * @param[in]       blockSize length of the input vector
+ * @return none.
+ *
+ * \par
+ * Vectors of up to 32 samples are sorted by a bitonic network in <code>pDst</code>.
+ * Longer vectors are sorted by counting the occurrences of each value, then writing out the values in order.
+ */
+
+void arm_sort_q7(
+  q7_t * pSrc,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t count[256];                           /* Number of occurrences of each value */
+  uint32_t value, i;                             /* Loop counters */
+
+  if (blockSize <= SORT_Q7_BITONIC_MAX_LEN)
+  {
+    if (pDst != pSrc)
+    {
+      memcpy(pDst, pSrc, blockSize * sizeof(q7_t));
+    }
+
+    arm_sort_bitonic_q7(pDst, blockSize);
+  }
+  else
+  {
+    memset(count, 0, sizeof(count));
+
+    /* The sign bit is flipped, so that negative values come first */
+    for (i = 0U; i < blockSize; i++)
+    {
+      count[(uint8_t) pSrc[i] ^ 0x80U]++;
+    }
+
+    for (value = 0U; value < 256U; value++)
+    {
+      i = count[value];
+
+      while (i > 0U)
+      {
+        *pDst++ = (q7_t) (value ^ 0x80U);
+        i--;
+      }
+    }
+  }
+}
+
+/**
+ * @} end of Sort group
+ */
@@ -228,3 +228,72 @@ uint16_t * pBitRevTab)
       pBitRevTab += bitRevFactor;
    }
 }
+
+#if defined (ARM_MATH_HOST)
+
+/* Run the below code for x86 hosts, where arm_bitreversal2.S cannot be assembled */
+
+/*
+* @brief  In-place bit reversal function.
+* @param[in, out] *pSrc        points to the in-place buffer of unknown 32-bit data type.
+* @param[in]      bitRevLen    bit reversal table length
+* @param[in]      *pBitRevTab  points to bit reversal table.
+* @return none.
+*/
+
+void arm_bitreversal_32(
+uint32_t * pSrc,
+const uint16_t bitRevLen,
+const uint16_t * pBitRevTab)
+{
+   uint32_t a, b, i, tmp;
+
+   /* The table holds pairs of byte offsets of the complex samples to swap */
+   for (i = 0U; i < bitRevLen; i += 2U)
+   {
+      a = pBitRevTab[i] >> 2U;
+      b = pBitRevTab[i + 1U] >> 2U;
+
+      tmp = pSrc[a];
+      pSrc[a] = pSrc[b];
+      pSrc[b] = tmp;
+
+      tmp = pSrc[a + 1U];
+      pSrc[a + 1U] = pSrc[b + 1U];
+      pSrc[b + 1U] = tmp;
+   }
+}
+
+/*
+* @brief  In-place bit reversal function.
+* @param[in, out] *pSrc        points to the in-place buffer of unknown 16-bit data type.
+* @param[in]      bitRevLen    bit reversal table length
+* @param[in]      *pBitRevTab  points to bit reversal table.
+* @return none.
+*/
+
+void arm_bitreversal_16(
+uint16_t * pSrc,
+const uint16_t bitRevLen,
+const uint16_t * pBitRevTab)
+{
+   uint32_t a, b, i;
+   uint16_t tmp;
+
+   /* The table is shared with the 32-bit data, so the byte offsets are halved */
+   for (i = 0U; i < bitRevLen; i += 2U)
+   {
+      a = pBitRevTab[i] >> 2U;
+      b = pBitRevTab[i + 1U] >> 2U;
+
+      tmp = pSrc[a];
+      pSrc[a] = pSrc[b];
+      pSrc[b] = tmp;
+
+      tmp = pSrc[a + 1U];
+      pSrc[a + 1U] = pSrc[b + 1U];
+      pSrc[b + 1U] = tmp;
+   }
+}
+
+#endif /* #if defined (ARM_MATH_HOST) */
@@ -1,7 +1,7 @@
 /* ----------------------------------------------------------------------
  * Project:      CMSIS DSP Library
  * Title:        arm_cfft_q31.c
- * Description:  Combined Radix Decimation in Frequency CFFT fixed point processing function
+ * Description:  Mixed radix-8/4/2 decimation in frequency Q31 CFFT processing function
  *
  * $Date:        27. January 2017
  * $Revision:    V.1.5.1
@@ -28,225 +28,535 @@
 
 #include "arm_math.h"
 
-extern void arm_radix4_butterfly_q31(
-    q31_t * pSrc,
-    uint32_t fftLen,
-    q31_t * pCoef,
-    uint32_t twidCoefModifier);
-
-extern void arm_radix4_butterfly_inverse_q31(
-    q31_t * pSrc,
-    uint32_t fftLen,
-    q31_t * pCoef,
-    uint32_t twidCoefModifier);
-
-extern void arm_bitreversal_32(
-    uint32_t * pSrc,
-    const uint16_t bitRevLen,
-    const uint16_t * pBitRevTable);
-
-void arm_cfft_radix4by2_q31(
-    q31_t * pSrc,
-    uint32_t fftLen,
-    const q31_t * pCoef);
-
-void arm_cfft_radix4by2_inverse_q31(
-    q31_t * pSrc,
-    uint32_t fftLen,
-    const q31_t * pCoef);
+/* cos(pi/4) in 1.31 format */
+#define CFFT_Q31_COS_PI_4   0x5A82799A
+
+/*
+ * The stages below take the offsets of the real and imaginary parts of each
+ * complex value as the constants re and im.  The inverse transform swaps them,
+ * which runs the forward butterflies on the data with the real and imaginary
+ * parts exchanged: that is the inverse transform with the same scaling.
+ */
 
 /**
-* @ingroup groupTransforms
-*/
+ * @brief  Multiplies a butterfly output by a twiddle factor and stores it.
+ * @param[out] *pOut  points to the output complex value.
+ * @param[in]  xr     real part of the butterfly output.
+ * @param[in]  xi     imaginary part of the butterfly output.
+ * @param[in]  *pTw   points to the twiddle factor {cos, sin}, or is NULL for W^0.
+ * @param[in]  re     offset of the real part.
+ * @param[in]  im     offset of the imaginary part.
+ * @return none.
+ */
+CMSIS_INLINE __STATIC_INLINE void arm_cfft_store_q31(
+  q31_t * pOut,
+  q31_t xr,
+  q31_t xi,
+  const q31_t * pTw,
+  uint32_t re,
+  uint32_t im)
+{
+  if (pTw == NULL)
+  {
+    pOut[re] = xr;
+    pOut[im] = xi;
+  }
+  else
+  {
+    pOut[re] = (q31_t) (((q63_t) xr * pTw[0] + (q63_t) xi * pTw[1]) >> 31);
+    pOut[im] = (q31_t) (((q63_t) xi * pTw[0] - (q63_t) xr * pTw[1]) >> 31);
+  }
+}
 
 /**
-* @addtogroup ComplexFFT
-* @{
-*/
+ * @brief  Radix-2 first stage, used when log2(fftLen) - 1 is one more than a
+ *         multiple of 3.  The inputs are scaled down by 4.
+ * @param[in, out] *pSrc   points to the complex data buffer.
+ * @param[in]      fftLen  length of the FFT.
+ * @param[in]      *pCoef  points to the twiddle coefficient buffer.
+ * @param[in]      re      offset of the real part.
+ * @param[in]      im      offset of the imaginary part.
+ * @return none.
+ */
+CMSIS_INLINE __STATIC_INLINE void arm_cfft_radix2_first_q31(
+  q31_t * pSrc,
+  uint32_t fftLen,
+  const q31_t * pCoef,
+  uint32_t re,
+  uint32_t im)
+{
+  q31_t *p0 = pSrc;                              /* Input pointers */
+  q31_t *p1 = pSrc + fftLen;
+  q31_t a0r, a0i, a1r, a1i;                      /* Temporary variables for the inputs */
+  uint32_t i;                                    /* Loop counter */
+
+  for (i = 0U; i < (fftLen >> 1U); i++)
+  {
+    a0r = p0[re] >> 2;
+    a0i = p0[im] >> 2;
+    a1r = p1[re] >> 2;
+    a1i = p1[im] >> 2;
+
+    p0[re] = a0r + a1r;
+    p0[im] = a0i + a1i;
+    arm_cfft_store_q31(p1, a0r - a1r, a0i - a1i, &pCoef[2U * i], re, im);
+
+    p0 += 2U;
+    p1 += 2U;
+  }
+}
 
 /**
-* @details
-* @brief       Processing function for the fixed-point complex FFT in Q31 format.
-* @param[in]      *S    points to an instance of the fixed-point CFFT structure.
-* @param[in, out] *p1   points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
-* @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
-* @param[in]     bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
-* @return none.
-*/
+ * @brief  Radix-4 first stage, used when log2(fftLen) - 1 is two more than a
+ *         multiple of 3.  The inputs are scaled down by 8 and the outputs are
+ *         stored in bit reversed order X0, X2, X1, X3.
+ * @param[in, out] *pSrc   points to the complex data buffer.
+ * @param[in]      fftLen  length of the FFT.
+ * @param[in]      *pCoef  points to the twiddle coefficient buffer.
+ * @param[in]      re      offset of the real part.
+ * @param[in]      im      offset of the imaginary part.
+ * @return none.
+ */
+CMSIS_INLINE __STATIC_INLINE void arm_cfft_radix4_first_q31(
+  q31_t * pSrc,
+  uint32_t fftLen,
+  const q31_t * pCoef,
+  uint32_t re,
+  uint32_t im)
+{
+  q31_t *p0 = pSrc;                              /* Input pointers */
+  q31_t *p1 = p0 + (fftLen >> 1U);
+  q31_t *p2 = p1 + (fftLen >> 1U);
+  q31_t *p3 = p2 + (fftLen >> 1U);
+  q31_t a0r, a0i, a1r, a1i, a2r, a2i, a3r, a3i; /* Temporary variables for the inputs */
+  q31_t s0r, s0i, s1r, s1i;                      /* Temporary variables for the sums */
+  uint32_t i;                                    /* Loop counter */
+
+  for (i = 0U; i < (fftLen >> 2U); i++)
+  {
+    a0r = p0[re] >> 3;
+    a0i = p0[im] >> 3;
+    a1r = p1[re] >> 3;
+    a1i = p1[im] >> 3;
+    a2r = p2[re] >> 3;
+    a2i = p2[im] >> 3;
+    a3r = p3[re] >> 3;
+    a3i = p3[im] >> 3;
+
+    /* X0 and X2 = (a0 + a2) +/- (a1 + a3) */
+    s0r = a0r + a2r;
+    s0i = a0i + a2i;
+    s1r = a1r + a3r;
+    s1i = a1i + a3i;
+    p0[re] = s0r + s1r;
+    p0[im] = s0i + s1i;
+    arm_cfft_store_q31(p1, s0r - s1r, s0i - s1i, &pCoef[4U * i], re, im);
+
+    /* X1 and X3 = (a0 - a2) -/+ j * (a1 - a3) */
+    s0r = a0r - a2r;
+    s0i = a0i - a2i;
+    s1r = a1r - a3r;
+    s1i = a1i - a3i;
+    arm_cfft_store_q31(p2, s0r + s1i, s0i - s1r, &pCoef[2U * i], re, im);
+    arm_cfft_store_q31(p3, s0r - s1i, s0i + s1r, &pCoef[6U * i], re, im);
+
+    p0 += 2U;
+    p1 += 2U;
+    p2 += 2U;
+    p3 += 2U;
+  }
+}
 
-void arm_cfft_q31(
-    const arm_cfft_instance_q31 * S,
-    q31_t * p1,
-    uint8_t ifftFlag,
-    uint8_t bitReverseFlag)
+/**
+ * @brief  Radix-8 butterfly.  The outputs are stored in bit reversed order
+ *         X0, X4, X2, X6, X1, X5, X3, X7.
+ * @param[in, out] *pSrc   points to the first input.
+ * @param[in]      n8      distance between the inputs, in words.
+ * @param[in]      *pTw    points to the twiddle factors W^j .. W^7j, or is NULL for j = 0.
+ * @param[in]      shift   right shift applied to the inputs.
+ * @param[in]      re      offset of the real part.
+ * @param[in]      im      offset of the imaginary part.
+ * @return none.
+ */
+CMSIS_INLINE __STATIC_INLINE void arm_cfft_radix8_butterfly_q31(
+  q31_t * pSrc,
+  uint32_t n8,
+  const q31_t * pTw,
+  uint32_t shift,
+  uint32_t re,
+  uint32_t im)
 {
-    uint32_t L = S->fftLen;
+  q31_t *p0 = pSrc, *p4 = pSrc + (4U * n8);      /* Input pointers */
+  q31_t b0r, b0i, b1r, b1i, b2r, b2i, b3r, b3i; /* Temporary variables for the sums */
+  q31_t xr, xi, yr, yi;                          /* Temporary variables */
+
+  /*
+   * First level: b_m = a_m + a_(m+4) is kept for the even outputs, while
+   * (a_m - a_(m+4)) * W8^m replaces a_(m+4) for the odd outputs, so that
+   * only one half of the butterfly is in registers at a time.
+   */
+  xr = p0[re] >> shift;
+  xi = p0[im] >> shift;
+  yr = p4[re] >> shift;
+  yi = p4[im] >> shift;
+  b0r = xr + yr;
+  b0i = xi + yi;
+  p4[re] = xr - yr;
+  p4[im] = xi - yi;
+  p0 += n8;
+  p4 += n8;
+
+  /* W8^1 = (1 - j) / sqrt(2) */
+  xr = p0[re] >> shift;
+  xi = p0[im] >> shift;
+  yr = p4[re] >> shift;
+  yi = p4[im] >> shift;
+  b1r = xr + yr;
+  b1i = xi + yi;
+  xr = xr - yr;
+  xi = xi - yi;
+  p4[re] = (q31_t) (((q63_t) (xr + xi) * CFFT_Q31_COS_PI_4) >> 31);
+  p4[im] = (q31_t) (((q63_t) (xi - xr) * CFFT_Q31_COS_PI_4) >> 31);
+  p0 += n8;
+  p4 += n8;
+
+  /* W8^2 = -j */
+  xr = p0[re] >> shift;
+  xi = p0[im] >> shift;
+  yr = p4[re] >> shift;
+  yi = p4[im] >> shift;
+  b2r = xr + yr;
+  b2i = xi + yi;
+  p4[re] = xi - yi;
+  p4[im] = yr - xr;
+  p0 += n8;
+  p4 += n8;
+
+  /* W8^3 = (-1 - j) / sqrt(2) */
+  xr = p0[re] >> shift;
+  xi = p0[im] >> shift;
+  yr = p4[re] >> shift;
+  yi = p4[im] >> shift;
+  b3r = xr + yr;
+  b3i = xi + yi;
+  xr = xr - yr;
+  xi = xi - yi;
+  p4[re] = (q31_t) (((q63_t) (xi - xr) * CFFT_Q31_COS_PI_4) >> 31);
+  p4[im] = (q31_t) (((q63_t) (-xr - xi) * CFFT_Q31_COS_PI_4) >> 31);
+
+  /* Second level: radix-4 on the sums gives the even outputs X0, X4, X2, X6 */
+  p0 = pSrc;
+  xr = b0r + b2r;
+  xi = b0i + b2i;
+  yr = b1r + b3r;
+  yi = b1i + b3i;
+  p0[re] = xr + yr;
+  p0[im] = xi + yi;
+  p0 += n8;
+  arm_cfft_store_q31(p0, xr - yr, xi - yi, (pTw == NULL) ? NULL : &pTw[6], re, im);
+  p0 += n8;
+
+  xr = b0r - b2r;
+  xi = b0i - b2i;
+  yr = b1r - b3r;
+  yi = b1i - b3i;
+  arm_cfft_store_q31(p0, xr + yi, xi - yr, (pTw == NULL) ? NULL : &pTw[2], re, im);
+  p0 += n8;
+  arm_cfft_store_q31(p0, xr - yi, xi + yr, (pTw == NULL) ? NULL : &pTw[10], re, im);
+  p0 += n8;
+
+  /* and radix-4 on the rotated differences gives the odd outputs X1, X5, X3, X7 */
+  b0r = p0[re];
+  b0i = p0[im];
+  b1r = p0[n8 + re];
+  b1i = p0[n8 + im];
+  b2r = p0[(2U * n8) + re];
+  b2i = p0[(2U * n8) + im];
+  b3r = p0[(3U * n8) + re];
+  b3i = p0[(3U * n8) + im];
+
+  xr = b0r + b2r;
+  xi = b0i + b2i;
+  yr = b1r + b3r;
+  yi = b1i + b3i;
+  arm_cfft_store_q31(p0, xr + yr, xi + yi, pTw, re, im);
+  p0 += n8;
+  arm_cfft_store_q31(p0, xr - yr, xi - yi, (pTw == NULL) ? NULL : &pTw[8], re, im);
+  p0 += n8;
+
+  xr = b0r - b2r;
+  xi = b0i - b2i;
+  yr = b1r - b3r;
+  yi = b1i - b3i;
+  arm_cfft_store_q31(p0, xr + yi, xi - yr, (pTw == NULL) ? NULL : &pTw[4], re, im);
+  p0 += n8;
+  arm_cfft_store_q31(p0, xr - yi, xi + yr, (pTw == NULL) ? NULL : &pTw[12], re, im);
+}
 
-    if (ifftFlag == 1U)
+/**
+ * @brief  Radix-8 stage.
+ * @param[in, out] *pSrc   points to the complex data buffer.
+ * @param[in]      fftLen  length of the FFT.
+ * @param[in]      subLen  length of the sub-transforms computed by the stage.
+ * @param[in]      *pCoef  points to the twiddle coefficient buffer.
+ * @param[in]      shift   right shift applied to the inputs.
+ * @param[in]      re      offset of the real part.
+ * @param[in]      im      offset of the imaginary part.
+ * @return none.
+ */
+CMSIS_INLINE __STATIC_INLINE void arm_cfft_radix8_stage_q31(
+  q31_t * pSrc,
+  uint32_t fftLen,
+  uint32_t subLen,
+  const q31_t * pCoef,
+  uint32_t shift,
+  uint32_t re,
+  uint32_t im)
+{
+  q31_t tw[14];                                  /* Twiddle factors W^j .. W^7j */
+  const q31_t *pW;                               /* Twiddle factor pointer */
+  uint32_t n8 = subLen >> 2U;                    /* Distance between the inputs, in words */
+  uint32_t step = 2U * (fftLen / subLen);        /* Twiddle step of W_subLen, in words */
+  uint32_t i, j, k;                              /* Loop counters */
+
+  /* All the twiddle factors of the first butterfly of each sub-transform are 1 */
+  for (i = 0U; i < fftLen; i += subLen)
+  {
+    arm_cfft_radix8_butterfly_q31(pSrc + (2U * i), n8, NULL, shift, re, im);
+  }
+
+  for (j = 1U; j < (subLen >> 3U); j++)
+  {
+    /* The twiddle factors are shared by the butterflies of all the
+       sub-transforms.  W^kj is in the table for k < 7, W^7j may be past its
+       3/4 length and is then -W^(7j - N/2). */
+    pW = pCoef;
+    for (k = 0U; k < 12U; k += 2U)
     {
-        switch (L)
-        {
-        case 16:
-        case 64:
-        case 256:
-        case 1024:
-        case 4096:
-            arm_radix4_butterfly_inverse_q31  ( p1, L, (q31_t*)S->pTwiddle, 1 );
-            break;
-
-        case 32:
-        case 128:
-        case 512:
-        case 2048:
-            arm_cfft_radix4by2_inverse_q31  ( p1, L, S->pTwiddle );
-            break;
-        }
+      pW += j * step;
+      tw[k] = pW[0];
+      tw[k + 1U] = pW[1];
+    }
+
+    pW += j * step;
+    if (pW < (pCoef + fftLen))
+    {
+      tw[12] = pW[0];
+      tw[13] = pW[1];
     }
     else
     {
-        switch (L)
-        {
-        case 16:
-        case 64:
-        case 256:
-        case 1024:
-        case 4096:
-            arm_radix4_butterfly_q31  ( p1, L, (q31_t*)S->pTwiddle, 1 );
-            break;
-
-        case 32:
-        case 128:
-        case 512:
-        case 2048:
-            arm_cfft_radix4by2_q31  ( p1, L, S->pTwiddle );
-            break;
-        }
+      tw[12] = -pW[-(int32_t) fftLen];
+      tw[13] = -pW[1 - (int32_t) fftLen];
     }
 
-    if ( bitReverseFlag )
-        arm_bitreversal_32((uint32_t*)p1,S->bitRevLength,S->pBitRevTable);
+    for (i = j; i < fftLen; i += subLen)
+    {
+      arm_cfft_radix8_butterfly_q31(pSrc + (2U * i), n8, tw, shift, re, im);
+    }
+  }
 }
 
 /**
-* @} end of ComplexFFT group
-*/
-
-void arm_cfft_radix4by2_q31(
-    q31_t * pSrc,
-    uint32_t fftLen,
-    const q31_t * pCoef)
+ * @brief  Final radix-2 stage.  Its butterflies need no twiddle factors nor
+ *         scaling, and are the same for both directions.  When bit reversal is
+ *         enabled the outputs are written straight to their natural order
+ *         positions, so that no separate reordering pass is needed.
+ * @param[in, out] *pSrc           points to the complex data buffer.
+ * @param[in]      fftLen          length of the FFT.
+ * @param[in]      bitReverseFlag  flag that enables the reordering of the output.
+ * @return none.
+ */
+static void arm_cfft_radix2_last_q31(
+  q31_t * pSrc,
+  uint32_t fftLen,
+  uint8_t bitReverseFlag)
 {
-    uint32_t i, l;
-    uint32_t n2, ia;
-    q31_t xt, yt, cosVal, sinVal;
-    q31_t p0, p1;
-
-    n2 = fftLen >> 1;
-    ia = 0;
-    for (i = 0; i < n2; i++)
-    {
-        cosVal = pCoef[2*ia];
-        sinVal = pCoef[2*ia + 1];
-        ia++;
+  q31_t a0r, a0i, a1r, a1i, a2r, a2i, a3r, a3i; /* Inputs of quad h */
+  q31_t b0r, b0i, b1r, b1i, b2r, b2i, b3r, b3i; /* Inputs of quad g */
+  q31_t *ph, *pg;                                /* Quad pointers */
+  uint32_t n4 = fftLen >> 2U;                    /* Number of quads */
+  uint32_t h, g, bit;                            /* Quad indexes */
 
-        l = i + n2;
-        xt = (pSrc[2 * i] >> 2) - (pSrc[2 * l] >> 2);
-        pSrc[2 * i] = (pSrc[2 * i] >> 2) + (pSrc[2 * l] >> 2);
+  if (bitReverseFlag == 0U)
+  {
+    ph = pSrc;
 
-        yt = (pSrc[2 * i + 1] >> 2) - (pSrc[2 * l + 1] >> 2);
-        pSrc[2 * i + 1] = (pSrc[2 * l + 1] >> 2) + (pSrc[2 * i + 1] >> 2);
-
-        mult_32x32_keep32_R(p0, xt, cosVal);
-        mult_32x32_keep32_R(p1, yt, cosVal);
-        multAcc_32x32_keep32_R(p0, yt, sinVal);
-        multSub_32x32_keep32_R(p1, xt, sinVal);
+    for (h = 0U; h < (fftLen >> 1U); h++)
+    {
+      a0r = ph[0];
+      a0i = ph[1];
+      a1r = ph[2];
+      a1i = ph[3];
 
-        pSrc[2U * l] = p0 << 1;
-        pSrc[2U * l + 1U] = p1 << 1;
+      ph[0] = a0r + a1r;
+      ph[1] = a0i + a1i;
+      ph[2] = a0r - a1r;
+      ph[3] = a0i - a1i;
 
+      ph += 4U;
     }
 
-    // first col
-    arm_radix4_butterfly_q31( pSrc, n2, (q31_t*)pCoef, 2U);
-    // second col
-    arm_radix4_butterfly_q31( pSrc + fftLen, n2, (q31_t*)pCoef, 2U);
+    return;
+  }
+
+  /*
+   * Quad h holds the butterflies on the complex values {2h, 2h + 1} and
+   * {2h + N/2, 2h + 1 + N/2}.  Their outputs go to 2g, 2g + N/2, 2g + 1 and
+   * 2g + 1 + N/2, with g the (log2(N) - 2)-bit reversal of h, which are the
+   * inputs of quad g: the two quads are loaded before either is written.
+   */
+  g = 0U;
 
-    for (i = 0; i < fftLen >> 1; i++)
+  for (h = 0U; h < n4; h++)
+  {
+    if (g >= h)
     {
-        p0 = pSrc[4*i+0];
-        p1 = pSrc[4*i+1];
-        xt = pSrc[4*i+2];
-        yt = pSrc[4*i+3];
-
-        p0 <<= 1;
-        p1 <<= 1;
-        xt <<= 1;
-        yt <<= 1;
-
-        pSrc[4*i+0] = p0;
-        pSrc[4*i+1] = p1;
-        pSrc[4*i+2] = xt;
-        pSrc[4*i+3] = yt;
+      ph = pSrc + (4U * h);
+      pg = pSrc + (4U * g);
+
+      a0r = ph[0];
+      a0i = ph[1];
+      a1r = ph[2];
+      a1i = ph[3];
+      a2r = ph[fftLen];
+      a2i = ph[fftLen + 1U];
+      a3r = ph[fftLen + 2U];
+      a3i = ph[fftLen + 3U];
+
+      b0r = pg[0];
+      b0i = pg[1];
+      b1r = pg[2];
+      b1i = pg[3];
+      b2r = pg[fftLen];
+      b2i = pg[fftLen + 1U];
+      b3r = pg[fftLen + 2U];
+      b3i = pg[fftLen + 3U];
+
+      pg[0] = a0r + a1r;
+      pg[1] = a0i + a1i;
+      pg[2] = a2r + a3r;
+      pg[3] = a2i + a3i;
+      pg[fftLen] = a0r - a1r;
+      pg[fftLen + 1U] = a0i - a1i;
+      pg[fftLen + 2U] = a2r - a3r;
+      pg[fftLen + 3U] = a2i - a3i;
+
+      ph[0] = b0r + b1r;
+      ph[1] = b0i + b1i;
+      ph[2] = b2r + b3r;
+      ph[3] = b2i + b3i;
+      ph[fftLen] = b0r - b1r;
+      ph[fftLen + 1U] = b0i - b1i;
+      ph[fftLen + 2U] = b2r - b3r;
+      ph[fftLen + 3U] = b2i - b3i;
     }
 
+    /* Bit reversed increment of g */
+    bit = n4 >> 1U;
+    while ((g & bit) != 0U)
+    {
+      g ^= bit;
+      bit >>= 1U;
+    }
+    g |= bit;
+  }
 }
 
-void arm_cfft_radix4by2_inverse_q31(
-    q31_t * pSrc,
-    uint32_t fftLen,
-    const q31_t * pCoef)
+/**
+ * @brief  Mixed radix pipeline for one direction.
+ * @param[in, out] *pSrc   points to the complex data buffer.
+ * @param[in]      fftLen  length of the FFT.
+ * @param[in]      *pCoef  points to the twiddle coefficient buffer.
+ * @param[in]      re      offset of the real part.
+ * @param[in]      im      offset of the imaginary part.
+ * @return none.
+ */
+CMSIS_INLINE __STATIC_INLINE void arm_cfft_mixed_radix_q31(
+  q31_t * pSrc,
+  uint32_t fftLen,
+  const q31_t * pCoef,
+  uint32_t re,
+  uint32_t im)
 {
-    uint32_t i, l;
-    uint32_t n2, ia;
-    q31_t xt, yt, cosVal, sinVal;
-    q31_t p0, p1;
-
-    n2 = fftLen >> 1;
-    ia = 0;
-    for (i = 0; i < n2; i++)
-    {
-        cosVal = pCoef[2*ia];
-        sinVal = pCoef[2*ia + 1];
-        ia++;
+  uint32_t log2Len = 0U;                         /* log2 of the FFT length */
+  uint32_t subLen;                               /* Length of the sub-transforms */
+  uint32_t shift;                                /* Scaling of the stage inputs */
+
+  while ((1U << log2Len) < fftLen)
+  {
+    log2Len++;
+  }
+
+  /* The first stage takes one more bit of headroom than its radix and the final
+     radix-2 stage none, so that the output is scaled by 1/fftLen */
+  switch ((log2Len - 1U) % 3U)
+  {
+  case 0U:
+    subLen = fftLen;
+    shift = 4U;
+    break;
+
+  case 1U:
+    arm_cfft_radix2_first_q31(pSrc, fftLen, pCoef, re, im);
+    subLen = fftLen >> 1U;
+    shift = 3U;
+    break;
+
+  default:
+    arm_cfft_radix4_first_q31(pSrc, fftLen, pCoef, re, im);
+    subLen = fftLen >> 2U;
+    shift = 3U;
+    break;
+  }
+
+  while (subLen > 2U)
+  {
+    arm_cfft_radix8_stage_q31(pSrc, fftLen, subLen, pCoef, shift, re, im);
+    subLen >>= 3U;
+    shift = 3U;
+  }
+}
 
-        l = i + n2;
-        xt = (pSrc[2 * i] >> 2) - (pSrc[2 * l] >> 2);
-        pSrc[2 * i] = (pSrc[2 * i] >> 2) + (pSrc[2 * l] >> 2);
+/**
+* @ingroup groupTransforms
+*/
 
-        yt = (pSrc[2 * i + 1] >> 2) - (pSrc[2 * l + 1] >> 2);
-        pSrc[2 * i + 1] = (pSrc[2 * l + 1] >> 2) + (pSrc[2 * i + 1] >> 2);
+/**
+* @addtogroup ComplexFFT
+* @{
+*/
 
-        mult_32x32_keep32_R(p0, xt, cosVal);
-        mult_32x32_keep32_R(p1, yt, cosVal);
-        multSub_32x32_keep32_R(p0, yt, sinVal);
-        multAcc_32x32_keep32_R(p1, xt, sinVal);
+/**
+* @details
+* @brief       Processing function for the fixed-point complex FFT in Q31 format.
+* @param[in]      *S    points to an instance of the fixed-point CFFT structure.
+* @param[in, out] *p1   points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+* @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+* @param[in]     bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
+* @return none.
+*/
 
-        pSrc[2U * l] = p0 << 1;
-        pSrc[2U * l + 1U] = p1 << 1;
+void arm_cfft_q31(
+    const arm_cfft_instance_q31 * S,
+    q31_t * p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag)
+{
+    uint32_t L = S->fftLen;
 
+    if (ifftFlag == 1U)
+    {
+        arm_cfft_mixed_radix_q31(p1, L, S->pTwiddle, 1U, 0U);
     }
-
-    // first col
-    arm_radix4_butterfly_inverse_q31( pSrc, n2, (q31_t*)pCoef, 2U);
-    // second col
-    arm_radix4_butterfly_inverse_q31( pSrc + fftLen, n2, (q31_t*)pCoef, 2U);
-
-    for (i = 0; i < fftLen >> 1; i++)
+    else
     {
-        p0 = pSrc[4*i+0];
-        p1 = pSrc[4*i+1];
-        xt = pSrc[4*i+2];
-        yt = pSrc[4*i+3];
-
-        p0 <<= 1;
-        p1 <<= 1;
-        xt <<= 1;
-        yt <<= 1;
-
-        pSrc[4*i+0] = p0;
-        pSrc[4*i+1] = p1;
-        pSrc[4*i+2] = xt;
-        pSrc[4*i+3] = yt;
+        arm_cfft_mixed_radix_q31(p1, L, S->pTwiddle, 0U, 1U);
     }
+
+    arm_cfft_radix2_last_q31(p1, L, bitReverseFlag);
 }
 
+/**
+* @} end of ComplexFFT group
+*/
@@ -0,0 +1,502 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "critical_profiler.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+#if ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 )
+	#include <stdio.h>
+#endif
+
+/* This entire source file will be skipped if the application is not configured
+to include the critical section profiler.  This #if is closed at the very bottom
+of this file.  If you want to include the profiler then ensure
+configUSE_CRITICAL_SECTION_PROFILER is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_CRITICAL_SECTION_PROFILER == 1 )
+
+/* Misc definitions. */
+#define cpSITE_INDEX_MASK		( ( UBaseType_t ) configCRITICAL_PROFILER_MAX_SITES - 1U )
+#define cpHASH_MULTIPLIER		( ( uint32_t ) 0x9e3779b1UL )
+
+/* The longest line written by vCriticalProfilerGetTable(): the name, count,
+max, mean and held columns, then one column per histogram bucket. */
+#define cpMAX_LINE_LENGTH		( 60 + ( 11 * configCRITICAL_PROFILER_HISTOGRAM_BUCKETS ) )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Adds one sample of ulCycles cycles to *pxStats.
+ */
+static void prvRecordSample( CriticalProfilerStats_t * const pxStats, uint32_t ulCycles ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the table entry used for pvCallSite, claiming a free entry if
+ * pvCallSite has not been seen before.  Returns the overflow entry if the
+ * table is full.
+ */
+static CriticalProfilerSiteStatus_t *prvGetSite( const void *pvCallSite ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 )
+
+	/*
+	 * Formats one line of the table into pcLine.
+	 */
+	static void prvFormatLine( char *pcLine, const char *pcName, const CriticalProfilerStats_t * const pxStats, uint32_t ulIRQsHeldOff, BaseType_t xShowHeldOff ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*-----------------------------------------------------------*/
+
+/* The call sites, in an open addressed hash table keyed on the call site
+address.  Entries are never removed, other than by vCriticalProfilerReset(),
+so a lookup stops at the first unused entry. */
+PRIVILEGED_DATA static CriticalProfilerSiteStatus_t xSites[ configCRITICAL_PROFILER_MAX_SITES ];
+
+/* Samples from call sites that did not fit in xSites. */
+PRIVILEGED_DATA static CriticalProfilerSiteStatus_t xOverflowSite;
+
+/* The interrupt latency statistics, indexed by latency source. */
+PRIVILEGED_DATA static CriticalProfilerStats_t xLatencies[ cpLATENCY_SOURCES ];
+
+/* The interrupts watched for latency.  Watched interrupt n is latency source
+n + 1. */
+PRIVILEGED_DATA static int32_t lWatchedIRQs[ configCRITICAL_PROFILER_WATCHED_IRQS ];
+PRIVILEGED_DATA static volatile UBaseType_t uxWatchedIRQs = 0U;
+
+/* The critical section that is currently open.  Critical sections that mask
+interrupts cannot interleave, so one is enough. */
+PRIVILEGED_DATA static const void *pvOpenCallSite = NULL;
+PRIVILEGED_DATA static uint32_t ulOpenStartCycles = 0UL;
+
+/*-----------------------------------------------------------*/
+
+void vCriticalProfilerSectionEnter( const void *pvCallSite )
+{
+	pvOpenCallSite = pvCallSite;
+
+	/* Read the cycle counter last so the time spent recording is not counted
+	as part of the critical section. */
+	ulOpenStartCycles = portCRITICAL_PROFILER_GET_CYCLES();
+}
+/*-----------------------------------------------------------*/
+
+void vCriticalProfilerSectionExit( void )
+{
+const uint32_t ulCycles = portCRITICAL_PROFILER_GET_CYCLES() - ulOpenStartCycles;
+CriticalProfilerSiteStatus_t *pxSite;
+UBaseType_t ux;
+
+	pxSite = prvGetSite( pvOpenCallSite );
+	prvRecordSample( &( pxSite->xStats ), ulCycles );
+
+	/* A watched interrupt that is pending now became pending at some point
+	during the critical section, so was held off for at most ulCycles. */
+	for( ux = 0U; ux < uxWatchedIRQs; ux++ )
+	{
+		if( portCRITICAL_PROFILER_IRQ_PENDING( lWatchedIRQs[ ux ] ) != pdFALSE )
+		{
+			( pxSite->ulIRQsHeldOff )++;
+			prvRecordSample( &( xLatencies[ ux + 1U ] ), ulCycles );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vCriticalProfilerRecordLatency( UBaseType_t uxSource, uint32_t ulCycles )
+{
+	configASSERT( uxSource < cpLATENCY_SOURCES );
+	prvRecordSample( &( xLatencies[ uxSource ] ), ulCycles );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xCriticalProfilerWatchIRQ( int32_t lIRQNumber )
+{
+BaseType_t xReturn = -1;
+
+	configASSERT( lIRQNumber >= 0 );
+
+	taskENTER_CRITICAL();
+	{
+		if( uxWatchedIRQs < ( UBaseType_t ) configCRITICAL_PROFILER_WATCHED_IRQS )
+		{
+			lWatchedIRQs[ uxWatchedIRQs ] = lIRQNumber;
+			uxWatchedIRQs++;
+			xReturn = ( BaseType_t ) uxWatchedIRQs;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxCriticalProfilerGetSites( CriticalProfilerSiteStatus_t *pxSiteStatusArray, UBaseType_t uxArraySize )
+{
+UBaseType_t ux, uxReturn = 0U;
+
+	configASSERT( pxSiteStatusArray );
+
+	/* Each site is copied in its own critical section to keep the time
+	interrupts are masked short. */
+	for( ux = 0U; ( ux < ( UBaseType_t ) configCRITICAL_PROFILER_MAX_SITES ) && ( uxReturn < uxArraySize ); ux++ )
+	{
+		taskENTER_CRITICAL();
+		{
+			if( xSites[ ux ].pvCallSite != NULL )
+			{
+				pxSiteStatusArray[ uxReturn ] = xSites[ ux ];
+				uxReturn++;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+
+	if( uxReturn < uxArraySize )
+	{
+		taskENTER_CRITICAL();
+		{
+			if( xOverflowSite.xStats.ulCount != 0UL )
+			{
+				pxSiteStatusArray[ uxReturn ] = xOverflowSite;
+				uxReturn++;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vCriticalProfilerGetLatency( UBaseType_t uxSource, CriticalProfilerStats_t *pxStats )
+{
+	configASSERT( uxSource < cpLATENCY_SOURCES );
+	configASSERT( pxStats );
+
+	taskENTER_CRITICAL();
+	{
+		*pxStats = xLatencies[ uxSource ];
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vCriticalProfilerReset( void )
+{
+	taskENTER_CRITICAL();
+	{
+		/* The critical section entered above is recorded when it exits, after
+		the tables have been cleared. */
+		memset( ( void * ) xSites, 0x00, sizeof( xSites ) );
+		memset( ( void * ) &xOverflowSite, 0x00, sizeof( xOverflowSite ) );
+		memset( ( void * ) xLatencies, 0x00, sizeof( xLatencies ) );
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+static void prvRecordSample( CriticalProfilerStats_t * const pxStats, uint32_t ulCycles )
+{
+UBaseType_t uxBucket;
+
+	( pxStats->ulCount )++;
+	pxStats->ullTotalCycles += ( uint64_t ) ulCycles;
+
+	if( ulCycles > pxStats->ulMaxCycles )
+	{
+		pxStats->ulMaxCycles = ulCycles;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	for( uxBucket = 0U; uxBucket < ( UBaseType_t ) ( configCRITICAL_PROFILER_HISTOGRAM_BUCKETS - 1 ); uxBucket++ )
+	{
+		if( ( ulCycles >> ( uxBucket + ( UBaseType_t ) configCRITICAL_PROFILER_HISTOGRAM_SHIFT ) ) == 0UL )
+		{
+			break;
+		}
+	}
+
+	( pxStats->ulHistogram[ uxBucket ] )++;
+}
+/*-----------------------------------------------------------*/
+
+static CriticalProfilerSiteStatus_t *prvGetSite( const void *pvCallSite )
+{
+CriticalProfilerSiteStatus_t *pxReturn = &xOverflowSite;
+UBaseType_t uxIndex, uxProbes;
+
+	/* Thumb addresses are at least two byte aligned, so the lowest bit carries
+	no information. */
+	uxIndex = ( UBaseType_t ) ( ( ( ( uint32_t ) ( portPOINTER_SIZE_TYPE ) pvCallSite >> 1UL ) * cpHASH_MULTIPLIER ) >> 16UL );
+
+	for( uxProbes = 0U; uxProbes < ( UBaseType_t ) configCRITICAL_PROFILER_MAX_SITES; uxProbes++ )
+	{
+		uxIndex &= cpSITE_INDEX_MASK;
+
+		if( xSites[ uxIndex ].pvCallSite == pvCallSite )
+		{
+			pxReturn = &( xSites[ uxIndex ] );
+			break;
+		}
+		else if( xSites[ uxIndex ].pvCallSite == NULL )
+		{
+			xSites[ uxIndex ].pvCallSite = pvCallSite;
+			pxReturn = &( xSites[ uxIndex ] );
+			break;
+		}
+		else
+		{
+			uxIndex++;
+		}
+	}
+
+	return pxReturn;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 )
+
+	void vCriticalProfilerGetTable( char *pcWriteBuffer, size_t xBufferLength )
+	{
+	char cLine[ cpMAX_LINE_LENGTH ], cName[ 16 ];
+	uint8_t ucPrinted[ configCRITICAL_PROFILER_MAX_SITES ];
+	CriticalProfilerStats_t xStats;
+	CriticalProfilerSiteStatus_t xSite;
+	UBaseType_t ux, uxNext;
+	size_t xUsed = 0, xLength;
+	BaseType_t xLineNumber = 0, xMoreLines = pdTRUE;
+
+		/*
+		 * PLEASE NOTE:
+		 *
+		 * This function is provided for convenience only, and is used by many
+		 * of the demo applications.  Do not consider it to be part of the
+		 * scheduler.
+		 *
+		 * vCriticalProfilerGetTable() has a dependency on the sprintf() C
+		 * library function that might bloat the code size, use a lot of stack,
+		 * and provide different results on different platforms.
+		 */
+
+		configASSERT( pcWriteBuffer );
+		memset( ( void * ) ucPrinted, 0x00, sizeof( ucPrinted ) );
+
+		if( xBufferLength > 0 )
+		{
+			*pcWriteBuffer = ( char ) 0x00;
+		}
+
+		/* Lines are generated one at a time, the header first, then the
+		latency sources, then the call sites in order of their longest critical
+		section, then the sites that did not fit in the table. */
+		while( xMoreLines != pdFALSE )
+		{
+			if( xLineNumber == 0 )
+			{
+				sprintf( cLine, "%-12s %-10s %-10s %-10s %-5s Histogram\r\n", "Source/Site", "Count", "Max", "Mean", "Held" );
+			}
+			else if( xLineNumber <= ( BaseType_t ) cpLATENCY_SOURCES )
+			{
+				ux = ( UBaseType_t ) xLineNumber - 1U;
+				vCriticalProfilerGetLatency( ux, &xStats );
+
+				if( ux == cpLATENCY_SOURCE_TICK )
+				{
+					sprintf( cName, "tick" );
+				}
+				else if( ux <= uxWatchedIRQs )
+				{
+					sprintf( cName, "IRQ%ld", ( long ) lWatchedIRQs[ ux - 1U ] );
+				}
+				else
+				{
+					/* Not watched, so there is nothing to print. */
+					cName[ 0 ] = ( char ) 0x00;
+				}
+
+				if( cName[ 0 ] != ( char ) 0x00 )
+				{
+					prvFormatLine( cLine, cName, &xStats, 0UL, pdFALSE );
+				}
+				else
+				{
+					cLine[ 0 ] = ( char ) 0x00;
+				}
+			}
+			else
+			{
+				/* Find the unprinted site with the longest critical section.
+				ulMaxCycles is read without a critical section as only the
+				order of the lines depends on it. */
+				uxNext = ( UBaseType_t ) configCRITICAL_PROFILER_MAX_SITES;
+
+				for( ux = 0U; ux < ( UBaseType_t ) configCRITICAL_PROFILER_MAX_SITES; ux++ )
+				{
+					if( ( ucPrinted[ ux ] == 0U ) && ( xSites[ ux ].pvCallSite != NULL ) )
+					{
+						if( ( uxNext == ( UBaseType_t ) configCRITICAL_PROFILER_MAX_SITES ) || ( xSites[ ux ].xStats.ulMaxCycles > xSites[ uxNext ].xStats.ulMaxCycles ) )
+						{
+							uxNext = ux;
+						}
+					}
+				}
+
+				if( uxNext < ( UBaseType_t ) configCRITICAL_PROFILER_MAX_SITES )
+				{
+					ucPrinted[ uxNext ] = 1U;
+
+					taskENTER_CRITICAL();
+					{
+						xSite = xSites[ uxNext ];
+					}
+					taskEXIT_CRITICAL();
+
+					sprintf( cName, "0x%08lx", ( unsigned long ) ( portPOINTER_SIZE_TYPE ) xSite.pvCallSite );
+					prvFormatLine( cLine, cName, &( xSite.xStats ), xSite.ulIRQsHeldOff, pdTRUE );
+				}
+				else
+				{
+					taskENTER_CRITICAL();
+					{
+						xSite = xOverflowSite;
+					}
+					taskEXIT_CRITICAL();
+
+					if( xSite.xStats.ulCount != 0UL )
+					{
+						prvFormatLine( cLine, "other", &( xSite.xStats ), xSite.ulIRQsHeldOff, pdTRUE );
+					}
+					else
+					{
+						cLine[ 0 ] = ( char ) 0x00;
+					}
+
+					xMoreLines = pdFALSE;
+				}
+			}
+
+			xLineNumber++;
+
+			/* Only whole lines are written. */
+			xLength = strlen( cLine );
+
+			if( ( xUsed + xLength ) < xBufferLength )
+			{
+				memcpy( ( void * ) &( pcWriteBuffer[ xUsed ] ), ( const void * ) cLine, xLength + 1U );
+				xUsed += xLength;
+			}
+			else
+			{
+				xMoreLines = pdFALSE;
+			}
+		}
+	}
+
+#endif /* configUSE_STATS_FORMATTING_FUNCTIONS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 )
+
+	static void prvFormatLine( char *pcLine, const char *pcName, const CriticalProfilerStats_t * const pxStats, uint32_t ulIRQsHeldOff, BaseType_t xShowHeldOff )
+	{
+	uint32_t ulMean = 0UL;
+	UBaseType_t uxBucket;
+
+		if( pxStats->ulCount != 0UL )
+		{
+			ulMean = ( uint32_t ) ( pxStats->ullTotalCycles / ( uint64_t ) pxStats->ulCount );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		pcLine += sprintf( pcLine, "%-12s %-10lu %-10lu %-10lu ", pcName, ( unsigned long ) pxStats->ulCount, ( unsigned long ) pxStats->ulMaxCycles, ( unsigned long ) ulMean );
+
+		if( xShowHeldOff != pdFALSE )
+		{
+			pcLine += sprintf( pcLine, "%-5lu", ( unsigned long ) ulIRQsHeldOff );
+		}
+		else
+		{
+			pcLine += sprintf( pcLine, "%-5s", "-" );
+		}
+
+		for( uxBucket = 0U; uxBucket < ( UBaseType_t ) configCRITICAL_PROFILER_HISTOGRAM_BUCKETS; uxBucket++ )
+		{
+			pcLine += sprintf( pcLine, " %lu", ( unsigned long ) pxStats->ulHistogram[ uxBucket ] );
+		}
+
+		sprintf( pcLine, "\r\n" );
+	}
+
+#endif /* configUSE_STATS_FORMATTING_FUNCTIONS */
+
+/* This entire source file will be skipped if the application is not configured
+to include the critical section profiler.  This #if is closed at the very bottom
+of this file.  If you want to include the profiler then ensure
+configUSE_CRITICAL_SECTION_PROFILER is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_CRITICAL_SECTION_PROFILER == 1 */
@@ -0,0 +1,455 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "atomic.h"
+#include "deferred_work.h"
+
+#if ( configUSE_DEFERRED_WORK == 1 ) && ( configUSE_TASK_NOTIFICATIONS != 1 )
+	#error configUSE_TASK_NOTIFICATIONS must be set to 1 to use deferred work.
+#endif
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+
+/* This entire source file will be skipped if the application is not configured
+to include deferred work functionality. */
+#if ( configUSE_DEFERRED_WORK == 1 )
+
+/* Misc definitions. */
+#define dwINDEX_MASK			( ( uint32_t ) configDEFERRED_WORK_QUEUE_LENGTH - 1UL )
+#define dwWORKER_NOT_NOTIFIED	( ( uint32_t ) 0UL )
+#define dwWORKER_NOTIFIED		( ( uint32_t ) 1UL )
+
+#ifndef configDEFERRED_WORK_TASK_NAME
+	#define configDEFERRED_WORK_TASK_NAME "DWork"
+#endif
+
+/* A slot in a level's ring.  ulSequence implements the ring without locks:
+a slot can be claimed by the poster whose position equals ulSequence, and can
+be processed by the worker once ulSequence equals the position plus one. */
+typedef struct xDEFERRED_WORK_ITEM
+{
+	volatile uint32_t ulSequence;
+	PendedFunction_t pxFunction;
+	void *pvParameter1;
+	uint32_t ulParameter2;
+	uint32_t ulTimestamp;		/* When the item was posted. */
+} DeferredWorkItem_t;
+
+/* The ring, worker and statistics for one deferred work level. */
+typedef struct xDEFERRED_WORK_LEVEL
+{
+	volatile uint32_t ulPostPosition;		/* Free running count of the items claimed by posters.  Only updated by compare and swap. */
+	uint32_t ulProcessPosition;				/* Free running count of the items processed.  Only accessed by the worker. */
+	volatile uint32_t ulWorkerNotified;		/* dwWORKER_NOTIFIED if a poster has notified the worker since the worker last started draining the ring. */
+	volatile uint32_t ulOverflows;
+	uint32_t ulPostPositionAtReset;			/* Used to derive the posted count from ulPostPosition. */
+	uint32_t ulOverflowsAtReset;
+	uint32_t ulProcessed;
+	uint32_t ulMaxLatency;
+	uint32_t ulLatencyHistogram[ configDEFERRED_WORK_HISTOGRAM_BUCKETS ];
+	TaskHandle_t xWorkerHandle;
+	DeferredWorkItem_t xItems[ configDEFERRED_WORK_QUEUE_LENGTH ];
+} DeferredWorkLevel_t;
+
+/*lint -save -e956 A manual analysis and inspection has been used to determine
+which static variables must be declared volatile. */
+
+PRIVILEGED_DATA static DeferredWorkLevel_t xLevels[ configDEFERRED_WORK_LEVELS ];
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+	PRIVILEGED_DATA static StaticTask_t xWorkerTCBs[ configDEFERRED_WORK_LEVELS ];
+	PRIVILEGED_DATA static StackType_t xWorkerStacks[ configDEFERRED_WORK_LEVELS ][ configDEFERRED_WORK_TASK_STACK_DEPTH ];
+#endif
+
+/*lint -restore */
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The worker task for a level.  pvParameters points to the level's
+ * DeferredWorkLevel_t structure.
+ */
+static void prvDeferredWorkTask( void *pvParameters ) PRIVILEGED_FUNCTION;
+
+/*
+ * Processes up to configDEFERRED_WORK_BATCH_SIZE items from a level's ring,
+ * returning the number processed.
+ */
+static UBaseType_t prvProcessBatch( DeferredWorkLevel_t * const pxLevel ) PRIVILEGED_FUNCTION;
+
+/*
+ * Claims a slot in a level's ring and fills it in.  Sets *pxNotifyWorker to
+ * pdTRUE if the caller must notify the level's worker.
+ */
+static BaseType_t prvPostItem( DeferredWorkLevel_t * const pxLevel, PendedFunction_t xFunctionToPend, void *pvParameter1, uint32_t ulParameter2, BaseType_t * const pxNotifyWorker ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+BaseType_t xDeferredWorkStart( void )
+{
+BaseType_t xReturn = pdPASS;
+UBaseType_t uxLevel;
+uint32_t ulSlot;
+
+	for( uxLevel = 0; uxLevel < ( UBaseType_t ) configDEFERRED_WORK_LEVELS; uxLevel++ )
+	{
+		/* Must not be started twice. */
+		configASSERT( xLevels[ uxLevel ].xWorkerHandle == NULL );
+
+		for( ulSlot = 0; ulSlot < ( uint32_t ) configDEFERRED_WORK_QUEUE_LENGTH; ulSlot++ )
+		{
+			xLevels[ uxLevel ].xItems[ ulSlot ].ulSequence = ulSlot;
+		}
+
+		#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+		{
+			if( xTaskCreate( prvDeferredWorkTask,
+							 configDEFERRED_WORK_TASK_NAME,
+							 configDEFERRED_WORK_TASK_STACK_DEPTH,
+							 ( void * ) &( xLevels[ uxLevel ] ),
+							 ( ( UBaseType_t ) configDEFERRED_WORK_TASK_PRIORITY + uxLevel ) | portPRIVILEGE_BIT,
+							 &( xLevels[ uxLevel ].xWorkerHandle ) ) != pdPASS )
+			{
+				xReturn = pdFAIL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#else
+		{
+			xLevels[ uxLevel ].xWorkerHandle = xTaskCreateStatic( prvDeferredWorkTask,
+																  configDEFERRED_WORK_TASK_NAME,
+																  configDEFERRED_WORK_TASK_STACK_DEPTH,
+																  ( void * ) &( xLevels[ uxLevel ] ),
+																  ( ( UBaseType_t ) configDEFERRED_WORK_TASK_PRIORITY + uxLevel ) | portPRIVILEGE_BIT,
+																  xWorkerStacks[ uxLevel ],
+																  &( xWorkerTCBs[ uxLevel ] ) );
+
+			if( xLevels[ uxLevel ].xWorkerHandle == NULL )
+			{
+				xReturn = pdFAIL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+	}
+
+	configASSERT( xReturn );
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xDeferredWorkPostFromISR( UBaseType_t uxLevel, PendedFunction_t xFunctionToPend, void *pvParameter1, uint32_t ulParameter2, BaseType_t *pxHigherPriorityTaskWoken )
+{
+BaseType_t xReturn, xNotifyWorker;
+
+	configASSERT( uxLevel < ( UBaseType_t ) configDEFERRED_WORK_LEVELS );
+
+	xReturn = prvPostItem( &( xLevels[ uxLevel ] ), xFunctionToPend, pvParameter1, ulParameter2, &xNotifyWorker );
+
+	if( xNotifyWorker != pdFALSE )
+	{
+		vTaskNotifyGiveFromISR( xLevels[ uxLevel ].xWorkerHandle, pxHigherPriorityTaskWoken );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xDeferredWorkPost( UBaseType_t uxLevel, PendedFunction_t xFunctionToPend, void *pvParameter1, uint32_t ulParameter2 )
+{
+BaseType_t xReturn, xNotifyWorker;
+
+	configASSERT( uxLevel < ( UBaseType_t ) configDEFERRED_WORK_LEVELS );
+
+	xReturn = prvPostItem( &( xLevels[ uxLevel ] ), xFunctionToPend, pvParameter1, ulParameter2, &xNotifyWorker );
+
+	if( xNotifyWorker != pdFALSE )
+	{
+		( void ) xTaskNotifyGive( xLevels[ uxLevel ].xWorkerHandle );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vDeferredWorkGetStats( UBaseType_t uxLevel, DeferredWorkStats_t *pxStats )
+{
+DeferredWorkLevel_t * const pxLevel = &( xLevels[ uxLevel ] );
+
+	configASSERT( uxLevel < ( UBaseType_t ) configDEFERRED_WORK_LEVELS );
+	configASSERT( pxStats );
+
+	/* The worker updates its statistics inside a critical section once per
+	batch, so the copy is consistent. */
+	taskENTER_CRITICAL();
+	{
+		pxStats->ulPosted = pxLevel->ulPostPosition - pxLevel->ulPostPositionAtReset;
+		pxStats->ulOverflows = pxLevel->ulOverflows - pxLevel->ulOverflowsAtReset;
+		pxStats->ulProcessed = pxLevel->ulProcessed;
+		pxStats->ulMaxLatency = pxLevel->ulMaxLatency;
+		memcpy( ( void * ) pxStats->ulLatencyHistogram, ( const void * ) pxLevel->ulLatencyHistogram, sizeof( pxStats->ulLatencyHistogram ) );
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vDeferredWorkResetStats( UBaseType_t uxLevel )
+{
+DeferredWorkLevel_t * const pxLevel = &( xLevels[ uxLevel ] );
+
+	configASSERT( uxLevel < ( UBaseType_t ) configDEFERRED_WORK_LEVELS );
+
+	taskENTER_CRITICAL();
+	{
+		/* ulPostPosition and ulOverflows are updated by posters without
+		entering a critical section, so are never written here. */
+		pxLevel->ulPostPositionAtReset = pxLevel->ulPostPosition;
+		pxLevel->ulOverflowsAtReset = pxLevel->ulOverflows;
+		pxLevel->ulProcessed = 0;
+		pxLevel->ulMaxLatency = 0;
+		memset( ( void * ) pxLevel->ulLatencyHistogram, 0x00, sizeof( pxLevel->ulLatencyHistogram ) );
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvPostItem( DeferredWorkLevel_t * const pxLevel, PendedFunction_t xFunctionToPend, void *pvParameter1, uint32_t ulParameter2, BaseType_t * const pxNotifyWorker )
+{
+DeferredWorkItem_t *pxItem;
+uint32_t ulPosition;
+int32_t lDifference;
+BaseType_t xReturn;
+
+	configASSERT( xFunctionToPend );
+	configASSERT( pxLevel->xWorkerHandle );
+
+	*pxNotifyWorker = pdFALSE;
+	ulPosition = pxLevel->ulPostPosition;
+
+	for( ;; )
+	{
+		pxItem = &( pxLevel->xItems[ ulPosition & dwINDEX_MASK ] );
+		lDifference = ( int32_t ) ( pxItem->ulSequence - ulPosition );
+
+		if( lDifference == 0 )
+		{
+			/* The slot is free.  Claim it, unless another poster claimed it
+			first. */
+			if( ulAtomicCompareAndSwap( &( pxLevel->ulPostPosition ), ulPosition + 1UL, ulPosition ) == atomicCOMPARE_AND_SWAP_SUCCESS )
+			{
+				xReturn = pdPASS;
+				break;
+			}
+			else
+			{
+				ulPosition = pxLevel->ulPostPosition;
+			}
+		}
+		else if( lDifference < 0 )
+		{
+			/* The slot has not yet been processed since the ring last wrapped,
+			so the ring is full. */
+			( void ) ulAtomicAdd( &( pxLevel->ulOverflows ), 1UL );
+			xReturn = pdFAIL;
+			break;
+		}
+		else
+		{
+			/* Another poster claimed the slot since ulPostPosition was
+			read. */
+			ulPosition = pxLevel->ulPostPosition;
+		}
+	}
+
+	if( xReturn == pdPASS )
+	{
+		pxItem->pxFunction = xFunctionToPend;
+		pxItem->pvParameter1 = pvParameter1;
+		pxItem->ulParameter2 = ulParameter2;
+		pxItem->ulTimestamp = configDEFERRED_WORK_GET_TIMESTAMP();
+
+		/* Publish the item to the worker. */
+		portMEMORY_BARRIER();
+		pxItem->ulSequence = ulPosition + 1UL;
+		portMEMORY_BARRIER();
+
+		/* Only the first poster since the worker started draining the ring
+		needs to notify it. */
+		if( ulAtomicCompareAndSwap( &( pxLevel->ulWorkerNotified ), dwWORKER_NOTIFIED, dwWORKER_NOT_NOTIFIED ) == atomicCOMPARE_AND_SWAP_SUCCESS )
+		{
+			*pxNotifyWorker = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvProcessBatch( DeferredWorkLevel_t * const pxLevel )
+{
+DeferredWorkItem_t *pxItem;
+PendedFunction_t pxFunction;
+void *pvParameter1;
+uint32_t ulParameter2, ulLatency, ulMaxLatency = 0, ulBucket;
+uint32_t ulLatencyHistogram[ configDEFERRED_WORK_HISTOGRAM_BUCKETS ];
+UBaseType_t uxProcessed;
+
+	memset( ( void * ) ulLatencyHistogram, 0x00, sizeof( ulLatencyHistogram ) );
+
+	for( uxProcessed = 0; uxProcessed < ( UBaseType_t ) configDEFERRED_WORK_BATCH_SIZE; uxProcessed++ )
+	{
+		pxItem = &( pxLevel->xItems[ pxLevel->ulProcessPosition & dwINDEX_MASK ] );
+
+		if( pxItem->ulSequence != ( pxLevel->ulProcessPosition + 1UL ) )
+		{
+			/* The ring is empty, or the oldest item is still being posted. */
+			break;
+		}
+
+		portMEMORY_BARRIER();
+		pxFunction = pxItem->pxFunction;
+		pvParameter1 = pxItem->pvParameter1;
+		ulParameter2 = pxItem->ulParameter2;
+		ulLatency = configDEFERRED_WORK_GET_TIMESTAMP() - pxItem->ulTimestamp;
+
+		/* Return the slot to the posters before calling the function, so the
+		function can post to the same level. */
+		portMEMORY_BARRIER();
+		pxItem->ulSequence = pxLevel->ulProcessPosition + ( uint32_t ) configDEFERRED_WORK_QUEUE_LENGTH;
+		pxLevel->ulProcessPosition++;
+
+		for( ulBucket = 0; ulBucket < ( ( uint32_t ) configDEFERRED_WORK_HISTOGRAM_BUCKETS - 1UL ); ulBucket++ )
+		{
+			if( ( ulLatency >> ulBucket ) == 0UL )
+			{
+				break;
+			}
+		}
+
+		ulLatencyHistogram[ ulBucket ]++;
+
+		if( ulLatency > ulMaxLatency )
+		{
+			ulMaxLatency = ulLatency;
+		}
+
+		pxFunction( pvParameter1, ulParameter2 );
+	}
+
+	if( uxProcessed != ( UBaseType_t ) 0 )
+	{
+		/* Statistics are committed once per batch to keep the cost per item
+		low. */
+		taskENTER_CRITICAL();
+		{
+			pxLevel->ulProcessed += ( uint32_t ) uxProcessed;
+
+			if( ulMaxLatency > pxLevel->ulMaxLatency )
+			{
+				pxLevel->ulMaxLatency = ulMaxLatency;
+			}
+
+			for( ulBucket = 0; ulBucket < ( uint32_t ) configDEFERRED_WORK_HISTOGRAM_BUCKETS; ulBucket++ )
+			{
+				pxLevel->ulLatencyHistogram[ ulBucket ] += ulLatencyHistogram[ ulBucket ];
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return uxProcessed;
+}
+/*-----------------------------------------------------------*/
+
+static void prvDeferredWorkTask( void *pvParameters )
+{
+DeferredWorkLevel_t * const pxLevel = ( DeferredWorkLevel_t * ) pvParameters;
+
+	for( ;; )
+	{
+		( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+		/* Posts made from now on must notify the worker again, as the ring is
+		only drained until it is found to be empty. */
+		pxLevel->ulWorkerNotified = dwWORKER_NOT_NOTIFIED;
+		portMEMORY_BARRIER();
+
+		while( prvProcessBatch( pxLevel ) == ( UBaseType_t ) configDEFERRED_WORK_BATCH_SIZE )
+		{
+			/* Let other tasks of equal priority run between batches. */
+			taskYIELD();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+to include deferred work functionality.  This #if is closed at the very bottom
+of this file.  If you want to include deferred work then ensure
+configUSE_DEFERRED_WORK is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_DEFERRED_WORK == 1 */
@@ -0,0 +1,219 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+
+/*
+ * The critical section profiler measures how long the kernel keeps interrupts
+ * masked, and how late interrupts are entered as a result.
+ *
+ * + Every outermost critical section - taskENTER_CRITICAL() to
+ *   taskEXIT_CRITICAL(), and taskENTER_CRITICAL_FROM_ISR() to
+ *   taskEXIT_CRITICAL_FROM_ISR() when interrupts were not already masked - is
+ *   timed with the port's cycle counter.  The time is recorded against the
+ *   address of the code that entered the critical section, so the kernel
+ *   paths that mask interrupts for longest can be found.
+ *
+ * + The latency of the tick interrupt, from the SysTick reaching zero to the
+ *   tick handler running, is recorded on every tick.
+ *
+ * + Up to configCRITICAL_PROFILER_WATCHED_IRQS further interrupts, such as a
+ *   UART interrupt, can be watched.  When a critical section ends while a
+ *   watched interrupt is pending the length of the critical section, which is
+ *   the longest the interrupt could have been held off by it, is recorded as a
+ *   latency sample for the interrupt, and counted against the call site.
+ *
+ * Set configUSE_CRITICAL_SECTION_PROFILER to 1 in FreeRTOSConfig.h to build
+ * the profiler.  The port must provide a cycle counter and the other
+ * portCRITICAL_PROFILER_ macros.  Recording a sample takes place with
+ * interrupts still masked, so profiling adds a small fixed time to every
+ * critical section - the reported times do not include it.
+ */
+
+#ifndef CRITICAL_PROFILER_H
+#define CRITICAL_PROFILER_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h must appear in source files before include critical_profiler.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The latency source used for the tick interrupt.  Watched interrupts use the
+sources returned by xCriticalProfilerWatchIRQ(). */
+#define cpLATENCY_SOURCE_TICK		( ( UBaseType_t ) 0U )
+
+/* The number of latency sources, the tick plus the watched interrupts. */
+#define cpLATENCY_SOURCES			( ( UBaseType_t ) ( configCRITICAL_PROFILER_WATCHED_IRQS + 1 ) )
+
+/**
+ * Timing statistics for one call site or latency source.  All times are in
+ * cycles of the port's cycle counter.
+ */
+typedef struct xCRITICAL_PROFILER_STATS
+{
+	uint32_t ulCount;			/* The number of samples. */
+	uint32_t ulMaxCycles;		/* The longest sample. */
+	uint64_t ullTotalCycles;	/* The sum of all the samples, from which the mean can be calculated. */
+	uint32_t ulHistogram[ configCRITICAL_PROFILER_HISTOGRAM_BUCKETS ]; /* Bucket n counts samples shorter than 2^( n + configCRITICAL_PROFILER_HISTOGRAM_SHIFT ) cycles.  The last bucket also counts all longer samples. */
+} CriticalProfilerStats_t;
+
+/**
+ * Used with uxCriticalProfilerGetSites() to obtain the statistics of each
+ * call site that entered a critical section.
+ */
+typedef struct xCRITICAL_PROFILER_SITE_STATUS
+{
+	const void *pvCallSite;		/* The address of the code that entered the critical section, or NULL for the sites that did not fit in the table. */
+	uint32_t ulIRQsHeldOff;		/* The number of times a watched interrupt was pending when a critical section entered from this site ended. */
+	CriticalProfilerStats_t xStats;
+} CriticalProfilerSiteStatus_t;
+
+/**
+ * critical_profiler.h
+ * <pre>
+ * BaseType_t xCriticalProfilerWatchIRQ( int32_t lIRQNumber );
+ * </pre>
+ *
+ * Starts recording the latency that critical sections add to the interrupt
+ * lIRQNumber, for example USART1_IRQn.  The interrupt must have a priority at
+ * or below configMAX_SYSCALL_INTERRUPT_PRIORITY, otherwise critical sections
+ * never hold it off.
+ *
+ * @return The latency source used for the interrupt, to be passed to
+ * vCriticalProfilerGetLatency(), or -1 if configCRITICAL_PROFILER_WATCHED_IRQS
+ * interrupts are already being watched.
+ *
+ * \defgroup xCriticalProfilerWatchIRQ xCriticalProfilerWatchIRQ
+ * \ingroup CriticalProfiler
+ */
+BaseType_t xCriticalProfilerWatchIRQ( int32_t lIRQNumber ) PRIVILEGED_FUNCTION;
+
+/**
+ * critical_profiler.h
+ * <pre>
+ * UBaseType_t uxCriticalProfilerGetSites( CriticalProfilerSiteStatus_t *pxSiteStatusArray, UBaseType_t uxArraySize );
+ * </pre>
+ *
+ * Copies the statistics of up to uxArraySize call sites into
+ * pxSiteStatusArray, in no particular order.  At most
+ * configCRITICAL_PROFILER_MAX_SITES + 1 entries are returned, the extra entry
+ * holding the sites that did not fit in the table.
+ *
+ * @return The number of entries written to pxSiteStatusArray.
+ *
+ * \defgroup uxCriticalProfilerGetSites uxCriticalProfilerGetSites
+ * \ingroup CriticalProfiler
+ */
+UBaseType_t uxCriticalProfilerGetSites( CriticalProfilerSiteStatus_t *pxSiteStatusArray, UBaseType_t uxArraySize ) PRIVILEGED_FUNCTION;
+
+/**
+ * critical_profiler.h
+ * <pre>
+ * void vCriticalProfilerGetLatency( UBaseType_t uxSource, CriticalProfilerStats_t *pxStats );
+ * </pre>
+ *
+ * Copies the interrupt latency statistics of uxSource, either
+ * cpLATENCY_SOURCE_TICK or a value returned by xCriticalProfilerWatchIRQ(),
+ * into *pxStats.
+ *
+ * \defgroup vCriticalProfilerGetLatency vCriticalProfilerGetLatency
+ * \ingroup CriticalProfiler
+ */
+void vCriticalProfilerGetLatency( UBaseType_t uxSource, CriticalProfilerStats_t *pxStats ) PRIVILEGED_FUNCTION;
+
+/**
+ * critical_profiler.h
+ * <pre>
+ * void vCriticalProfilerReset( void );
+ * </pre>
+ *
+ * Clears all the recorded statistics.  Watched interrupts remain watched.
+ *
+ * \defgroup vCriticalProfilerReset vCriticalProfilerReset
+ * \ingroup CriticalProfiler
+ */
+void vCriticalProfilerReset( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * critical_profiler.h
+ * <pre>
+ * void vCriticalProfilerGetTable( char *pcWriteBuffer, size_t xBufferLength );
+ * </pre>
+ *
+ * configUSE_STATS_FORMATTING_FUNCTIONS must be defined as 1 for this function
+ * to be available.
+ *
+ * Writes the recorded statistics to pcWriteBuffer as a human readable table,
+ * one line per latency source followed by one line per call site, longest
+ * critical section first:
+ *
+ * <pre>
+ * Source/Site  Count      Max        Mean       Held  Histogram
+ * tick         60000      412        96         -     0 59000 950 50 0 0 0 0
+ * IRQ37        3          1210       1100       -     0 0 0 0 1 2 0 0
+ * 0x08001a3c   1502       1210       350        3     0 0 12 1400 88 2 0 0
+ * </pre>
+ *
+ * Call sites are addresses within the functions that entered the critical
+ * section, and can be looked up in the linker map file.  Output stops when
+ * xBufferLength would be exceeded.  vCriticalProfilerGetTable() calls
+ * sprintf(), so the caller's stack must be large enough.
+ *
+ * \defgroup vCriticalProfilerGetTable vCriticalProfilerGetTable
+ * \ingroup CriticalProfiler
+ */
+void vCriticalProfilerGetTable( char *pcWriteBuffer, size_t xBufferLength ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------
+ * FUNCTIONS CALLED BY THE PORT LAYER ONLY
+ *----------------------------------------------------------*/
+
+/*
+ * Called by the port, with interrupts masked, when an outermost critical
+ * section is entered from pvCallSite.
+ */
+void vCriticalProfilerSectionEnter( const void *pvCallSite ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called by the port, with interrupts still masked, when an outermost
+ * critical section is exited.
+ */
+void vCriticalProfilerSectionExit( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called by the port, with interrupts masked, to record an interrupt latency
+ * measured by the port itself.
+ */
+void vCriticalProfilerRecordLatency( UBaseType_t uxSource, uint32_t ulCycles ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRITICAL_PROFILER_H */
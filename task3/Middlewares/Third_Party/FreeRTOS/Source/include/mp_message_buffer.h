@@ -0,0 +1,319 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * Multi-producer message buffers are used to send variable length discrete
+ * messages from any number of tasks and interrupts to a single reading task.
+ * They are intended for scenarios, such as logging, in which many contexts
+ * write short records that are drained by one low priority task.
+ *
+ * Unlike message buffers (see message_buffer.h), which assume a single writer,
+ * any number of tasks and interrupts can write to a multi-producer message
+ * buffer concurrently.  Space for each message is reserved using an atomic
+ * compare and swap on the buffer's head index (see atomic.h), after which the
+ * writer copies its message into the reserved space without holding any lock.
+ * A writer therefore never blocks, and never disables interrupts for longer
+ * than the compare and swap takes (which, on ports that define
+ * portATOMIC_COMPARE_AND_SWAP_U32(), is not at all).  If there is not enough
+ * free space the message is dropped and the buffer's dropped message count is
+ * incremented.
+ *
+ * Messages are stored in the order in which their space was reserved, and are
+ * read in that order.  If a writer is preempted between reserving space and
+ * completing its copy then the reader waits for that message to be completed
+ * before reading any messages written after it.
+ *
+ * Each message is stored with a 4 byte header, and is padded to a multiple of
+ * 4 bytes.  Messages are never split across the end of the buffer, so a
+ * message may also consume padding that makes the remaining space at the end of
+ * the buffer unusable until the reader has passed it.
+ *
+ * ***NOTE***:  Only one task can read from a multi-producer message buffer.
+ */
+
+#ifndef FREERTOS_MP_MESSAGE_BUFFER_H
+#define FREERTOS_MP_MESSAGE_BUFFER_H
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/**
+ * Type by which multi-producer message buffers are referenced.  For example, a
+ * call to xMPMessageBufferCreate() returns an MPMessageBufferHandle_t variable
+ * that can then be used as a parameter to xMPMessageBufferSend(),
+ * xMPMessageBufferReceive(), etc.
+ */
+typedef void * MPMessageBufferHandle_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * mp_message_buffer.h
+ *
+<pre>
+MPMessageBufferHandle_t xMPMessageBufferCreate( size_t xBufferSizeBytes );
+</pre>
+ *
+ * Creates a new multi-producer message buffer using dynamically allocated
+ * memory.  See xMPMessageBufferCreateStatic() for a version that uses
+ * statically allocated memory.
+ *
+ * configSUPPORT_DYNAMIC_ALLOCATION must be set to 1 or left undefined in
+ * FreeRTOSConfig.h for xMPMessageBufferCreate() to be available.
+ *
+ * @param xBufferSizeBytes The total number of bytes (not messages) the buffer
+ * will be able to hold at any one time.  Must be a power of two, and at least
+ * 8.  Each message requires its length rounded up to a multiple of 4, plus 4
+ * bytes for its header.
+ *
+ * @return If NULL is returned, then the buffer cannot be created because there
+ * is insufficient heap memory available for FreeRTOS to allocate the buffer's
+ * data structures and storage area.  A non-NULL value being returned indicates
+ * that the buffer has been created successfully - the returned value should be
+ * stored as the handle to the created buffer.
+ *
+ * \defgroup xMPMessageBufferCreate xMPMessageBufferCreate
+ * \ingroup MPMessageBufferManagement
+ */
+MPMessageBufferHandle_t xMPMessageBufferCreate( size_t xBufferSizeBytes ) PRIVILEGED_FUNCTION;
+
+/**
+ * mp_message_buffer.h
+ *
+<pre>
+MPMessageBufferHandle_t xMPMessageBufferCreateStatic( size_t xBufferSizeBytes,
+                                                      uint8_t *pucMessageBufferStorageArea,
+                                                      StaticMPMessageBuffer_t *pxStaticMPMessageBuffer );
+</pre>
+ *
+ * Creates a new multi-producer message buffer using statically allocated
+ * memory.  See xMPMessageBufferCreate() for a version that uses dynamically
+ * allocated memory.
+ *
+ * configSUPPORT_STATIC_ALLOCATION must be set to 1 in FreeRTOSConfig.h for
+ * xMPMessageBufferCreateStatic() to be available.
+ *
+ * @param xBufferSizeBytes The size, in bytes, of the buffer pointed to by the
+ * pucMessageBufferStorageArea parameter.  Must be a power of two, and at least
+ * 8.
+ *
+ * @param pucMessageBufferStorageArea Must point to a uint8_t array that is at
+ * least xBufferSizeBytes big, and that is aligned to a 4 byte boundary.  This
+ * is the array to which messages are copied when they are written to the
+ * buffer.
+ *
+ * @param pxStaticMPMessageBuffer Must point to a variable of type
+ * StaticMPMessageBuffer_t, which will be used to hold the buffer's data
+ * structure.
+ *
+ * @return If the buffer is created successfully then a handle to the created
+ * buffer is returned.  If either pucMessageBufferStorageArea or
+ * pxStaticMPMessageBuffer are NULL then NULL is returned.
+ *
+ * \defgroup xMPMessageBufferCreateStatic xMPMessageBufferCreateStatic
+ * \ingroup MPMessageBufferManagement
+ */
+MPMessageBufferHandle_t xMPMessageBufferCreateStatic( size_t xBufferSizeBytes,
+													  uint8_t * const pucMessageBufferStorageArea,
+													  StaticMPMessageBuffer_t * const pxStaticMPMessageBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * mp_message_buffer.h
+ *
+<pre>
+size_t xMPMessageBufferSend( MPMessageBufferHandle_t xMPMessageBuffer,
+                             const void *pvTxData,
+                             size_t xDataLengthBytes );
+</pre>
+ *
+ * Writes a discrete message to a multi-producer message buffer from a task.
+ * Any number of tasks and interrupts can write to the same buffer at the same
+ * time.  The function never blocks - if there is insufficient free space the
+ * message is dropped and the count returned by
+ * ulMPMessageBufferGetDroppedCount() is incremented.
+ *
+ * Use xMPMessageBufferSendFromISR() to write to a multi-producer message buffer
+ * from an interrupt service routine (ISR).
+ *
+ * @param xMPMessageBuffer The handle of the buffer to which a message is being
+ * sent.
+ *
+ * @param pvTxData A pointer to the message that is to be copied into the
+ * buffer.
+ *
+ * @param xDataLengthBytes The length of the message.  That is, the number of
+ * bytes to copy from pvTxData into the buffer.  Zero length messages are not
+ * permitted.
+ *
+ * @return The number of bytes written to the buffer.  If the message was
+ * dropped then 0 is returned, otherwise xDataLengthBytes is returned.
+ *
+ * \defgroup xMPMessageBufferSend xMPMessageBufferSend
+ * \ingroup MPMessageBufferManagement
+ */
+size_t xMPMessageBufferSend( MPMessageBufferHandle_t xMPMessageBuffer,
+							 const void *pvTxData,
+							 size_t xDataLengthBytes ) PRIVILEGED_FUNCTION;
+
+/**
+ * mp_message_buffer.h
+ *
+<pre>
+size_t xMPMessageBufferSendFromISR( MPMessageBufferHandle_t xMPMessageBuffer,
+                                    const void *pvTxData,
+                                    size_t xDataLengthBytes,
+                                    BaseType_t *pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * Interrupt safe version of the API function that writes a discrete message to
+ * a multi-producer message buffer.
+ *
+ * @param xMPMessageBuffer The handle of the buffer to which a message is being
+ * sent.
+ *
+ * @param pvTxData A pointer to the message that is to be copied into the
+ * buffer.
+ *
+ * @param xDataLengthBytes The length of the message.  Zero length messages are
+ * not permitted.
+ *
+ * @param pxHigherPriorityTaskWoken  It is possible that the reading task is
+ * blocked waiting for data.  Writing a message to the buffer will then cause
+ * the reading task to leave the Blocked state.  If the reading task has a
+ * priority higher than the currently executing task (the task that was
+ * interrupted), then *pxHigherPriorityTaskWoken will be set to pdTRUE
+ * internally, in which case a context switch should be requested before the
+ * interrupt is exited.  *pxHigherPriorityTaskWoken should be initialised to
+ * pdFALSE before it is passed into the function.
+ *
+ * @return The number of bytes written to the buffer.  If the message was
+ * dropped then 0 is returned, otherwise xDataLengthBytes is returned.
+ *
+ * \defgroup xMPMessageBufferSendFromISR xMPMessageBufferSendFromISR
+ * \ingroup MPMessageBufferManagement
+ */
+size_t xMPMessageBufferSendFromISR( MPMessageBufferHandle_t xMPMessageBuffer,
+									const void *pvTxData,
+									size_t xDataLengthBytes,
+									BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * mp_message_buffer.h
+ *
+<pre>
+size_t xMPMessageBufferReceive( MPMessageBufferHandle_t xMPMessageBuffer,
+                                void *pvRxData,
+                                size_t xBufferLengthBytes,
+                                TickType_t xTicksToWait );
+</pre>
+ *
+ * Receives the oldest discrete message from a multi-producer message buffer.
+ * Must only be called from the single task that reads from the buffer.
+ *
+ * @param xMPMessageBuffer The handle of the buffer from which a message is
+ * being received.
+ *
+ * @param pvRxData A pointer to the buffer into which the received message is
+ * to be copied.
+ *
+ * @param xBufferLengthBytes The length of the buffer pointed to by the pvRxData
+ * parameter.  If the next message is longer than xBufferLengthBytes then the
+ * message is left in the buffer and 0 is returned.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for a message, should the buffer be empty, or should
+ * the oldest message still be being written.
+ *
+ * @return The length, in bytes, of the message read from the buffer, if any.
+ * If xMPMessageBufferReceive() times out before a message became available
+ * then zero is returned.
+ *
+ * \defgroup xMPMessageBufferReceive xMPMessageBufferReceive
+ * \ingroup MPMessageBufferManagement
+ */
+size_t xMPMessageBufferReceive( MPMessageBufferHandle_t xMPMessageBuffer,
+								void *pvRxData,
+								size_t xBufferLengthBytes,
+								TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * mp_message_buffer.h
+ *
+<pre>
+BaseType_t xMPMessageBufferIsEmpty( MPMessageBufferHandle_t xMPMessageBuffer );
+</pre>
+ *
+ * Queries a multi-producer message buffer to see if it is empty.  A buffer is
+ * not empty while a message is being written to it.
+ *
+ * @return If the buffer is empty then pdTRUE is returned.  Otherwise pdFALSE
+ * is returned.
+ *
+ * \defgroup xMPMessageBufferIsEmpty xMPMessageBufferIsEmpty
+ * \ingroup MPMessageBufferManagement
+ */
+BaseType_t xMPMessageBufferIsEmpty( MPMessageBufferHandle_t xMPMessageBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * mp_message_buffer.h
+ *
+<pre>
+uint32_t ulMPMessageBufferGetDroppedCount( MPMessageBufferHandle_t xMPMessageBuffer );
+</pre>
+ *
+ * Returns the number of messages that have been dropped because the buffer
+ * did not have enough free space at the time they were sent.
+ *
+ * \defgroup ulMPMessageBufferGetDroppedCount ulMPMessageBufferGetDroppedCount
+ * \ingroup MPMessageBufferManagement
+ */
+uint32_t ulMPMessageBufferGetDroppedCount( MPMessageBufferHandle_t xMPMessageBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * mp_message_buffer.h
+ *
+<pre>
+void vMPMessageBufferDelete( MPMessageBufferHandle_t xMPMessageBuffer );
+</pre>
+ *
+ * Deletes a multi-producer message buffer that was previously created using a
+ * call to xMPMessageBufferCreate() or xMPMessageBufferCreateStatic().  If the
+ * buffer was created using dynamic memory then the memory is freed.
+ *
+ * A buffer handle must not be used after the buffer has been deleted.
+ *
+ * \defgroup vMPMessageBufferDelete vMPMessageBufferDelete
+ * \ingroup MPMessageBufferManagement
+ */
+void vMPMessageBufferDelete( MPMessageBufferHandle_t xMPMessageBuffer ) PRIVILEGED_FUNCTION;
+
+#if defined( __cplusplus )
+} /* extern "C" */
+#endif
+
+#endif	/* !defined( FREERTOS_MP_MESSAGE_BUFFER_H ) */
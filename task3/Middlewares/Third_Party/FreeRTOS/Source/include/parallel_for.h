@@ -0,0 +1,203 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * Parallel loops split the iterations of a compute loop between the calling
+ * task and configPARALLEL_FOR_WORKERS worker tasks:
+ *
+ * + The range of iterations is split recursively, in halves, down to the
+ *   grain size given by the caller.  Each participant keeps the halves it has
+ *   not started yet in its own Chase-Lev deque.  It takes work from the bottom
+ *   of its own deque, and only when that is empty steals from the top of
+ *   another participant's deque, so the largest pieces of work are the ones
+ *   that move between participants and the load balances itself.
+ *
+ * + Taking and stealing work use compare and swap, never a critical section.
+ *
+ * + When configPARALLEL_FOR_WORKERS is 0, which is the default and the right
+ *   setting for a single core microcontroller, no worker tasks are created
+ *   and each loop is executed by a single call to the loop body from the
+ *   calling task.
+ *
+ * Set configUSE_PARALLEL_FOR to 1 in FreeRTOSConfig.h to use parallel loops,
+ * and call xParallelForInit() before the first loop.
+ */
+
+#ifndef PARALLEL_FOR_H
+#define PARALLEL_FOR_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h must appear in source files before include parallel_for.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * The body of a parallel loop.  Executes iterations ulBegin to ulEnd - 1.
+ * Different ranges of the same loop can execute at the same time in
+ * different tasks, so the body must only write data that belongs to its own
+ * iterations.
+ */
+typedef void ( *ParallelForFunction_t )( void *pvContext, uint32_t ulBegin, uint32_t ulEnd );
+
+/*
+ * The body of a parallel reduction.  Executes iterations ulBegin to
+ * ulEnd - 1, accumulating their results into *pvAccumulator.
+ */
+typedef void ( *ParallelReduceFunction_t )( void *pvContext, uint32_t ulBegin, uint32_t ulEnd, void *pvAccumulator );
+
+/*
+ * Combines the partial result *pvPartial into *pvResult.
+ */
+typedef void ( *ParallelCombineFunction_t )( void *pvContext, void *pvResult, const void *pvPartial );
+
+/* The number of chunks vParallelReduce() splits ulIterations iterations
+into.  A grain of 0 is treated as 1, as it is by vParallelReduce(). */
+#define parallelforGRAIN( ulGrain )	( ( ( uint32_t ) ( ulGrain ) == 0UL ) ? 1UL : ( uint32_t ) ( ulGrain ) )
+#define parallelforREDUCE_CHUNKS( ulIterations, ulGrain )	( ( ( uint32_t ) ( ulIterations ) / parallelforGRAIN( ulGrain ) ) + ( ( ( ( uint32_t ) ( ulIterations ) % parallelforGRAIN( ulGrain ) ) != 0UL ) ? 1UL : 0UL ) )
+
+/* The number of bytes vParallelReduce() needs for the partial results of a
+reduction of ulIterations iterations. */
+#define parallelforREDUCE_PARTIALS_SIZE( xPartialSize, ulIterations, ulGrain )	( ( size_t ) ( xPartialSize ) * ( size_t ) parallelforREDUCE_CHUNKS( ( ulIterations ), ( ulGrain ) ) )
+
+/**
+ * parallel_for.h
+ * <pre>
+ * BaseType_t xParallelForInit( void );
+ * </pre>
+ *
+ * Creates the worker tasks, which run at configPARALLEL_FOR_WORKER_PRIORITY.
+ * Must be called once, before the first parallel loop.  Does nothing if
+ * configPARALLEL_FOR_WORKERS is 0.
+ *
+ * @return pdPASS if the worker tasks were created, otherwise pdFAIL.
+ *
+ * \defgroup xParallelForInit xParallelForInit
+ * \ingroup ParallelFor
+ */
+BaseType_t xParallelForInit( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * parallel_for.h
+ * <pre>
+ * void vParallelFor( uint32_t ulBegin,
+ *                    uint32_t ulEnd,
+ *                    uint32_t ulGrain,
+ *                    ParallelForFunction_t pxFunction,
+ *                    void *pvContext );
+ * </pre>
+ *
+ * Executes iterations ulBegin to ulEnd - 1 of a loop, spread over the
+ * calling task and the worker tasks, and returns when all of them have been
+ * executed.  For example, to scale a buffer:
+ *
+ * static void prvScale( void *pvContext, uint32_t ulBegin, uint32_t ulEnd )
+ * {
+ *     float *pfData = ( float * ) pvContext;
+ *
+ *     arm_scale_f32( &pfData[ ulBegin ], 0.5f, &pfData[ ulBegin ], ulEnd - ulBegin );
+ * }
+ *
+ * vParallelFor( 0, 4096, 256, prvScale, pfBuffer );
+ *
+ * Only one loop runs at a time.  A task that calls vParallelFor() while
+ * another task's loop is running waits for it to finish.  A loop started from
+ * inside the body of another loop is executed serially by the task that
+ * started it.
+ *
+ * @param ulBegin The first iteration.
+ *
+ * @param ulEnd One more than the last iteration.
+ *
+ * @param ulGrain Ranges of up to ulGrain iterations are not split further.
+ * Choose a grain large enough that one call to the body costs much more than
+ * taking work from a deque, which is a few hundred cycles.
+ *
+ * @param pxFunction The loop body.
+ *
+ * @param pvContext Passed to each call of the loop body.
+ *
+ * \defgroup vParallelFor vParallelFor
+ * \ingroup ParallelFor
+ */
+void vParallelFor( uint32_t ulBegin, uint32_t ulEnd, uint32_t ulGrain, ParallelForFunction_t pxFunction, void *pvContext ) PRIVILEGED_FUNCTION;
+
+/**
+ * parallel_for.h
+ * <pre>
+ * void vParallelReduce( uint32_t ulBegin,
+ *                       uint32_t ulEnd,
+ *                       uint32_t ulGrain,
+ *                       ParallelReduceFunction_t pxBody,
+ *                       ParallelCombineFunction_t pxCombine,
+ *                       void *pvContext,
+ *                       void *pvResult,
+ *                       void *pvPartials,
+ *                       size_t xPartialSize );
+ * </pre>
+ *
+ * Executes iterations ulBegin to ulEnd - 1 of a reduction, spread over the
+ * calling task and the worker tasks.  The iterations are split into chunks
+ * of ulGrain iterations, counted from ulBegin, and each chunk is accumulated
+ * by one call to the body into its own partial result, which starts as a
+ * copy of the initial value of *pvResult.  When every chunk has been
+ * executed the partial results are combined into *pvResult, in chunk order,
+ * by the calling task.
+ *
+ * The initial value of *pvResult must therefore be the identity of the
+ * combine operation (for example 0 for a sum).  The chunks and the order in
+ * which they are combined depend only on ulBegin, ulEnd and ulGrain, so a
+ * floating point result is the same on every run, whichever task executed
+ * each chunk.
+ *
+ * @param pxBody The reduction body.
+ *
+ * @param pxCombine Combines the partial result of a chunk into *pvResult.
+ *
+ * @param pvResult Holds the identity on entry and the result on return.
+ *
+ * @param pvPartials Storage for the partial results of the chunks, which
+ * must be at least parallelforREDUCE_PARTIALS_SIZE( xPartialSize,
+ * ulEnd - ulBegin, ulGrain ) bytes and suitably aligned for the result type.
+ * Can be NULL if configPARALLEL_FOR_WORKERS is 0, in which case the body is
+ * called once for the whole range.
+ *
+ * @param xPartialSize The size of the result in bytes.
+ *
+ * The other parameters are as for vParallelFor().
+ *
+ * \defgroup vParallelReduce vParallelReduce
+ * \ingroup ParallelFor
+ */
+void vParallelReduce( uint32_t ulBegin, uint32_t ulEnd, uint32_t ulGrain, ParallelReduceFunction_t pxBody, ParallelCombineFunction_t pxCombine, void *pvContext, void *pvResult, void *pvPartials, size_t xPartialSize ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* PARALLEL_FOR_H */
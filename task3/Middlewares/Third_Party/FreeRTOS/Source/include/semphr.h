@@ -778,6 +778,96 @@ typedef QueueHandle_t SemaphoreHandle_t;
 #endif /* configSUPPORT_STATIC_ALLOCATION */
 
 
+/**
+ * semphr. h
+ * <pre>SemaphoreHandle_t xSemaphoreCreateCeilingMutex( UBaseType_t uxCeilingPriority )</pre>
+ *
+ * Creates a new priority ceiling mutex type semaphore instance, and returns a
+ * handle by which the new mutex can be referenced.
+ *
+ * A priority ceiling mutex uses the immediate priority ceiling protocol in
+ * place of priority inheritance.  The task that takes the mutex is raised to
+ * uxCeilingPriority at the moment the mutex is taken, without inspecting the
+ * tasks that are waiting for the mutex, so a task of priority up to
+ * uxCeilingPriority can never preempt the holder and block on the mutex.  That
+ * bounds the time any task can be blocked by the mutex to a single critical
+ * section, and removes the context switches that inheritance causes when the
+ * mutex is contended.  The holder returns to its base priority when the last
+ * mutex it holds is given back, as with xSemaphoreCreateMutex().
+ *
+ * uxCeilingPriority must be at least the priority of the highest priority task
+ * that will ever take the mutex.  Taking the mutex from a task that has a
+ * higher priority than the ceiling will trigger configASSERT().
+ *
+ * Mutexes created using this function can be accessed using the xSemaphoreTake()
+ * and xSemaphoreGive() macros.  The xSemaphoreTakeRecursive() and
+ * xSemaphoreGiveRecursive() macros must not be used.
+ *
+ * Mutex type semaphores cannot be used from within interrupt service routines.
+ *
+ * configUSE_PRIORITY_CEILING_MUTEXES must be set to 1 in FreeRTOSConfig.h for
+ * this macro to be available.
+ *
+ * @param uxCeilingPriority The priority the holder of the mutex runs at while
+ * it holds the mutex.  Must be less than configMAX_PRIORITIES.
+ *
+ * @return If the mutex was successfully created then a handle to the created
+ * mutex is returned.  If there was not enough heap to allocate the mutex data
+ * structures then NULL is returned.
+ *
+ * Example usage:
+ <pre>
+ #define mainUART_MUTEX_CEILING		( tskIDLE_PRIORITY + 3 )
+
+ SemaphoreHandle_t xSemaphore;
+
+ void vATask( void * pvParameters )
+ {
+    // Only tasks of priority mainUART_MUTEX_CEILING or lower use the mutex.
+    xSemaphore = xSemaphoreCreateCeilingMutex( mainUART_MUTEX_CEILING );
+
+    if( xSemaphore != NULL )
+    {
+        // The semaphore was created successfully.
+        // The semaphore can now be used.
+    }
+ }
+ </pre>
+ * \defgroup xSemaphoreCreateCeilingMutex xSemaphoreCreateCeilingMutex
+ * \ingroup Semaphores
+ */
+#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_PRIORITY_CEILING_MUTEXES == 1 ) )
+	#define xSemaphoreCreateCeilingMutex( uxCeilingPriority ) xQueueCreateCeilingMutex( ( uxCeilingPriority ) )
+#endif
+
+/**
+ * semphr. h
+ * <pre>SemaphoreHandle_t xSemaphoreCreateCeilingMutexStatic( UBaseType_t uxCeilingPriority, StaticSemaphore_t *pxMutexBuffer )</pre>
+ *
+ * Creates a new priority ceiling mutex type semaphore instance using memory
+ * provided by the application writer, and returns a handle by which the new
+ * mutex can be referenced.  See xSemaphoreCreateCeilingMutex() for a
+ * description of the priority ceiling protocol, and
+ * xSemaphoreCreateMutexStatic() for a description of static allocation.
+ *
+ * @param uxCeilingPriority The priority the holder of the mutex runs at while
+ * it holds the mutex.  Must be less than configMAX_PRIORITIES.
+ *
+ * @param pxMutexBuffer Must point to a variable of type StaticSemaphore_t,
+ * which will be used to hold the mutex's data structure, removing the need for
+ * the memory to be allocated dynamically.
+ *
+ * @return If the mutex was successfully created then a handle to the created
+ * mutex is returned.  If pxMutexBuffer was NULL then NULL is returned.
+ *
+ * \defgroup xSemaphoreCreateCeilingMutexStatic xSemaphoreCreateCeilingMutexStatic
+ * \ingroup Semaphores
+ */
+#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_PRIORITY_CEILING_MUTEXES == 1 ) )
+	#define xSemaphoreCreateCeilingMutexStatic( uxCeilingPriority, pxMutexBuffer ) xQueueCreateCeilingMutexStatic( ( uxCeilingPriority ), ( pxMutexBuffer ) )
+#endif
+
+
 /**
  * semphr. h
  * <pre>SemaphoreHandle_t xSemaphoreCreateRecursiveMutex( void )</pre>
@@ -0,0 +1,180 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * Static pools reserve, at build time, the RAM for a fixed number of kernel
+ * objects of each type, so a build in which configSUPPORT_DYNAMIC_ALLOCATION
+ * is 0 - and which therefore links no heap - can still create objects whose
+ * number is only known to the code that creates them, such as the objects of
+ * the CMSIS-RTOS2 wrapper:
+ *
+ * + The number of objects of each type, and the stack and queue storage they
+ *   share, are set in FreeRTOSConfig.h by the configSTATIC_POOL_ constants.
+ *   Each pool is a separately named array, so the linker map lists the RAM
+ *   reserved for each object type.
+ *
+ * + Objects are taken from the pools and never returned.  Deleting a task,
+ *   queue, semaphore, event group or timer that was created from a pool does
+ *   not make its storage available again, so size the pools for the largest
+ *   number of objects created over the life of the application.
+ *
+ * + vStaticPoolGetUsage() reports how much of each pool has been taken, so
+ *   the capacities can be trimmed to what the application really needs.
+ *
+ * Set configUSE_STATIC_POOLS to 1 in FreeRTOSConfig.h to use static pools.
+ */
+
+#ifndef STATIC_POOLS_H
+#define STATIC_POOLS_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h must appear in source files before include static_pools.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The pools, used to identify a pool to vStaticPoolGetUsage(). */
+typedef enum
+{
+	eStaticPoolTasks = 0,		/* Task control blocks. */
+	eStaticPoolTaskStacks,		/* Task stacks. */
+	eStaticPoolQueues,			/* Queue control blocks. */
+	eStaticPoolQueueStorage,	/* Queue item storage. */
+	eStaticPoolSemaphores,		/* Semaphores and mutexes. */
+	eStaticPoolEventGroups,		/* Event groups. */
+	eStaticPoolTimers,			/* Software timers. */
+	eStaticPoolCount			/* The number of pools, not a pool. */
+} eStaticPool;
+
+/* The usage of a pool, as reported by vStaticPoolGetUsage(). */
+typedef struct xSTATIC_POOL_USAGE
+{
+	size_t xBytesReserved;		/* The RAM reserved for the pool at build time. */
+	size_t xBytesTaken;			/* The RAM taken from the pool so far. */
+} StaticPoolUsage_t;
+
+/**
+ * static_pools.h
+ * <pre>
+ * BaseType_t xStaticPoolTakeTask( uint32_t ulStackDepth,
+ *                                 StaticTask_t **ppxTaskBuffer,
+ *                                 StackType_t **ppxStackBuffer );
+ * </pre>
+ *
+ * Takes a task control block and ulStackDepth words of stack from the task
+ * pools, to pass to xTaskCreateStatic().  Either both are taken or neither
+ * is.  For example:
+ *
+ * StaticTask_t *pxTaskBuffer;
+ * StackType_t *pxStackBuffer;
+ *
+ * if( xStaticPoolTakeTask( 128, &pxTaskBuffer, &pxStackBuffer ) == pdPASS )
+ * {
+ *     xTaskCreateStatic( vTaskCode, "NAME", 128, NULL, 1, pxStackBuffer, pxTaskBuffer );
+ * }
+ *
+ * @param ulStackDepth The number of words of stack, as passed to
+ * xTaskCreateStatic().
+ *
+ * @param ppxTaskBuffer Set to the task control block.
+ *
+ * @param ppxStackBuffer Set to the stack.
+ *
+ * @return pdPASS if the task pools had room, otherwise pdFAIL.
+ *
+ * \defgroup xStaticPoolTakeTask xStaticPoolTakeTask
+ * \ingroup StaticPools
+ */
+BaseType_t xStaticPoolTakeTask( uint32_t ulStackDepth, StaticTask_t **ppxTaskBuffer, StackType_t **ppxStackBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * static_pools.h
+ * <pre>
+ * StaticQueue_t *pxStaticPoolTakeQueue( size_t xStorageSize,
+ *                                       uint8_t **ppucQueueStorage );
+ * </pre>
+ *
+ * Takes a queue control block and xStorageSize bytes of item storage from
+ * the queue pools, to pass to xQueueCreateStatic().  Either both are taken
+ * or neither is.
+ *
+ * @param xStorageSize The queue length multiplied by the item size.
+ *
+ * @param ppucQueueStorage Set to the item storage, or to NULL if xStorageSize
+ * is 0.
+ *
+ * @return The queue control block, or NULL if the queue pools did not have
+ * room.
+ *
+ * \defgroup pxStaticPoolTakeQueue pxStaticPoolTakeQueue
+ * \ingroup StaticPools
+ */
+StaticQueue_t *pxStaticPoolTakeQueue( size_t xStorageSize, uint8_t **ppucQueueStorage ) PRIVILEGED_FUNCTION;
+
+/**
+ * static_pools.h
+ * <pre>
+ * StaticSemaphore_t *pxStaticPoolTakeSemaphore( void );
+ * StaticEventGroup_t *pxStaticPoolTakeEventGroup( void );
+ * StaticTimer_t *pxStaticPoolTakeTimer( void );
+ * </pre>
+ *
+ * Take the storage for a semaphore or mutex, an event group or a software
+ * timer from its pool, to pass to the matching ...CreateStatic() function.
+ *
+ * @return The storage, or NULL if the pool is empty.
+ *
+ * \defgroup pxStaticPoolTakeSemaphore pxStaticPoolTakeSemaphore
+ * \ingroup StaticPools
+ */
+StaticSemaphore_t *pxStaticPoolTakeSemaphore( void ) PRIVILEGED_FUNCTION;
+StaticEventGroup_t *pxStaticPoolTakeEventGroup( void ) PRIVILEGED_FUNCTION;
+StaticTimer_t *pxStaticPoolTakeTimer( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * static_pools.h
+ * <pre>
+ * void vStaticPoolGetUsage( eStaticPool ePool, StaticPoolUsage_t *pxUsage );
+ * </pre>
+ *
+ * Reports the RAM reserved for a pool and how much of it has been taken.
+ *
+ * @param ePool The pool.
+ *
+ * @param pxUsage Set to the usage of the pool.
+ *
+ * \defgroup vStaticPoolGetUsage vStaticPoolGetUsage
+ * \ingroup StaticPools
+ */
+void vStaticPoolGetUsage( eStaticPool ePool, StaticPoolUsage_t *pxUsage ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* STATIC_POOLS_H */
@@ -0,0 +1,543 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "atomic.h"
+#include "mp_message_buffer.h"
+
+#if( configUSE_TASK_NOTIFICATIONS != 1 )
+	#error configUSE_TASK_NOTIFICATIONS must be set to 1 to build mp_message_buffer.c
+#endif
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* Each message is preceded by a 32-bit header that holds the message's length
+and the flags below.  Headers are always 4 byte aligned. */
+#define mpbHEADER_SIZE					( ( uint32_t ) sizeof( uint32_t ) )
+#define mpbHEADER_COMMITTED				( ( uint32_t ) 0x80000000UL ) /* Set by the writer once the message has been copied in, and so can be read. */
+#define mpbHEADER_PADDING				( ( uint32_t ) 0x40000000UL ) /* Set if the record only pads the remainder of the buffer, so messages are never split across the end of the buffer. */
+#define mpbHEADER_LENGTH_MASK			( ( uint32_t ) 0x3fffffffUL )
+#define mpbALIGNMENT_MASK				( ( uint32_t ) 0x03UL )
+
+/* Bits that can be set in ucFlags. */
+#define mpbFLAGS_IS_STATICALLY_ALLOCATED ( ( uint8_t ) 1 ) /* Set if the buffer was created using statically allocated memory. */
+
+/*lint -save -e9026 Function like macros allowed and needed here. */
+#define mpbRECORD_LENGTH( xDataLengthBytes ) ( mpbHEADER_SIZE + ( ( ( uint32_t ) ( xDataLengthBytes ) + mpbALIGNMENT_MASK ) & ~mpbALIGNMENT_MASK ) )
+/*lint -restore */
+
+/*-----------------------------------------------------------*/
+
+/* Structure that holds state information on the buffer. */
+typedef struct xMP_MESSAGE_BUFFER /*lint !e9058 Style convention uses tag. */
+{
+	volatile uint32_t ulHead;					/* Free running index of the next byte to be reserved by a writer.  Only ever updated by compare and swap. */
+	volatile uint32_t ulTail;					/* Free running index of the next byte to be read.  Only updated by the reader. */
+	uint32_t ulLength;							/* Length of the buffer pointed to by pucBuffer - always a power of two. */
+	volatile uint32_t ulDropped;				/* Number of messages dropped because there was insufficient space. */
+	uint8_t *pucBuffer;							/* Points to the buffer itself.  Bytes not holding messages are always zero. */
+	volatile TaskHandle_t xTaskWaitingToReceive; /* Holds the handle of the reading task if it is blocked. */
+	uint8_t ucFlags;
+} MPMessageBuffer_t;
+
+/*
+ * Called by both xMPMessageBufferCreate() and xMPMessageBufferCreateStatic()
+ * to initialise the members of the newly created buffer.
+ */
+static void prvInitialiseNewMPMessageBuffer( MPMessageBuffer_t * const pxMPMessageBuffer,
+											 uint8_t * const pucBuffer,
+											 size_t xBufferSizeBytes ) PRIVILEGED_FUNCTION;
+
+/*
+ * Atomically reserves space for a message, then copies the message into the
+ * reserved space and marks it as committed.  Returns pdFALSE, having
+ * incremented the dropped count, if there was insufficient space.
+ */
+static BaseType_t prvWriteMessage( MPMessageBuffer_t * const pxMPMessageBuffer,
+								   const void *pvTxData,
+								   size_t xDataLengthBytes ) PRIVILEGED_FUNCTION;
+
+/*
+ * Skips any padding at the tail of the buffer, then returns the header of the
+ * oldest message if that message has been committed, or 0 if there is no
+ * committed message to read.  Only called by the reader.
+ */
+static uint32_t prvGetNextHeader( MPMessageBuffer_t * const pxMPMessageBuffer ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	MPMessageBufferHandle_t xMPMessageBufferCreate( size_t xBufferSizeBytes )
+	{
+	uint8_t *pucAllocatedMemory;
+
+		/* The length must be a power of two so the free running indexes can
+		wrap, and must be able to hold at least one message. */
+		configASSERT( xBufferSizeBytes >= ( 2U * mpbHEADER_SIZE ) );
+		configASSERT( ( xBufferSizeBytes & ( xBufferSizeBytes - 1U ) ) == 0U );
+
+		/* A single allocation holds both the structure and the storage area,
+		the storage area following the structure.  The structure's size is a
+		multiple of 4 so the storage area is correctly aligned. */
+		pucAllocatedMemory = ( uint8_t * ) pvPortMalloc( xBufferSizeBytes + sizeof( MPMessageBuffer_t ) ); /*lint !e9079 malloc() only returns void*. */
+
+		if( pucAllocatedMemory != NULL )
+		{
+			prvInitialiseNewMPMessageBuffer( ( MPMessageBuffer_t * ) pucAllocatedMemory, /*lint !e9087 Safe cast as allocated memory is aligned. */
+											 pucAllocatedMemory + sizeof( MPMessageBuffer_t ), /*lint !e9016 Indexing past structure valid for uint8_t pointer into storage area. */
+											 xBufferSizeBytes );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return ( MPMessageBufferHandle_t ) pucAllocatedMemory; /*lint !e9087 !e826 Safe cast as allocated memory is aligned. */
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	MPMessageBufferHandle_t xMPMessageBufferCreateStatic( size_t xBufferSizeBytes,
+														  uint8_t * const pucMessageBufferStorageArea,
+														  StaticMPMessageBuffer_t * const pxStaticMPMessageBuffer )
+	{
+	MPMessageBuffer_t * const pxMPMessageBuffer = ( MPMessageBuffer_t * ) pxStaticMPMessageBuffer; /*lint !e740 !e9087 Safe cast as StaticMPMessageBuffer_t is opaque MPMessageBuffer_t. */
+	MPMessageBufferHandle_t xReturn;
+
+		configASSERT( pucMessageBufferStorageArea );
+		configASSERT( pxStaticMPMessageBuffer );
+		configASSERT( xBufferSizeBytes >= ( 2U * mpbHEADER_SIZE ) );
+		configASSERT( ( xBufferSizeBytes & ( xBufferSizeBytes - 1U ) ) == 0U );
+		configASSERT( ( ( ( uint32_t ) pucMessageBufferStorageArea ) & mpbALIGNMENT_MASK ) == 0U ); /*lint !e923 Cast to check alignment only. */
+
+		#if( configASSERT_DEFINED == 1 )
+		{
+			/* Sanity check that the size of the structure used to declare a
+			variable of type StaticMPMessageBuffer_t equals the size of the real
+			buffer structure. */
+			volatile size_t xSize = sizeof( StaticMPMessageBuffer_t );
+			configASSERT( xSize == sizeof( MPMessageBuffer_t ) );
+		}
+		#endif /* configASSERT_DEFINED */
+
+		if( ( pucMessageBufferStorageArea != NULL ) && ( pxStaticMPMessageBuffer != NULL ) )
+		{
+			prvInitialiseNewMPMessageBuffer( pxMPMessageBuffer, pucMessageBufferStorageArea, xBufferSizeBytes );
+
+			/* Remember this was statically allocated in case it is ever deleted
+			again. */
+			pxMPMessageBuffer->ucFlags |= mpbFLAGS_IS_STATICALLY_ALLOCATED;
+
+			xReturn = ( MPMessageBufferHandle_t ) pxStaticMPMessageBuffer; /*lint !e9087 Data hiding requires cast to opaque type. */
+		}
+		else
+		{
+			xReturn = NULL;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+void vMPMessageBufferDelete( MPMessageBufferHandle_t xMPMessageBuffer )
+{
+MPMessageBuffer_t * pxMPMessageBuffer = ( MPMessageBuffer_t * ) xMPMessageBuffer; /*lint !e9087 !e9079 Safe cast as MPMessageBufferHandle_t is opaque MPMessageBuffer_t. */
+
+	configASSERT( pxMPMessageBuffer );
+
+	if( ( pxMPMessageBuffer->ucFlags & mpbFLAGS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) pdFALSE )
+	{
+		#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+		{
+			/* Both the structure and the buffer were allocated using a single
+			call to pvPortMalloc(), hence only one call to vPortFree() is
+			required. */
+			vPortFree( ( void * ) pxMPMessageBuffer ); /*lint !e9087 Standard free() semantics require void *. */
+		}
+		#else
+		{
+			/* Should not be possible to get here, ucFlags must be corrupt.
+			Force an assert. */
+			configASSERT( xMPMessageBuffer == ( MPMessageBufferHandle_t ) ~0 );
+		}
+		#endif
+	}
+	else
+	{
+		/* The structure and buffer were not allocated dynamically and cannot be
+		freed - just scrub the structure so future use will assert. */
+		memset( pxMPMessageBuffer, 0x00, sizeof( MPMessageBuffer_t ) );
+	}
+}
+/*-----------------------------------------------------------*/
+
+size_t xMPMessageBufferSend( MPMessageBufferHandle_t xMPMessageBuffer,
+							 const void *pvTxData,
+							 size_t xDataLengthBytes )
+{
+MPMessageBuffer_t * const pxMPMessageBuffer = ( MPMessageBuffer_t * ) xMPMessageBuffer; /*lint !e9087 !e9079 Safe cast as MPMessageBufferHandle_t is opaque MPMessageBuffer_t. */
+TaskHandle_t xTaskToNotify;
+size_t xReturn = 0;
+
+	configASSERT( pxMPMessageBuffer );
+
+	if( prvWriteMessage( pxMPMessageBuffer, pvTxData, xDataLengthBytes ) != pdFALSE )
+	{
+		/* The reader sets xTaskWaitingToReceive before blocking, so the
+		message must be visible before xTaskWaitingToReceive is read. */
+		portMEMORY_BARRIER();
+		xTaskToNotify = pxMPMessageBuffer->xTaskWaitingToReceive;
+
+		if( xTaskToNotify != NULL )
+		{
+			( void ) xTaskNotify( xTaskToNotify, ( uint32_t ) 0, eNoAction );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		xReturn = xDataLengthBytes;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xMPMessageBufferSendFromISR( MPMessageBufferHandle_t xMPMessageBuffer,
+									const void *pvTxData,
+									size_t xDataLengthBytes,
+									BaseType_t * const pxHigherPriorityTaskWoken )
+{
+MPMessageBuffer_t * const pxMPMessageBuffer = ( MPMessageBuffer_t * ) xMPMessageBuffer; /*lint !e9087 !e9079 Safe cast as MPMessageBufferHandle_t is opaque MPMessageBuffer_t. */
+TaskHandle_t xTaskToNotify;
+size_t xReturn = 0;
+
+	configASSERT( pxMPMessageBuffer );
+
+	if( prvWriteMessage( pxMPMessageBuffer, pvTxData, xDataLengthBytes ) != pdFALSE )
+	{
+		portMEMORY_BARRIER();
+		xTaskToNotify = pxMPMessageBuffer->xTaskWaitingToReceive;
+
+		if( xTaskToNotify != NULL )
+		{
+			( void ) xTaskNotifyFromISR( xTaskToNotify, ( uint32_t ) 0, eNoAction, pxHigherPriorityTaskWoken );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		xReturn = xDataLengthBytes;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xMPMessageBufferReceive( MPMessageBufferHandle_t xMPMessageBuffer,
+								void *pvRxData,
+								size_t xBufferLengthBytes,
+								TickType_t xTicksToWait )
+{
+MPMessageBuffer_t * const pxMPMessageBuffer = ( MPMessageBuffer_t * ) xMPMessageBuffer; /*lint !e9087 !e9079 Safe cast as MPMessageBufferHandle_t is opaque MPMessageBuffer_t. */
+TimeOut_t xTimeOut;
+uint32_t ulHeader, ulTail, ulOffset, ulRecordLength;
+size_t xReceivedLength = 0;
+
+	configASSERT( pvRxData );
+	configASSERT( pxMPMessageBuffer );
+
+	vTaskSetTimeOutState( &xTimeOut );
+
+	for( ;; )
+	{
+		/* Checking for a message and recording that the task is about to
+		block must not be interleaved with a writer committing a message and
+		checking for a blocked reader. */
+		taskENTER_CRITICAL();
+		{
+			ulHeader = prvGetNextHeader( pxMPMessageBuffer );
+
+			if( ulHeader == 0UL )
+			{
+				/* Clear notification state as going to wait for data. */
+				( void ) xTaskNotifyStateClear( NULL );
+
+				configASSERT( pxMPMessageBuffer->xTaskWaitingToReceive == NULL );
+				pxMPMessageBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		if( ulHeader != 0UL )
+		{
+			break;
+		}
+		else if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+		{
+			pxMPMessageBuffer->xTaskWaitingToReceive = NULL;
+			break;
+		}
+		else
+		{
+			/* Wait for a writer to commit a message.  The message committed
+			may not be the oldest, in which case the loop waits again. */
+			( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+			pxMPMessageBuffer->xTaskWaitingToReceive = NULL;
+		}
+	}
+
+	if( ulHeader != 0UL )
+	{
+		/* Messages that do not fit in the caller's buffer are left in the
+		buffer. */
+		if( ( size_t ) ( ulHeader & mpbHEADER_LENGTH_MASK ) <= xBufferLengthBytes )
+		{
+			xReceivedLength = ( size_t ) ( ulHeader & mpbHEADER_LENGTH_MASK );
+			ulRecordLength = mpbRECORD_LENGTH( xReceivedLength );
+			ulTail = pxMPMessageBuffer->ulTail;
+			ulOffset = ulTail & ( pxMPMessageBuffer->ulLength - 1UL );
+
+			memcpy( pvRxData, ( const void * ) &( pxMPMessageBuffer->pucBuffer[ ulOffset + mpbHEADER_SIZE ] ), xReceivedLength ); /*lint !e9087 memcpy() requires void *. */
+
+			/* Free space must read as zero so a writer's header is only seen
+			once the writer has committed it. */
+			memset( ( void * ) &( pxMPMessageBuffer->pucBuffer[ ulOffset ] ), 0x00, ( size_t ) ulRecordLength );
+			portMEMORY_BARRIER();
+			pxMPMessageBuffer->ulTail = ulTail + ulRecordLength;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReceivedLength;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xMPMessageBufferIsEmpty( MPMessageBufferHandle_t xMPMessageBuffer )
+{
+const MPMessageBuffer_t * const pxMPMessageBuffer = ( MPMessageBuffer_t * ) xMPMessageBuffer; /*lint !e9087 !e9079 Safe cast as MPMessageBufferHandle_t is opaque MPMessageBuffer_t. */
+BaseType_t xReturn;
+
+	configASSERT( pxMPMessageBuffer );
+
+	if( pxMPMessageBuffer->ulHead == pxMPMessageBuffer->ulTail )
+	{
+		xReturn = pdTRUE;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulMPMessageBufferGetDroppedCount( MPMessageBufferHandle_t xMPMessageBuffer )
+{
+const MPMessageBuffer_t * const pxMPMessageBuffer = ( MPMessageBuffer_t * ) xMPMessageBuffer; /*lint !e9087 !e9079 Safe cast as MPMessageBufferHandle_t is opaque MPMessageBuffer_t. */
+
+	configASSERT( pxMPMessageBuffer );
+
+	return pxMPMessageBuffer->ulDropped;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvWriteMessage( MPMessageBuffer_t * const pxMPMessageBuffer,
+								   const void *pvTxData,
+								   size_t xDataLengthBytes )
+{
+uint32_t ulHead, ulTail, ulOffset, ulPadding, ulRecordLength;
+BaseType_t xReturn = pdTRUE;
+
+	configASSERT( pvTxData );
+	configASSERT( xDataLengthBytes > ( size_t ) 0 );
+	configASSERT( xDataLengthBytes <= ( size_t ) mpbHEADER_LENGTH_MASK );
+
+	ulRecordLength = mpbRECORD_LENGTH( xDataLengthBytes );
+
+	do
+	{
+		/* The tail is read before the head so the tail can never be ahead of
+		the head value used.  A stale tail only under estimates the free
+		space. */
+		ulTail = pxMPMessageBuffer->ulTail;
+		ulHead = pxMPMessageBuffer->ulHead;
+		ulOffset = ulHead & ( pxMPMessageBuffer->ulLength - 1UL );
+
+		/* Messages are not split across the end of the buffer.  If the message
+		does not fit before the end then the remainder of the buffer is
+		reserved too, and the message is placed at the start. */
+		if( ulRecordLength > ( pxMPMessageBuffer->ulLength - ulOffset ) )
+		{
+			ulPadding = pxMPMessageBuffer->ulLength - ulOffset;
+		}
+		else
+		{
+			ulPadding = 0;
+		}
+
+		if( ( ( ulHead - ulTail ) + ulPadding + ulRecordLength ) > pxMPMessageBuffer->ulLength )
+		{
+			( void ) ulAtomicAdd( &( pxMPMessageBuffer->ulDropped ), 1UL );
+			xReturn = pdFALSE;
+			break;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+	} while( ulAtomicCompareAndSwap( &( pxMPMessageBuffer->ulHead ), ulHead + ulPadding + ulRecordLength, ulHead ) != atomicCOMPARE_AND_SWAP_SUCCESS );
+
+	if( xReturn != pdFALSE )
+	{
+		if( ulPadding != 0UL )
+		{
+			/* Offsets and lengths are multiples of 4 so there is always room
+			for the padding header. */
+			*( ( volatile uint32_t * ) &( pxMPMessageBuffer->pucBuffer[ ulOffset ] ) ) = mpbHEADER_COMMITTED | mpbHEADER_PADDING; /*lint !e9087 !e826 Storage area is 4 byte aligned. */
+			ulOffset = 0;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		memcpy( ( void * ) &( pxMPMessageBuffer->pucBuffer[ ulOffset + mpbHEADER_SIZE ] ), pvTxData, xDataLengthBytes ); /*lint !e9087 memcpy() requires void *. */
+
+		/* The message must be complete before the reader can see the header
+		marked as committed. */
+		portMEMORY_BARRIER();
+		*( ( volatile uint32_t * ) &( pxMPMessageBuffer->pucBuffer[ ulOffset ] ) ) = mpbHEADER_COMMITTED | ( uint32_t ) xDataLengthBytes; /*lint !e9087 !e826 Storage area is 4 byte aligned. */
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvGetNextHeader( MPMessageBuffer_t * const pxMPMessageBuffer )
+{
+uint32_t ulHeader = 0, ulTail, ulOffset;
+
+	for( ;; )
+	{
+		ulTail = pxMPMessageBuffer->ulTail;
+
+		if( ulTail == pxMPMessageBuffer->ulHead )
+		{
+			/* Empty. */
+			ulHeader = 0;
+			break;
+		}
+
+		ulOffset = ulTail & ( pxMPMessageBuffer->ulLength - 1UL );
+		ulHeader = *( ( volatile uint32_t * ) &( pxMPMessageBuffer->pucBuffer[ ulOffset ] ) ); /*lint !e9087 !e826 Storage area is 4 byte aligned. */
+
+		if( ( ulHeader & mpbHEADER_COMMITTED ) == 0UL )
+		{
+			/* The oldest message is still being written. */
+			ulHeader = 0;
+			break;
+		}
+
+		/* The message must not be read before its header. */
+		portMEMORY_BARRIER();
+
+		if( ( ulHeader & mpbHEADER_PADDING ) != 0UL )
+		{
+			/* Skip to the start of the buffer, leaving the free space zeroed. */
+			*( ( volatile uint32_t * ) &( pxMPMessageBuffer->pucBuffer[ ulOffset ] ) ) = 0UL; /*lint !e9087 !e826 Storage area is 4 byte aligned. */
+			portMEMORY_BARRIER();
+			pxMPMessageBuffer->ulTail = ulTail + ( pxMPMessageBuffer->ulLength - ulOffset );
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	return ulHeader;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewMPMessageBuffer( MPMessageBuffer_t * const pxMPMessageBuffer,
+											 uint8_t * const pucBuffer,
+											 size_t xBufferSizeBytes )
+{
+	/* The reader relies on free space reading as zero. */
+	memset( ( void * ) pucBuffer, 0x00, xBufferSizeBytes );
+	memset( ( void * ) pxMPMessageBuffer, 0x00, sizeof( MPMessageBuffer_t ) ); /*lint !e9087 memset() requires void *. */
+	pxMPMessageBuffer->pucBuffer = pucBuffer;
+	pxMPMessageBuffer->ulLength = ( uint32_t ) xBufferSizeBytes;
+}
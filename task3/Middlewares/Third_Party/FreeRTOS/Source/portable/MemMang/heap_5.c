@@ -79,9 +79,11 @@ task.h is included from an application file. */
 
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
-#if( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
-	#error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
-#endif
+/* This entire source file will be skipped if the application is not configured
+to include dynamic memory allocation, so the heap is not linked into a build
+in which every kernel object is statically allocated.  This #if is closed at
+the very bottom of this file. */
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
 
 /* Block sizes must not get too small. */
 #define heapMINIMUM_BLOCK_SIZE	( ( size_t ) ( xHeapStructSize << 1 ) )
@@ -483,3 +485,4 @@ const HeapRegion_t *pxHeapRegion;
 	xBlockAllocatedBit = ( ( size_t ) 1 ) << ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) - 1 );
 }
 
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
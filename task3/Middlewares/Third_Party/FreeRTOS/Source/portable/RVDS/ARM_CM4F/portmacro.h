@@ -106,8 +106,18 @@ extern void vPortExitCritical( void );
 #define portENABLE_INTERRUPTS()					vPortSetBASEPRI( 0 )
 #define portENTER_CRITICAL()					vPortEnterCritical()
 #define portEXIT_CRITICAL()						vPortExitCritical()
-#define portSET_INTERRUPT_MASK_FROM_ISR()		ulPortRaiseBASEPRI()
-#define portCLEAR_INTERRUPT_MASK_FROM_ISR(x)	vPortSetBASEPRI(x)
+
+#if( configUSE_CRITICAL_SECTION_PROFILER == 1 )
+	/* Out of line, so the profiler can find the call site from the return
+	address. */
+	extern uint32_t ulPortSetInterruptMaskFromISR( void );
+	extern void vPortClearInterruptMaskFromISR( uint32_t ulNewMaskValue );
+	#define portSET_INTERRUPT_MASK_FROM_ISR()		ulPortSetInterruptMaskFromISR()
+	#define portCLEAR_INTERRUPT_MASK_FROM_ISR(x)	vPortClearInterruptMaskFromISR(x)
+#else
+	#define portSET_INTERRUPT_MASK_FROM_ISR()		ulPortRaiseBASEPRI()
+	#define portCLEAR_INTERRUPT_MASK_FROM_ISR(x)	vPortSetBASEPRI(x)
+#endif
 
 /*-----------------------------------------------------------*/
 
@@ -118,6 +128,62 @@ extern void vPortExitCritical( void );
 #endif
 /*-----------------------------------------------------------*/
 
+/* Stack overflow detection using the MPU.  When configUSE_MPU_STACK_GUARD is
+1 one MPU region is a 32 byte no access region that the kernel moves to the end
+of the stack of the task that is about to run, so writing past the end of the
+stack generates a MemManage fault instead of corrupting memory.  Moving the
+region is a single write to the MPU RBAR register, the VALID bit selecting the
+region.  The end of each stack is rounded up to the 32 byte alignment the MPU
+requires, so up to 63 bytes of each stack are not usable. */
+#if( configUSE_MPU_STACK_GUARD == 1 )
+
+	#ifndef configMPU_STACK_GUARD_REGION
+		#define configMPU_STACK_GUARD_REGION	7UL
+	#endif
+
+	#define portMPU_REGION_BASE_ADDRESS_REG		( * ( ( volatile uint32_t * ) 0xe000ed9c ) )
+	#define portMPU_REGION_VALID				( 0x10UL )
+	#define portSTACK_GUARD_SIZE				( 32UL )
+
+	#define portSETUP_STACK_GUARD( pxStack )	portMPU_REGION_BASE_ADDRESS_REG = ( ( ( uint32_t ) ( pxStack ) + ( portSTACK_GUARD_SIZE - 1UL ) ) & ~( portSTACK_GUARD_SIZE - 1UL ) ) | portMPU_REGION_VALID | ( uint32_t ) configMPU_STACK_GUARD_REGION
+
+	/* The first stack byte above the guard.  The guard bytes cannot be read
+	while the task runs, so the kernel's stack scans start here and the high
+	water mark does not include them. */
+	#define portSTACK_GUARD_END( pxStack )		( ( uint8_t * ) ( ( ( ( uint32_t ) ( pxStack ) + ( portSTACK_GUARD_SIZE - 1UL ) ) & ~( portSTACK_GUARD_SIZE - 1UL ) ) + portSTACK_GUARD_SIZE ) )
+
+#endif /* configUSE_MPU_STACK_GUARD */
+/*-----------------------------------------------------------*/
+
+/* Critical section profiler support (see critical_profiler.h).  Critical
+sections are timed with the DWT cycle counter, which xPortStartScheduler()
+enables.  A watched interrupt is pending if its bit is set in the NVIC ISPR
+registers. */
+#if( configUSE_CRITICAL_SECTION_PROFILER == 1 )
+
+	#define portCRITICAL_PROFILER_GET_CYCLES()	( * ( ( volatile uint32_t * ) 0xe0001004 ) )
+	#define portCRITICAL_PROFILER_IRQ_PENDING( lIRQNumber ) ( ( ( ( volatile uint32_t * ) 0xe000e200 )[ ( uint32_t ) ( lIRQNumber ) >> 5UL ] & ( 1UL << ( ( uint32_t ) ( lIRQNumber ) & 0x1fUL ) ) ) != 0UL )
+
+#endif /* configUSE_CRITICAL_SECTION_PROFILER */
+/*-----------------------------------------------------------*/
+
+/* Timestamp support (see ullTaskGetTimestamp()).  The timestamp clock is the
+SysTick clock, which is the core clock unless configSYSTICK_CLOCK_HZ is
+defined. */
+#if( configUSE_TIMESTAMP == 1 )
+
+	extern uint32_t ulPortGetTickElapsedCounts( void );
+	#define portGET_TICK_ELAPSED_COUNTS()	ulPortGetTickElapsedCounts()
+
+	#ifdef configSYSTICK_CLOCK_HZ
+		#define portTIMESTAMP_CLOCK_HZ		configSYSTICK_CLOCK_HZ
+	#else
+		#define portTIMESTAMP_CLOCK_HZ		configCPU_CLOCK_HZ
+	#endif
+
+#endif /* configUSE_TIMESTAMP */
+/*-----------------------------------------------------------*/
+
 /* Port specific optimisations. */
 #ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
 	#define configUSE_PORT_OPTIMISED_TASK_SELECTION 1
@@ -220,6 +286,37 @@ uint32_t ulReturn, ulNewBASEPRI = configMAX_SYSCALL_INTERRUPT_PRIORITY;
 }
 /*-----------------------------------------------------------*/
 
+static portFORCE_INLINE uint32_t ulPortCompareAndSwap( volatile uint32_t *pulDestination, uint32_t ulExchange, uint32_t ulComparand )
+{
+uint32_t ulReturn = 1UL;
+
+	for( ;; )
+	{
+		if( __ldrex( pulDestination ) != ulComparand )
+		{
+			/* Release the exclusive monitor as no store will be made. */
+			__clrex();
+			ulReturn = 0UL;
+			break;
+		}
+
+		/* The store-exclusive fails if anything, including an interrupt,
+		accessed the location since the load-exclusive, in which case the
+		comparison is made again. */
+		if( __strex( ulExchange, pulDestination ) == 0UL )
+		{
+			break;
+		}
+	}
+
+	return ulReturn;
+}
+
+/* Used by atomic.h in place of short critical sections. */
+#define portATOMIC_COMPARE_AND_SWAP_U32( pulDestination, ulExchange, ulComparand ) ulPortCompareAndSwap( ( pulDestination ), ( ulExchange ), ( ulComparand ) )
+#define portMEMORY_BARRIER() __dmb( portSY_FULL_READ_WRITE )
+/*-----------------------------------------------------------*/
+
 static portFORCE_INLINE BaseType_t xPortIsInsideInterrupt( void )
 {
 uint32_t ulCurrentInterrupt;
@@ -0,0 +1,321 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "static_pools.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* This entire source file will be skipped if the application is not configured
+to include static pools.  This #if is closed at the very bottom of this file.
+If you want to include static pools then ensure configUSE_STATIC_POOLS is set
+to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_STATIC_POOLS == 1 )
+
+/* The storage of a pool, and its size in bytes. */
+typedef struct xSTATIC_POOL_REGION
+{
+	uint8_t *pucStorage;
+	size_t xSize;
+} StaticPoolRegion_t;
+
+/*
+ * The pools.  A pool with a capacity of 0 has no storage.  Each pool is a
+ * separate array, with its own name in the linker map, so the map shows the
+ * RAM reserved for each object type.
+ */
+#if( configSTATIC_POOL_TASKS > 0 )
+	PRIVILEGED_DATA static StaticTask_t xStaticPoolTasks[ configSTATIC_POOL_TASKS ];
+	#define staticpoolsTASKS_REGION { ( uint8_t * ) xStaticPoolTasks, sizeof( xStaticPoolTasks ) }
+
+	PRIVILEGED_DATA static StackType_t xStaticPoolTaskStacks[ configSTATIC_POOL_TASK_STACK_WORDS ];
+	#define staticpoolsTASK_STACKS_REGION { ( uint8_t * ) xStaticPoolTaskStacks, sizeof( xStaticPoolTaskStacks ) }
+#else
+	#define staticpoolsTASKS_REGION { NULL, 0 }
+	#define staticpoolsTASK_STACKS_REGION { NULL, 0 }
+#endif
+
+#if( configSTATIC_POOL_QUEUES > 0 )
+	PRIVILEGED_DATA static StaticQueue_t xStaticPoolQueues[ configSTATIC_POOL_QUEUES ];
+	#define staticpoolsQUEUES_REGION { ( uint8_t * ) xStaticPoolQueues, sizeof( xStaticPoolQueues ) }
+#else
+	#define staticpoolsQUEUES_REGION { NULL, 0 }
+#endif
+
+#if( ( configSTATIC_POOL_QUEUES > 0 ) && ( configSTATIC_POOL_QUEUE_STORAGE_SIZE > 0 ) )
+	/* Declared as an array of the most strictly aligned type a queue item is
+	likely to be, so the storage of each queue starts suitably aligned. */
+	PRIVILEGED_DATA static uint64_t ullStaticPoolQueueStorage[ ( configSTATIC_POOL_QUEUE_STORAGE_SIZE + sizeof( uint64_t ) - 1 ) / sizeof( uint64_t ) ];
+	#define staticpoolsQUEUE_STORAGE_REGION { ( uint8_t * ) ullStaticPoolQueueStorage, sizeof( ullStaticPoolQueueStorage ) }
+#else
+	#define staticpoolsQUEUE_STORAGE_REGION { NULL, 0 }
+#endif
+
+#if( configSTATIC_POOL_SEMAPHORES > 0 )
+	PRIVILEGED_DATA static StaticSemaphore_t xStaticPoolSemaphores[ configSTATIC_POOL_SEMAPHORES ];
+	#define staticpoolsSEMAPHORES_REGION { ( uint8_t * ) xStaticPoolSemaphores, sizeof( xStaticPoolSemaphores ) }
+#else
+	#define staticpoolsSEMAPHORES_REGION { NULL, 0 }
+#endif
+
+#if( configSTATIC_POOL_EVENT_GROUPS > 0 )
+	PRIVILEGED_DATA static StaticEventGroup_t xStaticPoolEventGroups[ configSTATIC_POOL_EVENT_GROUPS ];
+	#define staticpoolsEVENT_GROUPS_REGION { ( uint8_t * ) xStaticPoolEventGroups, sizeof( xStaticPoolEventGroups ) }
+#else
+	#define staticpoolsEVENT_GROUPS_REGION { NULL, 0 }
+#endif
+
+#if( configSTATIC_POOL_TIMERS > 0 )
+	PRIVILEGED_DATA static StaticTimer_t xStaticPoolTimers[ configSTATIC_POOL_TIMERS ];
+	#define staticpoolsTIMERS_REGION { ( uint8_t * ) xStaticPoolTimers, sizeof( xStaticPoolTimers ) }
+#else
+	#define staticpoolsTIMERS_REGION { NULL, 0 }
+#endif
+
+/* The pools, in eStaticPool order. */
+static const StaticPoolRegion_t xStaticPoolRegions[ eStaticPoolCount ] =
+{
+	staticpoolsTASKS_REGION,
+	staticpoolsTASK_STACKS_REGION,
+	staticpoolsQUEUES_REGION,
+	staticpoolsQUEUE_STORAGE_REGION,
+	staticpoolsSEMAPHORES_REGION,
+	staticpoolsEVENT_GROUPS_REGION,
+	staticpoolsTIMERS_REGION
+};
+
+/* The number of bytes taken from each pool.  Only ever increases. */
+PRIVILEGED_DATA static size_t xStaticPoolTaken[ eStaticPoolCount ] = { 0 };
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Returns pdTRUE if xSize more bytes can be taken from the pool.  Called from
+ * a critical section.
+ */
+static BaseType_t prvPoolHasRoom( eStaticPool ePool, size_t xSize ) PRIVILEGED_FUNCTION;
+
+/*
+ * Takes xSize bytes from the pool, which must have room for them.  Called
+ * from a critical section.
+ */
+static void *prvPoolTake( eStaticPool ePool, size_t xSize ) PRIVILEGED_FUNCTION;
+
+/*
+ * Takes one object of xSize bytes from the pool, or returns NULL if the pool
+ * is empty.
+ */
+static void *prvPoolTakeObject( eStaticPool ePool, size_t xSize ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvPoolHasRoom( eStaticPool ePool, size_t xSize )
+{
+BaseType_t xReturn;
+
+	/* Written so it cannot overflow, as xSize comes from the caller. */
+	if( xSize <= ( xStaticPoolRegions[ ePool ].xSize - xStaticPoolTaken[ ePool ] ) )
+	{
+		xReturn = pdTRUE;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void *prvPoolTake( eStaticPool ePool, size_t xSize )
+{
+void *pvReturn;
+
+	pvReturn = ( void * ) &( xStaticPoolRegions[ ePool ].pucStorage[ xStaticPoolTaken[ ePool ] ] );
+	xStaticPoolTaken[ ePool ] += xSize;
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void *prvPoolTakeObject( eStaticPool ePool, size_t xSize )
+{
+void *pvReturn = NULL;
+
+	taskENTER_CRITICAL();
+	{
+		if( prvPoolHasRoom( ePool, xSize ) != pdFALSE )
+		{
+			pvReturn = prvPoolTake( ePool, xSize );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStaticPoolTakeTask( uint32_t ulStackDepth, StaticTask_t **ppxTaskBuffer, StackType_t **ppxStackBuffer )
+{
+BaseType_t xReturn = pdFAIL;
+size_t xStackSize;
+
+	configASSERT( ppxTaskBuffer );
+	configASSERT( ppxStackBuffer );
+
+	/* Checked in words first, so the size in bytes cannot overflow. */
+	if( ulStackDepth <= ( xStaticPoolRegions[ eStaticPoolTaskStacks ].xSize / sizeof( StackType_t ) ) )
+	{
+		xStackSize = ( size_t ) ulStackDepth * sizeof( StackType_t );
+
+		taskENTER_CRITICAL();
+		{
+			if( ( prvPoolHasRoom( eStaticPoolTasks, sizeof( StaticTask_t ) ) != pdFALSE ) &&
+				( prvPoolHasRoom( eStaticPoolTaskStacks, xStackSize ) != pdFALSE ) )
+			{
+				*ppxTaskBuffer = ( StaticTask_t * ) prvPoolTake( eStaticPoolTasks, sizeof( StaticTask_t ) );
+				*ppxStackBuffer = ( StackType_t * ) prvPoolTake( eStaticPoolTaskStacks, xStackSize ); /*lint !e9079 !e9087 The pool is an array of StackType_t. */
+				xReturn = pdPASS;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+StaticQueue_t *pxStaticPoolTakeQueue( size_t xStorageSize, uint8_t **ppucQueueStorage )
+{
+StaticQueue_t *pxReturn = NULL;
+size_t xAlignedSize = xStorageSize;
+
+	configASSERT( ppucQueueStorage );
+
+	/* Keep the storage of the next queue aligned. */
+	if( ( xAlignedSize & portBYTE_ALIGNMENT_MASK ) != 0 )
+	{
+		xAlignedSize += ( portBYTE_ALIGNMENT - ( xAlignedSize & portBYTE_ALIGNMENT_MASK ) );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* Rounding up can only wrap for a size that could never fit. */
+	if( xAlignedSize >= xStorageSize )
+	{
+		taskENTER_CRITICAL();
+		{
+			if( ( prvPoolHasRoom( eStaticPoolQueues, sizeof( StaticQueue_t ) ) != pdFALSE ) &&
+				( prvPoolHasRoom( eStaticPoolQueueStorage, xAlignedSize ) != pdFALSE ) )
+			{
+				pxReturn = ( StaticQueue_t * ) prvPoolTake( eStaticPoolQueues, sizeof( StaticQueue_t ) );
+
+				/* xQueueCreateStatic() requires NULL storage for a queue with
+				no item storage, such as a queue used as a semaphore. */
+				if( xStorageSize > 0 )
+				{
+					*ppucQueueStorage = ( uint8_t * ) prvPoolTake( eStaticPoolQueueStorage, xAlignedSize );
+				}
+				else
+				{
+					*ppucQueueStorage = NULL;
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pxReturn;
+}
+/*-----------------------------------------------------------*/
+
+StaticSemaphore_t *pxStaticPoolTakeSemaphore( void )
+{
+	return ( StaticSemaphore_t * ) prvPoolTakeObject( eStaticPoolSemaphores, sizeof( StaticSemaphore_t ) );
+}
+/*-----------------------------------------------------------*/
+
+StaticEventGroup_t *pxStaticPoolTakeEventGroup( void )
+{
+	return ( StaticEventGroup_t * ) prvPoolTakeObject( eStaticPoolEventGroups, sizeof( StaticEventGroup_t ) );
+}
+/*-----------------------------------------------------------*/
+
+StaticTimer_t *pxStaticPoolTakeTimer( void )
+{
+	return ( StaticTimer_t * ) prvPoolTakeObject( eStaticPoolTimers, sizeof( StaticTimer_t ) );
+}
+/*-----------------------------------------------------------*/
+
+void vStaticPoolGetUsage( eStaticPool ePool, StaticPoolUsage_t *pxUsage )
+{
+	configASSERT( ePool < eStaticPoolCount );
+	configASSERT( pxUsage );
+
+	pxUsage->xBytesReserved = xStaticPoolRegions[ ePool ].xSize;
+
+	/* A single aligned word, so read without a critical section. */
+	pxUsage->xBytesTaken = xStaticPoolTaken[ ePool ];
+}
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+to include static pools.  If you want to include static pools then ensure
+configUSE_STATIC_POOLS is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_STATIC_POOLS == 1 */